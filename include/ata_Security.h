@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "logs.h"
 #include "operations_Common.h"
 
 #if defined(__cplusplus)
@@ -118,6 +119,8 @@ extern "C"
     //
     //  Entry:
     //!   \param[in] device = file descriptor
+    //!   \param[in,out] directories = ATA log directories already read from this device, used for the security page
+    //!   of the identify device data log. M_NULLPTR reads them for this call only.
     //!   \param[out] securityStatus = pointer to the structure to fill in with security information
     //!   \param[in] useSAT = set to true to attempt commands using the SAT spec security protocol for ATA security.
     //!   This is recommended for non-ata interfaces if the SATL supports it since it allows the SATL to control the
@@ -126,11 +129,15 @@ extern "C"
     //  Exit:
     //
     //-----------------------------------------------------------------------------
-    M_NONNULL_PARAM_LIST(1, 2)
+    M_NONNULL_PARAM_LIST(1, 3)
     M_PARAM_RO(1)
-    M_PARAM_WO(2)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
     OPENSEA_OPERATIONS_API
-    void get_ATA_Security_Info(tDevice* device, ptrATASecurityStatus securityStatus, bool useSAT);
+    void get_ATA_Security_Info(tDevice*             device,
+                               ptrATALogDirectories directories,
+                               ptrATASecurityStatus securityStatus,
+                               bool                 useSAT);
 
     M_NONNULL_PARAM_LIST(1)
     M_PARAM_RO(1)
@@ -41,19 +41,140 @@ extern "C"
         uint32_t totalBufferMiscompares; // how many times did the buffer miscompare.
     } patternTestResults, *ptrPatternTestResults;
 
+#define BUFFER_MISCOMPARE_BYTE_LANES      4 // byte position within a dword, which is how data moves across SATA/SAS
+#define BUFFER_MISCOMPARE_BIT_POSITIONS   (BUFFER_MISCOMPARE_BYTE_LANES * 8)
+#define BUFFER_MISCOMPARE_MAX_SHIFT_BYTES 16 // how far to look for shifted or dropped data
+
+    // Most likely failure mode of a miscompare. This is a hint for where to look, not a definitive diagnosis.
+    typedef enum eBufferMiscompareTypeEnum
+    {
+        BUFFER_MISCOMPARE_NONE,
+        BUFFER_MISCOMPARE_RANDOM_BIT_ERRORS, // a few scattered bit flips. Typical of a marginal cable or connector
+        BUFFER_MISCOMPARE_BYTE_LANE,         // all errors in one byte lane. Suspect an HBA/expander lane or bridge
+        BUFFER_MISCOMPARE_STUCK_BITS,        // same bit(s) always read as 1 or 0. Suspect drive DRAM or a data path
+        BUFFER_MISCOMPARE_SHIFTED_DATA,      // correct data at the wrong offset. Suspect HBA/driver DMA handling
+        BUFFER_MISCOMPARE_DROPPED_DWORDS,    // data after some point moved up by whole dwords. Suspect lost frames
+        BUFFER_MISCOMPARE_BULK_CORRUPTION,   // most of the differing data is wrong. Suspect drive buffer or firmware
+        BUFFER_MISCOMPARE_TYPE_COUNT         // must be last
+    } eBufferMiscompareType;
+
+    typedef struct s_bufferMiscompareAnalysis
+    {
+        eBufferMiscompareType type;
+        uint32_t              bytesCompared;
+        uint32_t              differingBytes;
+        uint32_t              firstDifferingOffset;
+        uint32_t              lastDifferingOffset;
+        uint32_t              flippedBits;
+        uint32_t              bitsSetWhenExpectedClear; // 0 written, 1 read back
+        uint32_t              bitsClearWhenExpectedSet; // 1 written, 0 read back
+        uint32_t              bitPositionHistogram[BUFFER_MISCOMPARE_BIT_POSITIONS]; // lane * 8 + bit number
+        uint32_t              byteLaneHistogram[BUFFER_MISCOMPARE_BYTE_LANES];       // differing bytes per lane
+        uint32_t              stuckHighMask; // bit positions (lane * 8 + bit) read as 1 in every dword
+        uint32_t              stuckLowMask;  // bit positions (lane * 8 + bit) read as 0 in every dword
+        int32_t               shiftBytes;    // SHIFTED_DATA: received[n] == expected[n + shiftBytes]
+        uint32_t              droppedDwords; // DROPPED_DWORDS: number of dwords missing at firstDifferingOffset
+    } bufferMiscompareAnalysis, *ptrBufferMiscompareAnalysis;
+
+    // Running totals for all the miscompares seen during a test
+    typedef struct s_bufferMiscompareSummary
+    {
+        uint32_t miscompareTypeCount[BUFFER_MISCOMPARE_TYPE_COUNT];
+        uint64_t differingBytes;
+        uint64_t flippedBits;
+        uint64_t bitsSetWhenExpectedClear;
+        uint64_t bitsClearWhenExpectedSet;
+        uint32_t bitPositionHistogram[BUFFER_MISCOMPARE_BIT_POSITIONS];
+        uint32_t byteLaneHistogram[BUFFER_MISCOMPARE_BYTE_LANES];
+        uint32_t stuckHighMask; // bits that were stuck in at least one miscompare
+        uint32_t stuckLowMask;
+    } bufferMiscompareSummary, *ptrBufferMiscompareSummary;
+
     typedef struct s_cableTestResults
     {
-        uint64_t           totalTestTimeNS;
-        patternTestResults zerosTest[ALL_0_TEST_COUNT];        // all zeros tested
-        patternTestResults fTest[ALL_F_TEST_COUNT];            // all F's tested
-        patternTestResults fivesTest[ALL_5_TEST_COUNT];        // all 5's tested
-        patternTestResults aTest[ALL_A_TEST_COUNT];            // all A's tested
-        patternTestResults zeroF5ATest[ZERO_F_5_A_TEST_COUNT]; // pattern of 00FF55AA tested
-        patternTestResults walking1sTest[WALKING_1_TEST_COUNT];
-        patternTestResults walking0sTest[WALKING_0_TEST_COUNT];
-        patternTestResults randomTest[RANDOM_TEST_COUNT];
+        uint64_t                totalTestTimeNS;
+        patternTestResults      zerosTest[ALL_0_TEST_COUNT];        // all zeros tested
+        patternTestResults      fTest[ALL_F_TEST_COUNT];            // all F's tested
+        patternTestResults      fivesTest[ALL_5_TEST_COUNT];        // all 5's tested
+        patternTestResults      aTest[ALL_A_TEST_COUNT];            // all A's tested
+        patternTestResults      zeroF5ATest[ZERO_F_5_A_TEST_COUNT]; // pattern of 00FF55AA tested
+        patternTestResults      walking1sTest[WALKING_1_TEST_COUNT];
+        patternTestResults      walking0sTest[WALKING_0_TEST_COUNT];
+        patternTestResults      randomTest[RANDOM_TEST_COUNT];
+        bufferMiscompareSummary miscompareSummary; // all patterns combined
     } cableTestResults, *ptrCableTestResults;
 
+#define CABLE_STRESS_TEST_DEFAULT_SECONDS UINT32_C(300) // 5 minutes
+#define CABLE_STRESS_TEST_MAX_SECONDS     UINT32_C(86400)
+
+    // Order that the stress test rotates through the patterns. One write/read/compare pass is done per pattern before
+    // moving on to the next one so that every pattern gets roughly the same amount of bus time.
+    typedef enum eCableStressPatternEnum
+    {
+        CABLE_STRESS_PATTERN_ALL_0,
+        CABLE_STRESS_PATTERN_ALL_F,
+        CABLE_STRESS_PATTERN_ALL_5,
+        CABLE_STRESS_PATTERN_ALL_A,
+        CABLE_STRESS_PATTERN_00FF55AA,
+        CABLE_STRESS_PATTERN_WALKING_1,
+        CABLE_STRESS_PATTERN_WALKING_0,
+        CABLE_STRESS_PATTERN_RANDOM,
+        CABLE_STRESS_PATTERN_COUNT // must be last
+    } eCableStressPattern;
+
+    typedef struct s_cableStressTestResults
+    {
+        uint32_t                requestedTestSeconds;
+        uint32_t                bufferSize; // bytes moved in each read or write buffer command
+        uint64_t                totalTestTimeNS;
+        uint64_t                totalCommandTimeNS; // time spent in read/write buffer commands only
+        uint64_t                totalBytesTransferred; // successful commands + commands with a CRC error
+        uint64_t                totalBitsCompared;
+        uint64_t                totalBitErrors; // flipped bits found in miscompares + 1 for each command CRC error
+        patternTestResults      patternResults[CABLE_STRESS_PATTERN_COUNT];
+        double                  throughputMBPerSecond;  // bytes transferred / command time, in 10^6 bytes per second
+        double                  estimatedBitErrorRate;  // totalBitErrors / bits transferred
+        double                  bitErrorRateLowerBound; // 95% confidence lower bound
+        double                  bitErrorRateUpperBound; // 95% confidence upper bound. Non-zero even with no errors.
+        bufferMiscompareSummary miscompareSummary;
+        // SATA only. Phy event counters are read at the start, after each command CRC error, and at the end
+        bool     phyEventCountersValid;
+        uint64_t phyCRCEventsDelta;  // ICRC and H2D/D2H FIS CRC related counters
+        uint64_t phyRErrEventsDelta; // R_ERR responses that were not counted as CRC
+        uint64_t phyReadyTransitionsDelta;
+        uint64_t phyCOMRESETDelta;
+        uint32_t crcErrorsWithPhyEvent;    // command CRC errors where a CRC or R_ERR phy counter also incremented
+        uint32_t crcErrorsWithoutPhyEvent; // command CRC errors with no phy counter change (host side or bridge)
+    } cableStressTestResults, *ptrCableStressTestResults;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  analyze_Buffer_Miscompare(const uint8_t* expected, const uint8_t* received, uint32_t bufferSize,
+    //                            ptrBufferMiscompareAnalysis analysis)
+    //
+    //! \brief   Description: Find every differing byte between what was written and what was read back, build
+    //! histograms of the flipped bit positions and byte lanes, and classify the most likely failure mode (random bit
+    //! errors, a bad byte lane, stuck bits, shifted data, dropped dwords or bulk corruption).
+    //
+    //  Entry:
+    //!   \param[in] expected = buffer that was written to the device
+    //!   \param[in] received = buffer that was read back from the device
+    //!   \param[in] bufferSize = size of both buffers in bytes
+    //!   \param[out] analysis = filled in with the results. type is BUFFER_MISCOMPARE_NONE if the buffers match
+    //!
+    //  Exit:
+    //!   \return SUCCESS = analysis completed, BAD_PARAMETER = invalid pointer
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2, 4)
+    M_PARAM_RO_SIZE(1, 3)
+    M_PARAM_RO_SIZE(2, 3)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API eReturnValues analyze_Buffer_Miscompare(const uint8_t*              expected,
+                                                                   const uint8_t*              received,
+                                                                   uint32_t                    bufferSize,
+                                                                   ptrBufferMiscompareAnalysis analysis);
+
     //-----------------------------------------------------------------------------
     //
     //  perform_Cable_Test(tDevice *device, ptrCableTestResults testResults)
@@ -86,6 +207,47 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_Cable_Test_Results(cableTestResults testResults);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  perform_Cable_Stress_Test(tDevice* device, uint32_t testSeconds, ptrCableStressTestResults testResults)
+    //
+    //! \brief   Description: Stress the bus by streaming write buffer/read buffer commands back to back at the full
+    //! buffer size for a fixed amount of time. Rotates through the same byte, walking and random patterns as
+    //! perform_Cable_Test, then computes throughput and an estimated bit error rate with 95% confidence bounds.
+    //! On SATA, command CRC errors are correlated with SATA phy event counter changes.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] testSeconds = how long to stream data. 0 uses CABLE_STRESS_TEST_DEFAULT_SECONDS
+    //!   \param[out] testResults = pointer to structure that holds results
+    //!
+    //  Exit:
+    //!   \return SUCCESS = test completed (check results for errors), NOT_SUPPORTED = buffer commands not
+    //!   available, BAD_PARAMETER = invalid time or results pointer, other = failure
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO(1)
+    M_PARAM_WO(3)
+    OPENSEA_OPERATIONS_API eReturnValues perform_Cable_Stress_Test(tDevice*                  device,
+                                                                   uint32_t                  testSeconds,
+                                                                   ptrCableStressTestResults testResults);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Cable_Stress_Test_Results(ptrCableStressTestResults testResults)
+    //
+    //! \brief   Description: Print the results from a cable/buffer stress test.
+    //
+    //  Entry:
+    //!   \param[in] testResults = pointer to results from perform_Cable_Stress_Test
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1) OPENSEA_OPERATIONS_API void print_Cable_Stress_Test_Results(ptrCableStressTestResults testResults);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file config_profile.h
+// \brief This file defines the functions for applying a set of device settings as a single profile.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+#include "cdl.h"
+#include "operations_Common.h"
+#include "power_control.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    typedef enum eConfigProfileSettingEnum
+    {
+        CONFIG_PROFILE_WRITE_CACHE,
+        CONFIG_PROFILE_READ_LOOK_AHEAD,
+        CONFIG_PROFILE_SENSE_DATA_FORMAT,
+        CONFIG_PROFILE_POWER_CONDITIONS,
+        CONFIG_PROFILE_CDL,
+        CONFIG_PROFILE_JIT_MODES,
+        CONFIG_PROFILE_SETTING_COUNT // not a setting. Number of entries in configProfileResult.settings
+    } eConfigProfileSetting;
+
+    // Each setting is only touched when its valid flag is set. Settings are compared with what the device currently
+    // reports first and are only sent when something differs, so applying the same profile twice issues no changes.
+    typedef struct s_configProfile
+    {
+        bool                 writeCacheValid;
+        bool                 writeCacheEnable;
+        bool                 readLookAheadValid;
+        bool                 readLookAheadEnable;
+        bool                 senseDataFormatValid;
+        bool                 senseDataDescriptorFormat; // false for fixed format sense data
+        bool                 senseDataFormatSave;
+        bool                 powerConditionsValid;
+        bool                 powerConditionsSave;
+        powerConditionTimers powerConditions; // see set_EPC_Power_Conditions()
+        bool                 cdlValid;
+        tCDLSettings         cdlSettings; // see config_CDL_Settings()
+        bool                 jitModesValid;
+        bool                 jitDisableVjit;
+        uint8_t              jitMode; // 0 - 3, see seagate_Set_JIT_Modes()
+        bool                 jitModesSave;
+    } configProfile, *ptrConfigProfile;
+
+    typedef struct s_configProfileSettingResult
+    {
+        bool          requested; // the setting was valid in the profile
+        bool          changed;   // the device did not match the profile, so the change was sent
+        eReturnValues result;    // SUCCESS when the device now matches the profile
+        uint64_t      durationMilliseconds;
+    } configProfileSettingResult;
+
+    typedef struct s_configProfileResult
+    {
+        configProfileSettingResult settings[CONFIG_PROFILE_SETTING_COUNT];
+        uint32_t                   settingsChanged;
+        uint32_t                   settingsUnchanged; // already matched the profile
+        uint32_t                   settingsFailed;
+        uint64_t                   totalMilliseconds;
+    } configProfileResult, *ptrConfigProfileResult;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  apply_Config_Profile(tDevice *device, ptrConfigProfile profile, ptrConfigProfileResult result)
+    //
+    //! \brief   Description: Applies every valid setting in a profile to a device. Each setting is compared with the
+    //!          device's current value first and skipped when it already matches. On SCSI devices the write cache and
+    //!          read look-ahead settings share one read and one MODE SELECT of the caching mode page.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] profile = settings to apply
+    //!   \param[out] result = optional. Per-setting results and timing
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every requested setting now matches the profile, NOT_SUPPORTED = none of the requested
+    //!   settings are supported by this device, otherwise the first error that occurred. Remaining settings are still
+    //!   attempted after an error.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(3)
+    OPENSEA_OPERATIONS_API eReturnValues apply_Config_Profile(tDevice*               device,
+                                                              ptrConfigProfile       profile,
+                                                              ptrConfigProfileResult result);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  apply_Config_Profile_To_Devices(tDevice *deviceList, uint32_t numberOfDevices, ptrConfigProfile profile,
+    //                                  ptrConfigProfileResult results)
+    //
+    //! \brief   Description: Applies the same profile to each device in a list, one after another. A device that
+    //!          fails does not stop the remaining devices from being configured.
+    //
+    //  Entry:
+    //!   \param[in] deviceList = list of devices with open handles
+    //!   \param[in] numberOfDevices = number of devices in deviceList
+    //!   \param[in] profile = settings to apply
+    //!   \param[out] results = optional. One result per device, in the same order as deviceList
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every device now matches the profile, otherwise the first error from any device
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO(3)
+    M_PARAM_WO_SIZE(4, 2)
+    OPENSEA_OPERATIONS_API eReturnValues apply_Config_Profile_To_Devices(tDevice*               deviceList,
+                                                                         uint32_t               numberOfDevices,
+                                                                         ptrConfigProfile       profile,
+                                                                         ptrConfigProfileResult results);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Config_Profile_Result(ptrConfigProfileResult result)
+    //
+    //! \brief   Description: Prints what happened to each requested setting when a profile was applied.
+    //
+    //  Entry:
+    //!   \param[in] result = result from apply_Config_Profile()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    OPENSEA_OPERATIONS_API void print_Config_Profile_Result(ptrConfigProfileResult result);
+
+#if defined(__cplusplus)
+}
+#endif
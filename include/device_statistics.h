@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "logs.h"
 #include "operations_Common.h"
 
 #if defined(__cplusplus)
@@ -404,6 +405,61 @@ extern "C"
     M_PARAM_WO(2)
     OPENSEA_OPERATIONS_API eReturnValues get_DeviceStatistics(tDevice* device, ptrDeviceStatistics deviceStats);
 
+    // Pages for get_DeviceStatistics_Pages(). SCSI log pages are grouped with the closest ATA page:
+    //   GENERAL        - start-stop cycle counter, utilization, non-volatile cache, general statistics and performance,
+    //                    cache memory statistics and power condition transitions
+    //   ROTATING_MEDIA - background scan results and pending defects
+    //   GENERAL_ERRORS - write, read, read reverse and verify error counters, non-medium error and format status
+    //   TEMPERATURE    - temperature, environmental reporting and environmental limits
+    //   TRANSPORT      - protocol specific port
+    //   SSD            - solid state media and logical block provisioning
+    //   ZONED          - zoned device statistics
+    //   THRESHOLDS     - ATA device statistics notification log. SCSI threshold values of the other selected pages
+    // FREE_FALL, CDL and VENDOR are ATA only.
+#define DEVICE_STATISTICS_GENERAL        BIT0
+#define DEVICE_STATISTICS_FREE_FALL      BIT1
+#define DEVICE_STATISTICS_ROTATING_MEDIA BIT2
+#define DEVICE_STATISTICS_GENERAL_ERRORS BIT3
+#define DEVICE_STATISTICS_TEMPERATURE    BIT4
+#define DEVICE_STATISTICS_TRANSPORT      BIT5
+#define DEVICE_STATISTICS_SSD            BIT6
+#define DEVICE_STATISTICS_ZONED          BIT7
+#define DEVICE_STATISTICS_CDL            BIT8
+#define DEVICE_STATISTICS_VENDOR         BIT9
+#define DEVICE_STATISTICS_THRESHOLDS     BIT10
+#define DEVICE_STATISTICS_ALL_PAGES      UINT32_MAX
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_DeviceStatistics_Pages(tDevice *device, ptrLogPageCache logCache, ptrDeviceStatistics deviceStats,
+    //                             uint32_t requestMask)
+    //
+    //! \brief   Description: Same as get_DeviceStatistics() but only reads and decodes the selected pages. On ATA
+    //!          devices the log is only read up to the last selected page, and only selected pages in the supported
+    //!          pages list are decoded. SCSI devices read the list of supported pages and then only the selected
+    //!          pages. Threshold values are always read from the device.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] logCache = log pages already read from this device, such as by
+    //!   get_ATA_Drive_Information_Fields(). M_NULLPTR reads every page from the device
+    //!   \param[out] deviceStats = statistics to fill in. Only statistics on the selected pages are set.
+    //!   \param[in] requestMask = DEVICE_STATISTICS_* values or'd together. DEVICE_STATISTICS_ALL_PAGES is the same as
+    //!   get_DeviceStatistics()
+    //!
+    //  Exit:
+    //!   \return SUCCESS = statistics read, NOT_SUPPORTED = the device has no device statistics
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    OPENSEA_OPERATIONS_API eReturnValues get_DeviceStatistics_Pages(tDevice*            device,
+                                                                    ptrLogPageCache     logCache,
+                                                                    ptrDeviceStatistics deviceStats,
+                                                                    uint32_t            requestMask);
+
     M_NONNULL_PARAM_LIST(1, 2)
     M_PARAM_RO(1)
     M_PARAM_RO(2)
@@ -421,6 +477,113 @@ extern "C"
     M_PARAM_RO(1)
     eReturnValues ata_Device_Statistics_Reinitialize(tDevice* device, eDeviceStatisticsLog reinitializeRequest);
 
+    // Statistic IDs used by the sampler. ATA IDs are the device statistics log page and the byte offset of the
+    // statistic in that page. SCSI IDs are the log page, subpage and parameter code.
+#define DEVICE_STATISTIC_ID_ATA(page, offset) ((C_CAST(uint32_t, page) << 16) | C_CAST(uint32_t, offset))
+#define DEVICE_STATISTIC_ID_SCSI(page, subpage, parameterCode)                                                        \
+    ((C_CAST(uint32_t, page) << 24) | (C_CAST(uint32_t, subpage) << 16) | C_CAST(uint32_t, parameterCode))
+
+    typedef struct s_deviceStatisticSample
+    {
+        uint32_t id;
+        uint64_t value;         // ATA temperatures are sign extended. Cast to int64_t to read them.
+        int64_t  delta;         // change since the previous sample. 0 on the first sample and after a reset
+        double   ratePerSecond; // delta divided by the time between the two samples
+        bool     valid;         // the device reported a valid value in the latest sample
+        bool     isCounter;     // false for gauges that can go down on their own, such as temperatures
+        bool     reset;         // a counter went backwards since the previous sample (wrapped or reinitialized)
+    } deviceStatisticSample;
+
+#define DEVICE_STATISTICS_SAMPLER_MAX_PAGES (32)
+
+    typedef struct s_deviceStatisticsSamplerPage
+    {
+        uint8_t page;
+        uint8_t subpage; // SCSI only
+    } deviceStatisticsSamplerPage;
+
+    // Created by init_Device_Statistics_Sampler(), which reads every page once to find which statistics are supported.
+    // After that only the pages holding a tracked statistic are read. Samples are kept in the order they appear in
+    // the pages so each sample is a single pass with no searching in the common case.
+    typedef struct s_deviceStatisticsSampler
+    {
+        bool                        isATA;
+        uint8_t                     numberOfPages;
+        deviceStatisticsSamplerPage pages[DEVICE_STATISTICS_SAMPLER_MAX_PAGES];
+        uint32_t                    numberOfSamples;
+        uint32_t                    samplesCapacity;
+        deviceStatisticSample*      samples;
+        uint32_t                    searchHint;
+        uint64_t                    lastSampleMilliseconds;
+        uint32_t                    sampleCount;
+        uint32_t                    pagesReadLastSample;
+    } deviceStatisticsSampler, *ptrDeviceStatisticsSampler;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_Device_Statistics_Sampler(tDevice *device, ptrDeviceStatisticsSampler sampler, const uint32_t *ids,
+    //                                 uint32_t numberOfIDs)
+    //
+    //! \brief   Description: Finds which statistics the device supports and takes the first sample. Deltas and rates
+    //!          are zero until the next call to sample_Device_Statistics().
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[out] sampler = sampler to set up. Free with free_Device_Statistics_Sampler()
+    //!   \param[in] ids = optional. Statistics to track, made with DEVICE_STATISTIC_ID_ATA() or
+    //!   DEVICE_STATISTIC_ID_SCSI(). M_NULLPTR tracks every supported statistic
+    //!   \param[in] numberOfIDs = number of entries in ids
+    //!
+    //  Exit:
+    //!   \return SUCCESS = sampler ready, NOT_SUPPORTED = no requested statistic is supported, MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    M_PARAM_RO_SIZE(3, 4)
+    OPENSEA_OPERATIONS_API eReturnValues init_Device_Statistics_Sampler(tDevice*                   device,
+                                                                        ptrDeviceStatisticsSampler sampler,
+                                                                        const uint32_t*            ids,
+                                                                        uint32_t                   numberOfIDs);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  sample_Device_Statistics(tDevice *device, ptrDeviceStatisticsSampler sampler)
+    //
+    //! \brief   Description: Reads the pages holding tracked statistics and updates each sample's value, delta and
+    //!          rate. A counter that is lower than the previous sample is flagged as reset and reports no delta.
+    //!          Gauges (temperatures, pending defects, utilization, resource and zone counts) report a negative delta.
+    //
+    //  Entry:
+    //!   \param[in] device = same device the sampler was set up for
+    //!   \param[in,out] sampler = sampler from init_Device_Statistics_Sampler()
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every page was read, otherwise the error from the first page that failed. Statistics on
+    //!   pages that failed keep their previous values and are marked not valid.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    OPENSEA_OPERATIONS_API eReturnValues sample_Device_Statistics(tDevice* device, ptrDeviceStatisticsSampler sampler);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_Device_Statistics_Sampler(ptrDeviceStatisticsSampler sampler)
+    //
+    //! \brief   Description: Frees the samples and clears the sampler.
+    //
+    //  Entry:
+    //!   \param[in,out] sampler = sampler from init_Device_Statistics_Sampler()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_Device_Statistics_Sampler(ptrDeviceStatisticsSampler sampler);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "ata_Security.h"
+#include "logs.h"
 #include "operations_Common.h"
 #include "seagate_operations.h" //for low current spin up info
 
@@ -209,8 +210,167 @@ extern "C"
                                                                                // are more than 1 reported currently.
     } securityProtocolInfo;
 
-#define MAX_FEATURES       UINT8_C(60) // change this number if we need to capture more feature support
-#define MAX_FEATURE_LENGTH UINT8_C(50) // maximum number of characters to allow for use when storing feature names.
+    // Features reported in drive information. Use get_Drive_Feature_Name() for the name to show for each one.
+    typedef enum eDriveFeatureEnum
+    {
+        DRIVE_FEATURE_READ_WRITE_MULTIPLE,
+        DRIVE_FEATURE_DOUBLEWORD_IO,
+        DRIVE_FEATURE_SANITIZE,
+        DRIVE_FEATURE_ALL_WRITE_CACHE_NON_VOLATILE,
+        DRIVE_FEATURE_SATA_NCQ_PRIORITY,
+        DRIVE_FEATURE_SATA_NCQ,
+        DRIVE_FEATURE_SATA_OUT_OF_BAND_MANAGEMENT,
+        DRIVE_FEATURE_SATA_NCQ_STREAMING,
+        DRIVE_FEATURE_SATA_POWER_DISABLE,
+        DRIVE_FEATURE_SATA_REBUILD_ASSIST,
+        DRIVE_FEATURE_SATA_HYBRID_INFORMATION,
+        DRIVE_FEATURE_SATA_DEVICE_SLEEP,
+        DRIVE_FEATURE_SATA_NCQ_AUTOSENSE,
+        DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION,
+        DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL,
+        DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY,
+        DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT,
+        DRIVE_FEATURE_HPA,
+        DRIVE_FEATURE_PACKET,
+        DRIVE_FEATURE_POWER_MANAGEMENT,
+        DRIVE_FEATURE_SECURITY,
+        DRIVE_FEATURE_SMART,
+        DRIVE_FEATURE_DCO,
+        DRIVE_FEATURE_48BIT_ADDRESS,
+        DRIVE_FEATURE_AAM,
+        DRIVE_FEATURE_SET_MAX_SECURITY_EXTENSION,
+        DRIVE_FEATURE_PUIS,
+        DRIVE_FEATURE_REMOVABLE_MEDIA_STATUS_NOTIFICATION,
+        DRIVE_FEATURE_APM,
+        DRIVE_FEATURE_CFA,
+        DRIVE_FEATURE_TCQ,
+        DRIVE_FEATURE_GPL,
+        DRIVE_FEATURE_STREAMING,
+        DRIVE_FEATURE_MEDIA_CARD_PASS_THROUGH,
+        DRIVE_FEATURE_SMART_SELF_TEST,
+        DRIVE_FEATURE_SMART_ERROR_LOGGING,
+        DRIVE_FEATURE_DSN,
+        DRIVE_FEATURE_AMAC,
+        DRIVE_FEATURE_EPC,
+        DRIVE_FEATURE_SENSE_DATA_REPORTING,
+        DRIVE_FEATURE_FREE_FALL_CONTROL,
+        DRIVE_FEATURE_WRITE_READ_VERIFY,
+        DRIVE_FEATURE_TRIM,
+        DRIVE_FEATURE_SCT_READ_WRITE_LONG,
+        DRIVE_FEATURE_SCT_WRITE_SAME,
+        DRIVE_FEATURE_SCT_ERROR_RECOVERY_CONTROL,
+        DRIVE_FEATURE_SCT_FEATURE_CONTROL,
+        DRIVE_FEATURE_SCT_DATA_TABLES,
+        DRIVE_FEATURE_NV_CACHE,
+        DRIVE_FEATURE_NV_CACHE_POWER_MODE,
+        DRIVE_FEATURE_MUTATE,
+        DRIVE_FEATURE_ADVANCED_BACKGROUND_OPERATIONS,
+        DRIVE_FEATURE_SET_SECTOR_CONFIGURATION,
+        DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION_RESTORE,
+        DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION,
+        DRIVE_FEATURE_DEVICE_LIFE_CONTROL,
+        DRIVE_FEATURE_COMMAND_DURATION_LIMITS,
+        DRIVE_FEATURE_REMOVE_ELEMENT_AND_MODIFY_ZONES,
+        DRIVE_FEATURE_ZONE_DOMAINS,
+        DRIVE_FEATURE_ZONE_REALMS,
+        DRIVE_FEATURE_SEAGATE_IDD,
+        DRIVE_FEATURE_SEAGATE_REMANUFACTURE,
+        DRIVE_FEATURE_HOST_LOGGING,
+        DRIVE_FEATURE_FARM,
+        DRIVE_FEATURE_TCG,
+        DRIVE_FEATURE_IEEE_1667,
+        DRIVE_FEATURE_SCSA,
+        DRIVE_FEATURE_POWER_CONSUMPTION,
+        DRIVE_FEATURE_UNMAP,
+        DRIVE_FEATURE_WRITE_SAME,
+        DRIVE_FEATURE_ATOMIC_WRITES,
+        DRIVE_FEATURE_SAT,
+        DRIVE_FEATURE_APPLICATION_CLIENT_LOGGING,
+        DRIVE_FEATURE_SELF_TEST,
+        DRIVE_FEATURE_FORMAT_CORRUPT,
+        DRIVE_FEATURE_PROTECTION_TYPE_1,
+        DRIVE_FEATURE_PROTECTION_TYPE_2,
+        DRIVE_FEATURE_PROTECTION_TYPE_3,
+        DRIVE_FEATURE_AUTOMATIC_WRITE_REASSIGNMENT,
+        DRIVE_FEATURE_AUTOMATIC_READ_REASSIGNMENT,
+        DRIVE_FEATURE_IO_ADVICE_HINTS,
+        DRIVE_FEATURE_COMMAND_DURATION_LIMITS_T2,
+        DRIVE_FEATURE_PATA_CONTROL,
+        DRIVE_FEATURE_SATA_COMMAND_DURATION_LIMIT,
+        DRIVE_FEATURE_POWER_CONDITIONS,
+        DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS,
+        DRIVE_FEATURE_BACKGROUND_MEDIA_SCAN,
+        DRIVE_FEATURE_BACKGROUND_PRE_SCAN,
+        DRIVE_FEATURE_TRANSLATE_ADDRESS,
+        DRIVE_FEATURE_REBUILD_ASSIST,
+        DRIVE_FEATURE_FORMAT_UNIT,
+        DRIVE_FEATURE_FAST_FORMAT,
+        DRIVE_FEATURE_FORMAT_WITH_PRESET,
+        DRIVE_FEATURE_ATA_PASS_THROUGH_12,
+        DRIVE_FEATURE_ATA_PASS_THROUGH_16,
+        DRIVE_FEATURE_ATA_PASS_THROUGH_32,
+        DRIVE_FEATURE_CBCS,
+        DRIVE_FEATURE_TAPE_ENCRYPTION,
+        DRIVE_FEATURE_DATA_ENCRYPTION_CONFIGURATION,
+        DRIVE_FEATURE_SA_CREATION_CAPABILITIES,
+        DRIVE_FEATURE_IKE_V2_SCSI,
+        DRIVE_FEATURE_SD_ASSOCIATION,
+        DRIVE_FEATURE_DMTF_SECURITY,
+        DRIVE_FEATURE_NVME_RESERVED,
+        DRIVE_FEATURE_NVME_RPMB,
+        DRIVE_FEATURE_JEDEC_UFS,
+        DRIVE_FEATURE_SD_TRUSTED_FLASH,
+        DRIVE_FEATURE_ATA_SECURITY,
+        DRIVE_FEATURE_PERSISTENT_RESERVATIONS,
+        DRIVE_FEATURE_FORMAT_NVM,
+        DRIVE_FEATURE_FIRMWARE_UPDATE,
+        DRIVE_FEATURE_NAMESPACE_MANAGEMENT,
+        DRIVE_FEATURE_DEVICE_SELF_TEST,
+        DRIVE_FEATURE_VIRTUALIZATION_MANAGEMENT,
+        DRIVE_FEATURE_DOORBELL_BUFFER_CONFIG,
+        DRIVE_FEATURE_WRITE_UNCORRECTABLE,
+        DRIVE_FEATURE_DATASET_MANAGEMENT,
+        DRIVE_FEATURE_WRITE_ZEROS,
+        DRIVE_FEATURE_NAMESPACE_SHARING,
+        DRIVE_FEATURE_COUNT // must be last
+    } eDriveFeature;
+
+#define DRIVE_FEATURE_SET_WORDS ((DRIVE_FEATURE_COUNT + 63) / 64)
+
+    // One bit per eDriveFeature. A feature is only marked enabled when it is also supported.
+    typedef struct s_driveFeatureSet
+    {
+        uint64_t supported[DRIVE_FEATURE_SET_WORDS];
+        uint64_t enabled[DRIVE_FEATURE_SET_WORDS];
+    } driveFeatureSet;
+
+    static M_INLINE bool is_Drive_Feature_Supported(const driveFeatureSet* features, eDriveFeature feature)
+    {
+        return features->supported[feature / 64] & (UINT64_C(1) << (feature % 64));
+    }
+
+    static M_INLINE bool is_Drive_Feature_Enabled(const driveFeatureSet* features, eDriveFeature feature)
+    {
+        return features->enabled[feature / 64] & (UINT64_C(1) << (feature % 64));
+    }
+
+    typedef enum eUnmappedDataEnum
+    {
+        UNMAPPED_DATA_NOT_REPORTED,
+        UNMAPPED_DATA_ZEROES,
+        UNMAPPED_DATA_VENDOR_PATTERN,
+        UNMAPPED_DATA_PROVISIONING_PATTERN,
+    } eUnmappedData;
+
+    // Extra information shown after some feature names. Each field is only valid when its feature is supported.
+    typedef struct s_driveFeatureDetails
+    {
+        uint8_t       ncqQueueDepth;               // DRIVE_FEATURE_SATA_NCQ
+        uint8_t       tcqQueueDepth;               // DRIVE_FEATURE_TCQ
+        uint8_t       informationalExceptionsMode; // DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS. MRIE field
+        bool          deterministicUnmap;          // DRIVE_FEATURE_TRIM or DRIVE_FEATURE_UNMAP
+        eUnmappedData unmappedData;                // DRIVE_FEATURE_TRIM or DRIVE_FEATURE_UNMAP
+    } driveFeatureDetails;
 
 #define MAX_SPECS          UINT8_C(40)
 #define MAX_SPEC_LENGTH                                                                                                \
@@ -268,10 +428,9 @@ extern "C"
         uint64_t totalBytesWritten;
         double   deviceReportedUtilizationRate; // ACS4 or SBC4 required for this to be valid
         // interface speed (SATA or SAS only)
-        interfaceSpeed interfaceSpeedInfo;
-        uint8_t        numberOfFeaturesSupported;                 // number of features added in the next field
-        char featuresSupported[MAX_FEATURES][MAX_FEATURE_LENGTH]; // max of 50 different features, 50 characters allowed
-                                                                  // for each feature name
+        interfaceSpeed          interfaceSpeedInfo;
+        driveFeatureSet         features;
+        driveFeatureDetails     featureDetails;
         firmwareDownloadSupport fwdlSupport;
         ataSecurityStatus       ataSecurityInformation;
         bool                    readLookAheadSupported;
@@ -336,13 +495,9 @@ extern "C"
             uint8_t            numberOfFirmwareSlots;
             uint8_t            nvmSubsystemNVMeQualifiedName[257]; // This is a UTF8 string!
             eEncryptionSupport encryptionSupport;
-            uint8_t reserved; // previously part of numberOfControllerFeatures as a word, but changed to a byte
-            uint8_t numberOfControllerFeatures;
-            char    controllerFeaturesSupported[MAX_FEATURES]
-                                            [MAX_FEATURE_LENGTH]; // max of 50 different features, 50 characters allowed
-                                                                  // for each feature name
-            uint64_t longDSTTimeMinutes;
-            uint8_t  numberOfPowerStatesSupported;
+            driveFeatureSet    features;
+            uint64_t           longDSTTimeMinutes;
+            uint8_t            numberOfPowerStatesSupported;
         } controllerData;
         // smart log data (controller, not per namespace)
         struct
@@ -379,11 +534,7 @@ extern "C"
             uint8_t  namespaceGloballyUniqueIdentifier[16];
             uint64_t ieeeExtendedUniqueIdentifier;
             // Namespace features will include protection information types, and security protocols supported
-            uint8_t reserved; // previously part of numberOfControllerFeatures as a word, but changed to a byte
-            uint8_t numberOfNamespaceFeatures;
-            char    namespaceFeaturesSupported[MAX_FEATURES]
-                                           [MAX_FEATURE_LENGTH]; // max of 50 different features, 50 characters allowed
-                                                                 // for each feature name
+            driveFeatureSet features;
         } namespaceData;
         securityProtocolInfo securityInfo; // TCG, IEEE1667, etc
     } driveInformationNVMe, *ptrDriveInformationNVMe;
@@ -409,6 +560,37 @@ extern "C"
         safe_free_core(M_REINTERPRET_CAST(void**, info));
     }
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Feature_Name(eDriveFeature feature)
+    //
+    //! \brief   Description:  Gets the name shown for a feature in the drive information output.
+    //
+    //  Entry:
+    //!   \param[in] feature = feature to get the name of
+    //!
+    //  Exit:
+    //!   \return constant string with the name. An empty string for an invalid feature.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API const char* get_Drive_Feature_Name(eDriveFeature feature);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Feature_Count(const driveFeatureSet *features)
+    //
+    //! \brief   Description:  Counts the features that are supported in a feature set.
+    //
+    //  Entry:
+    //!   \param[in] features = feature set from drive information
+    //!
+    //  Exit:
+    //!   \return number of supported features
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1) OPENSEA_OPERATIONS_API uint16_t get_Drive_Feature_Count(const driveFeatureSet* features);
+
     //-----------------------------------------------------------------------------
     //
     //  get_ATA_Drive_Information(tDevice *device, ptrDriveInformation driveInfo)
@@ -454,6 +636,107 @@ extern "C"
     M_PARAM_WO(2)
     OPENSEA_OPERATIONS_API eReturnValues get_NVMe_Drive_Information(tDevice* device, ptrDriveInformationNVMe driveInfo);
 
+    // Groups of fields for the get_*_Drive_Information_Fields() functions. Only the commands needed for the selected
+    // groups are sent. Identify (ATA), standard inquiry (SCSI) and identify controller (NVMe) are always sent since
+    // everything else depends on them.
+    //   IDENTITY - model, serial number, firmware revision, vendor, WWN, rotation rate, form factor and, behind a SAT
+    //              translator, the translator's vendor, product and revision
+    //   CAPACITY - max LBA, logical and physical sector sizes, protection information
+    //   FEATURES - features and specifications supported, security protocols, settings from mode pages and features,
+    //              supported commands, native max LBA, date of manufacture
+    //   HEALTH   - SMART status, temperatures, power on time, workload, endurance and the last DST result
+    //   SETTINGS - current values of settings that can be changed without changing identify: mode pages (SCSI), the
+    //              identify device data log (ATA), write cache and host identifier (NVMe). FEATURES reads these too.
+    // INVENTORY is the usual set for listing many drives: one or two commands per drive in most cases.
+#define DRIVE_INFO_FIELD_IDENTITY  BIT0
+#define DRIVE_INFO_FIELD_CAPACITY  BIT1
+#define DRIVE_INFO_FIELD_FEATURES  BIT2
+#define DRIVE_INFO_FIELD_HEALTH    BIT3
+#define DRIVE_INFO_FIELD_SETTINGS  BIT4
+#define DRIVE_INFO_FIELD_INVENTORY (DRIVE_INFO_FIELD_IDENTITY | DRIVE_INFO_FIELD_CAPACITY)
+#define DRIVE_INFO_FIELD_ALL       UINT32_MAX
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_ATA_Drive_Information_Fields(tDevice *device, ptrLogPageCache logCache,
+    //                                   ptrDriveInformationSAS_SATA driveInfo, uint32_t fieldMask)
+    //
+    //! \brief   Description:  Same as get_ATA_Drive_Information() but only sends the commands needed for the
+    //!          selected field groups. Fields outside the selected groups are left zeroed unless they come from
+    //!          the identify data, which is always read and parsed.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in,out] logCache = log pages already read from this device, shared with get_DeviceStatistics_Pages().
+    //!   M_NULLPTR reads every log from the device
+    //!   \param[out] driveInfo = pointer to the struct to fill in with ATA drive information.
+    //!   \param[in] fieldMask = DRIVE_INFO_FIELD_* values OR'd together
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, MEMORY_FAILURE, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    OPENSEA_OPERATIONS_API eReturnValues get_ATA_Drive_Information_Fields(tDevice*                    device,
+                                                                          ptrLogPageCache             logCache,
+                                                                          ptrDriveInformationSAS_SATA driveInfo,
+                                                                          uint32_t                    fieldMask);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SCSI_Drive_Information_Fields(tDevice *device, ptrLogPageCache logCache,
+    //                                    ptrDriveInformationSAS_SATA driveInfo, uint32_t fieldMask)
+    //
+    //! \brief   Description:  Same as get_SCSI_Drive_Information() but only sends the commands needed for the
+    //!          selected field groups. With DRIVE_INFO_FIELD_INVENTORY only the unit serial number and device
+    //!          identification VPD pages and read capacity are read after the standard inquiry.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in,out] logCache = log pages already read from this device, shared with get_DeviceStatistics_Pages().
+    //!   M_NULLPTR reads every log page from the device
+    //!   \param[out] driveInfo = pointer to the struct to fill in with SCSI drive information.
+    //!   \param[in] fieldMask = DRIVE_INFO_FIELD_* values OR'd together
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    OPENSEA_OPERATIONS_API eReturnValues get_SCSI_Drive_Information_Fields(tDevice*                    device,
+                                                                           ptrLogPageCache             logCache,
+                                                                           ptrDriveInformationSAS_SATA driveInfo,
+                                                                           uint32_t                    fieldMask);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_NVMe_Drive_Information_Fields(tDevice *device, ptrDriveInformationNVMe driveInfo, uint32_t fieldMask)
+    //
+    //! \brief   Description:  Same as get_NVMe_Drive_Information() but only sends the commands needed for the
+    //!          selected field groups.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[out] driveInfo = pointer to the struct to fill in with NVMe drive information.
+    //!   \param[in] fieldMask = DRIVE_INFO_FIELD_* values OR'd together
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, MEMORY_FAILURE, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    OPENSEA_OPERATIONS_API eReturnValues get_NVMe_Drive_Information_Fields(tDevice*                device,
+                                                                           ptrDriveInformationNVMe driveInfo,
+                                                                           uint32_t                fieldMask);
+
     //-----------------------------------------------------------------------------
     //
     //  get_SCSI_Drive_Information(ptrDriveInformation externalDriveInfo, ptrDriveInformation scsiDriveInfo,
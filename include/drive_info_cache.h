@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_info_cache.h
+// \brief This file defines the functions for keeping static drive information in an on-disk cache between runs.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+#include "drive_info.h"
+#include "operations_Common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    // Each drive gets its own file in the cache directory, named from the interface, WWN, serial number and firmware
+    // revision, so a firmware update or a different drive in the same slot never finds the old file. Before the file
+    // is used it is also checked against a fingerprint of the data that describes the drive's identity, capacity and
+    // format: the ATA identify data, the NVMe identify controller and identify namespace data, or for SCSI the
+    // standard inquiry data, the device identification VPD page and read capacity. On SCSI those two commands are
+    // sent to check the cache. A format, capacity change or a setting that shows up in identify changes the
+    // fingerprint and the drive information is read again.
+    //
+    // The file holds the drive information structure as it is laid out in memory, so it is only used by a build of
+    // this library with the same DRIVE_INFO_CACHE_VERSION and structure size. A file that does not match is
+    // overwritten.
+    //
+    // On a cache hit, DRIVE_INFO_FIELD_HEALTH and DRIVE_INFO_FIELD_SETTINGS are read from the drive. Temperatures,
+    // power on time, workload counters, endurance, SMART status and the last DST result are always live, as are
+    // settings that can change without changing the fingerprint: the SCSI mode pages (write cache, read look-ahead,
+    // EPC, BMS, AWRE/ARRE, DLC, CDL, informational exceptions mode, negotiated link rate), the ATA identify device data
+    // log, and the NVMe write cache and host identifier.
+#define DRIVE_INFO_CACHE_VERSION UINT16_C(2)
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_ATA_Drive_Information_Cached(tDevice *device, ptrDriveInformationSAS_SATA driveInfo,
+    //                                   const char *cacheDirectory)
+    //
+    //! \brief   Description:  Same as get_ATA_Drive_Information(), but static information comes from the cache file
+    //!          for this drive when it is still valid. After a full read, the cache file is written for next time.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[out] driveInfo = pointer to the drive information structure to fill in
+    //!   \param[in] cacheDirectory = existing directory to keep cache files in. M_NULLPTR does not use a cache.
+    //!
+    //  Exit:
+    //!   \return same as get_ATA_Drive_Information(). Failing to write the cache file is not an error.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    M_NULL_TERM_STRING(3)
+    OPENSEA_OPERATIONS_API eReturnValues get_ATA_Drive_Information_Cached(tDevice*                    device,
+                                                                          ptrDriveInformationSAS_SATA driveInfo,
+                                                                          const char*                 cacheDirectory);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SCSI_Drive_Information_Cached(tDevice *device, ptrDriveInformationSAS_SATA driveInfo,
+    //                                    const char *cacheDirectory)
+    //
+    //! \brief   Description:  Same as get_SCSI_Drive_Information(), but static information comes from the cache file
+    //!          for this drive when it is still valid. After a full read, the cache file is written for next time.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[out] driveInfo = pointer to the drive information structure to fill in
+    //!   \param[in] cacheDirectory = existing directory to keep cache files in. M_NULLPTR does not use a cache.
+    //!
+    //  Exit:
+    //!   \return same as get_SCSI_Drive_Information(). Failing to write the cache file is not an error.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    M_NULL_TERM_STRING(3)
+    OPENSEA_OPERATIONS_API eReturnValues get_SCSI_Drive_Information_Cached(tDevice*                    device,
+                                                                           ptrDriveInformationSAS_SATA driveInfo,
+                                                                           const char*                 cacheDirectory);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_NVMe_Drive_Information_Cached(tDevice *device, ptrDriveInformationNVMe driveInfo,
+    //                                    const char *cacheDirectory)
+    //
+    //! \brief   Description:  Same as get_NVMe_Drive_Information(), but static information comes from the cache file
+    //!          for this drive when it is still valid. After a full read, the cache file is written for next time.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[out] driveInfo = pointer to the drive information structure to fill in
+    //!   \param[in] cacheDirectory = existing directory to keep cache files in. M_NULLPTR does not use a cache.
+    //!
+    //  Exit:
+    //!   \return same as get_NVMe_Drive_Information(). Failing to write the cache file is not an error.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    M_NULL_TERM_STRING(3)
+    OPENSEA_OPERATIONS_API eReturnValues get_NVMe_Drive_Information_Cached(tDevice*                device,
+                                                                           ptrDriveInformationNVMe driveInfo,
+                                                                           const char*             cacheDirectory);
+
+#if defined(__cplusplus)
+}
+#endif
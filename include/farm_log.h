@@ -105,6 +105,17 @@ extern "C"
         return field & UINT64_C(0x00FFFFFFFFFFFFFF);
     }
 
+    // FARM signed fields are 56 bits wide
+    static M_INLINE int64_t get_Farm_Signed_Qword_Data(uint64_t field)
+    {
+        uint64_t data = get_Farm_Qword_Data(field);
+        if (M_Byte6(data) & BIT7)
+        {
+            data |= UINT64_C(0xFF00000000000000);
+        }
+        return M_STATIC_CAST(int64_t, data);
+    }
+
     typedef struct s_farmGenericPage
     {
         uint64_t pageNumber;
@@ -571,11 +582,381 @@ extern "C"
         farmReliabilityStatistics reliability;
     } farmLogData;
 
+    // the view code relies on each page being at eFarmPage * FARM_PAGE_LEN in this structure
+    M_STATIC_ASSERT(sizeof(farmLogData) == FARM_PAGE_LEN * (FARM_PAGE_RELIABILITY_STATS + 1),
+                    farm_log_data_struct_is_not_6_pages);
+
     // TODO: Option to select which FARM data between current, saved, factory
     eReturnValues read_FARM_Data(tDevice* device, farmLogData* farmdata);
 
     void print_FARM_Data(farmLogData* farmdata);
 
+    // A view reads fields straight out of the raw FARM log instead of converting the whole log into farmLogData.
+    // Fields are addressed by their page and their offset in that page's structure, for example
+    // offsetof(farmDriveInfo, powerOnHours) on FARM_PAGE_DRIVE_INFO. Values are returned exactly as they would be in
+    // farmLogData, including the status byte, so get_Farm_Status_Byte() and get_Farm_Qword_Data() work on them.
+    // On SATA only the requested qwords are converted. SAS parameters do not follow the page layout, so the first
+    // access to a page decodes that page only and later accesses to it are copies.
+    typedef struct s_farmLogView
+    {
+        eFARMDriveInterface driveInterface;
+        uint8_t*            rawFarmData;
+        uint32_t            rawFarmDataLength;
+        bool                ownsRawFarmData; // set by read_FARM_View(). free_FARM_View() frees the raw data
+        uint8_t             decodedPages;    // SAS only. Bit per eFarmPage already decoded into sasFarmData
+        farmLogData*        sasFarmData;     // SAS only. Allocated on first access
+    } farmLogView, *ptrFarmLogView;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_FARM_View(ptrFarmLogView view, uint8_t *rawFarmData, uint32_t rawFarmDataLength,
+    //                 eFARMDriveInterface driveInterface)
+    //
+    //! \brief   Description: Sets up a view over a FARM log that is already in memory. Nothing is copied, so the
+    //!          buffer must stay valid until the view is freed.
+    //
+    //  Entry:
+    //!   \param[out] view = view to set up
+    //!   \param[in] rawFarmData = current FARM log as read from the device. SATA: all pages. SAS: log page 3Dh/03h
+    //!   \param[in] rawFarmDataLength = number of bytes in rawFarmData
+    //!   \param[in] driveInterface = which FARM format rawFarmData holds
+    //!
+    //  Exit:
+    //!   \return SUCCESS = view ready, FAILURE = rawFarmData is not a FARM log of that format, BAD_PARAMETER = null
+    //!   pointer
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_WO(1)
+    M_PARAM_RO_SIZE(2, 3)
+    OPENSEA_OPERATIONS_API eReturnValues init_FARM_View(ptrFarmLogView      view,
+                                                        uint8_t*            rawFarmData,
+                                                        uint32_t            rawFarmDataLength,
+                                                        eFARMDriveInterface driveInterface);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  read_FARM_View(tDevice *device, ptrFarmLogView view)
+    //
+    //! \brief   Description: Reads the current FARM log from the device and sets up a view over it without
+    //!          converting any fields.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[out] view = view to set up. Free it with free_FARM_View() when done.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = view ready, NOT_SUPPORTED = not an ATA or SCSI device, otherwise the error reading the log
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    OPENSEA_OPERATIONS_API eReturnValues read_FARM_View(tDevice* device, ptrFarmLogView view);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_FARM_View(ptrFarmLogView view)
+    //
+    //! \brief   Description: Frees anything the view allocated. The raw data is only freed when read_FARM_View()
+    //!          allocated it.
+    //
+    //  Entry:
+    //!   \param[in] view = view to free
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_FARM_View(ptrFarmLogView view);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_FARM_View_Fields(ptrFarmLogView view, eFarmPage page, size_t fieldOffset, uint64_t *values,
+    //                       uint8_t numberOfFields)
+    //
+    //! \brief   Description: Reads consecutive fields from a view, such as a by-head array.
+    //
+    //  Entry:
+    //!   \param[in] view = view set up by init_FARM_View() or read_FARM_View()
+    //!   \param[in] page = page the field is on
+    //!   \param[in] fieldOffset = offset of the first field in the page's structure. Must be a multiple of 8.
+    //!   \param[out] values = where to put the fields
+    //!   \param[in] numberOfFields = number of fields to read, such as FARM_MAX_HEADS
+    //!
+    //  Exit:
+    //!   \return number of fields read. Fewer than requested when the page or the log ends first.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 4)
+    M_PARAM_RW(1)
+    M_PARAM_WO_SIZE(4, 5)
+    OPENSEA_OPERATIONS_API uint8_t get_FARM_View_Fields(ptrFarmLogView view,
+                                                        eFarmPage      page,
+                                                        size_t         fieldOffset,
+                                                        uint64_t*      values,
+                                                        uint8_t        numberOfFields);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_FARM_View_Field(ptrFarmLogView view, eFarmPage page, size_t fieldOffset, uint64_t *value)
+    //
+    //! \brief   Description: Reads one field from a view.
+    //
+    //  Entry:
+    //!   \param[in] view = view set up by init_FARM_View() or read_FARM_View()
+    //!   \param[in] page = page the field is on
+    //!   \param[in] fieldOffset = offset of the field in the page's structure
+    //!   \param[out] value = the field
+    //!
+    //  Exit:
+    //!   \return true = field read, false = the field is outside the log
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 4)
+    M_PARAM_RW(1)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API bool get_FARM_View_Field(ptrFarmLogView view,
+                                                    eFarmPage      page,
+                                                    size_t         fieldOffset,
+                                                    uint64_t*      value);
+
+    // Offline parsing of combined FARM logs (FARMC files) written by pull_FARM_Combined_Log(). No device is needed.
+    // Data set types are in the same order as the bits in the combined log header's content field.
+    typedef enum eFarmCombinedDataSetEnum
+    {
+        FARM_DATA_SET_CURRENT,
+        FARM_DATA_SET_FACTORY,
+        FARM_DATA_SET_TIME_SERIES,
+        FARM_DATA_SET_STICKY,
+        FARM_DATA_SET_WORKLOAD_TRACE,
+        FARM_DATA_SET_SAVED,
+        FARM_DATA_SET_LONG_SAVED,
+        FARM_DATA_SET_UNKNOWN,
+    } eFarmCombinedDataSet;
+
+#define FARM_COMBINED_LOG_MAX_DATA_SETS (7)
+
+    typedef struct s_farmCombinedDataSet
+    {
+        eFarmCombinedDataSet type;
+        uint32_t             offset; // from the start of the combined log
+        uint32_t             length;
+        uint64_t             startTimestamp; // milliseconds since the unix epoch when the host started reading it
+        uint64_t             endTimestamp;
+        uint32_t             numberOfFrames; // 0 for the workload trace, which is not in FARM format
+        farmLogData*         frames;         // points into the log's frame storage. A frame whose signature did not
+                                             // match is left zeroed.
+    } farmCombinedDataSet;
+
+    // frameStorage and fileBuffer are kept between parses of the same structure and only grown when a bigger log is
+    // parsed, so parsing many files with one structure does not allocate per file.
+    typedef struct s_farmCombinedLog
+    {
+        eFARMDriveInterface driveInterface;
+        uint16_t            majorVersion;
+        uint16_t            minorVersion;
+        uint16_t            patchVersion;
+        char                modelNumber[MODEL_NUM_LEN + 1];
+        char                serialNumber[SERIAL_NUM_LEN + 1];
+        char                firmwareRevision[FW_REV_LEN + 1];
+        uint16_t            numberOfDataSets;
+        farmCombinedDataSet dataSets[FARM_COMBINED_LOG_MAX_DATA_SETS];
+        uint8_t*            rawData; // the combined log. Workload trace data is at rawData + offset
+        uint32_t            rawDataLength;
+        uint32_t            framesDecoded;
+        farmLogData*        frameStorage;
+        uint32_t            frameStorageCount;
+        uint8_t*            fileBuffer;
+        size_t              fileBufferSize;
+    } farmCombinedLog, *ptrFarmCombinedLog;
+
+    typedef struct s_farmCombinedLogBatchStatistics
+    {
+        uint32_t filesParsed;
+        uint32_t filesFailed;
+        uint64_t bytesRead;
+        uint64_t framesDecoded;
+        uint64_t totalMilliseconds;
+    } farmCombinedLogBatchStatistics, *ptrFarmCombinedLogBatchStatistics;
+
+    // Called once per file by parse_FARM_Combined_Log_Files(). log is only filled in when parseResult is SUCCESS and
+    // is reused for the next file, so copy anything that is needed later. Return anything other than SUCCESS to stop.
+    typedef eReturnValues (*farmCombinedLogCallback)(const char*        fileName,
+                                                      eReturnValues      parseResult,
+                                                      ptrFarmCombinedLog log,
+                                                      void*              context);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  parse_FARM_Combined_Log_Buffer(uint8_t *combinedLog, uint32_t combinedLogLength, ptrFarmCombinedLog log)
+    //
+    //! \brief   Description: Walks the data set headers of a combined FARM log in memory and decodes every FARM frame
+    //!          in every data set. The buffer is not copied and must stay valid while log->rawData is used.
+    //
+    //  Entry:
+    //!   \param[in] combinedLog = the combined log, as written to a FARMC file
+    //!   \param[in] combinedLogLength = number of bytes in combinedLog
+    //!   \param[in,out] log = zero it before the first use. Free it with free_FARM_Combined_Log() when done.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = parsed, FAILURE = not a combined FARM log or a data set is outside of the buffer,
+    //!   NOT_SUPPORTED = log from an interface that cannot be decoded, MEMORY_FAILURE = could not allocate frames
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RW(3)
+    OPENSEA_OPERATIONS_API eReturnValues parse_FARM_Combined_Log_Buffer(uint8_t*           combinedLog,
+                                                                        uint32_t           combinedLogLength,
+                                                                        ptrFarmCombinedLog log);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  parse_FARM_Combined_Log_File(const char *fileName, ptrFarmCombinedLog log)
+    //
+    //! \brief   Description: Reads a FARMC file into log's file buffer and parses it.
+    //
+    //  Entry:
+    //!   \param[in] fileName = path to the FARMC file
+    //!   \param[in,out] log = zero it before the first use. Free it with free_FARM_Combined_Log() when done.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = parsed, FILE_OPEN_ERROR = could not open or read the file, otherwise see
+    //!   parse_FARM_Combined_Log_Buffer()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_NULL_TERM_STRING(1)
+    M_PARAM_RW(2)
+    OPENSEA_OPERATIONS_API eReturnValues parse_FARM_Combined_Log_File(const char* fileName, ptrFarmCombinedLog log);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  parse_FARM_Combined_Log_Files(const char **fileNames, uint32_t numberOfFiles, farmCombinedLogCallback callback,
+    //                                void *context, ptrFarmCombinedLogBatchStatistics statistics)
+    //
+    //! \brief   Description: Parses a list of FARMC files, such as the contents of an archive directory, one after
+    //!          another and hands each result to a callback. One file buffer and one set of frames is reused for
+    //!          every file. A file that fails to parse is counted and passed to the callback, then the next file
+    //!          is parsed.
+    //
+    //  Entry:
+    //!   \param[in] fileNames = paths to the FARMC files
+    //!   \param[in] numberOfFiles = number of entries in fileNames
+    //!   \param[in] callback = called after each file
+    //!   \param[in] context = passed to the callback
+    //!   \param[out] statistics = optional. Counts for the whole list
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every file was parsed, FAILURE = at least one file could not be parsed, otherwise what the
+    //!   callback returned when it stopped the list early
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_WO(5)
+    OPENSEA_OPERATIONS_API eReturnValues parse_FARM_Combined_Log_Files(const char**                      fileNames,
+                                                                       uint32_t                          numberOfFiles,
+                                                                       farmCombinedLogCallback           callback,
+                                                                       void*                             context,
+                                                                       ptrFarmCombinedLogBatchStatistics statistics);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_FARM_Combined_Log(ptrFarmCombinedLog log)
+    //
+    //! \brief   Description: Frees the frames and file buffer held by a parsed combined log and zeroes it.
+    //
+    //  Entry:
+    //!   \param[in] log = log to free
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_FARM_Combined_Log(ptrFarmCombinedLog log);
+
+    // Columnar view of the frames in a time series, long saved or sticky data set. Each statistic gets one contiguous
+    // array of values so trend checks can run over a whole column at once.
+    typedef enum eFarmSeriesStatisticEnum
+    {
+        FARM_SERIES_POWER_ON_HOURS,
+        FARM_SERIES_HEAD_FLIGHT_HOURS,
+        FARM_SERIES_LOGICAL_SECTORS_WRITTEN,
+        FARM_SERIES_LOGICAL_SECTORS_READ,
+        FARM_SERIES_CURRENT_TEMPERATURE,
+        FARM_SERIES_REALLOCATED_SECTORS,
+        FARM_SERIES_REALLOCATION_CANDIDATES,
+        FARM_SERIES_REALLOCATED_SECTORS_BY_HEAD,
+        FARM_SERIES_REALLOCATION_CANDIDATES_BY_HEAD,
+        FARM_SERIES_FLY_HEIGHT_DELTA_OD_BY_HEAD, // 1/1000 Angstrom
+        FARM_SERIES_FLY_HEIGHT_DELTA_ID_BY_HEAD,
+        FARM_SERIES_FLY_HEIGHT_DELTA_MD_BY_HEAD,
+        FARM_SERIES_STATISTIC_COUNT // not a statistic. Number of entries in farmSeriesTable.columns
+    } eFarmSeriesStatistic;
+
+    // All arrays hold numberOfHeads * numberOfFrames entries, indexed [head * numberOfFrames + frame].
+    typedef struct s_farmSeriesColumn
+    {
+        const char* name;
+        uint8_t     numberOfHeads; // 1 for statistics that are not kept by head
+        int64_t*    values;
+        bool*       valid;        // the field was supported and valid in that frame
+        int64_t*    deltas;       // change from the previous frame. 0 for the first frame or when either is invalid
+        double*     ratesPerHour; // delta per power on hour between the two frames. 0 when the hours did not move
+    } farmSeriesColumn;
+
+    typedef struct s_farmSeriesTable
+    {
+        uint32_t         numberOfFrames; // frames with a valid FARM signature, sorted by power on hours
+        uint8_t          numberOfHeads;
+        farmSeriesColumn columns[FARM_SERIES_STATISTIC_COUNT];
+        int64_t*         valueStorage; // the column arrays point into these four allocations
+        int64_t*         deltaStorage;
+        double*          rateStorage;
+        bool*            validStorage;
+    } farmSeriesTable, *ptrFarmSeriesTable;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  build_FARM_Series_Table(const farmCombinedDataSet *dataSet, ptrFarmSeriesTable table)
+    //
+    //! \brief   Description: Converts every frame of a parsed data set into columns, one per statistic and head,
+    //!          and computes frame to frame deltas and rates. Frames are ordered by power on hours first since the
+    //!          drive saves time series frames in a ring.
+    //
+    //  Entry:
+    //!   \param[in] dataSet = data set from parse_FARM_Combined_Log_Buffer() or parse_FARM_Combined_Log_File()
+    //!   \param[out] table = table to fill in. Free it with free_FARM_Series_Table() when done.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = table built, NOT_SUPPORTED = no frame in the data set has a valid FARM signature,
+    //!   MEMORY_FAILURE = could not allocate the columns
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    OPENSEA_OPERATIONS_API eReturnValues build_FARM_Series_Table(const farmCombinedDataSet* dataSet,
+                                                                 ptrFarmSeriesTable         table);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_FARM_Series_Table(ptrFarmSeriesTable table)
+    //
+    //! \brief   Description: Frees the columns of a series table and zeroes it.
+    //
+    //  Entry:
+    //!   \param[in] table = table to free
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_FARM_Series_Table(ptrFarmSeriesTable table);
+
 #if defined(__cplusplus)
 }
 #endif
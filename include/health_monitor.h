@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file health_monitor.h
+// \brief This file defines the functions for tracking trends in SMART, device statistics and defect counts over time.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+#include "device_statistics.h"
+#include "operations_Common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    typedef enum eHealthMetricSourceEnum
+    {
+        HEALTH_METRIC_SMART_ATTRIBUTE_RAW,     // ATA. id = attribute number. 48 bit raw value
+        HEALTH_METRIC_SMART_ATTRIBUTE_CURRENT, // ATA. id = attribute number. Current (nominal) value
+        HEALTH_METRIC_DEVICE_STATISTIC,        // ATA or SCSI. id from DEVICE_STATISTIC_ID_ATA/SCSI()
+        HEALTH_METRIC_NVME_HEALTH,             // NVMe. id = eNVMeHealthField
+        HEALTH_METRIC_PENDING_LIST_COUNT,      // id is not used
+        HEALTH_METRIC_GROWN_LIST_COUNT,        // id is not used
+    } eHealthMetricSource;
+
+    // Fields of the NVMe SMART/health information log that can be tracked
+    typedef enum eNVMeHealthFieldEnum
+    {
+        NVME_HEALTH_COMPOSITE_TEMPERATURE, // Celsius
+        NVME_HEALTH_AVAILABLE_SPARE,
+        NVME_HEALTH_PERCENTAGE_USED,
+        NVME_HEALTH_MEDIA_ERRORS,
+        NVME_HEALTH_ERROR_LOG_ENTRIES,
+        NVME_HEALTH_UNSAFE_SHUTDOWNS,
+        NVME_HEALTH_WARNING_TEMPERATURE_TIME,
+        NVME_HEALTH_CRITICAL_TEMPERATURE_TIME,
+    } eNVMeHealthField;
+
+    // When a metric is flagged. A metric is flagged when its latest value is past the threshold, or when the trend
+    // over the history is heading toward the threshold fast enough to reach it within horizonSeconds.
+    typedef struct s_healthMetricPolicy
+    {
+        double   threshold;
+        bool     rising;         // true when higher values are worse (error counts). false for spare, current values
+        uint32_t horizonSeconds; // 0 only flags metrics that are already past the threshold
+    } healthMetricPolicy;
+
+#define HEALTH_MONITOR_MAX_METRICS        (16)
+#define HEALTH_MONITOR_HISTORY_LENGTH     (64)
+#define HEALTH_MONITOR_MIN_TREND_SAMPLES  (3) // fewer samples than this do not give a slope
+#define HEALTH_MONITOR_DEFAULT_INTERVAL_S (3600)
+
+    // The history is a ring buffer holding the most recent HEALTH_MONITOR_HISTORY_LENGTH samples. Sums for a least
+    // squares fit are updated as samples are added and removed, so the slope is found without going over the history.
+    // Times are in seconds since timeBaseMilliseconds, which moves forward each time the ring wraps to keep the sums
+    // small and exact.
+    typedef struct s_healthTrendMetric
+    {
+        eHealthMetricSource source;
+        uint32_t            id;
+        healthMetricPolicy  policy;
+        uint16_t            count; // samples in the history
+        uint16_t            next;  // slot the next sample is written to
+        uint64_t            timeBaseMilliseconds;
+        double              times[HEALTH_MONITOR_HISTORY_LENGTH];
+        double              values[HEALTH_MONITOR_HISTORY_LENGTH];
+        double              sumTimes;
+        double              sumValues;
+        double              sumTimesSquared;
+        double              sumTimesValues;
+        bool                latestValid; // the last sample read a value for this metric
+        double              latest;
+        bool                slopeValid;
+        double              slopePerSecond;
+        bool                timeToThresholdValid; // false when the trend is flat or moving away from the threshold
+        double              secondsToThreshold;   // 0 when already past the threshold
+        bool                flagged;
+    } healthTrendMetric;
+
+    // One monitor per device. Everything is in the structure except the device statistics sampler's samples, which
+    // are allocated once on the first sample, so memory use does not grow no matter how long the monitor runs.
+    typedef struct s_healthMonitor
+    {
+        uint32_t                intervalSeconds;
+        uint64_t                lastSampleMilliseconds; // 0 until the first sample
+        uint32_t                sampleCount;
+        uint8_t                 numberOfMetrics;
+        healthTrendMetric       metrics[HEALTH_MONITOR_MAX_METRICS];
+        eReturnValues           deviceStatisticsSamplerStatus; // UNKNOWN until set up by the first sample
+        deviceStatisticsSampler deviceStatisticsSampler;
+        bool                    flagged; // at least one metric is flagged
+    } healthMonitor, *ptrHealthMonitor;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_Health_Monitor(ptrHealthMonitor monitor, uint32_t intervalSeconds)
+    //
+    //! \brief   Description: Sets up an empty monitor. Add metrics with add_Health_Monitor_Metric().
+    //
+    //  Entry:
+    //!   \param[out] monitor = monitor to set up
+    //!   \param[in] intervalSeconds = time between samples for is_Health_Monitor_Sample_Due().
+    //!   HEALTH_MONITOR_DEFAULT_INTERVAL_S is one hour
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_WO(1) OPENSEA_OPERATIONS_API void init_Health_Monitor(ptrHealthMonitor monitor, uint32_t intervalSeconds);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  add_Health_Monitor_Metric(ptrHealthMonitor monitor, eHealthMetricSource source, uint32_t id,
+    //                            const healthMetricPolicy *policy)
+    //
+    //! \brief   Description: Adds a metric to track. Adding a device statistic after the first sample sets up the
+    //!          device statistics sampler again on the next sample.
+    //
+    //  Entry:
+    //!   \param[in,out] monitor = monitor from init_Health_Monitor()
+    //!   \param[in] source = where the value comes from
+    //!   \param[in] id = attribute number, device statistic ID or eNVMeHealthField depending on the source
+    //!   \param[in] policy = when to flag the metric
+    //!
+    //  Exit:
+    //!   \return SUCCESS = added, FAILURE = already HEALTH_MONITOR_MAX_METRICS metrics, BAD_PARAMETER = invalid id
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 4)
+    M_PARAM_RW(1)
+    M_PARAM_RO(4)
+    OPENSEA_OPERATIONS_API eReturnValues add_Health_Monitor_Metric(ptrHealthMonitor          monitor,
+                                                                   eHealthMetricSource       source,
+                                                                   uint32_t                  id,
+                                                                   const healthMetricPolicy* policy);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  is_Health_Monitor_Sample_Due(const healthMonitor *monitor)
+    //
+    //! \brief   Description: Checks if intervalSeconds have passed since the last sample. Lets a caller poll many
+    //!          monitors and only send commands to the drives that are due.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from init_Health_Monitor()
+    //!
+    //  Exit:
+    //!   \return true = no sample yet or the interval has passed
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1) OPENSEA_OPERATIONS_API bool is_Health_Monitor_Sample_Due(const healthMonitor* monitor);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  sample_Health_Monitor(tDevice *device, ptrHealthMonitor monitor)
+    //
+    //! \brief   Description: Reads every tracked metric and updates the trends and flags. Each source is read at most
+    //!          once per sample: one SMART read for all attributes or NVMe health fields, the device statistics
+    //!          sampler for all device statistics, and the pending and grown lists only when tracked.
+    //
+    //  Entry:
+    //!   \param[in] device = device the monitor is for. Always use the same device with a monitor.
+    //!   \param[in,out] monitor = monitor from init_Health_Monitor()
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every source was read, otherwise the error from the first source that failed. Metrics from
+    //!   sources that failed are not valid for this sample and keep their history.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2) OPENSEA_OPERATIONS_API eReturnValues sample_Health_Monitor(tDevice* device, ptrHealthMonitor monitor);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Health_Monitor(const healthMonitor *monitor)
+    //
+    //! \brief   Description: Prints each metric's latest value, slope per day and estimated time to its threshold.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor that has been sampled
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1) OPENSEA_OPERATIONS_API void print_Health_Monitor(const healthMonitor* monitor);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_Health_Monitor(ptrHealthMonitor monitor)
+    //
+    //! \brief   Description: Frees the device statistics sampler and clears the monitor.
+    //
+    //  Entry:
+    //!   \param[in,out] monitor = monitor from init_Health_Monitor()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_Health_Monitor(ptrHealthMonitor monitor);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file incremental_logs.h
+// \brief This file defines the functions for collecting only the parts of device logs that changed since the last
+// sample.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+#include "log_bundle.h"
+#include "logs.h"
+#include "operations_Common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    // Every log is split into fixed size chunks and a fingerprint of each chunk is kept between samples. When a log is
+    // read again only the chunks whose fingerprint changed are written out, so a counter that ticks costs one chunk
+    // instead of the whole log. Logs that carry a generation number (such as the NVMe error information log's error
+    // count) are checked with a small read first and skipped entirely when the generation has not moved.
+#define INCREMENTAL_LOG_CHUNK_SIZE    (64)
+#define INCREMENTAL_LOG_STATE_VERSION (1)
+
+    // State file layout. All multi-byte fields are little endian.
+    //    0  signature "SEALOGST"
+    //    8  format version (2 bytes)
+    //   10  chunk size (2 bytes)
+    //   12  number of logs (4 bytes)
+    //   16  time of the last sample in milliseconds since the unix epoch (8 bytes)
+    //   24  number of samples taken (4 bytes)
+    //   28  reserved
+    //   32  serial number of the device the state belongs to (32 bytes, space padded)
+    //   64  logs: type (2), flags (2), log id (4), length (4), number of chunks (4), generation (8), then one 8 byte
+    //       fingerprint per chunk
+#define INCREMENTAL_LOG_STATE_SIGNATURE     "SEALOGST"
+#define INCREMENTAL_LOG_STATE_HEADER_LENGTH (64)
+#define INCREMENTAL_LOG_STATE_ENTRY_LENGTH  (24)
+
+    // Delta file layout. All multi-byte fields are little endian. A delta file is only created when something changed.
+    //    0  signature "SEALOGDL"
+    //    8  format version (2 bytes)
+    //   10  chunk size (2 bytes)
+    //   12  reserved
+    //   16  time of this sample in milliseconds since the unix epoch (8 bytes)
+    //   24  time of the previous sample (8 bytes). 0 when this is the first sample
+    //   32  records until the end of the file: type (2), flags (2), log id (4), length of the whole log (4), offset of
+    //       the changed bytes in the log (4), number of changed bytes (4), then the changed bytes
+#define INCREMENTAL_LOG_DELTA_SIGNATURE     "SEALOGDL"
+#define INCREMENTAL_LOG_DELTA_HEADER_LENGTH (32)
+#define INCREMENTAL_LOG_RECORD_LENGTH       (20)
+    // A baseline record holds the whole log. It is written the first time a log is seen or when its length changes.
+#define INCREMENTAL_LOG_RECORD_FLAG_BASELINE (UINT16_C(1))
+
+    // log id for ATA logs is (feature register << 8) | log address. Other types match eLogBundleEntryType.
+    typedef struct s_incrementalLogPageState
+    {
+        eLogBundleEntryType type;
+        uint32_t            logID;
+        uint32_t            length; // bytes in the log when it was last read
+        bool                hasGeneration;
+        uint64_t            generation;
+        uint32_t            numberOfChunks;
+        uint64_t*           chunkFingerprints;
+    } incrementalLogPageState, *ptrIncrementalLogPageState;
+
+    typedef struct s_incrementalLogState
+    {
+        char                       serialNumber[SERIAL_NUM_LEN + 1];
+        uint64_t                   lastSampleMilliseconds;
+        uint32_t                   sampleCount;
+        uint32_t                   numberOfLogs;
+        uint32_t                   logCapacity;
+        ptrIncrementalLogPageState logs;
+    } incrementalLogState, *ptrIncrementalLogState;
+
+    typedef struct s_incrementalLogStatistics
+    {
+        uint32_t logsChecked;
+        uint32_t logsSkippedByGeneration; // logs not read because their generation number did not change
+        uint32_t logsChanged;
+        uint32_t chunksChanged;
+        uint32_t commandsIssued;
+        uint64_t bytesRead;
+        uint64_t deltaBytesWritten;
+    } incrementalLogStatistics, *ptrIncrementalLogStatistics;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_Incremental_Log_State(ptrIncrementalLogState state)
+    //
+    //! \brief   Description: Frees the fingerprints held by an incremental log state and empties it. The next
+    //!          collection with it will be a full baseline.
+    //
+    //  Entry:
+    //!   \param[in] state = state to free
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_Incremental_Log_State(ptrIncrementalLogState state);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  load_Incremental_Log_State(const char *stateFileName, ptrIncrementalLogState state)
+    //
+    //! \brief   Description: Reads fingerprints saved by save_Incremental_Log_State(). The state is emptied first,
+    //!          so on any error it is left empty and the next collection is a full baseline.
+    //
+    //  Entry:
+    //!   \param[in] stateFileName = path to the state file
+    //!   \param[out] state = state to fill in. Free it with free_Incremental_Log_State() when done.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = loaded, FILE_OPEN_ERROR = no state file could be opened, FAILURE = not a state file or it
+    //!   is damaged, MEMORY_FAILURE = could not allocate the state
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_NULL_TERM_STRING(1)
+    M_PARAM_WO(2)
+    OPENSEA_OPERATIONS_API eReturnValues load_Incremental_Log_State(const char*            stateFileName,
+                                                                    ptrIncrementalLogState state);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  save_Incremental_Log_State(const char *stateFileName, ptrIncrementalLogState state)
+    //
+    //! \brief   Description: Writes the fingerprints from the last collection to a state file, replacing it.
+    //
+    //  Entry:
+    //!   \param[in] stateFileName = path to the state file
+    //!   \param[in] state = state to save
+    //!
+    //  Exit:
+    //!   \return SUCCESS = saved, FILE_OPEN_ERROR = could not create the file, ERROR_WRITING_FILE = write failed
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_NULL_TERM_STRING(1)
+    M_PARAM_RO(2)
+    OPENSEA_OPERATIONS_API eReturnValues save_Incremental_Log_State(const char*            stateFileName,
+                                                                    ptrIncrementalLogState state);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  collect_Incremental_Logs(tDevice *device, ptrATALogDirectories directories, ptrIncrementalLogState state,
+    //                           const char *deltaFilePath, ptrIncrementalLogStatistics statistics)
+    //
+    //! \brief   Description: Reads the device statistics and FARM logs (ATA), every supported log page (SCSI), or the
+    //!          error information and SMART/health logs (NVMe), compares them against the fingerprints in state and
+    //!          writes only the changed bytes to a new delta file. State is updated to this sample. If the state
+    //!          belongs to a different device it is discarded and this sample is written as a full baseline.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] directories = ATA log directories already read from this device, filled in as they are
+    //!   read. Keep one between samples so the log sizes are not read again. M_NULLPTR reads them every sample.
+    //!   \param[in,out] state = fingerprints from the previous sample. An empty state gives a full baseline.
+    //!   \param[in] deltaFilePath = directory to create the delta file in. M_NULLPTR for the current directory.
+    //!   \param[out] statistics = optional. Counts of what was read and written for this sample.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = sample collected (a delta file is only created when something changed), NOT_SUPPORTED =
+    //!   none of the logs could be read, otherwise an error writing the delta file
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_RW(3)
+    M_NULL_TERM_STRING(4)
+    M_PARAM_RO(4)
+    M_PARAM_WO(5)
+    OPENSEA_OPERATIONS_API eReturnValues collect_Incremental_Logs(tDevice*                    device,
+                                                                  ptrATALogDirectories        directories,
+                                                                  ptrIncrementalLogState      state,
+                                                                  const char*                 deltaFilePath,
+                                                                  ptrIncrementalLogStatistics statistics);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Incremental_Log_Statistics(ptrIncrementalLogStatistics statistics)
+    //
+    //! \brief   Description: Prints what an incremental collection read from the device and wrote out.
+    //
+    //  Entry:
+    //!   \param[in] statistics = statistics from collect_Incremental_Logs()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    OPENSEA_OPERATIONS_API void print_Incremental_Log_Statistics(ptrIncrementalLogStatistics statistics);
+
+#if defined(__cplusplus)
+}
+#endif
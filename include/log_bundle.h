@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_bundle.h
+// \brief This file defines the functions for collecting many device logs into a single indexed bundle file.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+#include "logs.h"
+#include "operations_Common.h"
+#include "secure_file.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    // Bundle file layout. All multi-byte fields are little endian.
+    //
+    //   header (LOG_BUNDLE_HEADER_LENGTH bytes at offset 0)
+    //       0  signature "SEALOGBN"
+    //       8  format version (2 bytes)
+    //      10  header length (2 bytes)
+    //      12  payload alignment (4 bytes)
+    //      16  creation time in milliseconds since the unix epoch (8 bytes)
+    //      24  reserved
+    //      32  serial number (32 bytes, space padded)
+    //      64  model number (48 bytes, space padded)
+    //     112  firmware revision (16 bytes, space padded)
+    //   payloads, each starting on a multiple of the payload alignment
+    //   table of contents, one LOG_BUNDLE_TOC_ENTRY_LENGTH entry per log
+    //       0  entry type (2 bytes, eLogBundleEntryType)
+    //       2  flags (2 bytes, LOG_BUNDLE_ENTRY_FLAG_*)
+    //       4  log id (4 bytes, see eLogBundleEntryType)
+    //       8  payload offset from the start of the file (8 bytes)
+    //      16  payload length (8 bytes)
+    //      24  CRC-32 of the payload (4 bytes)
+    //      28  capture result (4 bytes, eReturnValues)
+    //      32  capture time in milliseconds since the unix epoch (8 bytes)
+    //      40  capture duration in milliseconds (8 bytes)
+    //   trailer (LOG_BUNDLE_TRAILER_LENGTH bytes at the end of the file)
+    //       0  signature "SEALOGTC"
+    //       8  table of contents offset (8 bytes)
+    //      16  number of table of contents entries (4 bytes)
+    //      20  CRC-32 of the table of contents (4 bytes)
+    //      24  reserved
+    //
+    // The table of contents goes at the end so that the bundle can be written front to back in one pass. Readers
+    // find it through the fixed size trailer, then seek (or index into a memory map) directly to any payload.
+#define LOG_BUNDLE_SIGNATURE              "SEALOGBN"
+#define LOG_BUNDLE_TRAILER_SIGNATURE      "SEALOGTC"
+#define LOG_BUNDLE_SIGNATURE_LENGTH       (8)
+#define LOG_BUNDLE_FORMAT_VERSION         (1)
+#define LOG_BUNDLE_HEADER_LENGTH          (128)
+#define LOG_BUNDLE_TOC_ENTRY_LENGTH       (48)
+#define LOG_BUNDLE_TRAILER_LENGTH         (32)
+#define LOG_BUNDLE_DEFAULT_ALIGNMENT      (UINT32_C(4096))
+#define LOG_BUNDLE_ENTRY_FLAG_PARTIAL     (UINT16_C(1)) // capture stopped early. Payload has what was read before then
+#define LOG_BUNDLE_DEFAULT_TRANSFER_BYTES (UINT32_C(32) * UINT32_C(512))
+
+    typedef enum eLogBundleEntryTypeEnum
+    {
+        LOG_BUNDLE_ENTRY_ATA_GPL_LOG   = 1, // log id = log address
+        LOG_BUNDLE_ENTRY_ATA_SMART_LOG = 2, // log id = log address
+        LOG_BUNDLE_ENTRY_SCSI_LOG_PAGE = 3, // log id = (page code << 8) | subpage code
+        LOG_BUNDLE_ENTRY_NVME_LOG_PAGE = 4, // log id = log identifier
+        LOG_BUNDLE_ENTRY_TELEMETRY     = 5, // log id = 0 for current/host initiated, 1 for saved/controller initiated
+        LOG_BUNDLE_ENTRY_FARM_COMBINED = 6, // log id = 0
+        LOG_BUNDLE_ENTRY_VENDOR        = 0x8000, // log id defined by whoever added it
+    } eLogBundleEntryType;
+
+    typedef struct s_logBundleEntry
+    {
+        eLogBundleEntryType type;
+        uint16_t            flags;
+        uint32_t            logID;
+        uint64_t            offset;
+        uint64_t            length;
+        uint32_t            crc32;
+        eReturnValues       captureResult;
+        uint64_t            captureTimeMilliseconds;
+        uint64_t            captureDurationMilliseconds;
+    } logBundleEntry, *ptrLogBundleEntry;
+
+    typedef struct s_logBundle
+    {
+        secureFileInfo*   file;
+        uint32_t          alignment;
+        uint64_t          fileOffset; // number of bytes written to the file so far
+        uint32_t          numberOfEntries;
+        uint32_t          entryCapacity;
+        ptrLogBundleEntry entries;
+        bool              entryOpen; // an entry has been started and not yet ended
+        uint32_t          runningCRC;
+        uint64_t          entryStartMilliseconds;
+    } logBundle, *ptrLogBundle;
+
+#define LOG_BUNDLE_ATA_LOGS  BIT0 // every log in the GPL directory plus logs only in the SMART directory
+#define LOG_BUNDLE_SCSI_LOGS BIT1 // every page and subpage in the supported log pages list
+#define LOG_BUNDLE_NVME_LOGS BIT2 // standard NVMe log pages that report a size
+#define LOG_BUNDLE_ALL_LOGS  (LOG_BUNDLE_ATA_LOGS | LOG_BUNDLE_SCSI_LOGS | LOG_BUNDLE_NVME_LOGS)
+
+    //-----------------------------------------------------------------------------
+    //
+    //  open_Log_Bundle(tDevice *device, const char *filePath, uint32_t alignment, ptrLogBundle bundle)
+    //
+    //! \brief   Description: Creates a new bundle file named after the device and writes the bundle header. Add logs
+    //!          with add_Log_To_Bundle() or the begin/append/end functions, then call close_Log_Bundle() to write the
+    //!          table of contents.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure. Used for the file name and header.
+    //!   \param[in] filePath = directory to create the bundle in. M_NULLPTR for the current directory.
+    //!   \param[in] alignment = payload alignment in bytes. 0 uses LOG_BUNDLE_DEFAULT_ALIGNMENT. Must be a power of 2.
+    //!   \param[out] bundle = bundle state to initialize
+    //!
+    //  Exit:
+    //!   \return SUCCESS = bundle created, BAD_PARAMETER = bad alignment, otherwise an error opening or writing the
+    //!   file
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 4)
+    M_PARAM_RO(1)
+    M_NULL_TERM_STRING(2)
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API eReturnValues open_Log_Bundle(tDevice*     device,
+                                                         const char*  filePath,
+                                                         uint32_t     alignment,
+                                                         ptrLogBundle bundle);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  begin_Log_Bundle_Entry(ptrLogBundle bundle, eLogBundleEntryType type, uint32_t logID)
+    //
+    //! \brief   Description: Starts a new payload in the bundle. Pads the file up to the payload alignment, then any
+    //!          data given to append_Log_Bundle_Entry_Data() is written directly to the file so that a log never has
+    //!          to be held in memory all at once.
+    //
+    //  Entry:
+    //!   \param[in] bundle = bundle from open_Log_Bundle()
+    //!   \param[in] type = kind of log in this payload
+    //!   \param[in] logID = log identifier. Meaning depends on the type
+    //!
+    //  Exit:
+    //!   \return SUCCESS = entry started, BAD_PARAMETER = another entry is still open, otherwise an error writing
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1)
+    OPENSEA_OPERATIONS_API eReturnValues begin_Log_Bundle_Entry(ptrLogBundle        bundle,
+                                                                eLogBundleEntryType type,
+                                                                uint32_t            logID);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  append_Log_Bundle_Entry_Data(ptrLogBundle bundle, const uint8_t *data, uint32_t dataLength)
+    //
+    //! \brief   Description: Writes more of the current entry's payload to the bundle and updates its CRC.
+    //
+    //  Entry:
+    //!   \param[in] bundle = bundle with an entry started by begin_Log_Bundle_Entry()
+    //!   \param[in] data = log data to add
+    //!   \param[in] dataLength = number of bytes in data
+    //!
+    //  Exit:
+    //!   \return SUCCESS = written, BAD_PARAMETER = no entry is open, ERROR_WRITING_FILE = write failed
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO_SIZE(2, 3)
+    OPENSEA_OPERATIONS_API eReturnValues append_Log_Bundle_Entry_Data(ptrLogBundle   bundle,
+                                                                      const uint8_t* data,
+                                                                      uint32_t       dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  end_Log_Bundle_Entry(ptrLogBundle bundle, eReturnValues captureResult)
+    //
+    //! \brief   Description: Finishes the current entry and adds it to the table of contents. Entries are kept even
+    //!          when the capture failed part way through so that the data that was read is not lost. These are
+    //!          flagged with LOG_BUNDLE_ENTRY_FLAG_PARTIAL.
+    //
+    //  Entry:
+    //!   \param[in] bundle = bundle with an entry started by begin_Log_Bundle_Entry()
+    //!   \param[in] captureResult = SUCCESS if the whole log was read, otherwise the error that stopped it
+    //!
+    //  Exit:
+    //!   \return SUCCESS = entry added, BAD_PARAMETER = no entry is open, MEMORY_FAILURE = could not grow the table
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1)
+    OPENSEA_OPERATIONS_API eReturnValues end_Log_Bundle_Entry(ptrLogBundle bundle, eReturnValues captureResult);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  add_Log_To_Bundle(ptrLogBundle bundle, eLogBundleEntryType type, uint32_t logID, const uint8_t *data,
+    //                    uint32_t dataLength)
+    //
+    //! \brief   Description: Adds a log that is already in memory, such as a FARM combined log or telemetry pulled
+    //!          to a buffer, to the bundle as a single entry.
+    //
+    //  Entry:
+    //!   \param[in] bundle = bundle from open_Log_Bundle()
+    //!   \param[in] type = kind of log in this payload
+    //!   \param[in] logID = log identifier. Meaning depends on the type
+    //!   \param[in] data = log data
+    //!   \param[in] dataLength = number of bytes in data
+    //!
+    //  Exit:
+    //!   \return SUCCESS = added, otherwise see begin_Log_Bundle_Entry() and append_Log_Bundle_Entry_Data()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 4)
+    M_PARAM_RW(1)
+    M_PARAM_RO_SIZE(4, 5)
+    OPENSEA_OPERATIONS_API eReturnValues add_Log_To_Bundle(ptrLogBundle        bundle,
+                                                           eLogBundleEntryType type,
+                                                           uint32_t            logID,
+                                                           const uint8_t*      data,
+                                                           uint32_t            dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  close_Log_Bundle(ptrLogBundle bundle)
+    //
+    //! \brief   Description: Writes the table of contents and trailer, flushes and closes the bundle file, and frees
+    //!          the bundle state. An entry that is still open is ended as partial first.
+    //
+    //  Entry:
+    //!   \param[in] bundle = bundle from open_Log_Bundle()
+    //!
+    //  Exit:
+    //!   \return SUCCESS = bundle complete, otherwise an error writing the file
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1)
+    OPENSEA_OPERATIONS_API eReturnValues close_Log_Bundle(ptrLogBundle bundle);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  collect_Log_Bundle(tDevice *device, ptrATALogDirectories directories, const char *filePath,
+    //                     uint32_t logSelection, uint32_t transferSizeBytes)
+    //
+    //! \brief   Description: Pulls every supported log of the selected kinds from a device into one bundle file.
+    //!          ATA logs are read a transfer at a time straight into the bundle. The telemetry (24h/25h) and SCT
+    //!          (E0h/E1h) logs are skipped since reading them has side effects or needs a command first. Use
+    //!          pull_Telemetry_Log2() or pull_FARM_Combined_Log() to a buffer and add_Log_To_Bundle() for those.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] directories = ATA log directories already read from this device, filled in as they are
+    //!   read. M_NULLPTR reads them for this call only.
+    //!   \param[in] filePath = directory to create the bundle in. M_NULLPTR for the current directory.
+    //!   \param[in] logSelection = LOG_BUNDLE_* flags for which logs to collect. Kinds that do not apply to the
+    //!   device type are ignored.
+    //!   \param[in] transferSizeBytes = largest ATA read log transfer. 0 uses LOG_BUNDLE_DEFAULT_TRANSFER_BYTES, or
+    //!   one page at a time on USB and IEEE 1394. Must be a multiple of 512.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = bundle written with at least one log, NOT_SUPPORTED = nothing could be collected,
+    //!   otherwise an error creating or writing the bundle
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_NULL_TERM_STRING(3)
+    M_PARAM_RO(3)
+    OPENSEA_OPERATIONS_API eReturnValues collect_Log_Bundle(tDevice*             device,
+                                                            ptrATALogDirectories directories,
+                                                            const char*          filePath,
+                                                            uint32_t             logSelection,
+                                                            uint32_t             transferSizeBytes);
+
+#if defined(__cplusplus)
+}
+#endif
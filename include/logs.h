@@ -62,18 +62,86 @@ extern "C"
         const char* logExt   // optional /*extension for the log file. If NULL, set to .bin*/
     );
 
+    typedef enum eATALogDirectoryTypeEnum
+    {
+        ATA_LOG_DIRECTORY_GPL,   // directory read with read log ext
+        ATA_LOG_DIRECTORY_SMART, // directory read with SMART read log
+    } eATALogDirectoryType;
+
+    // The GPL and SMART log directories and the supported identify device data log pages read from one device. Each
+    // is read the first time it is needed and only kept when the read succeeded. This belongs to the caller, who
+    // decides how long it is reused, and must only be used with the device it was first used with. Call
+    // init_ATA_Log_Directories() again to have everything read from the drive again, such as after a firmware update.
+    typedef struct s_ataLogDirectories
+    {
+        eReturnValues gplDirectoryStatus; // SUCCESS once the directory has been read
+        eReturnValues smartDirectoryStatus;
+        eReturnValues idDataPagesStatus;
+        uint8_t       gplDirectory[ATA_LOG_PAGE_LEN_BYTES];
+        uint8_t       smartDirectory[ATA_LOG_PAGE_LEN_BYTES];
+        bool          idDataPages[UINT8_MAX + 1]; // indexed by identify device data log page number
+    } ataLogDirectories, *ptrATALogDirectories;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_ATA_Log_Directories(ptrATALogDirectories directories)
+    //
+    //! \brief   Description: Clear an ataLogDirectories structure so that nothing is read until it is needed.
+    //
+    //  Entry:
+    //!   \param[out] directories = structure to clear
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_WO(1) OPENSEA_OPERATIONS_API void init_ATA_Log_Directories(ptrATALogDirectories directories);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_ATA_Log_Directory(tDevice *device, ptrATALogDirectories directories, eATALogDirectoryType directory,
+    //                        uint8_t *directoryData, uint32_t dataSize)
+    //
+    //! \brief   Description: Get a copy of the GPL or SMART log directory (log 0h). When directories is provided,
+    //!          the directory is only read from the drive the first time, so later calls for the same device do not
+    //!          send any commands.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] directories = directories already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[in] directory = which directory to return
+    //!   \param[out] directoryData = buffer to copy the directory into
+    //!   \param[in] dataSize = size of directoryData. Must be at least ATA_LOG_PAGE_LEN_BYTES
+    //!
+    //  Exit:
+    //!   \return the result of reading the directory from the drive. NOT_SUPPORTED if the drive does not support GPL
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 4)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO_SIZE(4, 5)
+    OPENSEA_OPERATIONS_API eReturnValues get_ATA_Log_Directory(tDevice*             device,
+                                                               ptrATALogDirectories directories,
+                                                               eATALogDirectoryType directory,
+                                                               uint8_t*             directoryData,
+                                                               uint32_t             dataSize);
+
     //-----------------------------------------------------------------------------
     //
-    //  get_ATA_Log_Size(tDevice *device, uint8_t logAddress, uint32_t *logFileSize, bool gpl, bool smart)
+    //  get_ATA_Log_Size(tDevice *device, ptrATALogDirectories directories, uint8_t logAddress, uint32_t *logFileSize,
+    //                   bool gpl, bool smart)
     //
     //! \brief   Description: This function will check for the size of an ATA log as reported in the GPL or SMART
     //! directory.
     //           The size returned is in bytes.
     //           If a log is not supported, this function will return NOT_SUPPORTED and logfilesize will be set to zero.
-    //           TIP: Use this function to see if an ATA log is supported or not.
+    //           TIP: Use this function to see if an ATA log is supported or not. Pass the same directories for every
+    //           log checked on a device so that each directory is only read from the drive once.
     //
     //  Entry:
     //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] directories = directories already read from this device. M_NULLPTR reads the drive every time
     //!   \param[in] logAddress = GPL or SMART log address you wish to know the size of
     //!   \param[out] logFileSize = pointer to uint32_t that will hold the size of the log at the requested address in
     //!   bytes. Will be zero when log is not supported; \param[in] gpl = set to true to check for the log in the GPL
@@ -84,11 +152,39 @@ extern "C"
     //!   went wrong
     //
     //-----------------------------------------------------------------------------
-    M_NONNULL_PARAM_LIST(1, 3)
+    M_NONNULL_PARAM_LIST(1, 4)
     M_PARAM_RO(1)
-    M_PARAM_WO(3)
-    OPENSEA_OPERATIONS_API eReturnValues
-    get_ATA_Log_Size(tDevice* device, uint8_t logAddress, uint32_t* logFileSize, bool gpl, bool smart);
+    M_PARAM_RW(2)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API eReturnValues get_ATA_Log_Size(tDevice*             device,
+                                                          ptrATALogDirectories directories,
+                                                          uint8_t              logAddress,
+                                                          uint32_t*            logFileSize,
+                                                          bool                 gpl,
+                                                          bool                 smart);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  is_ATA_Identify_Data_Log_Page_Supported(tDevice *device, ptrATALogDirectories directories, uint8_t pageNumber)
+    //
+    //! \brief   Description: Check the supported page list of the identify device data log (30h) for a page. When
+    //!          directories is provided, the list is kept in it with the log directories.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] directories = directories already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[in] pageNumber = identify device data log page to look for
+    //!
+    //  Exit:
+    //!   \return true = page is supported, false = page, or the identify device data log, is not supported
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    OPENSEA_OPERATIONS_API bool is_ATA_Identify_Data_Log_Page_Supported(tDevice*             device,
+                                                                        ptrATALogDirectories directories,
+                                                                        uint8_t              pageNumber);
 
     //-----------------------------------------------------------------------------
     //
@@ -162,6 +258,8 @@ extern "C"
     //!   \param[in] filePath = pointer to the path where this log should be generated. Use M_NULLPTR for current
     //!   working directory. \param[in] featureRegister - this is the feature register for the command. default to zero
     //!   for most commands.
+    //!   When toBuffer is false the log is written with stream_ATA_Log_To_File so the whole log is never held in
+    //!   memory.
     //!
     //  Exit:
     //!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
@@ -231,6 +329,100 @@ extern "C"
                                                       uint32_t    bufSize,
                                                       const char* filePath);
 
+#define LOG_STREAM_DEFAULT_RING_SLOTS      (4)
+#define LOG_STREAM_MAX_RING_SLOTS          (16)
+#define LOG_STREAM_MIN_SCSI_TRANSFER_BYTES UINT32_C(512)
+// Chunk size get_SCSI_Log() uses when streaming a page to a file. Log sense allocation lengths are 16 bits.
+#define LOG_STREAM_DEFAULT_SCSI_TRANSFER_BYTES UINT32_C(32768)
+
+    //-----------------------------------------------------------------------------
+    //
+    //! stream_ATA_Log_To_File
+    //
+    //! \brief   Pull an ATA log to a file without holding the whole log in memory. Page groups are read into a small
+    //!          ring of buffers and the ring is written to the file each time it fills up, so memory use depends only
+    //!          on the transfer size and number of slots, not on the size of the log.
+    //!          Logs read from the SMART directory are still read in a single command since SMART read log has no
+    //!          page offset.
+    //
+    //  Entry:
+    //!   \param[in]  device - file descriptor
+    //!   \param[in]  logAddress - the address of the log you wish to pull
+    //!   \param[in]  logName - a string that is the name of the log (NO SPACES please! as this gets used for the
+    //!   filename
+    //!   \param[in]  fileExtension - a string for the file extension. You do not need to include a dot character.
+    //!   \param[in]  GPL - boolean flag specifying if you want to check the GPL directory for the log
+    //!   \param[in]  SMART - boolean flag specifying if you want to check the SMART directory for the log
+    //!   \param[in]  filePath - pointer to the path where this log should be generated. Use M_NULLPTR for current
+    //!   working directory.
+    //!   \param[in]  transferSizeBytes - size of each ring slot. Must be a multiple of 512. 0 picks a size based on
+    //!   the interface.
+    //!   \param[in]  featureRegister - this is the feature register for the command. default to zero for most logs.
+    //!   \param[in]  ringSlots - number of transfer sized slots in the ring. 0 uses LOG_STREAM_DEFAULT_RING_SLOTS.
+    //!   Values above LOG_STREAM_MAX_RING_SLOTS are limited to it.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    M_NULL_TERM_STRING(3)
+    M_PARAM_RO(3)
+    M_NULL_TERM_STRING(4)
+    M_PARAM_RO(4)
+    M_NULL_TERM_STRING(7)
+    M_PARAM_RO(7)
+    OPENSEA_OPERATIONS_API eReturnValues stream_ATA_Log_To_File(tDevice*    device,
+                                                                uint8_t     logAddress,
+                                                                const char* logName,
+                                                                const char* fileExtension,
+                                                                bool        GPL,
+                                                                bool        SMART,
+                                                                const char* filePath,
+                                                                uint32_t    transferSizeBytes,
+                                                                uint16_t    featureRegister,
+                                                                uint8_t     ringSlots);
+
+    //-----------------------------------------------------------------------------
+    //
+    //! stream_SCSI_Log_To_File
+    //
+    //! \brief   Pull a SCSI log page to a file in chunks no larger than transferSizeBytes. Each chunk is cut at the
+    //!          last complete log parameter and the next chunk is requested with the parameter pointer set to the
+    //!          following parameter code. If the device rejects or ignores the parameter pointer, or a single
+    //!          parameter does not fit in a chunk, the rest of the page is read in one command instead.
+    //
+    //  Entry:
+    //!   \param[in]  device - file descriptor
+    //!   \param[in]  logAddress - the address of the log you wish to pull
+    //!   \param[in]  subpage - set this to something other than zero if looking for a specific subpage to a log
+    //!   \param[in]  logName - a string that is the name of the log (NO SPACES please!)
+    //!   \param[in]  fileExtension - a string for the file extension. You do not need to include a dot character.
+    //!   \param[in]  filePath - string with path to output the file to. Can be M_NULLPTR for current directory.
+    //!   \param[in]  transferSizeBytes - largest read to issue. 0 reads the whole page at once. Otherwise must be at
+    //!   least LOG_STREAM_MIN_SCSI_TRANSFER_BYTES.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 4, 5)
+    M_PARAM_RO(1)
+    M_NULL_TERM_STRING(4)
+    M_PARAM_RO(4)
+    M_NULL_TERM_STRING(5)
+    M_PARAM_RO(5)
+    M_NULL_TERM_STRING(6)
+    M_PARAM_RO(6)
+    OPENSEA_OPERATIONS_API eReturnValues stream_SCSI_Log_To_File(tDevice*    device,
+                                                                 uint8_t     logAddress,
+                                                                 uint8_t     subpage,
+                                                                 const char* logName,
+                                                                 const char* fileExtension,
+                                                                 const char* filePath,
+                                                                 uint32_t    transferSizeBytes);
+
     //-----------------------------------------------------------------------------
     //
     //! get_SCSI_VPD(tDevice *device, uint8_t pageCode, const char *logName, const char *fileExtension, bool toBuffer,
@@ -356,6 +548,74 @@ extern "C"
                                                             const char* filePath,
                                                             uint32_t    transferSizeBytes);
 
+#define TELEMETRY_PULL_MIN_AUTO_TRANSFER_BYTES UINT32_C(4096)
+#define TELEMETRY_PULL_MAX_AUTO_TRANSFER_BYTES UINT32_C(1048576)
+
+    typedef struct s_telemetryPullStatistics
+    {
+        uint32_t transferSizeBytes; // transfer size used for the data area after the header page
+        uint32_t readCommands;      // includes any retries at a smaller transfer size
+        uint64_t bytesPulled;       // data area bytes, not including the header page
+        uint64_t triggerTimeNS;     // creating the snapshot and reading the header page
+        uint64_t deviceReadTimeNS;
+        uint64_t fileWriteTimeNS;
+        uint64_t fileFlushTimeNS;
+        uint64_t totalTimeNS;
+    } telemetryPullStatistics, *ptrTelemetryPullStatistics;
+
+#define TELEMETRY_PULL_OPTIONS_VERSION (1)
+
+    typedef struct s_telemetryPullOptions
+    {
+        size_t                  size;    // sizeof(telemetryPullOptions)
+        uint32_t                version; // TELEMETRY_PULL_OPTIONS_VERSION
+        bool                    currentOrSaved;
+        uint8_t                 islDataSet;
+        bool                    saveToFile;
+        uint8_t*                ptrData; // required when saveToFile is false
+        uint32_t                dataSize;
+        const char*             filePath;
+        uint32_t                transferSizeBytes;  // 0 = automatic. Largest size the device/path accepts
+        uint32_t                flushIntervalBytes; // 0 = only flush the file when the pull is complete
+        telemetryPullStatistics statistics;         // output: per phase timing
+    } telemetryPullOptions, *ptrTelemetryPullOptions;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  pull_Telemetry_Log2()
+    //
+    //! \brief   Description:  Same as pull_Telemetry_Log, but takes an options structure that also allows automatic
+    //! transfer size selection, controlling how often the output file is flushed, and returns per phase timing.
+    //
+    //  Entry:
+    //!   \param[in] device - pointer to the device structure
+    //!   \param[in,out] options - pull options. See telemetryPullOptions. statistics is filled in on return
+    //!
+    //  Exit:
+    //!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    OPENSEA_OPERATIONS_API eReturnValues pull_Telemetry_Log2(tDevice* device, ptrTelemetryPullOptions options);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Telemetry_Pull_Statistics()
+    //
+    //! \brief   Description:  Print the per phase timing from pull_Telemetry_Log2
+    //
+    //  Entry:
+    //!   \param[in] statistics - statistics from the telemetryPullOptions structure
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    OPENSEA_OPERATIONS_API void print_Telemetry_Pull_Statistics(ptrTelemetryPullStatistics statistics);
+
     //-----------------------------------------------------------------------------
     //
     //! get_Pending_Defect_List( tDevice * device )
@@ -877,6 +1137,393 @@ extern "C"
                                                             const char*          filePath,
                                                             bool*                used6ByteCmd);
 
+#define SCSI_MODE_PAGE_CACHE_ENTRIES    (32)
+#define SCSI_MODE_PAGE_CACHE_MAX_LENGTH (1024) // mode parameter header and page. Larger pages are not cached.
+
+    typedef struct s_scsiModePageCacheEntry
+    {
+        bool                 valid;
+        uint8_t              modePage;
+        uint8_t              subpage;
+        eScsiModePageControl mpc;
+        uint32_t             lastUsed;
+        uint32_t             length;
+        uint8_t*             modeData; // mode parameter header and page
+    } scsiModePageCacheEntry;
+
+    // Changeable and default mode pages read with MODE SENSE (10) and block descriptors disabled. These only change
+    // with firmware, so a read-modify-write sequence that checks the changeable values first only has to read them
+    // once. Current and saved values are always read from the device since other hosts and the device itself can
+    // change them. This belongs to the caller, who decides how long it is kept, and must only be used with the device
+    // it was first used with. Call invalidate_SCSI_Mode_Page_Cache() after a firmware update or anything else outside
+    // of cached_SCSI_Mode_Select_10() that changes mode pages.
+    typedef struct s_scsiModePageCache
+    {
+        uint32_t               useCounter; // for evicting the least recently used page
+        scsiModePageCacheEntry entries[SCSI_MODE_PAGE_CACHE_ENTRIES];
+    } scsiModePageCache, *ptrSCSIModePageCache;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache)
+    //
+    //! \brief   Description: Sets up an empty mode page cache.
+    //
+    //  Entry:
+    //!   \param[out] cache = cache to set up. Free with free_SCSI_Mode_Page_Cache()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_WO(1) OPENSEA_OPERATIONS_API void init_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  invalidate_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache)
+    //
+    //! \brief   Description: Drops every page in the cache so the cache can still be used. Call this after anything
+    //!          that can change mode pages outside of this library, such as a firmware update or another host
+    //!          changing settings.
+    //
+    //  Entry:
+    //!   \param[in,out] cache = cache to empty
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void invalidate_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache)
+    //
+    //! \brief   Description: Frees every page in the cache and clears it.
+    //
+    //  Entry:
+    //!   \param[in,out] cache = cache from init_SCSI_Mode_Page_Cache()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  cached_SCSI_Mode_Sense_10(tDevice *device, ptrSCSIModePageCache cache, uint8_t pageCode,
+    //                            uint32_t allocationLength, uint8_t subPageCode, bool DBD, bool LLBAA,
+    //                            eScsiModePageControl pageControl, uint8_t *ptrData)
+    //
+    //! \brief   Description: Same as scsi_Mode_Sense_10(), but changeable and default values read with block
+    //!          descriptors disabled are kept in the cache and later requests are answered from that copy. Current
+    //!          and saved values are always read from the device. Only pages that were read successfully are kept.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] cache = mode pages already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[in] pageCode = mode page to read
+    //!   \param[in] allocationLength = size of ptrData
+    //!   \param[in] subPageCode = mode subpage to read
+    //!   \param[in] DBD = disable block descriptors. Only requests with this set are cached.
+    //!   \param[in] LLBAA = long LBA accepted. Requests with this set are not cached.
+    //!   \param[in] pageControl = which values to read
+    //!   \param[out] ptrData = buffer to fill with the mode parameter header and page
+    //!
+    //  Exit:
+    //!   \return same as scsi_Mode_Sense_10()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 9)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO_SIZE(9, 4)
+    OPENSEA_OPERATIONS_API eReturnValues cached_SCSI_Mode_Sense_10(tDevice*             device,
+                                                                   ptrSCSIModePageCache cache,
+                                                                   uint8_t              pageCode,
+                                                                   uint32_t             allocationLength,
+                                                                   uint8_t              subPageCode,
+                                                                   bool                 DBD,
+                                                                   bool                 LLBAA,
+                                                                   eScsiModePageControl pageControl,
+                                                                   uint8_t*             ptrData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  cached_SCSI_Mode_Select_10(tDevice *device, ptrSCSIModePageCache cache, uint16_t parameterListLength,
+    //                             bool pageFormat, bool savePages, bool resetToDefaults, uint8_t *ptrData,
+    //                             uint32_t dataSize)
+    //
+    //! \brief   Description: Same as scsi_Mode_Select_10(), then on success drops the cached copies of the pages
+    //!          that were sent so they are read from the device again. Resetting to defaults or a failure drops
+    //!          everything in the cache.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] cache = mode pages already read from this device. M_NULLPTR when nothing is cached
+    //!   \param[in] parameterListLength = length of the mode parameter list
+    //!   \param[in] pageFormat = set the PF bit
+    //!   \param[in] savePages = set the SP bit
+    //!   \param[in] resetToDefaults = set the RTD bit
+    //!   \param[in] ptrData = mode parameter list to send
+    //!   \param[in] dataSize = size of ptrData
+    //!
+    //  Exit:
+    //!   \return same as scsi_Mode_Select_10()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_RO_SIZE(7, 8)
+    OPENSEA_OPERATIONS_API eReturnValues cached_SCSI_Mode_Select_10(tDevice*             device,
+                                                                    ptrSCSIModePageCache cache,
+                                                                    uint16_t             parameterListLength,
+                                                                    bool                 pageFormat,
+                                                                    bool                 savePages,
+                                                                    bool                 resetToDefaults,
+                                                                    uint8_t*             ptrData,
+                                                                    uint32_t             dataSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  invalidate_SCSI_Mode_Pages(ptrSCSIModePageCache cache, const uint8_t *modeSelectData, uint32_t dataSize,
+    //                             bool sixByteHeader)
+    //
+    //! \brief   Description: Drops the cached copies of the pages in a parameter list that was just sent with a MODE
+    //!          SELECT command that did not go through cached_SCSI_Mode_Select_10(), such as MODE SELECT (6).
+    //
+    //  Entry:
+    //!   \param[in,out] cache = mode pages already read from the device the parameter list was sent to
+    //!   \param[in] modeSelectData = mode parameter list that was sent
+    //!   \param[in] dataSize = length of the mode parameter list
+    //!   \param[in] sixByteHeader = true if the list starts with a MODE SELECT (6) header
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO_SIZE(2, 3)
+    OPENSEA_OPERATIONS_API void invalidate_SCSI_Mode_Pages(ptrSCSIModePageCache cache,
+                                                           const uint8_t*       modeSelectData,
+                                                           uint32_t             dataSize,
+                                                           bool                 sixByteHeader);
+
+#define LOG_PAGE_CACHE_ENTRIES            (64)
+#define LOG_PAGE_CACHE_DEFAULT_MAX_AGE_MS (5000)
+#define LOG_PAGE_CACHE_NO_EXPIRATION      (0) // pages are kept until the cache is invalidated or freed
+
+    typedef enum eLogPageCacheSourceEnum
+    {
+        LOG_PAGE_CACHE_ATA_LOG,
+        LOG_PAGE_CACHE_ATA_LOG_PAGE, // one page of a GPL log
+        LOG_PAGE_CACHE_ATA_SMART_READ_DATA,
+        LOG_PAGE_CACHE_SCSI_LOG_SENSE,
+    } eLogPageCacheSource;
+
+    typedef struct s_logPageCacheEntry
+    {
+        bool                valid;
+        eLogPageCacheSource source;
+        uint8_t             page; // ATA log address or SCSI page code
+        uint8_t             subpage;
+        uint16_t            parameterPointer; // or the page number of one page of a GPL log
+        uint32_t            lastUsed;
+        uint64_t            readMilliseconds;
+        uint32_t            length;
+        uint8_t*            data;
+    } logPageCacheEntry;
+
+    // Log pages read from one device, so that reading drive information and device statistics together reads each
+    // page once. Unlike identify data these change as the device runs, so a page is only reused for as long as the
+    // caller allows. SCSI pages are kept per parameter pointer since drive information reads single parameters while
+    // device statistics read whole pages. This belongs to the caller, who decides how long it is kept and when it is
+    // invalidated, and must only be used with the device it was first used with. Nothing in this library invalidates
+    // it, so call invalidate_Log_Page_Cache() after resetting statistics, changing SMART settings, or anything else
+    // that is known to change log pages. The ATA log directories do not change as the device runs, so they are kept
+    // until the cache is set up again.
+    typedef struct s_logPageCache
+    {
+        uint32_t          maxAgeMilliseconds;
+        uint32_t          useCounter; // for evicting the least recently used page
+        logPageCacheEntry entries[LOG_PAGE_CACHE_ENTRIES];
+        ataLogDirectories directories; // pass &directories to anything else checking ATA log sizes on this device
+    } logPageCache, *ptrLogPageCache;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_Log_Page_Cache(ptrLogPageCache cache, uint32_t maxAgeMilliseconds)
+    //
+    //! \brief   Description: Sets up an empty log page cache.
+    //
+    //  Entry:
+    //!   \param[out] cache = cache to set up. Free with free_Log_Page_Cache()
+    //!   \param[in] maxAgeMilliseconds = how long a page may be reused. LOG_PAGE_CACHE_NO_EXPIRATION to keep pages
+    //!   until the cache is invalidated or freed
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_WO(1) OPENSEA_OPERATIONS_API void init_Log_Page_Cache(ptrLogPageCache cache, uint32_t maxAgeMilliseconds);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  invalidate_Log_Page_Cache(ptrLogPageCache cache)
+    //
+    //! \brief   Description: Drops every page in the cache, keeping the age limit and the ATA log directories so the
+    //!          cache can still be used.
+    //
+    //  Entry:
+    //!   \param[in,out] cache = cache to empty
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void invalidate_Log_Page_Cache(ptrLogPageCache cache);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_Log_Page_Cache(ptrLogPageCache cache)
+    //
+    //! \brief   Description: Frees every page in the cache and clears it.
+    //
+    //  Entry:
+    //!   \param[in,out] cache = cache from init_Log_Page_Cache()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void free_Log_Page_Cache(ptrLogPageCache cache);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  cached_ATA_Get_Log(tDevice *device, ptrLogPageCache cache, uint8_t logAddress, bool GPL, bool SMART,
+    //                     uint8_t *ptrData, uint32_t dataSize)
+    //
+    //! \brief   Description: Same as get_ATA_Log() reading a whole log to a buffer, answered from the cache when it
+    //!          holds a young enough copy of the log.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] cache = log pages already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[in] logAddress = log to read
+    //!   \param[in] GPL = check the GPL directory for the log
+    //!   \param[in] SMART = check the SMART directory for the log
+    //!   \param[out] ptrData = buffer to fill
+    //!   \param[in] dataSize = size of ptrData
+    //!
+    //  Exit:
+    //!   \return same as get_ATA_Log()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 6)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO_SIZE(6, 7)
+    OPENSEA_OPERATIONS_API eReturnValues cached_ATA_Get_Log(tDevice*        device,
+                                                            ptrLogPageCache cache,
+                                                            uint8_t         logAddress,
+                                                            bool            GPL,
+                                                            bool            SMART,
+                                                            uint8_t*        ptrData,
+                                                            uint32_t        dataSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  cached_ATA_Read_Log_Ext_Page(tDevice *device, ptrLogPageCache cache, uint8_t logAddress, uint16_t pageNumber,
+    //                               uint8_t *ptrData, uint32_t dataSize)
+    //
+    //! \brief   Description: Reads one 512 byte page of a GPL log with READ LOG EXT, answered from the cache when it
+    //!          holds a young enough copy of that page or of the whole log.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] cache = log pages already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[in] logAddress = log to read
+    //!   \param[in] pageNumber = page of the log to read
+    //!   \param[out] ptrData = buffer to fill
+    //!   \param[in] dataSize = size of ptrData. Must be at least ATA_LOG_PAGE_LEN_BYTES
+    //!
+    //  Exit:
+    //!   \return SUCCESS on success, BAD_PARAMETER if ptrData is too small, otherwise same as
+    //!   send_ATA_Read_Log_Ext_Cmd()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 5)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO_SIZE(5, 6)
+    OPENSEA_OPERATIONS_API eReturnValues cached_ATA_Read_Log_Ext_Page(tDevice*        device,
+                                                                      ptrLogPageCache cache,
+                                                                      uint8_t         logAddress,
+                                                                      uint16_t        pageNumber,
+                                                                      uint8_t*        ptrData,
+                                                                      uint32_t        dataSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  cached_ATA_SMART_Read_Data(tDevice *device, ptrLogPageCache cache, uint8_t *ptrData, uint32_t dataSize)
+    //
+    //! \brief   Description: Same as ata_SMART_Read_Data(), answered from the cache when it holds a young enough copy.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] cache = log pages already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[out] ptrData = buffer to fill
+    //!   \param[in] dataSize = size of ptrData
+    //!
+    //  Exit:
+    //!   \return same as ata_SMART_Read_Data()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO_SIZE(3, 4)
+    OPENSEA_OPERATIONS_API eReturnValues cached_ATA_SMART_Read_Data(tDevice*        device,
+                                                                    ptrLogPageCache cache,
+                                                                    uint8_t*        ptrData,
+                                                                    uint32_t        dataSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  cached_SCSI_Log_Sense(tDevice *device, ptrLogPageCache cache, uint8_t pageCode, uint8_t subpageCode,
+    //                        uint16_t parameterPointer, uint8_t *ptrData, uint16_t dataSize)
+    //
+    //! \brief   Description: Same as scsi_Log_Sense_Cmd() reading cumulative values without saving parameters,
+    //!          answered from the cache when it holds a young enough copy of the page. A request with a parameter
+    //!          pointer can be answered from a complete copy of the page read with a lower one.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] cache = log pages already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[in] pageCode = log page to read
+    //!   \param[in] subpageCode = log subpage to read
+    //!   \param[in] parameterPointer = first parameter code to return
+    //!   \param[out] ptrData = buffer to fill
+    //!   \param[in] dataSize = allocation length
+    //!
+    //  Exit:
+    //!   \return same as scsi_Log_Sense_Cmd()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 6)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO_SIZE(6, 7)
+    OPENSEA_OPERATIONS_API eReturnValues cached_SCSI_Log_Sense(tDevice*        device,
+                                                               ptrLogPageCache cache,
+                                                               uint8_t         pageCode,
+                                                               uint8_t         subpageCode,
+                                                               uint16_t        parameterPointer,
+                                                               uint8_t*        ptrData,
+                                                               uint16_t        dataSize);
+
     typedef struct s_ModifyScsiBlkDescFields
     {
         uint64_t numberOfLogicalBlocks;
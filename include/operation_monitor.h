@@ -0,0 +1,321 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file operation_monitor.h
+// \brief This file defines the functions for tracking long running operations (sanitize, DST, format) on many devices
+// from a single thread.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+#include "dst.h"
+#include "format.h"
+#include "operations_Common.h"
+#include "sanitize.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// The monitor schedules progress polls on a hashed timer wheel. Each slot covers one tick. Polls that are further out
+// than one revolution of the wheel stay in their slot and are skipped until their tick comes around.
+#define OPERATION_MONITOR_WHEEL_SLOTS               (64)
+#define OPERATION_MONITOR_TICK_MILLISECONDS         (UINT32_C(1000))
+#define OPERATION_MONITOR_DEFAULT_POLL_MILLISECONDS (UINT32_C(5000))
+#define OPERATION_MONITOR_MAX_CONSECUTIVE_ERRORS    (UINT32_C(5))
+#define OPERATION_MONITOR_INVALID_INDEX             (UINT32_MAX)
+
+    typedef enum eMonitoredOperationEnum
+    {
+        MONITORED_OPERATION_SANITIZE,
+        MONITORED_OPERATION_DST,
+        MONITORED_OPERATION_FORMAT_UNIT, // SCSI format unit
+        MONITORED_OPERATION_NVM_FORMAT,  // NVMe format NVM
+    } eMonitoredOperation;
+
+    typedef enum eMonitoredOperationStateEnum
+    {
+        MONITORED_OPERATION_STATE_IN_PROGRESS,
+        MONITORED_OPERATION_STATE_COMPLETE, // device reports the operation finished without error
+        MONITORED_OPERATION_STATE_FAILED,   // device reports the operation finished with an error
+        MONITORED_OPERATION_STATE_ABORTED,  // DST only. Aborted by the host or a reset
+        MONITORED_OPERATION_STATE_ERROR, // progress could not be read from the device after several attempts. Check
+                                         // lastResult for the error from the most recent attempt.
+    } eMonitoredOperationState;
+
+    typedef struct s_monitoredOperation
+    {
+        tDevice*                 device;
+        eMonitoredOperation      operation;
+        eMonitoredOperationState state;
+        eReturnValues            lastResult; // result from the start command or most recent progress request
+        double                   percentComplete;
+        uint8_t  deviceStatus; // DST: self-test execution status nibble. Sanitize: eSanitizeStatus. Format: sense ASC
+        uint32_t pollIntervalMilliseconds;
+        uint32_t pollCount;
+        uint32_t consecutiveErrors;
+        uint64_t startTimeMilliseconds; // since unix epoch
+        uint64_t lastPollTimeMilliseconds;
+        uint64_t endTimeMilliseconds; // zero while the operation is in progress
+        // Timer wheel bookkeeping. Do not modify these.
+        uint64_t nextPollTick;
+        uint32_t nextInSlot;
+    } monitoredOperation, *ptrMonitoredOperation;
+
+    typedef struct s_operationMonitor
+    {
+        uint32_t maxOperations;
+        uint32_t numberOfOperations; // number of entries in operation[] that are in use
+        uint32_t activeOperations;   // number of entries still in progress
+        uint32_t maxConsecutiveErrors;
+        uint64_t lastServicedTick;
+        uint32_t wheel[OPERATION_MONITOR_WHEEL_SLOTS]; // index of first operation in each slot
+        monitoredOperation operation[1]; // ANYSIZE ARRAY. Allocated with new_Operation_Monitor()
+    } operationMonitor, *ptrOperationMonitor;
+
+    static M_INLINE void safe_free_operation_monitor(operationMonitor** monitor)
+    {
+        safe_free_core(M_REINTERPRET_CAST(void**, monitor));
+    }
+
+    // Called by the monitor when an operation leaves the in progress state.
+    typedef void (*operationMonitorCompletion)(ptrMonitoredOperation operation, void* completionData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  new_Operation_Monitor(uint32_t maxOperations)
+    //
+    //! \brief   Description: Allocates a monitor that can track up to maxOperations long running operations at once.
+    //!          Free it with safe_free_operation_monitor() when done. The monitor does not own the devices.
+    //
+    //  Entry:
+    //!   \param[in] maxOperations = maximum number of operations that will be added to the monitor
+    //!
+    //  Exit:
+    //!   \return pointer to the new monitor or M_NULLPTR if it could not be allocated
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API ptrOperationMonitor new_Operation_Monitor(uint32_t maxOperations);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  add_Operation_To_Monitor()
+    //
+    //! \brief   Description: Adds an operation that has already been started (for example by calling run_DST() with
+    //!          pollForProgress set to false) to the monitor.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!   \param[in] device = device the operation is running on. Must stay open while it is in the monitor.
+    //!   \param[in] operation = which operation is running
+    //!   \param[in] pollIntervalMilliseconds = how often to check progress. 0 uses
+    //!   OPERATION_MONITOR_DEFAULT_POLL_MILLISECONDS. Rounded up to OPERATION_MONITOR_TICK_MILLISECONDS.
+    //!   \param[out] index = optional. Set to the index of this operation in monitor->operation[]
+    //!
+    //  Exit:
+    //!   \return SUCCESS = added, MEMORY_FAILURE = monitor is full, BAD_PARAMETER = invalid input
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(5)
+    OPENSEA_OPERATIONS_API eReturnValues add_Operation_To_Monitor(ptrOperationMonitor monitor,
+                                                                  tDevice*            device,
+                                                                  eMonitoredOperation operation,
+                                                                  uint32_t            pollIntervalMilliseconds,
+                                                                  uint32_t*           index);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  start_Monitored_Sanitize()
+    //
+    //! \brief   Description: Starts a sanitize erase without waiting for it (pollForProgress is forced to false) and
+    //!          adds it to the monitor. A sanitize that is already in progress is also added.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!   \param[in] device = device to sanitize
+    //!   \param[in] sanitizeOptions = same options as run_Sanitize_Operation2()
+    //!   \param[out] index = optional. Set to the index of this operation in monitor->operation[]
+    //!
+    //  Exit:
+    //!   \return SUCCESS = started and added to the monitor, otherwise the error from run_Sanitize_Operation2()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API eReturnValues start_Monitored_Sanitize(ptrOperationMonitor      monitor,
+                                                                  tDevice*                 device,
+                                                                  sanitizeOperationOptions sanitizeOptions,
+                                                                  uint32_t*                index);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  start_Monitored_DST()
+    //
+    //! \brief   Description: Starts an offline DST and adds it to the monitor.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!   \param[in] device = device to run the self test on
+    //!   \param[in] DSTType = short, long, or conveyence
+    //!   \param[out] index = optional. Set to the index of this operation in monitor->operation[]
+    //!
+    //  Exit:
+    //!   \return SUCCESS = started and added to the monitor, otherwise the error from run_DST()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API eReturnValues start_Monitored_DST(ptrOperationMonitor monitor,
+                                                             tDevice*            device,
+                                                             eDSTType            DSTType,
+                                                             uint32_t*           index);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  start_Monitored_Format_Unit()
+    //
+    //! \brief   Description: Starts a SCSI format unit with the immediate bit set and adds it to the monitor.
+    //!          disableImmediate in formatParameters is ignored.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!   \param[in] device = device to format
+    //!   \param[in] formatParameters = same parameters as run_Format_Unit()
+    //!   \param[out] index = optional. Set to the index of this operation in monitor->operation[]
+    //!
+    //  Exit:
+    //!   \return SUCCESS = started and added to the monitor, otherwise the error from run_Format_Unit()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API eReturnValues start_Monitored_Format_Unit(ptrOperationMonitor     monitor,
+                                                                     tDevice*                device,
+                                                                     runFormatUnitParameters formatParameters,
+                                                                     uint32_t*               index);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  start_Monitored_NVM_Format()
+    //
+    //! \brief   Description: Starts an NVMe format and adds it to the monitor.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!   \param[in] device = device to format
+    //!   \param[in] nvmParams = same parameters as run_NVMe_Format()
+    //!   \param[out] index = optional. Set to the index of this operation in monitor->operation[]
+    //!
+    //  Exit:
+    //!   \return SUCCESS = started and added to the monitor, otherwise the error from run_NVMe_Format()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API eReturnValues start_Monitored_NVM_Format(ptrOperationMonitor    monitor,
+                                                                    tDevice*               device,
+                                                                    runNVMFormatParameters nvmParams,
+                                                                    uint32_t*              index);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  service_Operation_Monitor()
+    //
+    //! \brief   Description: Polls progress on every operation whose poll time has arrived. Does not sleep.
+    //!          Call this periodically from an application's own event loop, or use run_Operation_Monitor().
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!   \param[in] completion = optional. Called once for each operation that leaves the in progress state
+    //!   \param[in] completionData = optional. Passed to completion
+    //!
+    //  Exit:
+    //!   \return IN_PROGRESS = operations are still running, SUCCESS = every operation has finished (check each
+    //!   operation's state for its result)
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1)
+    OPENSEA_OPERATIONS_API eReturnValues service_Operation_Monitor(ptrOperationMonitor        monitor,
+                                                                   operationMonitorCompletion completion,
+                                                                   void*                      completionData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Operation_Monitor_Wait_Time()
+    //
+    //! \brief   Description: Returns the number of milliseconds until the next operation needs to be polled so that
+    //!          an event loop knows how long it can sleep.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!
+    //  Exit:
+    //!   \return milliseconds until the next poll. 0 if a poll is due now. UINT32_MAX if nothing is in progress.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1) OPENSEA_OPERATIONS_API uint32_t get_Operation_Monitor_Wait_Time(ptrOperationMonitor monitor);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  run_Operation_Monitor()
+    //
+    //! \brief   Description: Services the monitor and sleeps between polls until every operation has finished.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!   \param[in] completion = optional. Called once for each operation that leaves the in progress state
+    //!   \param[in] completionData = optional. Passed to completion
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every operation completed without error, FAILURE = at least one operation failed, was
+    //!   aborted, or its progress could not be read
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1)
+    OPENSEA_OPERATIONS_API eReturnValues run_Operation_Monitor(ptrOperationMonitor        monitor,
+                                                               operationMonitorCompletion completion,
+                                                               void*                      completionData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Operation_Monitor_Progress()
+    //
+    //! \brief   Description: Prints one line per operation with the device, operation, state and percent complete.
+    //
+    //  Entry:
+    //!   \param[in] monitor = monitor from new_Operation_Monitor()
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1) OPENSEA_OPERATIONS_API void print_Operation_Monitor_Progress(ptrOperationMonitor monitor);
+
+#if defined(__cplusplus)
+}
+#endif
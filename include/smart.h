@@ -16,6 +16,7 @@
 #pragma once
 
 #include "ata_helper.h"
+#include "logs.h"
 #include "operations_Common.h"
 
 #if defined(__cplusplus)
@@ -66,11 +67,79 @@ extern "C"
     M_PARAM_RO(1)
     M_PARAM_WO(2) OPENSEA_OPERATIONS_API eReturnValues get_SMART_Attributes(tDevice* device, smartLogData* smartAttrs);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SMART_Attributes_Cached(tDevice *device, ptrLogPageCache logCache, smartLogData *smartAttrs)
+    //
+    //! \brief   Description: Same as get_SMART_Attributes(), reading the ATA SMART data through a log page cache so a
+    //!          report that also reads drive information or runs a SMART check reads it once.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] logCache = log pages already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[out] smartAttrs = structure that holds the attributes
+    //!
+    //  Exit:
+    //!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    OPENSEA_OPERATIONS_API eReturnValues get_SMART_Attributes_Cached(tDevice*        device,
+                                                                     ptrLogPageCache logCache,
+                                                                     smartLogData*   smartAttrs);
+
     M_NONNULL_PARAM_LIST(1, 3)
     M_PARAM_RO(1)
     M_PARAM_WO(3)
     OPENSEA_OPERATIONS_API void get_Attribute_Name(tDevice* device, uint8_t attributeNumber, char** attributeName);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SMART_Attribute_Name(tDevice *device, uint8_t attributeNumber)
+    //
+    //! \brief   Description: Looks up the name of an ATA SMART attribute for this drive's family. Names are in
+    //!          constant tables, so this does not copy anything, but it looks up the drive family on every call. Use
+    //!          get_SMART_Attribute_Name_Table() once and get_SMART_Attribute_Name_From_Table() in loops.
+    //
+    //  Entry:
+    //!   \param[in] device = device the attribute came from
+    //!   \param[in] attributeNumber = attribute to name
+    //!
+    //  Exit:
+    //!   \return the name, or an empty string when the attribute has no name for this family. Never M_NULLPTR.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    OPENSEA_OPERATIONS_API const char* get_SMART_Attribute_Name(tDevice* device, uint8_t attributeNumber);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SMART_Attribute_Name_Table(eSeagateFamily family)
+    //
+    //! \brief   Description: Gets the constant table of ATA SMART attribute names for a drive family, so a caller
+    //!          naming many attributes compares the model and vendor strings with is_Seagate_Family() only once.
+    //
+    //  Entry:
+    //!   \param[in] family = drive family from is_Seagate_Family()
+    //!
+    //  Exit:
+    //!   \return table indexed by attribute number with UINT8_MAX + 1 entries. Entries for attributes without a name
+    //!   for this family are M_NULLPTR.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API const char* const* get_SMART_Attribute_Name_Table(eSeagateFamily family);
+
+    // Name of an attribute from get_SMART_Attribute_Name_Table(), or an empty string when it has none
+    static M_INLINE const char* get_SMART_Attribute_Name_From_Table(const char* const* attributeNames,
+                                                                    uint8_t            attributeNumber)
+    {
+        return attributeNames[attributeNumber] != M_NULLPTR ? attributeNames[attributeNumber] : "";
+    }
+
     typedef enum eSMARTAttrOutModeEnum
     {
         SMART_ATTR_OUTPUT_RAW,
@@ -347,6 +416,90 @@ extern "C"
     M_PARAM_RO(1)
     M_PARAM_WO(2) OPENSEA_OPERATIONS_API eReturnValues run_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  run_SMART_Check_Cached(tDevice *device, ptrLogPageCache logCache, ptrSmartTripInfo tripInfo)
+    //
+    //! \brief   Description: Same as run_SMART_Check(), reading the ATA SMART data through a log page cache.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in,out] logCache = log pages already read from this device. M_NULLPTR reads the drive every time
+    //!   \param[in] tripInfo = OPTIONAL pointer to a struct to get why a drive has been tripped (if available).
+    //!
+    //  Exit:
+    //!   \return same as run_SMART_Check()
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    OPENSEA_OPERATIONS_API eReturnValues run_SMART_Check_Cached(tDevice*         device,
+                                                                ptrLogPageCache  logCache,
+                                                                ptrSmartTripInfo tripInfo);
+
+    typedef enum eHealthSweepStatusEnum
+    {
+        HEALTH_SWEEP_UNKNOWN,
+        HEALTH_SWEEP_PASS,
+        HEALTH_SWEEP_WARNING,
+        HEALTH_SWEEP_FAIL,
+    } eHealthSweepStatus;
+
+    // The check that decided a drive's status
+    typedef enum eHealthSweepMethodEnum
+    {
+        HEALTH_SWEEP_METHOD_NONE,
+        HEALTH_SWEEP_METHOD_SMART_RETURN_STATUS,          // ATA
+        HEALTH_SWEEP_METHOD_NVME_HEALTH_LOG,              // NVMe critical warning
+        HEALTH_SWEEP_METHOD_INFORMATIONAL_EXCEPTIONS_LOG, // SCSI
+        HEALTH_SWEEP_METHOD_FULL_SMART_CHECK,             // run_SMART_Check()
+    } eHealthSweepMethod;
+
+    // One record per drive. The sense code, attribute and critical warning are filled in when a drive did not pass
+    // and the full check was able to say why.
+    typedef struct s_healthSweepRecord
+    {
+        eHealthSweepStatus status;
+        eHealthSweepMethod method;
+        bool               escalated;  // the quick check was not a pass, so the full check was also run
+        eReturnValues      lastResult; // return value from the last check that was run
+        uint8_t            asc;
+        uint8_t            ascq;
+        uint8_t            attributeNumber;
+        uint8_t            nvmeCriticalWarning;
+    } healthSweepRecord, *ptrHealthSweepRecord;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  run_Health_Sweep(tDevice *deviceList, uint32_t numberOfDevices, ptrHealthSweepRecord records)
+    //
+    //! \brief   Description:  Checks the health of many drives, cheapest check first. Every drive first gets a single
+    //! command: SMART RETURN STATUS for ATA, the SMART/health log for NVMe, or the informational exceptions log page
+    //! for SCSI. Only drives that did not clearly pass are then run through run_SMART_Check(), after every drive has
+    //! had its quick check, so a fleet of healthy drives costs one command per drive.
+    //! Drives are checked one at a time on the calling thread. Nothing is shared between drives other than the
+    //! position in deviceList and records, so to check drives in parallel the caller splits the list into ranges and
+    //! calls this once per range from its own thread, passing the matching part of records. A device must only be in
+    //! one range at a time.
+    //
+    //  Entry:
+    //!   \param[in] deviceList = devices to check, such as the list from get_Device_List()
+    //!   \param[in] numberOfDevices = number of devices in deviceList
+    //!   \param[out] records = one record per device, in the same order as deviceList
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every drive was checked (see the records for results), BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 3)
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_WO_SIZE(3, 2)
+    OPENSEA_OPERATIONS_API eReturnValues run_Health_Sweep(tDevice*             deviceList,
+                                                          uint32_t             numberOfDevices,
+                                                          ptrHealthSweepRecord records);
+
     //-----------------------------------------------------------------------------
     //
     //  print_SMART_Tripped_Message()
@@ -1041,6 +1194,79 @@ extern "C"
     OPENSEA_OPERATIONS_API
     void print_ATA_Comprehensive_SMART_Error_Log(ptrComprehensiveSMARTErrorLog errorLogData, bool genericOutput);
 
+    // Walks the extended comprehensive SMART error log from the newest entry to the oldest, reading a page only when
+    // the next entry is on it. Every entry is numbered with the device error count at the time it was logged (the
+    // newest entry is deviceErrorCount, the one before it deviceErrorCount - 1, etc), which can be saved and passed
+    // back as sinceErrorCount to only get new errors next time.
+    typedef struct s_ataSMARTErrorLogIterator
+    {
+        uint8_t       version;
+        bool          checksumsValid;
+        uint16_t      deviceErrorCount;
+        uint16_t      logPages;
+        uint16_t      nextIndex;        // 1 based index in the log of the next entry
+        uint16_t      nextErrorNumber;  // device error count for the next entry
+        uint16_t      entriesRemaining; // entries left before reaching the oldest one in the log or sinceErrorCount
+        uint32_t      pagesRead;
+        eReturnValues status; // set when reading a page fails
+        bool          pageBuffered;
+        uint16_t      bufferedPage;
+        uint8_t       pageData[LEGACY_DRIVE_SEC_SIZE];
+    } ataSMARTErrorLogIterator, *ptrATASMARTErrorLogIterator;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_ATA_SMART_Error_Log_Iterator(tDevice * device, ptrATASMARTErrorLogIterator iterator,
+    //                                    uint16_t sinceErrorCount)
+    //
+    //! \brief   Description:  Reads the first page of the extended comprehensive SMART error log to find the newest
+    //! entry and the device error count. Entries are then read with get_Next_ATA_SMART_Error_Log_Entry().
+    //
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param iterator - iterator to set up
+    //!   \param sinceErrorCount - only return errors after this device error count. 0 returns every entry in the log.
+    //!   Use the deviceErrorCount from the last time the log was read to only get new errors.
+    //  Exit:
+    //!   \return SUCCESS = ready, FAILURE = failed to read the log, NOT_SUPPORTED = the drive does not support the
+    //!   extended comprehensive SMART error log (use get_ATA_Comprehensive_SMART_Error_Log() for the SMART log)
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RO(1)
+    M_PARAM_WO(2)
+    OPENSEA_OPERATIONS_API eReturnValues init_ATA_SMART_Error_Log_Iterator(tDevice*                    device,
+                                                                           ptrATASMARTErrorLogIterator iterator,
+                                                                           uint16_t                    sinceErrorCount);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Next_ATA_SMART_Error_Log_Entry(tDevice * device, ptrATASMARTErrorLogIterator iterator,
+    //                                     SMARTErrorDataStructure * entry, uint16_t * errorNumber)
+    //
+    //! \brief   Description:  Gets the next older entry from the extended comprehensive SMART error log. A page is
+    //! only read when the entry is not on the page that was read last, so stopping after N entries reads about N / 4
+    //! pages.
+    //
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param iterator - iterator from init_ATA_SMART_Error_Log_Iterator()
+    //!   \param entry - filled in with the entry
+    //!   \param errorNumber - optional. Set to the device error count for this entry
+    //  Exit:
+    //!   \return true = entry filled in, false = no more entries. iterator->status is not SUCCESS if a read failed.
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    M_PARAM_WO(4)
+    OPENSEA_OPERATIONS_API bool get_Next_ATA_SMART_Error_Log_Entry(tDevice*                    device,
+                                                                   ptrATASMARTErrorLogIterator iterator,
+                                                                   SMARTErrorDataStructure*    entry,
+                                                                   uint16_t*                   errorNumber);
+
     M_NONNULL_PARAM_LIST(1) M_PARAM_RO(1) OPENSEA_OPERATIONS_API bool is_SMART_Error_Logging_Supported(tDevice* device);
 
     M_NONNULL_PARAM_LIST(1)
@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file structured_output.h
+// \brief This file defines the functions for writing FARM, device statistics and SMART data as JSON Lines or CSV.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+#include "device_statistics.h"
+#include "farm_log.h"
+#include "operations_Common.h"
+#include "secure_file.h"
+#include "smart.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    // Every record has the same five columns so the output does not change shape between drives or releases:
+    //   device - the device ID given to init_Structured_Output(), usually the serial number
+    //   source - "farm", "devstat" or "smart"
+    //   name   - the statistic. Device statistics use the member name in deviceStatistics. FARM uses the page name.
+    //   index  - head, attribute number, qword in the FARM page, etc. Empty (CSV) or left out (JSON) when unused.
+    //   value  - the value
+    // JSON Lines writes one object per line. CSV writes one row per record after the header from
+    // write_Structured_Output_Header().
+    typedef enum eStructuredOutputFormatEnum
+    {
+        STRUCTURED_OUTPUT_JSON_LINES,
+        STRUCTURED_OUTPUT_CSV,
+    } eStructuredOutputFormat;
+
+#define STRUCTURED_OUTPUT_BUFFER_LENGTH (4096)
+#define STRUCTURED_OUTPUT_NO_INDEX      (-1)
+
+    // Records are formatted into buffer and only written out when it fills or on flush_Structured_Output(), so no
+    // allocations are made while writing. One structure can be reused for any number of devices.
+    typedef struct s_structuredOutput
+    {
+        eStructuredOutputFormat format;
+        secureFileInfo*         file; // M_NULLPTR writes to stdout
+        char                    deviceID[SERIAL_NUM_LEN + 1];
+        bool                    writeError; // set when a write to the file failed. Later records are dropped.
+        uint64_t                recordsWritten;
+        size_t                  used;
+        char                    buffer[STRUCTURED_OUTPUT_BUFFER_LENGTH];
+    } structuredOutput, *ptrStructuredOutput;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  init_Structured_Output(ptrStructuredOutput output, eStructuredOutputFormat format, secureFileInfo *file,
+    //                         const char *deviceID)
+    //
+    //! \brief   Description: Sets up an emitter. Call set_Structured_Output_Device() to switch devices later.
+    //
+    //  Entry:
+    //!   \param[out] output = emitter to set up
+    //!   \param[in] format = JSON Lines or CSV
+    //!   \param[in] file = file opened for writing. M_NULLPTR for stdout
+    //!   \param[in] deviceID = written in the device column of every record. M_NULLPTR for an empty string
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_WO(1)
+    M_PARAM_RW(3)
+    M_PARAM_RO(4)
+    M_NULL_TERM_STRING(4)
+    OPENSEA_OPERATIONS_API void init_Structured_Output(ptrStructuredOutput     output,
+                                                       eStructuredOutputFormat format,
+                                                       secureFileInfo*         file,
+                                                       const char*             deviceID);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  set_Structured_Output_Device(ptrStructuredOutput output, const char *deviceID)
+    //
+    //! \brief   Description: Changes the device column for the records that follow.
+    //
+    //  Entry:
+    //!   \param[in,out] output = emitter
+    //!   \param[in] deviceID = usually the serial number. M_NULLPTR for an empty string
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(2)
+    OPENSEA_OPERATIONS_API void set_Structured_Output_Device(ptrStructuredOutput output, const char* deviceID);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  write_Structured_Output_Header(ptrStructuredOutput output)
+    //
+    //! \brief   Description: Writes the CSV column names. Does nothing for JSON Lines.
+    //
+    //  Entry:
+    //!   \param[in,out] output = emitter
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API void write_Structured_Output_Header(ptrStructuredOutput output);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  write_Structured_Record_Uint64(ptrStructuredOutput output, const char *source, const char *name,
+    //                                 int32_t index, uint64_t value)
+    //
+    //! \brief   Description: Writes one record. The Int64 and Double versions differ only in the value type.
+    //
+    //  Entry:
+    //!   \param[in,out] output = emitter
+    //!   \param[in] source = source column
+    //!   \param[in] name = name column
+    //!   \param[in] index = index column. STRUCTURED_OUTPUT_NO_INDEX when unused
+    //!   \param[in] value = value column
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2, 3)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(2)
+    M_PARAM_RO(3)
+    M_NULL_TERM_STRING(3)
+    OPENSEA_OPERATIONS_API void write_Structured_Record_Uint64(ptrStructuredOutput output,
+                                                               const char*         source,
+                                                               const char*         name,
+                                                               int32_t             index,
+                                                               uint64_t            value);
+
+    M_NONNULL_PARAM_LIST(1, 2, 3)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(2)
+    M_PARAM_RO(3)
+    M_NULL_TERM_STRING(3)
+    OPENSEA_OPERATIONS_API void write_Structured_Record_Int64(ptrStructuredOutput output,
+                                                              const char*         source,
+                                                              const char*         name,
+                                                              int32_t             index,
+                                                              int64_t             value);
+
+    M_NONNULL_PARAM_LIST(1, 2, 3)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(2)
+    M_PARAM_RO(3)
+    M_NULL_TERM_STRING(3)
+    OPENSEA_OPERATIONS_API void write_Structured_Record_Double(ptrStructuredOutput output,
+                                                               const char*         source,
+                                                               const char*         name,
+                                                               int32_t             index,
+                                                               double              value);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  write_Structured_Record_Uint128(ptrStructuredOutput output, const char *source, const char *name,
+    //                                  int32_t index, const uint8_t value[16])
+    //
+    //! \brief   Description: Writes one record for a 128-bit little endian counter, such as the NVMe SMART/health
+    //!          log counters. When the upper 64 bits are zero the value is written in decimal like
+    //!          write_Structured_Record_Uint64(), otherwise it is written as a string of 32 hex digits with a 0x
+    //!          prefix so that no digits are lost.
+    //
+    //  Entry:
+    //!   \param[in,out] output = emitter
+    //!   \param[in] source = source column
+    //!   \param[in] name = name column
+    //!   \param[in] index = index column. STRUCTURED_OUTPUT_NO_INDEX when unused
+    //!   \param[in] value = 16 bytes, least significant byte first
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2, 3, 5)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(2)
+    M_PARAM_RO(3)
+    M_NULL_TERM_STRING(3)
+    M_PARAM_RO_SIZE(5, 16)
+    OPENSEA_OPERATIONS_API void write_Structured_Record_Uint128(ptrStructuredOutput output,
+                                                                const char*         source,
+                                                                const char*         name,
+                                                                int32_t             index,
+                                                                const uint8_t       value[16]);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  flush_Structured_Output(ptrStructuredOutput output)
+    //
+    //! \brief   Description: Writes out everything still in the buffer.
+    //
+    //  Entry:
+    //!   \param[in,out] output = emitter
+    //!
+    //  Exit:
+    //!   \return SUCCESS = everything written, ERROR_WRITING_FILE = a write failed at some point
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1)
+    M_PARAM_RW(1) OPENSEA_OPERATIONS_API eReturnValues flush_Structured_Output(ptrStructuredOutput output);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  write_FARM_Data_Structured(ptrStructuredOutput output, const farmLogData *farmdata)
+    //
+    //! \brief   Description: Writes every supported and valid FARM field. The name is the page and the index is the
+    //!          qword in the page structure, which does not change between releases. Values have the status byte
+    //!          removed.
+    //
+    //  Entry:
+    //!   \param[in,out] output = emitter
+    //!   \param[in] farmdata = FARM data from read_FARM_Data() or a parsed combined log
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2)
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    OPENSEA_OPERATIONS_API void write_FARM_Data_Structured(ptrStructuredOutput output, const farmLogData* farmdata);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  write_DeviceStatistics_Structured(tDevice *device, ptrDeviceStatistics deviceStats, ptrStructuredOutput output)
+    //
+    //! \brief   Description: Writes every supported statistic with a valid value.
+    //
+    //  Entry:
+    //!   \param[in] device = device the statistics came from. Selects the SATA or SAS statistics.
+    //!   \param[in] deviceStats = statistics from get_DeviceStatistics()
+    //!   \param[in,out] output = emitter
+    //!
+    //  Exit:
+    //!   \return SUCCESS = written, NOT_SUPPORTED = not an ATA or SCSI device
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_RW(3)
+    OPENSEA_OPERATIONS_API eReturnValues write_DeviceStatistics_Structured(tDevice*            device,
+                                                                           ptrDeviceStatistics deviceStats,
+                                                                           ptrStructuredOutput output);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  write_SMART_Attributes_Structured(tDevice *device, smartLogData *smartData, ptrStructuredOutput output)
+    //
+    //! \brief   Description: Writes ATA SMART attributes (current, worst, threshold and the 48 bit raw value, with
+    //!          the attribute number as the index) or the NVMe SMART/health log.
+    //
+    //  Entry:
+    //!   \param[in] device = device the data came from. Used for attribute names.
+    //!   \param[in] smartData = data from get_SMART_Attributes()
+    //!   \param[in,out] output = emitter
+    //!
+    //  Exit:
+    //!   \return SUCCESS = written, NOT_SUPPORTED = not an ATA or NVMe device
+    //
+    //-----------------------------------------------------------------------------
+    M_NONNULL_PARAM_LIST(1, 2, 3)
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_RW(3)
+    OPENSEA_OPERATIONS_API eReturnValues write_SMART_Attributes_Structured(tDevice*            device,
+                                                                           smartLogData*       smartData,
+                                                                           ptrStructuredOutput output);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "logs.h"
 #include "operations_Common.h"
 
 #if defined(__cplusplus)
@@ -52,13 +53,15 @@ extern "C"
 
     //-----------------------------------------------------------------------------
     //
-    //  trim_unmap_range( tDevice * device )
+    //  trim_unmap_range( tDevice * device, ptrATALogDirectories directories )
     //
     //! \brief   TRIM or UNMAP a range of LBAs from a starting LBA until the end of the range. This will auto detect ATA
     //! vs SCSI to send the appropriate command
     //
     //  Entry:
     //!   \param device - file descriptor
+    //!   \param directories - ATA log directories already read from this device, used to check for the XL command.
+    //!   Keep one when trimming many ranges. M_NULLPTR reads them for this call only. Ignored on SCSI and NVMe.
     //!   \param startLBA - the LBA to start the unmap/trim at
     //!   \param range - the range of LBAs to trim/unmap from the starting LBA
     //!
@@ -68,7 +71,11 @@ extern "C"
     //-----------------------------------------------------------------------------
     M_NONNULL_PARAM_LIST(1)
     M_PARAM_RO(1)
-    OPENSEA_OPERATIONS_API eReturnValues trim_Unmap_Range(tDevice* device, uint64_t startLBA, uint64_t range);
+    M_PARAM_RW(2)
+    OPENSEA_OPERATIONS_API eReturnValues trim_Unmap_Range(tDevice*             device,
+                                                          ptrATALogDirectories directories,
+                                                          uint64_t             startLBA,
+                                                          uint64_t             range);
 
     //-----------------------------------------------------------------------------
     //
@@ -93,13 +100,15 @@ extern "C"
 
     //-----------------------------------------------------------------------------
     //
-    //  ata_Trim_Range( tDevice * device )
+    //  ata_Trim_Range( tDevice * device, ptrATALogDirectories directories )
     //
     //! \brief   TRIM a range of LBAs from a starting LBA until the end of the range. This will send the ATA data set
     //! management command with the TRIM bit set, possibly multiple times depending on the range.
     //
     //  Entry:
     //!   \param device - file descriptor
+    //!   \param directories - ATA log directories already read from this device, used to check for the XL command.
+    //!   M_NULLPTR reads them for this call only.
     //!   \param startLBA - the LBA to start the unmap/trim at
     //!   \param range - the range of LBAs to trim/unmap from the starting LBA
     //!
@@ -109,7 +118,11 @@ extern "C"
     //-----------------------------------------------------------------------------
     M_NONNULL_PARAM_LIST(1)
     M_PARAM_RO(1)
-    OPENSEA_OPERATIONS_API eReturnValues ata_Trim_Range(tDevice* device, uint64_t startLBA, uint64_t range);
+    M_PARAM_RW(2)
+    OPENSEA_OPERATIONS_API eReturnValues ata_Trim_Range(tDevice*             device,
+                                                        ptrATALogDirectories directories,
+                                                        uint64_t             startLBA,
+                                                        uint64_t             range);
 
     //-----------------------------------------------------------------------------
     //
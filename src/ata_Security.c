@@ -27,6 +27,7 @@
 #include "type_conversion.h"
 
 #include "ata_Security.h"
+#include "logs.h"
 #include "operations_Common.h"
 #include "platform_helper.h"
 #include <ctype.h>
@@ -73,7 +74,10 @@ bool sat_ATA_Security_Protocol_Supported(tDevice* device)
     return supported;
 }
 
-void get_ATA_Security_Info(tDevice* device, ptrATASecurityStatus securityStatus, bool useSAT)
+void get_ATA_Security_Info(tDevice*             device,
+                           ptrATALogDirectories directories,
+                           ptrATASecurityStatus securityStatus,
+                           bool                 useSAT)
 {
     if (useSAT) // if SAT ATA security supported, use it so the SATL manages the erase.
     {
@@ -231,68 +235,26 @@ void get_ATA_Security_Info(tDevice* device, ptrATASecurityStatus securityStatus,
         }
     }
     // read ID data log page for security bits to get restrictedSanitizeOverridesSecurity bit
-    if (device->drive_info.drive_type == ATA_DRIVE && device->drive_info.ata_Options.generalPurposeLoggingSupported)
+    if (device->drive_info.drive_type == ATA_DRIVE && device->drive_info.ata_Options.generalPurposeLoggingSupported &&
+        is_ATA_Identify_Data_Log_Page_Supported(device, directories, ATA_ID_DATA_LOG_SECURITY))
     {
         DECLARE_ZERO_INIT_ARRAY(uint8_t, securityPage, ATA_LOG_PAGE_LEN_BYTES);
-        if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, 0, 0, securityPage, ATA_LOG_PAGE_LEN_BYTES, 0))
-        {
-            if (get_ATA_Log_Size_From_Directory(securityPage, ATA_LOG_PAGE_LEN_BYTES, ATA_LOG_IDENTIFY_DEVICE_DATA) > 0)
+        if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_IDENTIFY_DEVICE_DATA, ATA_ID_DATA_LOG_SECURITY,
+                                                 securityPage, ATA_LOG_PAGE_LEN_BYTES, 0))
+        {
+            // make sure we got the right page first!
+            uint64_t header = M_BytesTo8ByteValue(securityPage[7], securityPage[6], securityPage[5], securityPage[4],
+                                                  securityPage[3], securityPage[2], securityPage[1], securityPage[0]);
+            if (header & ATA_ID_DATA_QWORD_VALID_BIT && M_Word0(header) >= ATA_ID_DATA_VERSION_1 &&
+                M_Byte2(header) == ATA_ID_DATA_LOG_SECURITY)
             {
-                safe_memset(&securityPage, 512, 0, 512);
-                // IDData log suppored. Read first page to see if security subpage (06h) is supported
-                if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_IDENTIFY_DEVICE_DATA,
-                                                         ATA_ID_DATA_LOG_SUPPORTED_PAGES, securityPage, 512, 0))
+                uint64_t securityCapabilities =
+                    M_BytesTo8ByteValue(securityPage[55], securityPage[54], securityPage[53], securityPage[52],
+                                        securityPage[51], securityPage[50], securityPage[49], securityPage[48]);
+                if (securityCapabilities & BIT63)
                 {
-                    uint8_t  pageNumber = securityPage[2];
-                    uint16_t revision   = M_BytesTo2ByteValue(securityPage[1], securityPage[0]);
-                    if (pageNumber == C_CAST(uint8_t, ATA_ID_DATA_LOG_SUPPORTED_PAGES) &&
-                        revision >= ATA_ID_DATA_VERSION_1)
-                    {
-                        uint8_t listLen = securityPage[ATA_ID_DATA_SUP_PG_LIST_LEN_OFFSET];
-                        for (uint16_t iter = ATA_ID_DATA_SUP_PG_LIST_OFFSET;
-                             iter < C_CAST(uint16_t, listLen + ATA_ID_DATA_SUP_PG_LIST_OFFSET) && iter < UINT16_C(512);
-                             ++iter)
-                        {
-                            bool foundSecurityPage = false;
-                            switch (securityPage[iter])
-                            {
-                            case ATA_ID_DATA_LOG_SECURITY:
-                                foundSecurityPage = true;
-                                safe_memset(securityPage, 512, 0, 512);
-                                if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_IDENTIFY_DEVICE_DATA,
-                                                                         ATA_ID_DATA_LOG_SECURITY, securityPage, 512,
-                                                                         0))
-                                {
-                                    // make sure we got the right page first!
-                                    uint64_t header = M_BytesTo8ByteValue(
-                                        securityPage[7], securityPage[6], securityPage[5], securityPage[4],
-                                        securityPage[3], securityPage[2], securityPage[1], securityPage[0]);
-                                    if (header & ATA_ID_DATA_QWORD_VALID_BIT &&
-                                        M_Word0(header) >= ATA_ID_DATA_VERSION_1 &&
-                                        M_Byte2(header) == ATA_ID_DATA_LOG_SECURITY)
-                                    {
-                                        uint64_t securityCapabilities = M_BytesTo8ByteValue(
-                                            securityPage[55], securityPage[54], securityPage[53], securityPage[52],
-                                            securityPage[51], securityPage[50], securityPage[49], securityPage[48]);
-                                        if (securityCapabilities & BIT63)
-                                        {
-                                            securityStatus->restrictedSanitizeOverridesSecurity =
-                                                securityCapabilities & BIT7;
-                                            securityStatus->encryptAll = securityCapabilities & BIT0;
-                                        }
-                                    }
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                            if (foundSecurityPage)
-                            {
-                                // exit the loop since we got what we wanted.
-                                break;
-                            }
-                        }
-                    }
+                    securityStatus->restrictedSanitizeOverridesSecurity = securityCapabilities & BIT7;
+                    securityStatus->encryptAll                          = securityCapabilities & BIT0;
                 }
             }
         }
@@ -757,7 +719,7 @@ eReturnValues run_Disable_ATA_Security_Password(tDevice*            device,
     {
         ataSecurityStatus securityStatus;
         safe_memset(&securityStatus, sizeof(ataSecurityStatus), 0, sizeof(ataSecurityStatus));
-        get_ATA_Security_Info(device, &securityStatus, satATASecuritySupported);
+        get_ATA_Security_Info(device, M_NULLPTR, &securityStatus, satATASecuritySupported);
         if (securityStatus.securitySupported)
         {
             if (securityStatus.securityEnabled)
@@ -855,7 +817,7 @@ eReturnValues run_Freeze_ATA_Security(tDevice* device, bool forceSATvalid, bool
     {
         ataSecurityStatus securityStatus;
         safe_memset(&securityStatus, sizeof(ataSecurityStatus), 0, sizeof(ataSecurityStatus));
-        get_ATA_Security_Info(device, &securityStatus, satATASecuritySupported);
+        get_ATA_Security_Info(device, M_NULLPTR, &securityStatus, satATASecuritySupported);
         if (securityStatus.securitySupported)
         {
             if (satATASecuritySupported) // if SAT ATA security supported, use it so the SATL manages the commands.
@@ -901,7 +863,7 @@ eReturnValues run_Unlock_ATA_Security(tDevice*            device,
     {
         ataSecurityStatus securityStatus;
         safe_memset(&securityStatus, sizeof(ataSecurityStatus), 0, sizeof(ataSecurityStatus));
-        get_ATA_Security_Info(device, &securityStatus, satATASecuritySupported);
+        get_ATA_Security_Info(device, M_NULLPTR, &securityStatus, satATASecuritySupported);
         if (securityStatus.securitySupported)
         {
             if (securityStatus.securityEnabled)
@@ -995,7 +957,7 @@ eReturnValues run_Set_ATA_Security_Password(tDevice*            device,
     {
         ataSecurityStatus securityStatus;
         safe_memset(&securityStatus, sizeof(ataSecurityStatus), 0, sizeof(ataSecurityStatus));
-        get_ATA_Security_Info(device, &securityStatus, satATASecuritySupported);
+        get_ATA_Security_Info(device, M_NULLPTR, &securityStatus, satATASecuritySupported);
         if (securityStatus.securitySupported)
         {
             // Check if frozen or already enabled.
@@ -1070,9 +1032,11 @@ eReturnValues run_ATA_Security_Erase(tDevice*              device,
     uint16_t          eraseTimeMinutes = UINT16_C(0);
     ataSecurityStatus securityStatus;
     ataSecurityStatus finalSecurityStatus;
+    ataLogDirectories directories; // the status is read again after the erase, so keep the log directories
     safe_memset(&securityStatus, sizeof(ataSecurityStatus), 0, sizeof(ataSecurityStatus));
     safe_memset(&finalSecurityStatus, sizeof(ataSecurityStatus), 0, sizeof(ataSecurityStatus));
-    get_ATA_Security_Info(device, &securityStatus, satATASecuritySupported);
+    init_ATA_Log_Directories(&directories);
+    get_ATA_Security_Info(device, &directories, &securityStatus, satATASecuritySupported);
     if (securityStatus.securitySupported)
     {
         // if they asked for enhanced erase, make sure it is supported
@@ -1323,7 +1287,7 @@ eReturnValues run_ATA_Security_Erase(tDevice*              device,
     // structure.
     DECLARE_ZERO_INIT_ARRAY(uint8_t, iddata, LEGACY_DRIVE_SEC_SIZE);
     ata_Identify(device, iddata, LEGACY_DRIVE_SEC_SIZE);
-    get_ATA_Security_Info(device, &finalSecurityStatus, satATASecuritySupported);
+    get_ATA_Security_Info(device, &directories, &finalSecurityStatus, satATASecuritySupported);
     if (SUCCESS == ataEraseResult && !finalSecurityStatus.securityEnabled && !finalSecurityStatus.securityLocked)
     {
         if (VERBOSITY_QUIET < device->deviceVerbosity)
@@ -1375,7 +1339,7 @@ eReturnValues run_ATA_Security_Erase(tDevice*              device,
                 unlock_ATA_Security(device, ataPassword, satATASecuritySupported);
                 safe_memset(&finalSecurityStatus, sizeof(ataSecurityStatus), 0, sizeof(ataSecurityStatus));
                 ata_Identify(device, iddata, LEGACY_DRIVE_SEC_SIZE);
-                get_ATA_Security_Info(device, &finalSecurityStatus, satATASecuritySupported);
+                get_ATA_Security_Info(device, &directories, &finalSecurityStatus, satATASecuritySupported);
             }
             if (finalSecurityStatus.securityEnabled && !finalSecurityStatus.securityLocked)
             {
@@ -23,9 +23,13 @@
 #include "pattern_utils.h"
 #include "precision_timer.h"
 #include "string_utils.h"
+#include "time_utils.h"
 #include "type_conversion.h"
 
 #include "buffer_test.h"
+#include "sata_phy.h"
+
+#include <math.h>
 
 static bool are_Buffer_Commands_Available(tDevice* device)
 {
@@ -230,11 +234,250 @@ static bool was_There_A_CRC_Error_On_Last_Command(tDevice* device)
     return crc;
 }
 
+static const uint8_t nibbleBitCount[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+static M_INLINE uint8_t count_Bits_In_Byte(uint8_t value)
+{
+    return nibbleBitCount[M_Nibble0(value)] + nibbleBitCount[M_Nibble1(value)];
+}
+
+// Only called for 8 byte chunks that already failed the word compare, so this can be simple.
+static void tally_Differing_Bytes(const uint8_t*              expected,
+                                  const uint8_t*              received,
+                                  uint32_t                    offset,
+                                  uint32_t                    length,
+                                  ptrBufferMiscompareAnalysis analysis)
+{
+    for (uint32_t byteIter = offset; byteIter < (offset + length); ++byteIter)
+    {
+        uint8_t  difference = expected[byteIter] ^ received[byteIter];
+        uint32_t lane       = byteIter % BUFFER_MISCOMPARE_BYTE_LANES;
+        if (difference == 0)
+        {
+            continue;
+        }
+        if (analysis->differingBytes == UINT32_C(0))
+        {
+            analysis->firstDifferingOffset = byteIter;
+        }
+        analysis->lastDifferingOffset = byteIter;
+        ++(analysis->differingBytes);
+        ++(analysis->byteLaneHistogram[lane]);
+        analysis->flippedBits += count_Bits_In_Byte(difference);
+        analysis->bitsSetWhenExpectedClear += count_Bits_In_Byte(difference & received[byteIter]);
+        analysis->bitsClearWhenExpectedSet += count_Bits_In_Byte(difference & expected[byteIter]);
+        for (uint8_t bitIter = UINT8_C(0); bitIter < UINT8_C(8); ++bitIter)
+        {
+            if (difference & M_BitN8(bitIter))
+            {
+                ++(analysis->bitPositionHistogram[(lane * UINT32_C(8)) + bitIter]);
+            }
+        }
+    }
+}
+
+// Checks if received[n] == expected[n + shift] from start to the end of the overlapping data
+static bool buffer_Matches_With_Shift(const uint8_t* expected,
+                                      const uint8_t* received,
+                                      uint32_t       bufferSize,
+                                      uint32_t       start,
+                                      int32_t        shift)
+{
+    uint32_t shiftBytes = M_STATIC_CAST(uint32_t, shift < 0 ? -shift : shift);
+    if (shiftBytes >= bufferSize || (bufferSize - shiftBytes) <= start ||
+        (bufferSize - shiftBytes - start) < BUFFER_MISCOMPARE_MAX_SHIFT_BYTES)
+    {
+        // not enough overlapping data to say anything with confidence
+        return false;
+    }
+    if (shift > 0)
+    {
+        return memcmp(&received[start], &expected[start + shiftBytes], bufferSize - shiftBytes - start) == 0;
+    }
+    else
+    {
+        return memcmp(&received[start + shiftBytes], &expected[start], bufferSize - shiftBytes - start) == 0;
+    }
+}
+
+#define BUFFER_MISCOMPARE_BULK_MIN_BYTES 16
+
+eReturnValues analyze_Buffer_Miscompare(const uint8_t*              expected,
+                                        const uint8_t*              received,
+                                        uint32_t                    bufferSize,
+                                        ptrBufferMiscompareAnalysis analysis)
+{
+    uint64_t expectedAnd = UINT64_MAX;
+    uint64_t expectedOr  = UINT64_C(0);
+    uint64_t receivedAnd = UINT64_MAX;
+    uint64_t receivedOr  = UINT64_C(0);
+    uint32_t offset      = UINT32_C(0);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, expectedAndLanes, sizeof(uint64_t));
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, expectedOrLanes, sizeof(uint64_t));
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, receivedAndLanes, sizeof(uint64_t));
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, receivedOrLanes, sizeof(uint64_t));
+    DISABLE_NONNULL_COMPARE
+    if (expected == M_NULLPTR || received == M_NULLPTR || analysis == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(analysis, sizeof(bufferMiscompareAnalysis), 0, sizeof(bufferMiscompareAnalysis));
+    analysis->type          = BUFFER_MISCOMPARE_NONE;
+    analysis->bytesCompared = bufferSize;
+    // Compare a 64bit word at a time. A matching word costs a load, xor and branch, so this keeps up with back to back
+    // transfers. The and/or accumulators used to find stuck bits are updated for every word.
+    for (; (offset + sizeof(uint64_t)) <= bufferSize; offset += sizeof(uint64_t))
+    {
+        uint64_t expectedWord = UINT64_C(0);
+        uint64_t receivedWord = UINT64_C(0);
+        memcpy(&expectedWord, &expected[offset], sizeof(uint64_t));
+        memcpy(&receivedWord, &received[offset], sizeof(uint64_t));
+        expectedAnd &= expectedWord;
+        expectedOr |= expectedWord;
+        receivedAnd &= receivedWord;
+        receivedOr |= receivedWord;
+        if (expectedWord ^ receivedWord)
+        {
+            tally_Differing_Bytes(expected, received, offset, sizeof(uint64_t), analysis);
+        }
+    }
+    // Fold the words down to one byte per lane. Done on bytes so that host endianness does not matter.
+    memcpy(expectedAndLanes, &expectedAnd, sizeof(uint64_t));
+    memcpy(expectedOrLanes, &expectedOr, sizeof(uint64_t));
+    memcpy(receivedAndLanes, &receivedAnd, sizeof(uint64_t));
+    memcpy(receivedOrLanes, &receivedOr, sizeof(uint64_t));
+    for (uint32_t lane = UINT32_C(0); lane < BUFFER_MISCOMPARE_BYTE_LANES; ++lane)
+    {
+        expectedAndLanes[lane] &= expectedAndLanes[lane + BUFFER_MISCOMPARE_BYTE_LANES];
+        expectedOrLanes[lane] |= expectedOrLanes[lane + BUFFER_MISCOMPARE_BYTE_LANES];
+        receivedAndLanes[lane] &= receivedAndLanes[lane + BUFFER_MISCOMPARE_BYTE_LANES];
+        receivedOrLanes[lane] |= receivedOrLanes[lane + BUFFER_MISCOMPARE_BYTE_LANES];
+    }
+    // remaining bytes when the buffer is not a multiple of 8 bytes
+    for (uint32_t byteIter = offset; byteIter < bufferSize; ++byteIter)
+    {
+        uint32_t lane = byteIter % BUFFER_MISCOMPARE_BYTE_LANES;
+        expectedAndLanes[lane] &= expected[byteIter];
+        expectedOrLanes[lane] |= expected[byteIter];
+        receivedAndLanes[lane] &= received[byteIter];
+        receivedOrLanes[lane] |= received[byteIter];
+    }
+    if (offset < bufferSize)
+    {
+        tally_Differing_Bytes(expected, received, offset, bufferSize - offset, analysis);
+    }
+    if (analysis->differingBytes == UINT32_C(0))
+    {
+        return SUCCESS;
+    }
+    // A stuck bit reads back the same value in every dword even though the written data varied, and must also
+    // explain at least one of the flipped bits.
+    for (uint32_t lane = UINT32_C(0); lane < BUFFER_MISCOMPARE_BYTE_LANES; ++lane)
+    {
+        uint8_t stuckHigh = receivedAndLanes[lane] & M_STATIC_CAST(uint8_t, ~expectedAndLanes[lane]);
+        uint8_t stuckLow  = M_STATIC_CAST(uint8_t, ~receivedOrLanes[lane]) & expectedOrLanes[lane];
+        for (uint8_t bitIter = UINT8_C(0); bitIter < UINT8_C(8); ++bitIter)
+        {
+            uint32_t position = (lane * UINT32_C(8)) + bitIter;
+            if (analysis->bitPositionHistogram[position] == UINT32_C(0))
+            {
+                continue;
+            }
+            if (stuckHigh & M_BitN8(bitIter))
+            {
+                analysis->stuckHighMask |= M_BitN32(position);
+            }
+            if (stuckLow & M_BitN8(bitIter))
+            {
+                analysis->stuckLowMask |= M_BitN32(position);
+            }
+        }
+    }
+    // Look for the data being intact but at the wrong offset, starting from the dword where it first went bad.
+    // Positive shifts mean data is missing, negative shifts mean extra data was inserted.
+    for (int32_t shiftIter = INT32_C(1); shiftIter <= BUFFER_MISCOMPARE_MAX_SHIFT_BYTES; ++shiftIter)
+    {
+        uint32_t start = analysis->firstDifferingOffset -
+                         (analysis->firstDifferingOffset % BUFFER_MISCOMPARE_BYTE_LANES);
+        if (buffer_Matches_With_Shift(expected, received, bufferSize, start, shiftIter))
+        {
+            analysis->shiftBytes = shiftIter;
+            break;
+        }
+        if (buffer_Matches_With_Shift(expected, received, bufferSize, start, -shiftIter))
+        {
+            analysis->shiftBytes = -shiftIter;
+            break;
+        }
+    }
+    if (analysis->shiftBytes > 0 && (analysis->shiftBytes % BUFFER_MISCOMPARE_BYTE_LANES) == 0)
+    {
+        analysis->type          = BUFFER_MISCOMPARE_DROPPED_DWORDS;
+        analysis->droppedDwords = M_STATIC_CAST(uint32_t, analysis->shiftBytes) / BUFFER_MISCOMPARE_BYTE_LANES;
+    }
+    else if (analysis->shiftBytes != 0)
+    {
+        analysis->type = BUFFER_MISCOMPARE_SHIFTED_DATA;
+    }
+    else if (analysis->stuckHighMask != UINT32_C(0) || analysis->stuckLowMask != UINT32_C(0))
+    {
+        analysis->type = BUFFER_MISCOMPARE_STUCK_BITS;
+    }
+    else if (analysis->differingBytes > UINT32_C(1) &&
+             (analysis->byteLaneHistogram[analysis->firstDifferingOffset % BUFFER_MISCOMPARE_BYTE_LANES] ==
+              analysis->differingBytes))
+    {
+        analysis->type = BUFFER_MISCOMPARE_BYTE_LANE;
+    }
+    else if (analysis->differingBytes >= BUFFER_MISCOMPARE_BULK_MIN_BYTES &&
+             analysis->flippedBits >= (analysis->differingBytes * UINT32_C(3)))
+    {
+        // random data differs in 4 bits per byte on average, single event upsets in 1
+        analysis->type = BUFFER_MISCOMPARE_BULK_CORRUPTION;
+    }
+    else
+    {
+        analysis->type = BUFFER_MISCOMPARE_RANDOM_BIT_ERRORS;
+    }
+    return SUCCESS;
+}
+
+// Analyzes a miscompare and adds it to the running totals. Returns the number of flipped bits
+static uint32_t record_Buffer_Miscompare(const uint8_t*             expected,
+                                         const uint8_t*             received,
+                                         uint32_t                   bufferSize,
+                                         ptrBufferMiscompareSummary summary)
+{
+    bufferMiscompareAnalysis analysis;
+    if (SUCCESS != analyze_Buffer_Miscompare(expected, received, bufferSize, &analysis))
+    {
+        return UINT32_C(0);
+    }
+    ++(summary->miscompareTypeCount[analysis.type]);
+    summary->differingBytes += analysis.differingBytes;
+    summary->flippedBits += analysis.flippedBits;
+    summary->bitsSetWhenExpectedClear += analysis.bitsSetWhenExpectedClear;
+    summary->bitsClearWhenExpectedSet += analysis.bitsClearWhenExpectedSet;
+    for (uint32_t position = UINT32_C(0); position < BUFFER_MISCOMPARE_BIT_POSITIONS; ++position)
+    {
+        summary->bitPositionHistogram[position] += analysis.bitPositionHistogram[position];
+    }
+    for (uint32_t lane = UINT32_C(0); lane < BUFFER_MISCOMPARE_BYTE_LANES; ++lane)
+    {
+        summary->byteLaneHistogram[lane] += analysis.byteLaneHistogram[lane];
+    }
+    summary->stuckHighMask |= analysis.stuckHighMask;
+    summary->stuckLowMask |= analysis.stuckLowMask;
+    return analysis.flippedBits;
+}
+
 // Function for simple byte pattern tests. take counter for number of times to try it?
-static void perform_Byte_Pattern_Test(tDevice*              device,
-                                      uint32_t              pattern,
-                                      uint32_t              deviceBufferSize,
-                                      ptrPatternTestResults testResults)
+static void perform_Byte_Pattern_Test(tDevice*                   device,
+                                      uint32_t                   pattern,
+                                      uint32_t                   deviceBufferSize,
+                                      ptrPatternTestResults      testResults,
+                                      ptrBufferMiscompareSummary miscompareSummary)
 {
     uint32_t numberOfTimesToTest = UINT32_C(5);
     uint8_t* patternBuffer =
@@ -314,6 +557,7 @@ static void perform_Byte_Pattern_Test(tDevice*              device,
             if (memcmp(patternBuffer, returnBuffer, deviceBufferSize) != 0)
             {
                 ++(testResults->totalBufferMiscompares);
+                record_Buffer_Miscompare(patternBuffer, returnBuffer, deviceBufferSize, miscompareSummary);
             }
         }
         stop_Timer(&patternTimer);
@@ -324,10 +568,11 @@ static void perform_Byte_Pattern_Test(tDevice*              device,
 }
 
 // Function for Walking 1's/0's test
-static void perform_Walking_Test(tDevice*              device,
-                                 bool                  walkingZeros,
-                                 uint32_t              deviceBufferSize,
-                                 ptrPatternTestResults testResults)
+static void perform_Walking_Test(tDevice*                   device,
+                                 bool                       walkingZeros,
+                                 uint32_t                   deviceBufferSize,
+                                 ptrPatternTestResults      testResults,
+                                 ptrBufferMiscompareSummary miscompareSummary)
 {
     uint8_t* patternBuffer = M_REINTERPRET_CAST(
         uint8_t*, safe_calloc_aligned(deviceBufferSize, sizeof(uint8_t),
@@ -431,6 +676,7 @@ static void perform_Walking_Test(tDevice*              device,
             if (memcmp(patternBuffer, returnBuffer, deviceBufferSize) != 0)
             {
                 ++(testResults->totalBufferMiscompares);
+                record_Buffer_Miscompare(patternBuffer, returnBuffer, deviceBufferSize, miscompareSummary);
             }
         }
         stop_Timer(&patternTimer);
@@ -440,7 +686,10 @@ static void perform_Walking_Test(tDevice*              device,
     safe_free_aligned(&returnBuffer);
 }
 // Function for random data pattern test
-static void perform_Random_Pattern_Test(tDevice* device, uint32_t deviceBufferSize, ptrPatternTestResults testResults)
+static void perform_Random_Pattern_Test(tDevice*                   device,
+                                        uint32_t                   deviceBufferSize,
+                                        ptrPatternTestResults      testResults,
+                                        ptrBufferMiscompareSummary miscompareSummary)
 {
     uint32_t numberOfTimesToTest = UINT32_C(10);
     uint8_t* patternBuffer =
@@ -518,6 +767,7 @@ static void perform_Random_Pattern_Test(tDevice* device, uint32_t deviceBufferSi
             if (memcmp(patternBuffer, returnBuffer, deviceBufferSize) != 0)
             {
                 ++(testResults->totalBufferMiscompares);
+                record_Buffer_Miscompare(patternBuffer, returnBuffer, deviceBufferSize, miscompareSummary);
             }
         }
         stop_Timer(&patternTimer);
@@ -562,61 +812,62 @@ eReturnValues perform_Cable_Test(tDevice* device, ptrCableTestResults testResult
             for (uint8_t count = UINT8_C(0); count < ALL_0_TEST_COUNT; ++count)
             {
                 perform_Byte_Pattern_Test(
-                    device, UINT32_C(0x00000000), bufferSize,
-                    &testResults->zerosTest[count]); // arbitrary number 10 was chosen since it sounded good for number
-                                                     // of times to try this pattern
+                    device, UINT32_C(0x00000000), bufferSize, &testResults->zerosTest[count],
+                    &testResults->miscompareSummary); // arbitrary number 10 was chosen since it sounded good for number
+                                                      // of times to try this pattern
             }
             for (uint8_t count = UINT8_C(0); count < ALL_F_TEST_COUNT; ++count)
             {
                 perform_Byte_Pattern_Test(
-                    device, UINT32_C(0xFFFFFFFF), bufferSize,
-                    &testResults->fTest[count]); // arbitrary number 10 was chosen since it sounded good for number of
-                                                 // times to try this pattern
+                    device, UINT32_C(0xFFFFFFFF), bufferSize, &testResults->fTest[count],
+                    &testResults->miscompareSummary); // arbitrary number 10 was chosen since it sounded good for number
+                                                      // of times to try this pattern
             }
             for (uint8_t count = UINT8_C(0); count < ALL_5_TEST_COUNT; ++count)
             {
                 perform_Byte_Pattern_Test(
-                    device, UINT32_C(0x55555555), bufferSize,
-                    &testResults->fivesTest[count]); // arbitrary number 10 was chosen since it sounded good for number
-                                                     // of times to try this pattern
+                    device, UINT32_C(0x55555555), bufferSize, &testResults->fivesTest[count],
+                    &testResults->miscompareSummary); // arbitrary number 10 was chosen since it sounded good for number
+                                                      // of times to try this pattern
             }
             for (uint8_t count = UINT8_C(0); count < ALL_A_TEST_COUNT; ++count)
             {
                 perform_Byte_Pattern_Test(
-                    device, UINT32_C(0xAAAAAAAA), bufferSize,
-                    &testResults->aTest[count]); // arbitrary number 10 was chosen since it sounded good for number of
-                                                 // times to try this pattern
+                    device, UINT32_C(0xAAAAAAAA), bufferSize, &testResults->aTest[count],
+                    &testResults->miscompareSummary); // arbitrary number 10 was chosen since it sounded good for number
+                                                      // of times to try this pattern
             }
             for (uint8_t count = UINT8_C(0); count < ZERO_F_5_A_TEST_COUNT; ++count)
             {
                 perform_Byte_Pattern_Test(
-                    device, UINT32_C(0x00FF55AA), bufferSize,
-                    &testResults->zeroF5ATest[count]); // arbitrary number 10 was chosen since it sounded good for
-                                                       // number of times to try this pattern
+                    device, UINT32_C(0x00FF55AA), bufferSize, &testResults->zeroF5ATest[count],
+                    &testResults->miscompareSummary); // arbitrary number 10 was chosen since it sounded good for number
+                                                      // of times to try this pattern
             }
             // now walking 1's
             for (uint8_t count = UINT8_C(0); count < WALKING_1_TEST_COUNT; ++count)
             {
-                perform_Walking_Test(device, false, bufferSize,
-                                     &testResults->walking1sTest[count]); // arbitrary number 5 was chose since it
-                                                                          // sounded good for trying this test
+                perform_Walking_Test(device, false, bufferSize, &testResults->walking1sTest[count],
+                                     &testResults->miscompareSummary); // arbitrary number 5 was chose since it sounded
+                                                                       // good for trying this test
             }
             // walking 0's
             for (uint8_t count = UINT8_C(0); count < WALKING_0_TEST_COUNT; ++count)
             {
-                perform_Walking_Test(device, true, bufferSize,
-                                     &testResults->walking0sTest[count]); // arbitrary number 5 was chose since it
-                                                                          // sounded good for trying this test
+                perform_Walking_Test(device, true, bufferSize, &testResults->walking0sTest[count],
+                                     &testResults->miscompareSummary); // arbitrary number 5 was chose since it sounded
+                                                                       // good for trying this test
             }
             // random data patterns
             for (uint8_t count = UINT8_C(0); count < RANDOM_TEST_COUNT; ++count)
             {
                 perform_Random_Pattern_Test(
-                    device, bufferSize,
-                    &testResults->randomTest[count]); // arbitrary number 10 was chosen since it sounded good for number
+                    device, bufferSize, &testResults->randomTest[count],
+                    &testResults->miscompareSummary); // arbitrary number 10 was chosen since it sounded good for number
                                                       // of times to try this pattern
             }
             stop_Timer(&totalTestingTime);
+
             testResults->totalTestTimeNS = get_Nano_Seconds(totalTestingTime);
         }
         else
@@ -631,6 +882,72 @@ eReturnValues perform_Cable_Test(tDevice* device, ptrCableTestResults testResult
     return ret;
 }
 
+static const char* get_Buffer_Miscompare_Type_String(eBufferMiscompareType type)
+{
+    switch (type)
+    {
+    case BUFFER_MISCOMPARE_NONE:
+        return "None";
+    case BUFFER_MISCOMPARE_RANDOM_BIT_ERRORS:
+        return "Random bit errors (check cable/connectors)";
+    case BUFFER_MISCOMPARE_BYTE_LANE:
+        return "Single byte lane (check HBA/expander/bridge)";
+    case BUFFER_MISCOMPARE_STUCK_BITS:
+        return "Stuck bits (check drive buffer or HBA data path)";
+    case BUFFER_MISCOMPARE_SHIFTED_DATA:
+        return "Shifted data (check HBA/driver)";
+    case BUFFER_MISCOMPARE_DROPPED_DWORDS:
+        return "Dropped dwords (check cable, HBA or expander)";
+    case BUFFER_MISCOMPARE_BULK_CORRUPTION:
+        return "Bulk corruption (check drive buffer/firmware)";
+    case BUFFER_MISCOMPARE_TYPE_COUNT:
+        break;
+    }
+    return "Unknown";
+}
+
+static void print_Buffer_Miscompare_Summary(ptrBufferMiscompareSummary summary)
+{
+    uint32_t totalMiscompares = UINT32_C(0);
+    for (uint32_t typeIter = UINT32_C(0); typeIter < BUFFER_MISCOMPARE_TYPE_COUNT; ++typeIter)
+    {
+        totalMiscompares += summary->miscompareTypeCount[typeIter];
+    }
+    if (totalMiscompares == UINT32_C(0))
+    {
+        return;
+    }
+    printf("\nMiscompare Analysis:\n");
+    for (uint32_t typeIter = UINT32_C(1); typeIter < BUFFER_MISCOMPARE_TYPE_COUNT; ++typeIter)
+    {
+        if (summary->miscompareTypeCount[typeIter] > UINT32_C(0))
+        {
+            printf("    %-50s %" PRIu32 "\n",
+                   get_Buffer_Miscompare_Type_String(M_STATIC_CAST(eBufferMiscompareType, typeIter)),
+                   summary->miscompareTypeCount[typeIter]);
+        }
+    }
+    printf("    Differing bytes: %" PRIu64 "\n", summary->differingBytes);
+    printf("    Flipped bits: %" PRIu64 " (0 -> 1: %" PRIu64 ", 1 -> 0: %" PRIu64 ")\n", summary->flippedBits,
+           summary->bitsSetWhenExpectedClear, summary->bitsClearWhenExpectedSet);
+    if (summary->stuckHighMask != UINT32_C(0) || summary->stuckLowMask != UINT32_C(0))
+    {
+        printf("    Stuck high bit mask (lane * 8 + bit): %08" PRIX32 "h\n", summary->stuckHighMask);
+        printf("    Stuck low bit mask (lane * 8 + bit): %08" PRIX32 "h\n", summary->stuckLowMask);
+    }
+    printf("    Flipped bits by byte lane and bit position:\n");
+    printf("        Lane  Bytes       Bit 0    Bit 1    Bit 2    Bit 3    Bit 4    Bit 5    Bit 6    Bit 7\n");
+    for (uint32_t lane = UINT32_C(0); lane < BUFFER_MISCOMPARE_BYTE_LANES; ++lane)
+    {
+        printf("        %-4" PRIu32 "  %-10" PRIu32, lane, summary->byteLaneHistogram[lane]);
+        for (uint32_t bitIter = UINT32_C(0); bitIter < UINT32_C(8); ++bitIter)
+        {
+            printf(" %8" PRIu32, summary->bitPositionHistogram[(lane * UINT32_C(8)) + bitIter]);
+        }
+        printf("\n");
+    }
+}
+
 void print_Cable_Test_Results(cableTestResults testResults)
 {
     printf("Test Results:\n");
@@ -763,4 +1080,456 @@ void print_Cable_Test_Results(cableTestResults testResults)
         print_Command_Time(testResults.randomTest[count].totalTimeNS);
         printf("\n");
     }
+    print_Buffer_Miscompare_Summary(&testResults.miscompareSummary);
+}
+
+// Bit errors on a link are rare independent events, so treat the error count as Poisson distributed.
+// Wilson-Hilferty approximation of the exact (chi-squared) Poisson confidence interval at 95% (z = 1.96). This stays
+// within a couple percent of the exact limits even for 0 or 1 errors, which is the common case on a good cable.
+static void calculate_Bit_Error_Rate_Bounds(uint64_t bitErrors, uint64_t bitsTransferred, double* lower, double* upper)
+{
+    const double zScore = 1.96;
+    double       errors = M_STATIC_CAST(double, bitErrors);
+    double       bits   = M_STATIC_CAST(double, bitsTransferred);
+    double       term   = 0.0;
+    *lower              = 0.0;
+    *upper              = 0.0;
+    if (bitsTransferred == UINT64_C(0))
+    {
+        return;
+    }
+    if (bitErrors > UINT64_C(0))
+    {
+        term = 1.0 - (1.0 / (9.0 * errors)) - (zScore / (3.0 * sqrt(errors)));
+        if (term > 0.0)
+        {
+            *lower = (errors * term * term * term) / bits;
+        }
+    }
+    term   = 1.0 - (1.0 / (9.0 * (errors + 1.0))) + (zScore / (3.0 * sqrt(errors + 1.0)));
+    *upper = ((errors + 1.0) * term * term * term) / bits;
+    if (*upper > 1.0)
+    {
+        *upper = 1.0;
+    }
+}
+
+static void fill_Cable_Stress_Pattern(eCableStressPattern pattern,
+                                      uint8_t*            patternBuffer,
+                                      uint32_t            bufferSize,
+                                      uint64_t*           walkingBitPosition)
+{
+    uint32_t bytePattern = UINT32_C(0);
+    switch (pattern)
+    {
+    case CABLE_STRESS_PATTERN_ALL_0:
+        bytePattern = UINT32_C(0x00000000);
+        break;
+    case CABLE_STRESS_PATTERN_ALL_F:
+        bytePattern = UINT32_C(0xFFFFFFFF);
+        break;
+    case CABLE_STRESS_PATTERN_ALL_5:
+        bytePattern = UINT32_C(0x55555555);
+        break;
+    case CABLE_STRESS_PATTERN_ALL_A:
+        bytePattern = UINT32_C(0xAAAAAAAA);
+        break;
+    case CABLE_STRESS_PATTERN_00FF55AA:
+        bytePattern = UINT32_C(0x00FF55AA);
+        break;
+    case CABLE_STRESS_PATTERN_WALKING_1:
+    case CABLE_STRESS_PATTERN_WALKING_0:
+    {
+        // Each pass moves the single set (or cleared) bit one position further into the buffer, wrapping at the end
+        uint64_t bitOffset  = *walkingBitPosition % (M_STATIC_CAST(uint64_t, bufferSize) * UINT64_C(8));
+        uint32_t byteNumber = M_STATIC_CAST(uint32_t, bitOffset / UINT64_C(8));
+        uint8_t  bitNumber  = M_STATIC_CAST(uint8_t, bitOffset % UINT64_C(8));
+        if (pattern == CABLE_STRESS_PATTERN_WALKING_0)
+        {
+            safe_memset(patternBuffer, bufferSize, 0xFF, bufferSize);
+            patternBuffer[byteNumber] ^= M_BitN8(bitNumber);
+        }
+        else
+        {
+            safe_memset(patternBuffer, bufferSize, 0, bufferSize);
+            patternBuffer[byteNumber] |= M_BitN8(bitNumber);
+        }
+        ++(*walkingBitPosition);
+        return;
+    }
+    case CABLE_STRESS_PATTERN_RANDOM:
+    case CABLE_STRESS_PATTERN_COUNT:
+        fill_Random_Pattern_In_Buffer(patternBuffer, bufferSize);
+        return;
+    }
+    fill_Pattern_Buffer_Into_Another_Buffer(C_CAST(uint8_t*, &bytePattern), sizeof(uint32_t), patternBuffer,
+                                            bufferSize);
+}
+
+typedef struct s_phyEventSummary
+{
+    uint64_t crcEvents;
+    uint64_t rErrEvents;
+    uint64_t readyTransitions;
+    uint64_t comresets;
+} phyEventSummary;
+
+// Collapse the standard phy event counters down to the few categories that matter for judging a cable.
+// Vendor unique counters are skipped since their meaning is not known here.
+static void summarize_SATA_Phy_Event_Counters(ptrSATAPhyEventCounters counters, phyEventSummary* summary)
+{
+    safe_memset(summary, sizeof(phyEventSummary), 0, sizeof(phyEventSummary));
+    for (uint8_t counterIter = UINT8_C(0);
+         counterIter < counters->numberOfCounters && counterIter < MAX_PHY_EVENT_COUNTERS; ++counterIter)
+    {
+        if (counters->counters[counterIter].vendorUnique)
+        {
+            continue;
+        }
+        switch (counters->counters[counterIter].eventID)
+        {
+        case SATA_PHY_EVENT_COMMAND_ICRC:
+        case SATA_PHY_EVENT_CRC_ERRORS_WITHIN_H2D_FIS:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_H2D_DATA_FIS_CRC:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_H2D_NONDATA_FIS_CRC:
+            summary->crcEvents += counters->counters[counterIter].counterValue;
+            break;
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_FOR_DATA_FIS:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_FOR_D2H_DATA_FIS:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_FOR_H2D_DATA_FIS:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_FOR_NON_DATA_FIS:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_FOR_D2H_NON_DATA_FIS:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_FOR_H2D_NON_DATA_FIS:
+        case SATA_PHY_EVENT_NON_CRC_ERRORS_WITHIN_H2D_FIS:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_H2D_DATA_FIS_NONCRC:
+        case SATA_PHY_EVENT_R_ERR_RESPONSE_H2D_NONDATA_FIS_NONCRC:
+            summary->rErrEvents += counters->counters[counterIter].counterValue;
+            break;
+        case SATA_PHY_EVENT_TRANSITIONS_FROM_PHYRDY_2_PHYRDYN:
+            summary->readyTransitions += counters->counters[counterIter].counterValue;
+            break;
+        case SATA_PHY_EVENT_H2D_FISES_SENT_DUE_TO_COMRESET:
+            summary->comresets += counters->counters[counterIter].counterValue;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// Counters can be reset by the drive (power cycle, or when they are read on some products) so never go negative
+static uint64_t phy_Event_Delta(uint64_t before, uint64_t after)
+{
+    if (after >= before)
+    {
+        return after - before;
+    }
+    return after;
+}
+
+static bool read_Phy_Event_Summary(tDevice* device, phyEventSummary* summary)
+{
+    bool                 valid = false;
+    sataPhyEventCounters counters;
+    safe_memset(&counters, sizeof(sataPhyEventCounters), 0, sizeof(sataPhyEventCounters));
+    if (SUCCESS == get_SATA_Phy_Event_Counters(device, &counters) && counters.valid)
+    {
+        summarize_SATA_Phy_Event_Counters(&counters, summary);
+        valid = true;
+    }
+    return valid;
+}
+
+// Called right after a command reported a CRC error. If the drive's phy counters moved since the last check, the
+// drive saw the bad frame too, which points at the cable/backplane rather than the host adapter or a bridge.
+static void correlate_CRC_Error_With_Phy_Events(tDevice*                  device,
+                                                ptrCableStressTestResults testResults,
+                                                phyEventSummary*          lastSummary)
+{
+    phyEventSummary currentSummary;
+    if (!testResults->phyEventCountersValid)
+    {
+        return;
+    }
+    safe_memset(&currentSummary, sizeof(phyEventSummary), 0, sizeof(phyEventSummary));
+    if (read_Phy_Event_Summary(device, &currentSummary))
+    {
+        if (phy_Event_Delta(lastSummary->crcEvents, currentSummary.crcEvents) > UINT64_C(0) ||
+            phy_Event_Delta(lastSummary->rErrEvents, currentSummary.rErrEvents) > UINT64_C(0))
+        {
+            ++(testResults->crcErrorsWithPhyEvent);
+        }
+        else
+        {
+            ++(testResults->crcErrorsWithoutPhyEvent);
+        }
+        safe_memcpy(lastSummary, sizeof(phyEventSummary), &currentSummary, sizeof(phyEventSummary));
+    }
+}
+
+// Sends one read or write buffer command and records it in the stress results.
+// Returns the command's result so the caller can decide whether to compare the data or stop the test.
+static eReturnValues cable_Stress_Transfer(tDevice*                  device,
+                                           bool                      writeBuffer,
+                                           uint8_t*                  buffer,
+                                           uint32_t                  bufferSize,
+                                           ptrPatternTestResults     patternResults,
+                                           ptrCableStressTestResults testResults,
+                                           phyEventSummary*          lastSummary)
+{
+    eReturnValues result = SUCCESS;
+    if (writeBuffer)
+    {
+        result = send_Write_Buffer_Command(device, buffer, bufferSize);
+    }
+    else
+    {
+        result = send_Read_Buffer_Command(device, buffer, bufferSize);
+    }
+    ++(patternResults->totalCommandsSent);
+    patternResults->totalTimeNS += device->drive_info.lastCommandTimeNanoSeconds;
+    testResults->totalCommandTimeNS += device->drive_info.lastCommandTimeNanoSeconds;
+    switch (result)
+    {
+    case OS_PASSTHROUGH_FAILURE:
+    case NOT_SUPPORTED:
+        break;
+    case OS_COMMAND_TIMEOUT:
+        // nothing is known to have crossed the cable, so this does not count toward the bit error rate
+        ++(patternResults->totalCommandTimeouts);
+        break;
+    case SUCCESS:
+        testResults->totalBytesTransferred += bufferSize;
+        break;
+    case ABORTED:
+    case COMMAND_FAILURE:
+    case FAILURE:
+    default:
+        if (was_There_A_CRC_Error_On_Last_Command(device))
+        {
+            // A CRC error means the data was sent and at least one bit was corrupted on the wire during this transfer
+            testResults->totalBytesTransferred += bufferSize;
+            ++(patternResults->totalCommandCRCErrors);
+            ++(testResults->totalBitErrors);
+            correlate_CRC_Error_With_Phy_Events(device, testResults, lastSummary);
+        }
+        break;
+    }
+    return result;
+}
+
+eReturnValues perform_Cable_Stress_Test(tDevice* device, uint32_t testSeconds, ptrCableStressTestResults testResults)
+{
+    eReturnValues ret           = SUCCESS;
+    uint8_t       offsetPO2     = UINT8_C(0);
+    uint32_t      bufferSize    = UINT32_C(0);
+    uint8_t*      patternBuffer = M_NULLPTR;
+    uint8_t*      returnBuffer  = M_NULLPTR;
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || testResults == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (testSeconds == UINT32_C(0))
+    {
+        testSeconds = CABLE_STRESS_TEST_DEFAULT_SECONDS;
+    }
+    else if (testSeconds > CABLE_STRESS_TEST_MAX_SECONDS)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!are_Buffer_Commands_Available(device) || SUCCESS != get_Buffer_Size(device, &bufferSize, &offsetPO2) ||
+        bufferSize == UINT32_C(0))
+    {
+        return NOT_SUPPORTED;
+    }
+    safe_memset(testResults, sizeof(cableStressTestResults), 0, sizeof(cableStressTestResults));
+    testResults->requestedTestSeconds = testSeconds;
+    testResults->bufferSize           = bufferSize;
+    patternBuffer = M_REINTERPRET_CAST(uint8_t*, safe_malloc_aligned(bufferSize, device->os_info.minimumAlignment));
+    returnBuffer  = M_REINTERPRET_CAST(uint8_t*, safe_malloc_aligned(bufferSize, device->os_info.minimumAlignment));
+    if (patternBuffer && returnBuffer)
+    {
+        phyEventSummary     startSummary;
+        phyEventSummary     lastSummary;
+        eCableStressPattern pattern            = CABLE_STRESS_PATTERN_ALL_0;
+        uint64_t            walking1Position   = UINT64_C(0);
+        uint64_t            walking0Position   = UINT64_C(0);
+        bool                stopTest           = false;
+        uint64_t            testMilliseconds   = M_STATIC_CAST(uint64_t, testSeconds) * UINT64_C(1000);
+        uint64_t            startMilliseconds  = get_Milliseconds_Since_Unix_Epoch();
+        uint64_t            endMilliseconds    = startMilliseconds + testMilliseconds;
+        uint64_t            lastProgressSecond = UINT64_C(0);
+        DECLARE_SEATIMER(totalTestingTime);
+        safe_memset(&startSummary, sizeof(phyEventSummary), 0, sizeof(phyEventSummary));
+        if (device->drive_info.drive_type == ATA_DRIVE)
+        {
+            testResults->phyEventCountersValid = read_Phy_Event_Summary(device, &startSummary);
+        }
+        safe_memcpy(&lastSummary, sizeof(phyEventSummary), &startSummary, sizeof(phyEventSummary));
+        start_Timer(&totalTestingTime);
+        while (!stopTest)
+        {
+            uint64_t              currentMilliseconds = get_Milliseconds_Since_Unix_Epoch();
+            ptrPatternTestResults patternResults      = &testResults->patternResults[pattern];
+            eReturnValues         transferResult      = SUCCESS;
+            if (currentMilliseconds >= endMilliseconds || currentMilliseconds < startMilliseconds)
+            {
+                break;
+            }
+            if (VERBOSITY_QUIET < device->deviceVerbosity &&
+                (currentMilliseconds - startMilliseconds) / UINT64_C(1000) != lastProgressSecond)
+            {
+                lastProgressSecond = (currentMilliseconds - startMilliseconds) / UINT64_C(1000);
+                printf("\r    Stress testing: %" PRIu64 " of %" PRIu32 " seconds", lastProgressSecond, testSeconds);
+                flush_stdout();
+            }
+            fill_Cable_Stress_Pattern(pattern, patternBuffer, bufferSize,
+                                      pattern == CABLE_STRESS_PATTERN_WALKING_0 ? &walking0Position
+                                                                                : &walking1Position);
+            transferResult = cable_Stress_Transfer(device, true, patternBuffer, bufferSize, patternResults,
+                                                   testResults, &lastSummary);
+            if (transferResult == SUCCESS)
+            {
+                safe_memset(returnBuffer, bufferSize, 0, bufferSize);
+                transferResult = cable_Stress_Transfer(device, false, returnBuffer, bufferSize, patternResults,
+                                                       testResults, &lastSummary);
+                if (transferResult == SUCCESS)
+                {
+                    ++(patternResults->totalBufferComparisons);
+                    testResults->totalBitsCompared += M_STATIC_CAST(uint64_t, bufferSize) * UINT64_C(8);
+                    if (memcmp(patternBuffer, returnBuffer, bufferSize) != 0)
+                    {
+                        ++(patternResults->totalBufferMiscompares);
+                        testResults->totalBitErrors += record_Buffer_Miscompare(
+                            patternBuffer, returnBuffer, bufferSize, &testResults->miscompareSummary);
+                    }
+                }
+            }
+            if (transferResult == OS_PASSTHROUGH_FAILURE || transferResult == NOT_SUPPORTED)
+            {
+                // cannot continue. Either the OS is not allowing these commands or the drive stopped accepting them
+                ret      = transferResult;
+                stopTest = true;
+            }
+            pattern = M_STATIC_CAST(eCableStressPattern, (pattern + 1) % CABLE_STRESS_PATTERN_COUNT);
+        }
+        stop_Timer(&totalTestingTime);
+        testResults->totalTestTimeNS = get_Nano_Seconds(totalTestingTime);
+        if (VERBOSITY_QUIET < device->deviceVerbosity)
+        {
+            printf("\n");
+        }
+        if (testResults->phyEventCountersValid)
+        {
+            phyEventSummary endSummary;
+            safe_memset(&endSummary, sizeof(phyEventSummary), 0, sizeof(phyEventSummary));
+            if (!read_Phy_Event_Summary(device, &endSummary))
+            {
+                // use the last successful read after a CRC error instead
+                safe_memcpy(&endSummary, sizeof(phyEventSummary), &lastSummary, sizeof(phyEventSummary));
+            }
+            testResults->phyCRCEventsDelta  = phy_Event_Delta(startSummary.crcEvents, endSummary.crcEvents);
+            testResults->phyRErrEventsDelta = phy_Event_Delta(startSummary.rErrEvents, endSummary.rErrEvents);
+            testResults->phyReadyTransitionsDelta =
+                phy_Event_Delta(startSummary.readyTransitions, endSummary.readyTransitions);
+            testResults->phyCOMRESETDelta = phy_Event_Delta(startSummary.comresets, endSummary.comresets);
+        }
+        if (testResults->totalCommandTimeNS > UINT64_C(0))
+        {
+            testResults->throughputMBPerSecond = (M_STATIC_CAST(double, testResults->totalBytesTransferred) /
+                                                  (M_STATIC_CAST(double, testResults->totalCommandTimeNS) / 1e9)) /
+                                                 1e6;
+        }
+        if (testResults->totalBytesTransferred > UINT64_C(0))
+        {
+            uint64_t bitsTransferred = testResults->totalBytesTransferred * UINT64_C(8);
+            testResults->estimatedBitErrorRate =
+                M_STATIC_CAST(double, testResults->totalBitErrors) / M_STATIC_CAST(double, bitsTransferred);
+            calculate_Bit_Error_Rate_Bounds(testResults->totalBitErrors, bitsTransferred,
+                                            &testResults->bitErrorRateLowerBound,
+                                            &testResults->bitErrorRateUpperBound);
+        }
+    }
+    else
+    {
+        ret = MEMORY_FAILURE;
+    }
+    safe_free_aligned(&patternBuffer);
+    safe_free_aligned(&returnBuffer);
+    return ret;
+}
+
+static const char* get_Cable_Stress_Pattern_Name(eCableStressPattern pattern)
+{
+    switch (pattern)
+    {
+    case CABLE_STRESS_PATTERN_ALL_0:
+        return "00h";
+    case CABLE_STRESS_PATTERN_ALL_F:
+        return "FFh";
+    case CABLE_STRESS_PATTERN_ALL_5:
+        return "55h";
+    case CABLE_STRESS_PATTERN_ALL_A:
+        return "AAh";
+    case CABLE_STRESS_PATTERN_00FF55AA:
+        return "00FF55AAh";
+    case CABLE_STRESS_PATTERN_WALKING_1:
+        return "Walking 1's";
+    case CABLE_STRESS_PATTERN_WALKING_0:
+        return "Walking 0's";
+    case CABLE_STRESS_PATTERN_RANDOM:
+        return "Random";
+    case CABLE_STRESS_PATTERN_COUNT:
+        break;
+    }
+    return "Unknown";
+}
+
+void print_Cable_Stress_Test_Results(ptrCableStressTestResults testResults)
+{
+    DISABLE_NONNULL_COMPARE
+    if (testResults == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    printf("Stress Test Results:\n");
+    printf("====================\n");
+    printf("Requested test time: %" PRIu32 " seconds\n", testResults->requestedTestSeconds);
+    printf("Total test time: ");
+    print_Command_Time(testResults->totalTestTimeNS);
+    printf("\n");
+    printf("Transfer size: %" PRIu32 " bytes\n", testResults->bufferSize);
+    printf("Total bytes transferred: %" PRIu64 "\n", testResults->totalBytesTransferred);
+    printf("Throughput: %0.02f MB/s\n", testResults->throughputMBPerSecond);
+    printf("\n%-12s %10s %10s %10s %12s %12s\n", "Pattern", "Commands", "CRC Errs", "Timeouts", "Comparisons",
+           "Miscompares");
+    for (uint8_t patternIter = UINT8_C(0); patternIter < CABLE_STRESS_PATTERN_COUNT; ++patternIter)
+    {
+        ptrPatternTestResults patternResults = &testResults->patternResults[patternIter];
+        printf("%-12s %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %12" PRIu32 " %12" PRIu32 "\n",
+               get_Cable_Stress_Pattern_Name(M_STATIC_CAST(eCableStressPattern, patternIter)),
+               patternResults->totalCommandsSent, patternResults->totalCommandCRCErrors,
+               patternResults->totalCommandTimeouts, patternResults->totalBufferComparisons,
+               patternResults->totalBufferMiscompares);
+    }
+    printf("\nBits compared: %" PRIu64 "\n", testResults->totalBitsCompared);
+    printf("Bit errors: %" PRIu64 "\n", testResults->totalBitErrors);
+    printf("Estimated bit error rate: %e\n", testResults->estimatedBitErrorRate);
+    printf("    95%% confidence interval: %e to %e\n", testResults->bitErrorRateLowerBound,
+           testResults->bitErrorRateUpperBound);
+    if (testResults->phyEventCountersValid)
+    {
+        printf("\nSATA Phy Event Counter changes during test:\n");
+        printf("    CRC events: %" PRIu64 "\n", testResults->phyCRCEventsDelta);
+        printf("    R_ERR/Non-CRC FIS errors: %" PRIu64 "\n", testResults->phyRErrEventsDelta);
+        printf("    PHYRDY to PHYRDYn transitions: %" PRIu64 "\n", testResults->phyReadyTransitionsDelta);
+        printf("    COMRESETs: %" PRIu64 "\n", testResults->phyCOMRESETDelta);
+        printf("    Command CRC errors also seen by the drive phy: %" PRIu32 "\n", testResults->crcErrorsWithPhyEvent);
+        printf("    Command CRC errors not seen by the drive phy: %" PRIu32 "\n",
+               testResults->crcErrorsWithoutPhyEvent);
+    }
+    print_Buffer_Miscompare_Summary(&testResults->miscompareSummary);
 }
@@ -56,7 +56,7 @@ static eReturnValues get_ATA_CDL_Settings(tDevice* device, tCDLSettings* cdlSett
     // read the logaddress 0x18, logpage 0x00
     // Note - read this page at begining, as this will tell if the feature is supported or not
     uint32_t logSize = 0;
-    ret              = get_ATA_Log_Size(device, ATA_LOG_COMMAND_DURATION_LIMITS_LOG, &logSize, true, false);
+    ret              = get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_COMMAND_DURATION_LIMITS_LOG, &logSize, true, false);
     if (ret == SUCCESS)
     {
         uint8_t* logBuffer = safe_calloc_aligned(logSize, sizeof(uint8_t), device->os_info.minimumAlignment);
@@ -832,7 +832,7 @@ static eReturnValues config_ATA_CDL_Settings(tDevice* device, tCDLSettings* cdlS
 
     // read current CDL settings
     uint32_t logSize = 0;
-    ret              = get_ATA_Log_Size(device, ATA_LOG_COMMAND_DURATION_LIMITS_LOG, &logSize, true, false);
+    ret              = get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_COMMAND_DURATION_LIMITS_LOG, &logSize, true, false);
     if (ret == SUCCESS)
     {
         uint8_t* logBuffer = safe_calloc_aligned(logSize, sizeof(uint8_t), device->os_info.minimumAlignment);
@@ -1010,8 +1010,8 @@ static eReturnValues config_SCSI_CDL_Settings(tDevice* device, tCDLSettings* cdl
             }
 
             // now send the modified data to drive
-            ret = scsi_Mode_Select_10(device, C_CAST(uint16_t, modePageLength), true, true, false, modeData,
-                                      modePageLength);
+            ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, C_CAST(uint16_t, modePageLength), true, true, false,
+                                             modeData, modePageLength);
             if (ret != SUCCESS)
             {
                 safe_free_aligned(&modeData);
@@ -1091,8 +1091,8 @@ static eReturnValues config_SCSI_CDL_Settings(tDevice* device, tCDLSettings* cdl
             }
 
             // now send the modified data to drive
-            ret = scsi_Mode_Select_10(device, C_CAST(uint16_t, modePageLength), true, true, false, modeData,
-                                      modePageLength);
+            ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, C_CAST(uint16_t, modePageLength), true, true, false,
+                                             modeData, modePageLength);
             if (ret != SUCCESS)
             {
                 safe_free_aligned(&modeData);
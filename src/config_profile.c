@@ -0,0 +1,476 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file config_profile.c
+// \brief This file defines the functions for applying a set of device settings as a single profile.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "error_translation.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "cdl.h"
+#include "config_profile.h"
+#include "logs.h"
+#include "operations.h"
+#include "power_control.h"
+#include "seagate_operations.h"
+
+static void set_Config_Profile_Setting_Result(configProfileSettingResult* setting,
+                                              bool                        changed,
+                                              eReturnValues               result,
+                                              uint64_t                    startMilliseconds)
+{
+    setting->requested            = true;
+    setting->changed              = changed;
+    setting->result               = result;
+    setting->durationMilliseconds = get_Milliseconds_Since_Unix_Epoch() - startMilliseconds;
+}
+
+// Write cache enable (WCE) and read ahead disable (DRA) both live on the caching mode page, so read it once, change
+// whichever bits differ from the profile and send it back with a single MODE SELECT.
+static void scsi_Apply_Caching_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    uint64_t      start            = get_Milliseconds_Since_Unix_Epoch();
+    bool          writeCacheChange = false;
+    bool          lookAheadChange  = false;
+    bool          mode6ByteCmd     = false;
+    uint8_t       headerLength     = MODE_PARAMETER_HEADER_10_LEN;
+    eReturnValues ret              = SUCCESS;
+    uint8_t*      cachingModePage  =
+        M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, sizeof(uint8_t),
+                                                         device->os_info.minimumAlignment));
+    if (cachingModePage == M_NULLPTR)
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else
+    {
+        ret = cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0,
+                                        true, false, MPC_CURRENT_VALUES, cachingModePage);
+        if (ret != SUCCESS &&
+            SUCCESS == scsi_Mode_Sense_6(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_6_LEN, 0, true,
+                                         MPC_CURRENT_VALUES, cachingModePage))
+        {
+            ret          = SUCCESS;
+            mode6ByteCmd = true;
+            headerLength = MODE_PARAMETER_HEADER_6_LEN;
+        }
+    }
+    if (ret == SUCCESS)
+    {
+        uint8_t* page = &cachingModePage[headerLength];
+        if (profile->writeCacheValid && M_ToBool(page[2] & BIT2) != profile->writeCacheEnable)
+        {
+            writeCacheChange = true;
+            if (profile->writeCacheEnable)
+            {
+                M_SET_BIT8(page[2], 2);
+            }
+            else
+            {
+                M_CLEAR_BIT8(page[2], 2);
+            }
+        }
+        if (profile->readLookAheadValid && M_ToBool(page[12] & BIT5) == profile->readLookAheadEnable)
+        {
+            lookAheadChange = true;
+            if (profile->readLookAheadEnable)
+            {
+                M_CLEAR_BIT8(page[12], 5);
+            }
+            else
+            {
+                M_SET_BIT8(page[12], 5);
+            }
+        }
+        if (writeCacheChange || lookAheadChange)
+        {
+            // mode data length is reserved for MODE SELECT, as is the PS bit. Medium type, device specific parameter
+            // and block descriptor length are cleared the same way scsi_Set_Write_Cache() does.
+            safe_memset(cachingModePage, headerLength, 0, headerLength);
+            M_CLEAR_BIT8(page[0], 7);
+            if (mode6ByteCmd)
+            {
+                ret = scsi_Mode_Select_6(device, MP_CACHING_LEN + MODE_PARAMETER_HEADER_6_LEN, true, true, false,
+                                         cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_6_LEN);
+            }
+            else
+            {
+                ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, true,
+                                                 true, false, cachingModePage,
+                                                 MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
+            }
+        }
+    }
+    safe_free_aligned(&cachingModePage);
+    // both settings were handled by the same commands, so they share the time taken
+    if (profile->writeCacheValid)
+    {
+        set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_WRITE_CACHE], writeCacheChange, ret, start);
+    }
+    if (profile->readLookAheadValid)
+    {
+        set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_READ_LOOK_AHEAD], lookAheadChange, ret,
+                                          start);
+    }
+}
+
+static void apply_Write_Cache_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    uint64_t      start   = get_Milliseconds_Since_Unix_Epoch();
+    bool          changed = false;
+    eReturnValues ret     = SUCCESS;
+    if (!is_Write_Cache_Supported(device))
+    {
+        ret = NOT_SUPPORTED;
+    }
+    else if (is_Write_Cache_Enabled(device) != profile->writeCacheEnable)
+    {
+        changed = true;
+        ret     = set_Write_Cache(device, profile->writeCacheEnable);
+    }
+    set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_WRITE_CACHE], changed, ret, start);
+}
+
+static void apply_Read_Look_Ahead_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    uint64_t      start   = get_Milliseconds_Since_Unix_Epoch();
+    bool          changed = false;
+    eReturnValues ret     = SUCCESS;
+    if (!is_Read_Look_Ahead_Supported(device))
+    {
+        ret = NOT_SUPPORTED;
+    }
+    else if (is_Read_Look_Ahead_Enabled(device) != profile->readLookAheadEnable)
+    {
+        changed = true;
+        ret     = set_Read_Look_Ahead(device, profile->readLookAheadEnable);
+    }
+    set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_READ_LOOK_AHEAD], changed, ret, start);
+}
+
+static void apply_Sense_Data_Format_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    uint64_t      start   = get_Milliseconds_Since_Unix_Epoch();
+    bool          changed = false;
+    eReturnValues ret     = SUCCESS;
+    bool          dSense  = false;
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, controlModePage, MODE_PARAMETER_HEADER_10_LEN + MP_CONTROL_LEN);
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CONTROL,
+                                             MODE_PARAMETER_HEADER_10_LEN + MP_CONTROL_LEN, 0, true, false,
+                                             MPC_CURRENT_VALUES, controlModePage))
+    {
+        dSense = M_ToBool(controlModePage[MODE_PARAMETER_HEADER_10_LEN + 2] & BIT2);
+    }
+    else if (SUCCESS == scsi_Mode_Sense_6(device, MP_CONTROL, MODE_PARAMETER_HEADER_6_LEN + MP_CONTROL_LEN, 0, true,
+                                          MPC_CURRENT_VALUES, controlModePage))
+    {
+        dSense = M_ToBool(controlModePage[MODE_PARAMETER_HEADER_6_LEN + 2] & BIT2);
+    }
+    else
+    {
+        ret = NOT_SUPPORTED;
+    }
+    if (ret == SUCCESS && dSense != profile->senseDataDescriptorFormat)
+    {
+        changed = true;
+        ret = set_Sense_Data_Format(device, false, profile->senseDataDescriptorFormat, profile->senseDataFormatSave);
+    }
+    set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_SENSE_DATA_FORMAT], changed, ret, start);
+}
+
+static bool power_Condition_Matches(const powerConditionSettings* wanted, const powerConditionInfo* current)
+{
+    if (!wanted->powerConditionValid)
+    {
+        return true;
+    }
+    if (wanted->restoreToDefault)
+    {
+        return current->currentTimerEnabled == current->defaultTimerEnabled &&
+               current->currentTimerSetting == current->defaultTimerSetting;
+    }
+    if (wanted->enableValid && current->currentTimerEnabled != wanted->enable)
+    {
+        return false;
+    }
+    if (wanted->timerValid && current->currentTimerSetting != wanted->timerInHundredMillisecondIncrements)
+    {
+        return false;
+    }
+    return true;
+}
+
+static bool power_Conditions_Match(ptrPowerConditionTimers wanted, ptrEpcSettings current)
+{
+    if (wanted->powerModeBackgroundValid || wanted->checkConditionFlags.ccfIdleValid ||
+        wanted->checkConditionFlags.ccfStandbyValid || wanted->checkConditionFlags.ccfStopValid)
+    {
+        // these SAS fields are not reported by get_EPC_Settings(), so they always need to be sent
+        return false;
+    }
+    return power_Condition_Matches(&wanted->idle_a, &current->idle_a) &&
+           power_Condition_Matches(&wanted->idle_b, &current->idle_b) &&
+           power_Condition_Matches(&wanted->idle_c, &current->idle_c) &&
+           power_Condition_Matches(&wanted->standby_y, &current->standby_y) &&
+           power_Condition_Matches(&wanted->standby_z, &current->standby_z);
+}
+
+static void apply_Power_Conditions_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    uint64_t    start   = get_Milliseconds_Since_Unix_Epoch();
+    bool        changed = true;
+    epcSettings current;
+    safe_memset(&current, sizeof(epcSettings), 0, sizeof(epcSettings));
+    // If the current settings cannot be read the change is sent anyway and the set function reports whether the
+    // device supports it.
+    if (SUCCESS == get_EPC_Settings(device, &current) && power_Conditions_Match(&profile->powerConditions, &current))
+    {
+        changed = false;
+    }
+    eReturnValues ret = SUCCESS;
+    if (changed)
+    {
+        ret = set_EPC_Power_Conditions(device, false, &profile->powerConditions, profile->powerConditionsSave);
+    }
+    set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_POWER_CONDITIONS], changed, ret, start);
+}
+
+static bool cdl_Descriptors_Match(const tCDLDescriptor* wanted, const tCDLDescriptor* current, uint8_t count)
+{
+    for (uint8_t iter = UINT8_C(0); iter < count; ++iter)
+    {
+        if (wanted[iter].timeFieldUnitType != current[iter].timeFieldUnitType ||
+            wanted[iter].inactiveTimePolicy != current[iter].inactiveTimePolicy ||
+            wanted[iter].activeTimePolicy != current[iter].activeTimePolicy ||
+            wanted[iter].totalTimePolicy != current[iter].totalTimePolicy ||
+            wanted[iter].activeTime != current[iter].activeTime ||
+            wanted[iter].inactiveTime != current[iter].inactiveTime ||
+            wanted[iter].totalTime != current[iter].totalTime)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool cdl_Settings_Match(tDevice* device, const tCDLSettings* wanted, const tCDLSettings* current)
+{
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        return wanted->ataCDLSettings.performanceVsCommandCompletion ==
+                   current->ataCDLSettings.performanceVsCommandCompletion &&
+               cdl_Descriptors_Match(wanted->ataCDLSettings.cdlReadDescriptor,
+                                     current->ataCDLSettings.cdlReadDescriptor, MAX_CDL_READ_DESCRIPTOR) &&
+               cdl_Descriptors_Match(wanted->ataCDLSettings.cdlWriteDescriptor,
+                                     current->ataCDLSettings.cdlWriteDescriptor, MAX_CDL_WRITE_DESCRIPTOR);
+    }
+    return wanted->scsiCDLSettings.performanceVsCommandDurationGuidelines ==
+               current->scsiCDLSettings.performanceVsCommandDurationGuidelines &&
+           cdl_Descriptors_Match(wanted->scsiCDLSettings.cdlT2ADescriptor, current->scsiCDLSettings.cdlT2ADescriptor,
+                                 MAX_CDL_T2A_DESCRIPTOR) &&
+           cdl_Descriptors_Match(wanted->scsiCDLSettings.cdlT2BDescriptor, current->scsiCDLSettings.cdlT2BDescriptor,
+                                 MAX_CDL_T2B_DESCRIPTOR);
+}
+
+static void apply_CDL_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    uint64_t     start   = get_Milliseconds_Since_Unix_Epoch();
+    bool         changed = false;
+    tCDLSettings current;
+    safe_memset(&current, sizeof(tCDLSettings), 0, sizeof(tCDLSettings));
+    eReturnValues ret = get_CDL_Settings(device, &current);
+    if (ret == SUCCESS && !current.isSupported)
+    {
+        ret = NOT_SUPPORTED;
+    }
+    if (ret == SUCCESS && !cdl_Settings_Match(device, &profile->cdlSettings, &current))
+    {
+        changed = true;
+        ret     = config_CDL_Settings(device, &profile->cdlSettings);
+    }
+    set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_CDL], changed, ret, start);
+}
+
+static void apply_JIT_Modes_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    uint64_t        start   = get_Milliseconds_Since_Unix_Epoch();
+    bool            changed = false;
+    seagateJITModes current;
+    safe_memset(&current, sizeof(seagateJITModes), 0, sizeof(seagateJITModes));
+    eReturnValues ret = seagate_Get_JIT_Modes(device, &current);
+    if (ret == SUCCESS)
+    {
+        // seagate_Set_JIT_Modes() enables the requested mode and every slower mode. Anything above 3 is treated as 0.
+        uint8_t jitMode = profile->jitMode > 3 ? UINT8_C(0) : profile->jitMode;
+        if (current.vJIT == profile->jitDisableVjit || current.jit0 != (jitMode == 0) ||
+            current.jit1 != (jitMode <= 1) || current.jit2 != (jitMode <= 2) || !current.jit3)
+        {
+            changed = true;
+            ret = seagate_Set_JIT_Modes(device, profile->jitDisableVjit, jitMode, false, profile->jitModesSave);
+        }
+    }
+    set_Config_Profile_Setting_Result(&result->settings[CONFIG_PROFILE_JIT_MODES], changed, ret, start);
+}
+
+eReturnValues apply_Config_Profile(tDevice* device, ptrConfigProfile profile, ptrConfigProfileResult result)
+{
+    eReturnValues       ret = SUCCESS;
+    configProfileResult localResult;
+    uint64_t            start = get_Milliseconds_Since_Unix_Epoch();
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || profile == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(&localResult, sizeof(configProfileResult), 0, sizeof(configProfileResult));
+    if (device->drive_info.drive_type == SCSI_DRIVE && (profile->writeCacheValid || profile->readLookAheadValid))
+    {
+        scsi_Apply_Caching_Profile(device, profile, &localResult);
+    }
+    else
+    {
+        if (profile->writeCacheValid)
+        {
+            apply_Write_Cache_Profile(device, profile, &localResult);
+        }
+        if (profile->readLookAheadValid)
+        {
+            apply_Read_Look_Ahead_Profile(device, profile, &localResult);
+        }
+    }
+    if (profile->senseDataFormatValid)
+    {
+        apply_Sense_Data_Format_Profile(device, profile, &localResult);
+    }
+    if (profile->powerConditionsValid)
+    {
+        apply_Power_Conditions_Profile(device, profile, &localResult);
+    }
+    if (profile->cdlValid)
+    {
+        apply_CDL_Profile(device, profile, &localResult);
+    }
+    if (profile->jitModesValid)
+    {
+        apply_JIT_Modes_Profile(device, profile, &localResult);
+    }
+    bool anySupported = false;
+    bool anyRequested = false;
+    for (uint8_t iter = UINT8_C(0); iter < CONFIG_PROFILE_SETTING_COUNT; ++iter)
+    {
+        configProfileSettingResult* setting = &localResult.settings[iter];
+        if (!setting->requested)
+        {
+            continue;
+        }
+        anyRequested = true;
+        if (setting->result != NOT_SUPPORTED)
+        {
+            anySupported = true;
+        }
+        if (setting->result != SUCCESS)
+        {
+            ++localResult.settingsFailed;
+            if (ret == SUCCESS)
+            {
+                ret = setting->result;
+            }
+        }
+        else if (setting->changed)
+        {
+            ++localResult.settingsChanged;
+        }
+        else
+        {
+            ++localResult.settingsUnchanged;
+        }
+    }
+    if (anyRequested && !anySupported)
+    {
+        ret = NOT_SUPPORTED;
+    }
+    localResult.totalMilliseconds = get_Milliseconds_Since_Unix_Epoch() - start;
+    if (result != M_NULLPTR)
+    {
+        safe_memcpy(result, sizeof(configProfileResult), &localResult, sizeof(configProfileResult));
+    }
+    return ret;
+}
+
+eReturnValues apply_Config_Profile_To_Devices(tDevice*               deviceList,
+                                              uint32_t               numberOfDevices,
+                                              ptrConfigProfile       profile,
+                                              ptrConfigProfileResult results)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (deviceList == M_NULLPTR || profile == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    for (uint32_t deviceIter = UINT32_C(0); deviceIter < numberOfDevices; ++deviceIter)
+    {
+        eReturnValues deviceRet = apply_Config_Profile(&deviceList[deviceIter], profile,
+                                                       results != M_NULLPTR ? &results[deviceIter] : M_NULLPTR);
+        if (deviceRet != SUCCESS && ret == SUCCESS)
+        {
+            ret = deviceRet;
+        }
+    }
+    return ret;
+}
+
+void print_Config_Profile_Result(ptrConfigProfileResult result)
+{
+    static const char* settingNames[CONFIG_PROFILE_SETTING_COUNT] = {
+        "Write Cache", "Read Look-Ahead", "Sense Data Format", "Power Conditions", "Command Duration Limits",
+        "JIT Modes"};
+    DISABLE_NONNULL_COMPARE
+    if (result == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    printf("\nConfiguration Profile Results:\n");
+    for (uint8_t iter = UINT8_C(0); iter < CONFIG_PROFILE_SETTING_COUNT; ++iter)
+    {
+        configProfileSettingResult* setting = &result->settings[iter];
+        const char*                 status  = "Unchanged";
+        if (!setting->requested)
+        {
+            continue;
+        }
+        if (setting->result == NOT_SUPPORTED)
+        {
+            status = "Not Supported";
+        }
+        else if (setting->result != SUCCESS)
+        {
+            status = "Failed";
+        }
+        else if (setting->changed)
+        {
+            status = "Changed";
+        }
+        printf("\t%-24s %-14s %" PRIu64 "ms\n", settingNames[iter], status, setting->durationMilliseconds);
+    }
+    printf("\tChanged: %" PRIu32 "  Unchanged: %" PRIu32 "  Failed: %" PRIu32 "  Total time: %" PRIu64 "ms\n",
+           result->settingsChanged, result->settingsUnchanged, result->settingsFailed, result->totalMilliseconds);
+}
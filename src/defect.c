@@ -1472,7 +1472,7 @@ eReturnValues get_LBAs_From_ATA_Pending_List(tDevice* device, ptrPendingDefect d
         // Check if the ACS pending log is supported and use that INSTEAD of the Seagate log...always use std spec when
         // we can
         uint32_t pendingLogSize = UINT32_C(0);
-        get_ATA_Log_Size(device, ATA_LOG_PENDING_DEFECTS_LOG, &pendingLogSize, true, false);
+        get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_PENDING_DEFECTS_LOG, &pendingLogSize, true, false);
         if (pendingLogSize > 0)
         {
             // ACS Pending List
@@ -28,752 +28,671 @@
 #include "device_statistics.h"
 #include "logs.h"
 
-M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_general_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+// How a statistic from one of the tables below is shown by print_DeviceStatistics()
+typedef enum eDevStatDisplayEnum
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsGeneralOffsets, byteOffsetOnPage))
+    DEV_STAT_DISPLAY_COUNT,
+    DEV_STAT_DISPLAY_COUNT_PERCENT_IF_NORMALIZED,
+    DEV_STAT_DISPLAY_DATE_AND_TIME,
+    DEV_STAT_DISPLAY_WORKLOAD_UTILIZATION,
+    DEV_STAT_DISPLAY_UTILIZATION_USAGE_RATE,
+    DEV_STAT_DISPLAY_RESOURCE_AVAILABILITY,
+    DEV_STAT_DISPLAY_RANDOM_WRITE_RESOURCES_USED,
+    DEV_STAT_DISPLAY_TEMPERATURE,
+    DEV_STAT_DISPLAY_TIME_MINUTES,
+} eDevStatDisplay;
+
+// One statistic on an ATA device statistics page or SCSI log page and where it is stored in deviceStatistics.
+// Adding a statistic that is decoded the same way as its neighbours only needs a new entry here.
+typedef struct s_devStatField
+{
+    uint16_t        location;    // ATA: byte offset on the page. SCSI: parameter code
+    size_t          fieldOffset; // offset of the statistic in sataDeviceStatistics or sasDeviceStatitics
+    eDevStatDisplay display;
+    const char*     name;
+    const char*     unit;
+} devStatField;
+
+#define DEV_STAT_PAGE_ALL_F_IS_INVALID BIT0 // a value of all F's means the statistic is not valid
+
+typedef struct s_devStatPage
+{
+    uint8_t             page;
+    uint8_t             subpage;
+    uint16_t            parameterPointer; // SCSI only. First parameter to request
+    uint16_t            flags;
+    size_t              supportedOffset; // offset of the bool saying the page is supported
+    const char*         title;           // M_NULLPTR when the page is printed separately
+    const devStatField* fields;
+    size_t              numberOfFields;
+} devStatPage;
+
+#define ATA_DEV_STAT(location, member, display, name, unit)                                                            \
+    {                                                                                                                  \
+        M_STATIC_CAST(uint16_t, location), offsetof(sataDeviceStatistics, member), display, name, unit                 \
+    }
+
+#define SCSI_DEV_STAT(parameterCode, member, name, unit)                                                               \
+    {                                                                                                                  \
+        M_STATIC_CAST(uint16_t, parameterCode), offsetof(sasDeviceStatitics, member), DEV_STAT_DISPLAY_COUNT, name,    \
+            unit                                                                                                       \
+    }
+
+static const devStatField ataGeneralStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_LIFETIME_POR, lifetimePoweronResets, DEV_STAT_DISPLAY_COUNT,
+                 "LifeTime Power-On Resets", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_POH, powerOnHours, DEV_STAT_DISPLAY_COUNT, "Power-On Hours", "hours"),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_LBA_WRITTEN, logicalSectorsWritten, DEV_STAT_DISPLAY_COUNT,
+                 "Logical Sectors Written", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_NUM_WRITE_CMDS, numberOfWriteCommands, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of Write Commands", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_LBA_READ, logicalSectorsRead, DEV_STAT_DISPLAY_COUNT, "Logical Sectors Read",
+                 M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_NUM_READ_CMDS, numberOfReadCommands, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of Read Commands", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_DATE_AND_TIME_TIMESTAMP, dateAndTimeTimestamp, DEV_STAT_DISPLAY_DATE_AND_TIME,
+                 "Date And Time Timestamp", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_PENDING_ERR_CNT, pendingErrorCount, DEV_STAT_DISPLAY_COUNT, "Pending Error Count",
+                 M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_WORKLOAD_UTIL, workloadUtilization, DEV_STAT_DISPLAY_WORKLOAD_UTILIZATION,
+                 "Workload Utilization", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_UTIL_USAGE_RATE, utilizationUsageRate, DEV_STAT_DISPLAY_UTILIZATION_USAGE_RATE,
+                 "Utilization Usage Rate", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_RESOURCE_AVAIL, resourceAvailability, DEV_STAT_DISPLAY_RESOURCE_AVAILABILITY,
+                 "Resource Availability", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERAL_RAND_WRITE_RESOURCE_USED, randomWriteResourcesUsed,
+                 DEV_STAT_DISPLAY_RANDOM_WRITE_RESOURCES_USED, "Random Write Resources Used", M_NULLPTR),
+};
+
+static const devStatField ataFreeFallStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_FREEFALL_NUM_FREEFALL_EVENTS, numberOfFreeFallEventsDetected, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of Free-Fall Events Detected", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_FREEFALL_OVERLIM_SHOCK_EVENT, overlimitShockEvents, DEV_STAT_DISPLAY_COUNT,
+                 "Overlimit Shock Events", M_NULLPTR),
+};
+
+static const devStatField ataRotatingMediaStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_SPINDLE_MOTOR_POH, spindleMotorPoweronHours, DEV_STAT_DISPLAY_COUNT,
+                 "Spindle Motor Power-On Hours", "hours"),
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_HEAD_FLYING_HOURS, headFlyingHours, DEV_STAT_DISPLAY_COUNT, "Head Flying Hours",
+                 "hours"),
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_HEAD_LOAD_EVENTS, headLoadEvents, DEV_STAT_DISPLAY_COUNT, "Head Load Events",
+                 M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_NUM_REALLOCATED_LBA, numberOfReallocatedLogicalSectors,
+                 DEV_STAT_DISPLAY_COUNT_PERCENT_IF_NORMALIZED, "Number Of Reallocated Logical Sectors", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_READ_RECOVERY_ATTEMPTS, readRecoveryAttempts, DEV_STAT_DISPLAY_COUNT,
+                 "Read Recovery Attempts", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_NUM_MECH_START_FAILURE, numberOfMechanicalStartFailures, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of Mechanical Start Failures", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_NUM_REALLOCATION_CANDIDATE_LBA, numberOfReallocationCandidateLogicalSectors,
+                 DEV_STAT_DISPLAY_COUNT, "Number Of Reallocation Candidate Logical Sectors", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ROTATING_NUM_HIGH_PRIO_UNLOAD_EVENTS, numberOfHighPriorityUnloadEvents,
+                 DEV_STAT_DISPLAY_COUNT, "Number Of High Priority Unload Events", M_NULLPTR),
+};
+
+static const devStatField ataGeneralErrorsStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERR_NUM_REPORTED_UNCOR_ERR, numberOfReportedUncorrectableErrors,
+                 DEV_STAT_DISPLAY_COUNT, "Number Of Reported Uncorrectable Errors", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERR_NUM_RESETS_BETWEEN_CMD_ACCEPT_AND_COMPLETE,
+                 numberOfResetsBetweenCommandAcceptanceAndCommandCompletion, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of Resets Between Command Acceptance and Completion", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_GENERR_PHYSICAL_ELEMENT_STATUS_CHANGE, physicalElementStatusChanged,
+                 DEV_STAT_DISPLAY_COUNT, "Physical Element Status Changed", M_NULLPTR),
+};
+
+static const devStatField ataTemperatureStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_CURRENT_TEMP, currentTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Current Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_AVG_SHORT_TEMP, averageShortTermTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Average Short Term Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_AVG_LONG_TEMP, averageLongTermTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Average Long Term Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_HIGHEST_TEMP, highestTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Highest Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_LOWEST_TEMP, lowestTemperature, DEV_STAT_DISPLAY_TEMPERATURE, "Lowest Temperature",
+                 M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_HIGH_AVG_SHORT_TEMP, highestAverageShortTermTemperature,
+                 DEV_STAT_DISPLAY_TEMPERATURE, "Highest Average Short Term Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_LOW_AVG_SHORT_TEMP, lowestAverageShortTermTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Lowest Average Short Term Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_HIGH_AVG_LONG_TEMP, highestAverageLongTermTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Highest Average Long Term Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_LOW_AVG_LONG_TEMP, lowestAverageLongTermTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Lowest Average Long Term Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_TIME_OVER_TEMP, timeInOverTemperature, DEV_STAT_DISPLAY_TIME_MINUTES,
+                 "Time In Over Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_SPEC_MAX_TEMP, specifiedMaximumOperatingTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Specified Maximum Operating Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_TIME_UNDER_TEMP, timeInUnderTemperature, DEV_STAT_DISPLAY_TIME_MINUTES,
+                 "Time In Under Temperature", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TEMP_SPEC_MIN_TEMP, specifiedMinimumOperatingTemperature, DEV_STAT_DISPLAY_TEMPERATURE,
+                 "Specified Minimum Operating Temperature", M_NULLPTR),
+};
+
+static const devStatField ataTransportStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_TRANSPORT_NUM_HARD_RESET, numberOfHardwareResets, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of Hardware Resets", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TRANSPORT_NUM_ASR_EVENTS, numberOfASREvents, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of ASR Events", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_TRANSPORT_NUM_CRC_ERRORS, numberOfInterfaceCRCErrors, DEV_STAT_DISPLAY_COUNT,
+                 "Number Of Interface CRC Errors", M_NULLPTR),
+};
+
+static const devStatField ataSSDStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_SSD_ENDURANCE, percentageUsedIndicator, DEV_STAT_DISPLAY_COUNT, "Percent Used Indicator",
+                 "%"),
+};
+
+static const devStatField ataZonedDeviceStatistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_MAX_OPEN_ZONES, maximumOpenZones, DEV_STAT_DISPLAY_COUNT, "Maximum Open Zones",
+                 M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_MAX_EXPLICIT_OPEN_ZONES, maximumExplicitlyOpenZones, DEV_STAT_DISPLAY_COUNT,
+                 "Maximum Explicitly Open Zones", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_MAX_IMPLICIT_OPEN_ZONES, maximumImplicitlyOpenZones, DEV_STAT_DISPLAY_COUNT,
+                 "Maximum Implicitly Open Zones", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_MIN_EMPTY_ZONES, minimumEmptyZones, DEV_STAT_DISPLAY_COUNT, "Minumum Empty Zones",
+                 M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_MAX_NON_SEQ_ZONES, maximumNonSequentialZones, DEV_STAT_DISPLAY_COUNT,
+                 "Maximum Non-sequential Zones", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_ZONES_EMPTIED, zonesEmptied, DEV_STAT_DISPLAY_COUNT, "Zones Emptied", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_SUBOPTIMAL_WRITE_CMD, suboptimalWriteCommands, DEV_STAT_DISPLAY_COUNT,
+                 "Suboptimal Write Commands", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_CMD_EXCEED_OPTIMAL_LIM, commandsExceedingOptimalLimit, DEV_STAT_DISPLAY_COUNT,
+                 "Commands Exceeding Optimal Limit", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_FAILED_EXPLICIT_OPEN, failedExplicitOpens, DEV_STAT_DISPLAY_COUNT,
+                 "Failed Explicit Opens", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_READ_RULE_VIOLATIONS, readRuleViolations, DEV_STAT_DISPLAY_COUNT,
+                 "Read Rule Violations", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_WRITE_RULE_VIOLATIONS, writeRuleViolations, DEV_STAT_DISPLAY_COUNT,
+                 "Write Rule Violations", M_NULLPTR),
+    ATA_DEV_STAT(ATA_DEV_STAT_ZONED_MAX_IMPLICIT_OPEN_SEQ_OR_BEF_REQ_ZONES,
+                 maximumImplicitOpenSequentialOrBeforeRequiredZones, DEV_STAT_DISPLAY_COUNT,
+                 "Max Implicitly Open Sequential or Before Required Zones", M_NULLPTR),
+};
+static const devStatField scsiWriteErrorCounters[] = {
+    SCSI_DEV_STAT(0, writeErrorsCorrectedWithoutSubstantialDelay, "Write Errors Corrected Without Substantial Delay",
+                  M_NULLPTR),
+    SCSI_DEV_STAT(1, writeErrorsCorrectedWithPossibleDelays, "Write Errors Corrected With Possible Delay", M_NULLPTR),
+    SCSI_DEV_STAT(2, writeTotalReWrites, "Write Total Rewrites", M_NULLPTR),
+    SCSI_DEV_STAT(3, writeErrorsCorrected, "Write Errors Corrected", M_NULLPTR),
+    SCSI_DEV_STAT(4, writeTotalTimeCorrectionAlgorithmProcessed, "Write Total Times Corrective Algorithm Processed",
+                  M_NULLPTR),
+    SCSI_DEV_STAT(5, writeTotalBytesProcessed, "Write Total Bytes Processed", M_NULLPTR),
+    SCSI_DEV_STAT(6, writeTotalUncorrectedErrors, "Write Total Uncorrected Errors", M_NULLPTR),
+};
+
+static const devStatField scsiReadErrorCounters[] = {
+    SCSI_DEV_STAT(0, readErrorsCorrectedWithoutSubstantialDelay, "Read Errors Corrected Without Substantial Delay",
+                  M_NULLPTR),
+    SCSI_DEV_STAT(1, readErrorsCorrectedWithPossibleDelays, "Read Errors Corrected With Possible Delay", M_NULLPTR),
+    SCSI_DEV_STAT(2, readTotalRereads, "Read Total Rereads", M_NULLPTR),
+    SCSI_DEV_STAT(3, readErrorsCorrected, "Read Errors Corrected", M_NULLPTR),
+    SCSI_DEV_STAT(4, readTotalTimeCorrectionAlgorithmProcessed, "Read Total Times Corrective Algorithm Processed",
+                  M_NULLPTR),
+    SCSI_DEV_STAT(5, readTotalBytesProcessed, "Read Total Bytes Processed", M_NULLPTR),
+    SCSI_DEV_STAT(6, readTotalUncorrectedErrors, "Read Total Uncorrected Errors", M_NULLPTR),
+};
+
+static const devStatField scsiReadReverseErrorCounters[] = {
+    SCSI_DEV_STAT(0, readReverseErrorsCorrectedWithoutSubstantialDelay,
+                  "Read Reverse Errors Corrected Without Substantial Delay", M_NULLPTR),
+    SCSI_DEV_STAT(1, readReverseErrorsCorrectedWithPossibleDelays, "Read Reverse Errors Corrected With Possible Delay",
+                  M_NULLPTR),
+    SCSI_DEV_STAT(2, readReverseTotalReReads, "Read Reverse Total Rereads", M_NULLPTR),
+    SCSI_DEV_STAT(3, readReverseErrorsCorrected, "Read Reverse Errors Corrected", M_NULLPTR),
+    SCSI_DEV_STAT(4, readReverseTotalTimeCorrectionAlgorithmProcessed,
+                  "Read Reverse Total Times Corrective Algorithm Processed", M_NULLPTR),
+    SCSI_DEV_STAT(5, readReverseTotalBytesProcessed, "Read Reverse Total Bytes Processed", M_NULLPTR),
+    SCSI_DEV_STAT(6, readReverseTotalUncorrectedErrors, "Read Reverse Total Uncorrected Errors", M_NULLPTR),
+};
+
+static const devStatField scsiVerifyErrorCounters[] = {
+    SCSI_DEV_STAT(0, verifyErrorsCorrectedWithoutSubstantialDelay, "Verify Errors Corrected Without Substantial Delay",
+                  M_NULLPTR),
+    SCSI_DEV_STAT(1, verifyErrorsCorrectedWithPossibleDelays, "Verify Errors Corrected With Possible Delay", M_NULLPTR),
+    SCSI_DEV_STAT(2, verifyTotalReVerifies, "Verify Total Rereads", M_NULLPTR),
+    SCSI_DEV_STAT(3, verifyErrorsCorrected, "Verify Errors Corrected", M_NULLPTR),
+    SCSI_DEV_STAT(4, verifyTotalTimeCorrectionAlgorithmProcessed, "Verify Total Times Corrective Algorithm Processed",
+                  M_NULLPTR),
+    SCSI_DEV_STAT(5, verifyTotalBytesProcessed, "Verify Total Bytes Processed", M_NULLPTR),
+    SCSI_DEV_STAT(6, verifyTotalUncorrectedErrors, "Verify Total Uncorrected Errors", M_NULLPTR),
+};
+
+static const devStatField scsiNonMediumError[] = {
+    SCSI_DEV_STAT(0, nonMediumErrorCount, "Non-Medium Error Count", M_NULLPTR),
+};
+
+static const devStatField scsiFormatStatus[] = {
+    SCSI_DEV_STAT(1, grownDefectsDuringCertification, "Grown Defects During Certification", M_NULLPTR),
+    SCSI_DEV_STAT(2, totalBlocksReassignedDuringFormat, "Total Blocks Reassigned During Format", M_NULLPTR),
+    SCSI_DEV_STAT(3, totalNewBlocksReassigned, "Total New Blocks Reassigned", M_NULLPTR),
+    SCSI_DEV_STAT(4, powerOnMinutesSinceFormat, "Power On Minutes Since Last Format", "minutes"),
+};
+// The CDL statistics pages repeat the same 7 read and 7 write policies for statistic A and B of each LBA range
+#define ATA_CDL_STAT(range, letter, rw, number, policy)                                                                \
+    ATA_DEV_STAT(ATA_DEV_STAT_CDL_RANGE##range##_STAT_##letter##_##rw##number,                                         \
+                 cdlRange[range].group##letter.policy[number - 1], DEV_STAT_DISPLAY_COUNT, M_NULLPTR, M_NULLPTR)
+
+#define ATA_CDL_POLICY_STATS(range, letter, rw, policy)                                                                \
+    ATA_CDL_STAT(range, letter, rw, 1, policy), ATA_CDL_STAT(range, letter, rw, 2, policy),                            \
+        ATA_CDL_STAT(range, letter, rw, 3, policy), ATA_CDL_STAT(range, letter, rw, 4, policy),                        \
+        ATA_CDL_STAT(range, letter, rw, 5, policy), ATA_CDL_STAT(range, letter, rw, 6, policy),                        \
+        ATA_CDL_STAT(range, letter, rw, 7, policy)
+
+#define ATA_CDL_RANGE_STATS(range)                                                                                     \
+    ATA_CDL_POLICY_STATS(range, A, R, readPolicy), ATA_CDL_POLICY_STATS(range, A, W, writePolicy),                     \
+        ATA_CDL_POLICY_STATS(range, B, R, readPolicy), ATA_CDL_POLICY_STATS(range, B, W, writePolicy)
+
+static const devStatField ataCDLRange01Statistics[] = {
+    ATA_DEV_STAT(ATA_DEV_STAT_CDL_LOWEST_ACHIEVABLE_CMD_DUR, lowestAchievableCommandDuration, DEV_STAT_DISPLAY_COUNT,
+                 M_NULLPTR, M_NULLPTR),
+    ATA_CDL_RANGE_STATS(0),
+    ATA_CDL_RANGE_STATS(1),
+};
+
+static const devStatField ataCDLRange23Statistics[] = {
+    ATA_CDL_RANGE_STATS(2),
+    ATA_CDL_RANGE_STATS(3),
+};
+
+#define ATA_DEV_STAT_PAGE(page, supported, title, fields)                                                              \
+    {                                                                                                                  \
+        page, 0, 0, 0, offsetof(sataDeviceStatistics, supported), title, fields, SIZE_OF_STACK_ARRAY(fields)           \
+    }
+
+// In the order they are printed. Vendor specific statistics have no table since they are numbered by their position.
+static const devStatPage ataDevStatPages[] = {
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_GENERAL, generalStatisticsSupported, "General Statistics",
+                      ataGeneralStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_FREE_FALL, freeFallStatisticsSupported, "Free Fall Statistics",
+                      ataFreeFallStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_ROTATING_MEDIA, rotatingMediaStatisticsSupported,
+                      "Rotating Media Statistics", ataRotatingMediaStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_GEN_ERR, generalErrorsStatisticsSupported, "General Errors Statistics",
+                      ataGeneralErrorsStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_TEMP, temperatureStatisticsSupported, "Temperature Statistics",
+                      ataTemperatureStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_TRANSPORT, transportStatisticsSupported, "Transport Statistics",
+                      ataTransportStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_SSD, ssdStatisticsSupported, "Solid State Device Statistics",
+                      ataSSDStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_ZONED_DEVICE, zonedDeviceStatisticsSupported, "Zoned Device Statistics",
+                      ataZonedDeviceStatistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_0_1, cdlStatisticsSupported, M_NULLPTR,
+                      ataCDLRange01Statistics),
+    ATA_DEV_STAT_PAGE(ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_2_3, cdlStatisticsSupported, M_NULLPTR,
+                      ataCDLRange23Statistics),
+    {ATA_DEVICE_STATS_LOG_VENDOR_SPECIFIC, 0, 0, 0, offsetof(sataDeviceStatistics, vendorSpecificStatisticsSupported),
+     M_NULLPTR, M_NULLPTR, 0},
+};
+
+#define SCSI_DEV_STAT_PAGE(page, parameterPointer, flags, supported, title, fields)                                    \
+    {                                                                                                                  \
+        page, 0, parameterPointer, flags, offsetof(sasDeviceStatitics, supported), title, fields,                      \
+            SIZE_OF_STACK_ARRAY(fields)                                                                                \
+    }
+
+// Log pages made up only of counters with optional thresholds. Other pages are decoded individually in
+// get_SCSI_DeviceStatistics(). In the order they are printed.
+static const devStatPage scsiDevStatPages[] = {
+    SCSI_DEV_STAT_PAGE(LP_WRITE_ERROR_COUNTERS, 0, 0, writeErrorCountersSupported, "Write Error Counters",
+                       scsiWriteErrorCounters),
+    SCSI_DEV_STAT_PAGE(LP_READ_ERROR_COUNTERS, 0, 0, readErrorCountersSupported, "Read Error Counters",
+                       scsiReadErrorCounters),
+    SCSI_DEV_STAT_PAGE(LP_READ_REVERSE_ERROR_COUNTERS, 0, 0, readReverseErrorCountersSupported,
+                       "Read Reverse Error Counters", scsiReadReverseErrorCounters),
+    SCSI_DEV_STAT_PAGE(LP_VERIFY_ERROR_COUNTERS, 0, 0, verifyErrorCountersSupported, "Verify Error Counters",
+                       scsiVerifyErrorCounters),
+    SCSI_DEV_STAT_PAGE(LP_NON_MEDIUM_ERROR, 0, 0, nonMediumErrorSupported, "Non Medium Error", scsiNonMediumError),
+    SCSI_DEV_STAT_PAGE(LP_FORMAT_STATUS_LOG_PAGE, 1, DEV_STAT_PAGE_ALL_F_IS_INVALID, formatStatusSupported,
+                       "Format Status", scsiFormatStatus),
+};
+
+static M_INLINE statistic* dev_Stat_Field(void* statistics, const devStatField* field)
+{
+    return M_REINTERPRET_CAST(statistic*, M_REINTERPRET_CAST(uint8_t*, statistics) + field->fieldOffset);
+}
+
+static M_INLINE bool* dev_Stat_Page_Supported(void* statistics, const devStatPage* page)
+{
+    return M_REINTERPRET_CAST(bool*, M_REINTERPRET_CAST(uint8_t*, statistics) + page->supportedOffset);
+}
+
+static const devStatPage* find_Dev_Stat_Page(const devStatPage* pages,
+                                             size_t             numberOfPages,
+                                             uint8_t            page,
+                                             uint8_t            subpage)
+{
+    for (size_t pageIter = SIZE_T_C(0); pageIter < numberOfPages; ++pageIter)
     {
-    case ATA_DEV_STAT_GENERAL_LIFETIME_POR:
-        stat = &deviceStats->sataStatistics.lifetimePoweronResets;
-        break;
-    case ATA_DEV_STAT_GENERAL_POH:
-        stat = &deviceStats->sataStatistics.powerOnHours;
-        break;
-    case ATA_DEV_STAT_GENERAL_LBA_WRITTEN:
-        stat = &deviceStats->sataStatistics.logicalSectorsWritten;
-        break;
-    case ATA_DEV_STAT_GENERAL_NUM_WRITE_CMDS:
-        stat = &deviceStats->sataStatistics.numberOfWriteCommands;
-        break;
-    case ATA_DEV_STAT_GENERAL_LBA_READ:
-        stat = &deviceStats->sataStatistics.logicalSectorsRead;
-        break;
-    case ATA_DEV_STAT_GENERAL_NUM_READ_CMDS:
-        stat = &deviceStats->sataStatistics.numberOfReadCommands;
-        break;
-    case ATA_DEV_STAT_GENERAL_DATE_AND_TIME_TIMESTAMP:
-        stat = &deviceStats->sataStatistics.dateAndTimeTimestamp;
-        break;
-    case ATA_DEV_STAT_GENERAL_PENDING_ERR_CNT:
-        stat = &deviceStats->sataStatistics.pendingErrorCount;
-        break;
-    case ATA_DEV_STAT_GENERAL_WORKLOAD_UTIL:
-        stat = &deviceStats->sataStatistics.workloadUtilization;
-        break;
-    case ATA_DEV_STAT_GENERAL_UTIL_USAGE_RATE:
-        stat = &deviceStats->sataStatistics.utilizationUsageRate;
-        break;
-    case ATA_DEV_STAT_GENERAL_RESOURCE_AVAIL:
-        stat = &deviceStats->sataStatistics.resourceAvailability;
-        break;
-    case ATA_DEV_STAT_GENERAL_RAND_WRITE_RESOURCE_USED:
-        stat = &deviceStats->sataStatistics.randomWriteResourcesUsed;
-        break;
+        if (pages[pageIter].page == page && pages[pageIter].subpage == subpage)
+        {
+            return &pages[pageIter];
+        }
     }
-    return stat;
+    return M_NULLPTR;
 }
 
-M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_freefall_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+static const devStatField* find_Dev_Stat_Field(const devStatPage* page, uint16_t location)
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsFreeFallOffset, byteOffsetOnPage))
+    for (size_t fieldIter = SIZE_T_C(0); fieldIter < page->numberOfFields; ++fieldIter)
     {
-    case ATA_DEV_STAT_FREEFALL_NUM_FREEFALL_EVENTS:
-        stat = &deviceStats->sataStatistics.numberOfFreeFallEventsDetected;
-        break;
-    case ATA_DEV_STAT_FREEFALL_OVERLIM_SHOCK_EVENT:
-        stat = &deviceStats->sataStatistics.overlimitShockEvents;
-        break;
+        if (page->fields[fieldIter].location == location)
+        {
+            return &page->fields[fieldIter];
+        }
     }
-    return stat;
+    return M_NULLPTR;
 }
 
+// this is ued to determine which device statistic is being talked about by the DSN log on ata
 M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_rotating_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+static statistic* dev_stat_page_offset_map(ptrDeviceStatistics deviceStats,
+                                           uint8_t             ataDevStatPage,
+                                           uint16_t            byteOffsetOnPage)
 {
     statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsRotatingOffset, byteOffsetOnPage))
+    if (ataDevStatPage == ATA_DEVICE_STATS_LOG_VENDOR_SPECIFIC)
     {
-    case ATA_DEV_STAT_ROTATING_SPINDLE_MOTOR_POH:
-        stat = &deviceStats->sataStatistics.spindleMotorPoweronHours;
-        break;
-    case ATA_DEV_STAT_ROTATING_HEAD_FLYING_HOURS:
-        stat = &deviceStats->sataStatistics.headFlyingHours;
-        break;
-    case ATA_DEV_STAT_ROTATING_HEAD_LOAD_EVENTS:
-        stat = &deviceStats->sataStatistics.headLoadEvents;
-        break;
-    case ATA_DEV_STAT_ROTATING_NUM_REALLOCATED_LBA:
-        stat = &deviceStats->sataStatistics.numberOfReallocatedLogicalSectors;
-        break;
-    case ATA_DEV_STAT_ROTATING_READ_RECOVERY_ATTEMPTS:
-        stat = &deviceStats->sataStatistics.readRecoveryAttempts;
-        break;
-    case ATA_DEV_STAT_ROTATING_NUM_MECH_START_FAILURE:
-        stat = &deviceStats->sataStatistics.numberOfMechanicalStartFailures;
-        break;
-    case ATA_DEV_STAT_ROTATING_NUM_REALLOCATION_CANDIDATE_LBA:
-        stat = &deviceStats->sataStatistics.numberOfReallocationCandidateLogicalSectors;
-        break;
-    case ATA_DEV_STAT_ROTATING_NUM_HIGH_PRIO_UNLOAD_EVENTS:
-        stat = &deviceStats->sataStatistics.numberOfHighPriorityUnloadEvents;
-        break;
+        uint16_t vendorStatistic = byteOffsetOnPage / UINT16_C(8);
+        if (vendorStatistic > UINT16_C(0) && vendorStatistic <= MAX_VENDOR_STATISTICS)
+        {
+            stat = &deviceStats->sataStatistics.vendorSpecificStatistics[vendorStatistic - 1];
+        }
+    }
+    else
+    {
+        const devStatPage* page =
+            find_Dev_Stat_Page(ataDevStatPages, SIZE_OF_STACK_ARRAY(ataDevStatPages), ataDevStatPage, 0);
+        if (page != M_NULLPTR)
+        {
+            const devStatField* field = find_Dev_Stat_Field(page, byteOffsetOnPage);
+            if (field != M_NULLPTR)
+            {
+                stat = dev_Stat_Field(&deviceStats->sataStatistics, field);
+            }
+        }
     }
     return stat;
 }
 
-M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_generallerror_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+M_NONNULL_PARAM_LIST(1) M_PARAM_RW(1) void scsi_Threshold_Comparison(statistic* ptrStatistic); // prototype
+
+static void set_ATA_Dev_Stat_Notification_Info(uint64_t statisticCondition, statistic* stat)
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsGeneralErrorOffset, byteOffsetOnPage))
+    if (stat != M_NULLPTR)
     {
-    case ATA_DEV_STAT_GENERR_NUM_REPORTED_UNCOR_ERR:
-        stat = &deviceStats->sataStatistics.numberOfReportedUncorrectableErrors;
-        break;
-    case ATA_DEV_STAT_GENERR_NUM_RESETS_BETWEEN_CMD_ACCEPT_AND_COMPLETE:
-        stat = &deviceStats->sataStatistics.numberOfResetsBetweenCommandAcceptanceAndCommandCompletion;
-        break;
-    case ATA_DEV_STAT_GENERR_PHYSICAL_ELEMENT_STATUS_CHANGE:
-        stat = &deviceStats->sataStatistics.physicalElementStatusChanged;
-        break;
+        // device statistics condition definition:
+        // Bits 63:56 = DSN Condition Flags (below)
+        // Bit 63 = notification enabled
+        // Bits 62:60 = value comparison type
+        //   000b = does not trigger on any update
+        //   001b = triggers on every update of the statistics value
+        //   010b = triggers on the device statistic value equal to the threshold value
+        //   011b = triggers on the device statistic value less than the threshold value
+        //   100b = triggers on the device statistic value greater than the threshold value
+        // Bit 59 = non-validity trigger
+        // Bit 58 = validity trigger
+        uint8_t dsnConditionFlags   = M_Byte7(statisticCondition);
+        bool    notificationEnabled = dsnConditionFlags & BIT7;
+        uint8_t comparisonType      = M_Nibble1(dsnConditionFlags) & 0x03;
+        bool    nonValidityTrigger  = dsnConditionFlags & BIT3;
+        bool    validityTrigger     = dsnConditionFlags & BIT2;
+        // Bits 55:0 = Threshold Value
+        uint64_t thresholdValue            = statisticCondition & UINT64_C(0x00FFFFFFFFFFFFFF); // removing byte 7
+        stat->isThresholdValid             = true;
+        stat->thresholdNotificationEnabled = notificationEnabled;
+        stat->threshType                   = C_CAST(eThresholdType, comparisonType);
+        stat->nonValidityTrigger           = nonValidityTrigger;
+        stat->validityTrigger              = validityTrigger;
+        stat->threshold                    = thresholdValue;
     }
-    return stat;
 }
 
-M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_temperature_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+// NOTE: call le64 to host on qword when passing in to keep this simpler!
+M_PARAM_WO(2)
+static bool set_ATA_Dev_Stat_Info(uint64_t qword, statistic* stat)
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsTemperatureOffset, byteOffsetOnPage))
+    bool statisticPopulated = false;
+    if (stat != M_NULLPTR)
     {
-    case ATA_DEV_STAT_TEMP_CURRENT_TEMP:
-        stat = &deviceStats->sataStatistics.currentTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_AVG_SHORT_TEMP:
-        stat = &deviceStats->sataStatistics.averageShortTermTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_AVG_LONG_TEMP:
-        stat = &deviceStats->sataStatistics.averageLongTermTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_HIGHEST_TEMP:
-        stat = &deviceStats->sataStatistics.highestTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_LOWEST_TEMP:
-        stat = &deviceStats->sataStatistics.lowestTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_HIGH_AVG_SHORT_TEMP:
-        stat = &deviceStats->sataStatistics.highestAverageShortTermTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_LOW_AVG_SHORT_TEMP:
-        stat = &deviceStats->sataStatistics.lowestAverageShortTermTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_HIGH_AVG_LONG_TEMP:
-        stat = &deviceStats->sataStatistics.highestAverageLongTermTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_LOW_AVG_LONG_TEMP:
-        stat = &deviceStats->sataStatistics.lowestAverageLongTermTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_TIME_OVER_TEMP:
-        stat = &deviceStats->sataStatistics.timeInOverTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_SPEC_MAX_TEMP:
-        stat = &deviceStats->sataStatistics.specifiedMaximumOperatingTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_TIME_UNDER_TEMP:
-        stat = &deviceStats->sataStatistics.timeInUnderTemperature;
-        break;
-    case ATA_DEV_STAT_TEMP_SPEC_MIN_TEMP:
-        stat = &deviceStats->sataStatistics.specifiedMinimumOperatingTemperature;
-        break;
+        if (qword & ATA_DEV_STATS_STATISTIC_SUPPORTED_BIT)
+        {
+            stat->isSupported                = true;
+            stat->isValueValid               = M_ToBool(qword & ATA_DEV_STATS_VALID_VALUE_BIT);
+            stat->isNormalized               = M_ToBool(qword & ATA_DEV_STATS_NORMALIZED_STAT_BIT);
+            stat->supportsNotification       = M_ToBool(qword & ATA_DEV_STATS_SUPPORTS_DSN);
+            stat->monitoredConditionMet      = M_ToBool(qword & ATA_DEV_STATS_MONITORED_CONDITION_MET);
+            stat->supportsReadThenInitialize = M_ToBool(qword & ATA_DEV_STATS_READ_THEN_INIT_SUPPORTED);
+            stat->statisticValue = get_bit_range_uint64(qword, ATA_DEV_STATS_VALUE_MSB, ATA_DEV_STATS_VALUE_LSB);
+            statisticPopulated   = true;
+        }
+        else
+        {
+            stat->isSupported = false;
+        }
     }
-    return stat;
+    return statisticPopulated;
 }
 
 M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_transport_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+static void set_ATA_CDL_Statistic_Ranges(ptrDeviceStatistics deviceStats,
+                                         uint8_t             statisticPage,
+                                         uint16_t            statisticOffset)
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsTransportOffset, byteOffsetOnPage))
+    uint8_t ranges = UINT8_C(0);
+    if (statisticPage == ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_0_1)
     {
-    case ATA_DEV_STAT_TRANSPORT_NUM_HARD_RESET:
-        stat = &deviceStats->sataStatistics.numberOfHardwareResets;
-        break;
-    case ATA_DEV_STAT_TRANSPORT_NUM_ASR_EVENTS:
-        stat = &deviceStats->sataStatistics.numberOfASREvents;
-        break;
-    case ATA_DEV_STAT_TRANSPORT_NUM_CRC_ERRORS:
-        stat = &deviceStats->sataStatistics.numberOfInterfaceCRCErrors;
-        break;
+        if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE1_STAT_A_R1)
+        {
+            ranges = 2;
+        }
+        else if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE0_STAT_A_R1)
+        {
+            ranges = 1;
+        }
+    }
+    else if (statisticPage == ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_2_3)
+    {
+        if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE3_STAT_A_R1)
+        {
+            ranges = 4;
+        }
+        else if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE2_STAT_A_R1)
+        {
+            ranges = 3;
+        }
+    }
+    if (ranges > deviceStats->sataStatistics.cdlStatisticRanges)
+    {
+        deviceStats->sataStatistics.cdlStatisticRanges = ranges;
     }
-    return stat;
 }
 
-M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_ssd_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+static uint32_t get_ATA_Dev_Stat_Request_Mask(uint8_t statisticPage)
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsSSDOffset, byteOffsetOnPage))
+    switch (statisticPage)
     {
-    case ATA_DEV_STAT_SSD_ENDURANCE:
-        stat = &deviceStats->sataStatistics.percentageUsedIndicator;
-        break;
+    case ATA_DEVICE_STATS_LOG_GENERAL:
+        return DEVICE_STATISTICS_GENERAL;
+    case ATA_DEVICE_STATS_LOG_FREE_FALL:
+        return DEVICE_STATISTICS_FREE_FALL;
+    case ATA_DEVICE_STATS_LOG_ROTATING_MEDIA:
+        return DEVICE_STATISTICS_ROTATING_MEDIA;
+    case ATA_DEVICE_STATS_LOG_GEN_ERR:
+        return DEVICE_STATISTICS_GENERAL_ERRORS;
+    case ATA_DEVICE_STATS_LOG_TEMP:
+        return DEVICE_STATISTICS_TEMPERATURE;
+    case ATA_DEVICE_STATS_LOG_TRANSPORT:
+        return DEVICE_STATISTICS_TRANSPORT;
+    case ATA_DEVICE_STATS_LOG_SSD:
+        return DEVICE_STATISTICS_SSD;
+    case ATA_DEVICE_STATS_LOG_ZONED_DEVICE:
+        return DEVICE_STATISTICS_ZONED;
+    case ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_0_1:
+    case ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_2_3:
+        return DEVICE_STATISTICS_CDL;
+    case ATA_DEVICE_STATS_LOG_VENDOR_SPECIFIC:
+        return DEVICE_STATISTICS_VENDOR;
+    default:
+        return UINT32_C(0);
     }
-    return stat;
 }
 
-M_NONNULL_PARAM_LIST(1)
-static M_INLINE statistic* dev_stat_zoned_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+// Decodes one 512 byte page of the device statistics log. The supported pages list, pages this code does not know,
+// and pages with a bad header are skipped.
+static void decode_ATA_Device_Statistics_Page(ptrDeviceStatistics deviceStats,
+                                              uint8_t             statisticPage,
+                                              const uint8_t*      pageData)
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsZonedOffset, byteOffsetOnPage))
+    const uint64_t*    qwordPtrDeviceStatsLog = C_CAST(const uint64_t*, pageData);
+    const devStatPage* pageMap =
+        find_Dev_Stat_Page(ataDevStatPages, SIZE_OF_STACK_ARRAY(ataDevStatPages), statisticPage, 0);
+    if (pageMap == M_NULLPTR || statisticPage != M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
     {
-    case ATA_DEV_STAT_ZONED_MAX_OPEN_ZONES:
-        stat = &deviceStats->sataStatistics.maximumOpenZones;
-        break;
-    case ATA_DEV_STAT_ZONED_MAX_EXPLICIT_OPEN_ZONES:
-        stat = &deviceStats->sataStatistics.maximumExplicitlyOpenZones;
-        break;
-    case ATA_DEV_STAT_ZONED_MAX_IMPLICIT_OPEN_ZONES:
-        stat = &deviceStats->sataStatistics.maximumImplicitlyOpenZones;
-        break;
-    case ATA_DEV_STAT_ZONED_MIN_EMPTY_ZONES:
-        stat = &deviceStats->sataStatistics.minimumEmptyZones;
-        break;
-    case ATA_DEV_STAT_ZONED_MAX_NON_SEQ_ZONES:
-        stat = &deviceStats->sataStatistics.maximumNonSequentialZones;
-        break;
-    case ATA_DEV_STAT_ZONED_ZONES_EMPTIED:
-        stat = &deviceStats->sataStatistics.zonesEmptied;
-        break;
-    case ATA_DEV_STAT_ZONED_SUBOPTIMAL_WRITE_CMD:
-        stat = &deviceStats->sataStatistics.suboptimalWriteCommands;
-        break;
-    case ATA_DEV_STAT_ZONED_CMD_EXCEED_OPTIMAL_LIM:
-        stat = &deviceStats->sataStatistics.commandsExceedingOptimalLimit;
-        break;
-    case ATA_DEV_STAT_ZONED_FAILED_EXPLICIT_OPEN:
-        stat = &deviceStats->sataStatistics.failedExplicitOpens;
-        break;
-    case ATA_DEV_STAT_ZONED_READ_RULE_VIOLATIONS:
-        stat = &deviceStats->sataStatistics.readRuleViolations;
-        break;
-    case ATA_DEV_STAT_ZONED_WRITE_RULE_VIOLATIONS:
-        stat = &deviceStats->sataStatistics.writeRuleViolations;
-        break;
-    case ATA_DEV_STAT_ZONED_MAX_IMPLICIT_OPEN_SEQ_OR_BEF_REQ_ZONES:
-        stat = &deviceStats->sataStatistics.maximumImplicitOpenSequentialOrBeforeRequiredZones;
-        break;
+        return;
+    }
+    *dev_Stat_Page_Supported(&deviceStats->sataStatistics, pageMap) = true;
+    if (pageMap->fields == M_NULLPTR)
+    {
+        // vendor specific statistics are numbered by their position on the page
+        for (uint16_t statisticOffset = UINT16_C(8); statisticOffset < LEGACY_DRIVE_SEC_SIZE;
+             statisticOffset += UINT16_C(8))
+        {
+            uint64_t qword = le64_to_host(qwordPtrDeviceStatsLog[statisticOffset / UINT16_C(8)]);
+            if (set_ATA_Dev_Stat_Info(qword, dev_stat_page_offset_map(deviceStats, statisticPage, statisticOffset)))
+            {
+                ++deviceStats->sataStatistics.statisticsPopulated;
+                ++deviceStats->sataStatistics.vendorSpecificStatisticsPopulated;
+            }
+        }
+        return;
+    }
+    // TODO: Need to adjust min/max field offsets based on the attribute. For now selecting all 48
+    // possible bits seems ok.
+    //       Need more testing and to come back to this again later.
+    for (size_t fieldIter = SIZE_T_C(0); fieldIter < pageMap->numberOfFields; ++fieldIter)
+    {
+        const devStatField* field = &pageMap->fields[fieldIter];
+        if (set_ATA_Dev_Stat_Info(le64_to_host(qwordPtrDeviceStatsLog[field->location / UINT16_C(8)]),
+                                  dev_Stat_Field(&deviceStats->sataStatistics, field)))
+        {
+            ++deviceStats->sataStatistics.statisticsPopulated;
+            set_ATA_CDL_Statistic_Ranges(deviceStats, statisticPage, field->location);
+        }
     }
-    return stat;
 }
 
-static statistic* dev_stat_cdl_0_1_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
+// On GPL devices reads the supported pages list and then each selected page on its own, one 512 byte READ LOG EXT
+// each. The SMART log can only be read from the start, so it is read up to the last selected page instead. Pages
+// already in the cache, alone or as part of a copy of the whole log, are not read again.
+static eReturnValues get_Selected_ATA_Device_Statistics_Pages(tDevice*             device,
+                                                              ptrLogPageCache      logCache,
+                                                              ptrATALogDirectories directories,
+                                                              ptrDeviceStatistics  deviceStats,
+                                                              uint32_t             requestMask,
+                                                              uint32_t             deviceStatsSize)
 {
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsCDL_0_1_Offset, byteOffsetOnPage))
+    eReturnValues ret     = NOT_SUPPORTED;
+    uint32_t      gplSize = UINT32_C(0);
+    if (device->drive_info.ata_Options.generalPurposeLoggingSupported &&
+        SUCCESS == get_ATA_Log_Size(device, directories, ATA_LOG_DEVICE_STATISTICS, &gplSize, true, false) &&
+        gplSize > UINT32_C(0))
     {
-    case ATA_DEV_STAT_CDL_LOWEST_ACHIEVABLE_CMD_DUR:
-        stat = &deviceStats->sataStatistics.lowestAchievableCommandDuration;
-        break;
-    // Range 0 for STAT_A
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_A_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupA.writePolicy[6];
-        break;
+        // supported pages list followed by the page being decoded
+        uint8_t* logData = M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(2 * ATA_LOG_PAGE_LEN_BYTES, sizeof(uint8_t),
+                                                                            device->os_info.minimumAlignment));
+        if (logData == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        uint8_t* pageData = &logData[ATA_LOG_PAGE_LEN_BYTES];
+        ret = cached_ATA_Read_Log_Ext_Page(device, logCache, ATA_LOG_DEVICE_STATISTICS, 0, logData,
+                                           ATA_LOG_PAGE_LEN_BYTES);
+        if (ret == SUCCESS)
+        {
+            for (uint8_t listIter = UINT8_C(0); listIter < logData[ATA_DEV_STATS_SUP_PG_LIST_LEN_OFFSET]; ++listIter)
+            {
+                uint8_t statisticPage = logData[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + listIter];
+                if (statisticPage != UINT8_C(0) &&
+                    (C_CAST(uint32_t, statisticPage) + UINT32_C(1)) * ATA_LOG_PAGE_LEN_BYTES <= gplSize &&
+                    (get_ATA_Dev_Stat_Request_Mask(statisticPage) & requestMask) &&
+                    SUCCESS == cached_ATA_Read_Log_Ext_Page(device, logCache, ATA_LOG_DEVICE_STATISTICS,
+                                                            statisticPage, pageData, ATA_LOG_PAGE_LEN_BYTES))
+                {
+                    decode_ATA_Device_Statistics_Page(deviceStats, statisticPage, pageData);
+                }
+            }
+        }
+        safe_free_aligned(&logData);
+        return ret;
+    }
+    uint32_t readSize = ATA_LOG_PAGE_LEN_BYTES;
+    for (size_t pageIter = SIZE_T_C(0); pageIter < SIZE_OF_STACK_ARRAY(ataDevStatPages); ++pageIter)
+    {
+        uint32_t pageEnd = (C_CAST(uint32_t, ataDevStatPages[pageIter].page) + UINT32_C(1)) * ATA_LOG_PAGE_LEN_BYTES;
+        if ((get_ATA_Dev_Stat_Request_Mask(ataDevStatPages[pageIter].page) & requestMask) && pageEnd <= deviceStatsSize)
+        {
+            readSize = M_Max(readSize, pageEnd);
+        }
+    }
+    uint8_t* logData = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(readSize, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (logData == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (SUCCESS == cached_ATA_Get_Log(device, logCache, ATA_LOG_DEVICE_STATISTICS, false, true, logData, readSize))
+    {
+        ret = SUCCESS;
+        for (uint8_t listIter = UINT8_C(0); listIter < logData[ATA_DEV_STATS_SUP_PG_LIST_LEN_OFFSET]; ++listIter)
+        {
+            uint8_t  statisticPage = logData[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + listIter];
+            uint32_t offset        = C_CAST(uint32_t, statisticPage) * ATA_LOG_PAGE_LEN_BYTES;
+            if (statisticPage != UINT8_C(0) && offset + ATA_LOG_PAGE_LEN_BYTES <= readSize &&
+                (get_ATA_Dev_Stat_Request_Mask(statisticPage) & requestMask))
+            {
+                decode_ATA_Device_Statistics_Page(deviceStats, statisticPage, &logData[offset]);
+            }
+        }
+    }
+    safe_free_aligned(&logData);
+    return ret;
+}
 
-    // Range 0 for STAT_B
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE0_STAT_B_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[0].groupB.writePolicy[6];
-        break;
-
-    // Range 1 for STAT_A
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_A_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupA.writePolicy[6];
-        break;
-
-    // Range 1 for STAT_B
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE1_STAT_B_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[1].groupB.writePolicy[6];
-        break;
-    }
-    return stat;
-}
-
-static statistic* dev_stat_cdl_2_3_offset_map(ptrDeviceStatistics deviceStats, uint16_t byteOffsetOnPage)
-{
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDevStatsCDL_2_3_Offset, byteOffsetOnPage))
-    {
-        // Range 2 for STAT_A
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_A_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupA.writePolicy[6];
-        break;
-
-    // Range 2 for STAT_B
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE2_STAT_B_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[2].groupB.writePolicy[6];
-        break;
-
-    // Range 3 for STAT_A
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_A_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupA.writePolicy[6];
-        break;
-    // Range 3 for STAT_B
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_R1:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.readPolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_R2:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.readPolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_R3:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.readPolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_R4:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.readPolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_R5:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.readPolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_R6:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.readPolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_R7:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.readPolicy[6];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_W1:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.writePolicy[0];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_W2:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.writePolicy[1];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_W3:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.writePolicy[2];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_W4:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.writePolicy[3];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_W5:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.writePolicy[4];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_W6:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.writePolicy[5];
-        break;
-    case ATA_DEV_STAT_CDL_RANGE3_STAT_B_W7:
-        stat = &deviceStats->sataStatistics.cdlRange[3].groupB.writePolicy[6];
-        break;
-    }
-    return stat;
-}
-
-// this is ued to determine which device statistic is being talked about by the DSN log on ata
-// TODO: Make enum of all stat offsets on each page so it is easy to make sure all cases are handled correctly
-M_NONNULL_PARAM_LIST(1)
-static statistic* dev_stat_page_offset_map(ptrDeviceStatistics deviceStats,
-                                           uint8_t             ataDevStatPage,
-                                           uint16_t            byteOffsetOnPage)
-{
-    statistic* stat = M_NULLPTR;
-    switch (M_STATIC_CAST(eDeviceStatisticsLog, ataDevStatPage))
-    {
-    case ATA_DEVICE_STATS_LOG_LIST:
-        break;
-    case ATA_DEVICE_STATS_LOG_GENERAL:
-        stat = dev_stat_general_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_FREE_FALL:
-        stat = dev_stat_freefall_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_ROTATING_MEDIA:
-        stat = dev_stat_rotating_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_GEN_ERR:
-        stat = dev_stat_generallerror_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_TEMP:
-        stat = dev_stat_temperature_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_TRANSPORT:
-        stat = dev_stat_transport_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_SSD:
-        stat = dev_stat_ssd_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_ZONED_DEVICE:
-        stat = dev_stat_zoned_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_0_1:
-        stat = dev_stat_cdl_0_1_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_2_3:
-        stat = dev_stat_cdl_2_3_offset_map(deviceStats, byteOffsetOnPage);
-        break;
-    case ATA_DEVICE_STATS_LOG_VENDOR_SPECIFIC:
-        // slightly different than case by case here -TJE
-        stat = &deviceStats->sataStatistics.vendorSpecificStatistics[(byteOffsetOnPage / UINT8_C(8)) - 1];
-        break;
-    }
-    return stat;
-}
-
-M_NONNULL_PARAM_LIST(1) M_PARAM_RW(1) void scsi_Threshold_Comparison(statistic* ptrStatistic); // prototype
-
-static void set_ATA_Dev_Stat_Notification_Info(uint64_t statisticCondition, statistic* stat)
+static eReturnValues get_ATA_DeviceStatistics(tDevice*            device,
+                                              ptrLogPageCache     logCache,
+                                              ptrDeviceStatistics deviceStats,
+                                              uint32_t            requestMask)
 {
-    if (stat != M_NULLPTR)
+    eReturnValues ret = NOT_SUPPORTED;
+    if (deviceStats == M_NULLPTR)
     {
-        // device statistics condition definition:
-        // Bits 63:56 = DSN Condition Flags (below)
-        // Bit 63 = notification enabled
-        // Bits 62:60 = value comparison type
-        //   000b = does not trigger on any update
-        //   001b = triggers on every update of the statistics value
-        //   010b = triggers on the device statistic value equal to the threshold value
-        //   011b = triggers on the device statistic value less than the threshold value
-        //   100b = triggers on the device statistic value greater than the threshold value
-        // Bit 59 = non-validity trigger
-        // Bit 58 = validity trigger
-        uint8_t dsnConditionFlags   = M_Byte7(statisticCondition);
-        bool    notificationEnabled = dsnConditionFlags & BIT7;
-        uint8_t comparisonType      = M_Nibble1(dsnConditionFlags) & 0x03;
-        bool    nonValidityTrigger  = dsnConditionFlags & BIT3;
-        bool    validityTrigger     = dsnConditionFlags & BIT2;
-        // Bits 55:0 = Threshold Value
-        uint64_t thresholdValue            = statisticCondition & UINT64_C(0x00FFFFFFFFFFFFFF); // removing byte 7
-        stat->isThresholdValid             = true;
-        stat->thresholdNotificationEnabled = notificationEnabled;
-        stat->threshType                   = C_CAST(eThresholdType, comparisonType);
-        stat->nonValidityTrigger           = nonValidityTrigger;
-        stat->validityTrigger              = validityTrigger;
-        stat->threshold                    = thresholdValue;
+        return BAD_PARAMETER;
     }
-}
-
-// NOTE: call le64 to host on qword when passing in to keep this simpler!
-M_PARAM_WO(2)
-static bool set_ATA_Dev_Stat_Info(uint64_t qword, statistic* stat)
-{
-    bool statisticPopulated = false;
-    if (stat != M_NULLPTR)
+    uint32_t             deviceStatsSize              = UINT32_C(0);
+    uint32_t             deviceStatsNotificationsSize = UINT32_C(0);
+    ataLogDirectories    localDirectories;
+    ptrATALogDirectories directories = &localDirectories;
+    if (logCache != M_NULLPTR)
     {
-        if (qword & ATA_DEV_STATS_STATISTIC_SUPPORTED_BIT)
-        {
-            stat->isSupported                = true;
-            stat->isValueValid               = M_ToBool(qword & ATA_DEV_STATS_VALID_VALUE_BIT);
-            stat->isNormalized               = M_ToBool(qword & ATA_DEV_STATS_NORMALIZED_STAT_BIT);
-            stat->supportsNotification       = M_ToBool(qword & ATA_DEV_STATS_SUPPORTS_DSN);
-            stat->monitoredConditionMet      = M_ToBool(qword & ATA_DEV_STATS_MONITORED_CONDITION_MET);
-            stat->supportsReadThenInitialize = M_ToBool(qword & ATA_DEV_STATS_READ_THEN_INIT_SUPPORTED);
-            stat->statisticValue = get_bit_range_uint64(qword, ATA_DEV_STATS_VALUE_MSB, ATA_DEV_STATS_VALUE_LSB);
-            statisticPopulated   = true;
-        }
-        else
-        {
-            stat->isSupported = false;
-        }
+        directories = &logCache->directories;
     }
-    return statisticPopulated;
-}
-
-static eReturnValues get_ATA_DeviceStatistics(tDevice* device, ptrDeviceStatistics deviceStats)
-{
-    eReturnValues ret = NOT_SUPPORTED;
-    if (deviceStats == M_NULLPTR)
+    else
     {
-        return BAD_PARAMETER;
+        // keeps the directories read for the size checks below and the selected pages
+        init_ATA_Log_Directories(&localDirectories);
     }
-    uint32_t deviceStatsSize              = UINT32_C(0);
-    uint32_t deviceStatsNotificationsSize = UINT32_C(0);
     // need to get the device statistics log
-    if (SUCCESS == get_ATA_Log_Size(device, ATA_LOG_DEVICE_STATISTICS, &deviceStatsSize, true, true) &&
+    if (SUCCESS == get_ATA_Log_Size(device, directories, ATA_LOG_DEVICE_STATISTICS, &deviceStatsSize, true, true) &&
         deviceStatsSize > UINT32_C(0))
     {
-        bool     dsnFeatureSupported = M_ToBool(le16_to_host(device->drive_info.IdentifyData.ata.Word119) & BIT9);
-        bool     dsnFeatureEnabled   = M_ToBool(le16_to_host(device->drive_info.IdentifyData.ata.Word120) & BIT9);
-        uint8_t* deviceStatsLog      = M_REINTERPRET_CAST(
-            uint8_t*, safe_calloc_aligned(deviceStatsSize, sizeof(uint8_t), device->os_info.minimumAlignment));
-        if (deviceStatsLog == M_NULLPTR)
-        {
-            return MEMORY_FAILURE;
-        }
+        bool dsnFeatureSupported = M_ToBool(le16_to_host(device->drive_info.IdentifyData.ata.Word119) & BIT9);
+        bool dsnFeatureEnabled   = M_ToBool(le16_to_host(device->drive_info.IdentifyData.ata.Word120) & BIT9);
         // this is to get the threshold stuff
-        if (dsnFeatureSupported && dsnFeatureEnabled &&
-            SUCCESS == get_ATA_Log_Size(device, ATA_LOG_DEVICE_STATISTICS_NOTIFICATION, &deviceStatsNotificationsSize,
-                                        true, false) &&
+        if ((requestMask & DEVICE_STATISTICS_THRESHOLDS) && dsnFeatureSupported && dsnFeatureEnabled &&
+            SUCCESS == get_ATA_Log_Size(device, directories, ATA_LOG_DEVICE_STATISTICS_NOTIFICATION,
+                                        &deviceStatsNotificationsSize, true, false) &&
             deviceStatsNotificationsSize > UINT32_C(0))
         {
             uint8_t* devStatsNotificationsLog =
@@ -789,3843 +708,362 @@ static eReturnValues get_ATA_DeviceStatistics(tDevice* device, ptrDeviceStatisti
                 {
                     uint64_t statisticLocation =
                         M_BytesTo8ByteValue(devStatsNotificationsLog[offset + 7], devStatsNotificationsLog[offset + 6],
-                                            devStatsNotificationsLog[offset + 5], devStatsNotificationsLog[offset + 4],
-                                            devStatsNotificationsLog[offset + 3], devStatsNotificationsLog[offset + 2],
-                                            devStatsNotificationsLog[offset + 1], devStatsNotificationsLog[offset]);
-                    uint64_t statisticCondition = M_BytesTo8ByteValue(
-                        devStatsNotificationsLog[offset + 15], devStatsNotificationsLog[offset + 14],
-                        devStatsNotificationsLog[offset + 13], devStatsNotificationsLog[offset + 12],
-                        devStatsNotificationsLog[offset + 11], devStatsNotificationsLog[offset + 10],
-                        devStatsNotificationsLog[offset + 9], devStatsNotificationsLog[offset + 8]);
-                    uint8_t statisticLogPage    = M_Byte3(statisticLocation);
-                    uint8_t statisticByteOffset = M_Byte0(statisticLocation);
-                    set_ATA_Dev_Stat_Notification_Info(
-                        statisticCondition,
-                        dev_stat_page_offset_map(deviceStats, statisticLogPage, statisticByteOffset));
-                }
-            }
-            safe_free_aligned(&devStatsNotificationsLog);
-        }
-        if (SUCCESS == get_ATA_Log(device, ATA_LOG_DEVICE_STATISTICS, M_NULLPTR, M_NULLPTR, true, true, true,
-                                   deviceStatsLog, deviceStatsSize, M_NULLPTR, 0, 0))
-        {
-            uint32_t  offset                 = UINT32_C(0); // start offset 1 sector to get to the general statistics
-            uint64_t* qwordPtrDeviceStatsLog = M_NULLPTR;
-            ret                              = SUCCESS;
-            for (uint8_t pageIter = UINT8_C(0); pageIter < deviceStatsLog[ATA_DEV_STATS_SUP_PG_LIST_LEN_OFFSET];
-                 ++pageIter)
-            {
-                uint8_t statisticPage = deviceStatsLog[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + pageIter];
-                offset                = statisticPage * LEGACY_DRIVE_SEC_SIZE;
-                if (offset > deviceStatsSize)
-                {
-                    // this exists for the hack loop above
-                    break;
-                }
-                qwordPtrDeviceStatsLog = C_CAST(uint64_t*, &deviceStatsLog[offset]);
-                switch (statisticPage)
-                {
-                case ATA_DEVICE_STATS_LOG_LIST: // supported pages page...
-                    continue;
-                    break;
-                case ATA_DEVICE_STATS_LOG_GENERAL: // general statistics
-                    if (ATA_DEVICE_STATS_LOG_GENERAL == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.generalStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_FREE_FALL: // free fall statistics
-                    if (ATA_DEVICE_STATS_LOG_FREE_FALL == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.freeFallStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_ROTATING_MEDIA: // rotating media statistics
-                    if (ATA_DEVICE_STATS_LOG_ROTATING_MEDIA == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.rotatingMediaStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_GEN_ERR: // general errors statistics
-                    if (ATA_DEVICE_STATS_LOG_GEN_ERR == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.generalErrorsStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_TEMP: // temperature statistics
-                    if (ATA_DEVICE_STATS_LOG_TEMP == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.temperatureStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_TRANSPORT: // transport statistics
-                    if (ATA_DEVICE_STATS_LOG_TRANSPORT == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.transportStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_SSD: // solid state device statistics
-                    if (ATA_DEVICE_STATS_LOG_SSD == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.ssdStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_ZONED_DEVICE: // ZAC statistics
-                    if (ATA_DEVICE_STATS_LOG_ZONED_DEVICE == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.zonedDeviceStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_0_1:
-                    if (ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_0_1 == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.cdlStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_2_3:
-                    if (ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_2_3 == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.cdlStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                case ATA_DEVICE_STATS_LOG_VENDOR_SPECIFIC: // vendor specific
-                    if (ATA_DEVICE_STATS_LOG_VENDOR_SPECIFIC == M_Byte2(le64_to_host(qwordPtrDeviceStatsLog[0])))
-                    {
-                        deviceStats->sataStatistics.vendorSpecificStatisticsSupported = true;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                    break;
-                default:
-                    continue;
-                    break;
-                }
-
-                for (uint16_t statisticOffset = UINT16_C(8); statisticOffset < LEGACY_DRIVE_SEC_SIZE;
-                     statisticOffset += UINT16_C(8))
-                {
-                    // TODO: Need to adjust min/max field offsets based on the attribute. For now selecting all 48
-                    // possible bits seems ok.
-                    //       Need more testing and to come back to this again later.
-                    uint16_t statisticNumberOnPage = statisticOffset / UINT16_C(8);
-                    if (set_ATA_Dev_Stat_Info(le64_to_host(qwordPtrDeviceStatsLog[statisticNumberOnPage]),
-                                              dev_stat_page_offset_map(deviceStats, statisticPage, statisticOffset)))
-                    {
-                        ++deviceStats->sataStatistics.statisticsPopulated;
-                        if (statisticPage == ATA_DEVICE_STATS_LOG_VENDOR_SPECIFIC)
-                        {
-                            ++deviceStats->sataStatistics.vendorSpecificStatisticsPopulated;
-                        }
-                        else if (statisticPage == ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_0_1)
-                        {
-                            if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE1_STAT_A_R1)
-                            {
-                                deviceStats->sataStatistics.cdlStatisticRanges = 2;
-                            }
-                            else if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE0_STAT_A_R1)
-                            {
-                                deviceStats->sataStatistics.cdlStatisticRanges = 1;
-                            }
-                        }
-                        else if (statisticPage == ATA_DEVICE_STATS_LOG_CDL_LBA_RANGE_2_3)
-                        {
-                            if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE3_STAT_A_R1)
-                            {
-                                deviceStats->sataStatistics.cdlStatisticRanges = 4;
-                            }
-                            else if (statisticOffset >= ATA_DEV_STAT_CDL_RANGE2_STAT_A_R1)
-                            {
-                                deviceStats->sataStatistics.cdlStatisticRanges = 3;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        safe_free_aligned(&deviceStatsLog);
-    }
-    return ret;
-}
-
-static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatistics deviceStats)
-{
-    eReturnValues ret = NOT_SUPPORTED;
-    if (deviceStats == M_NULLPTR)
-    {
-        return BAD_PARAMETER;
-    }
-    DECLARE_ZERO_INIT_ARRAY(uint8_t, supportedLogPages, LEGACY_DRIVE_SEC_SIZE);
-    // read list of supported logs, the with that list we'll populate the statistics data
-    bool dummyUpLogPages   = false;
-    bool subpagesSupported = true;
-    if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF,
-                                      0, supportedLogPages, LEGACY_DRIVE_SEC_SIZE))
-    {
-        // either device doesn't support logs, or it just doesn't support subpages, so let's try reading the list of
-        // supported pages (no subpages) before saying we need to dummy up the list
-        if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0, 0,
-                                          supportedLogPages, LEGACY_DRIVE_SEC_SIZE))
-        {
-            dummyUpLogPages = true;
-        }
-        else
-        {
-            subpagesSupported = false;
-        }
-    }
-    if (!dummyUpLogPages)
-    {
-        // memcmp to make sure we weren't given zeros
-        DECLARE_ZERO_INIT_ARRAY(uint8_t, zeroMem, LEGACY_DRIVE_SEC_SIZE);
-        if (memcmp(zeroMem, supportedLogPages, LEGACY_DRIVE_SEC_SIZE) == 0)
-        {
-            dummyUpLogPages = true;
-        }
-    }
-    // this is really a work-around for USB drives since some DO support pages, but the don't actually list them (same
-    // as the VPD pages above). Most USB drives don't work though - TJE
-    if (dummyUpLogPages)
-    {
-        subpagesSupported = true;
-        safe_memset(supportedLogPages, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-        supportedLogPages[0] = 0;
-        supportedLogPages[1] = 0;
-        // page length
-        supportedLogPages[2] = 0;
-        supportedLogPages[3] = 0x29; // <---increment me when adding a new dummy page below
-        // descriptors (2 bytes per page for pages + subpage format)) if you add a new page here, make the page length
-        // above bigger
-        supportedLogPages[4]  = LP_SUPPORTED_LOG_PAGES; // just to be correct/accurate
-        supportedLogPages[5]  = 0;                      // subpage
-        supportedLogPages[6]  = LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES;
-        supportedLogPages[7]  = 0xFF; // supported subpages
-        supportedLogPages[8]  = LP_WRITE_ERROR_COUNTERS;
-        supportedLogPages[9]  = 0; // subpage
-        supportedLogPages[10] = LP_READ_ERROR_COUNTERS;
-        supportedLogPages[11] = 0; // subpage
-        supportedLogPages[12] = LP_READ_REVERSE_ERROR_COUNTERS;
-        supportedLogPages[13] = 0; // subpage
-        supportedLogPages[14] = LP_VERIFY_ERROR_COUNTERS;
-        supportedLogPages[15] = 0; // subpage
-        supportedLogPages[16] = LP_NON_MEDIUM_ERROR;
-        supportedLogPages[17] = 0; // subpage
-        supportedLogPages[18] = LP_FORMAT_STATUS_LOG_PAGE;
-        supportedLogPages[19] = 0; // subpage
-        supportedLogPages[20] = LP_LOGICAL_BLOCK_PROVISIONING;
-        supportedLogPages[21] = 0; // subpage
-        supportedLogPages[22] = LP_TEMPERATURE;
-        supportedLogPages[23] = 0; // subpage
-        supportedLogPages[24] = LP_ENVIRONMENTAL_REPORTING;
-        supportedLogPages[25] = 0x01; // subpage (page number is same as temperature)
-        supportedLogPages[26] = LP_ENVIRONMENTAL_LIMITS;
-        supportedLogPages[27] = 0x02; // subpage (page number is same as temperature)
-        supportedLogPages[28] = LP_START_STOP_CYCLE_COUNTER;
-        supportedLogPages[29] = 0;
-        supportedLogPages[30] = LP_UTILIZATION;
-        supportedLogPages[31] = 0x01; // subpage (page number is same as start stop cycle counter)
-        supportedLogPages[32] = LP_SOLID_STATE_MEDIA;
-        supportedLogPages[33] = 0; // subpage
-        supportedLogPages[34] = LP_BACKGROUND_SCAN_RESULTS;
-        supportedLogPages[35] = 0; // subpage
-        supportedLogPages[36] = LP_PENDING_DEFECTS;
-        supportedLogPages[37] = 0x01; // subpage (page number is same as background scan results)
-        supportedLogPages[38] = LP_LPS_MISALLIGNMENT;
-        supportedLogPages[39] = 0x03; // subpage (page number is same as background scan results)
-        supportedLogPages[40] = LP_NON_VOLITILE_CACHE;
-        supportedLogPages[41] = 0; // subpage
-        supportedLogPages[42] = LP_GENERAL_STATISTICS_AND_PERFORMANCE;
-        supportedLogPages[43] = 0; // subpage
-        supportedLogPages[44] = LP_CACHE_MEMORY_STATISTICS;
-        supportedLogPages[45] = 0x20; // subpage (page number is same as general statistics and performance)
-    }
-    uint32_t logPageIter = LOG_PAGE_HEADER_LENGTH; // log page descriptors start on offset 4 and are 2 bytes long each
-    uint16_t supportedPagesLength = M_BytesTo2ByteValue(supportedLogPages[2], supportedLogPages[3]);
-    uint8_t  incrementAmount      = subpagesSupported ? 2 : 1;
-    DECLARE_ZERO_INIT_ARRAY(uint8_t, tempLogBuf, LEGACY_DRIVE_SEC_SIZE);
-    for (; logPageIter <
-           M_Min(M_STATIC_CAST(uint32_t, supportedPagesLength) + LOG_PAGE_HEADER_LENGTH, LEGACY_DRIVE_SEC_SIZE);
-         logPageIter += incrementAmount)
-    {
-        uint8_t pageCode    = supportedLogPages[logPageIter] & 0x3F; // outer switch statement
-        uint8_t subpageCode = UINT8_C(0);
-        if (subpagesSupported)
-        {
-            subpageCode = supportedLogPages[logPageIter + 1]; // inner switch statement
-        }
-        switch (pageCode)
-        {
-        case LP_WRITE_ERROR_COUNTERS:
-            if (subpageCode == 0)
-            {
-                safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                {
-                    deviceStats->sasStatistics.writeErrorCountersSupported = true;
-                    uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                    uint8_t  parameterLength = UINT8_C(0);
-                    // loop through the data and gather the data from each parameter we care about getting.
-                    for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                         iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                    {
-                        uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                        parameterLength        = tempLogBuf[iter + 3];
-                        switch (parameterCode)
-                        {
-                        case 0: // Errors corrected without substantial delay
-                            deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.isSupported  = true;
-                            deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay.isValueValid =
-                                    false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 1: // Errors corrected with possible delays
-                            deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.isSupported  = true;
-                            deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 2: // total rewrites
-                            deviceStats->sasStatistics.writeTotalReWrites.isSupported  = true;
-                            deviceStats->sasStatistics.writeTotalReWrites.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.writeTotalReWrites.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.writeTotalReWrites.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.writeTotalReWrites.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.writeTotalReWrites.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.writeTotalReWrites.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.writeTotalReWrites.statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.writeTotalReWrites.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.writeTotalReWrites.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.writeTotalReWrites.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.writeTotalReWrites.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 3: // total errors corrected
-                            deviceStats->sasStatistics.writeErrorsCorrected.isSupported  = true;
-                            deviceStats->sasStatistics.writeErrorsCorrected.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.writeErrorsCorrected.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.writeErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.writeErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.writeErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.writeErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.writeErrorsCorrected.statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.writeErrorsCorrected.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.writeErrorsCorrected.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.writeErrorsCorrected.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.writeErrorsCorrected.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 4: // total times correction algorithm processed
-                            deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.isSupported  = true;
-                            deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed.isValueValid =
-                                    false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 5: // total bytes processed
-                            deviceStats->sasStatistics.writeTotalBytesProcessed.isSupported  = true;
-                            deviceStats->sasStatistics.writeTotalBytesProcessed.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.writeTotalBytesProcessed.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.writeTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.writeTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.writeTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.writeTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.writeTotalBytesProcessed.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.writeTotalBytesProcessed.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.writeTotalBytesProcessed.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.writeTotalBytesProcessed.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.writeTotalBytesProcessed.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 6: // total uncorrected errors
-                            deviceStats->sasStatistics.writeTotalUncorrectedErrors.isSupported  = true;
-                            deviceStats->sasStatistics.writeTotalUncorrectedErrors.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.writeTotalUncorrectedErrors.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.writeTotalUncorrectedErrors.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.writeTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.writeTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.writeTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.writeTotalUncorrectedErrors.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        default:
-                            break;
-                        }
-                        if (parameterLength == 0)
-                        {
-                            break;
-                        }
-                    }
-                    // thresholds
-                    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                    {
-                        pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                        parameterLength = 0;
-                        // loop through the data and gather the data from each parameter we care about getting.
-                        for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                             iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                        {
-                            uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                            parameterLength        = tempLogBuf[iter + 3];
-                            switch (parameterCode)
-                            {
-                            case 0: // Errors corrected without substantial delay
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay);
-                                }
-                                break;
-                            case 1: // Errors corrected with possible delays
-                                deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.supportsNotification =
-                                    true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.isThresholdValid =
-                                        true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays);
-                                }
-                                break;
-                            case 2: // total
-                                deviceStats->sasStatistics.writeTotalReWrites.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.writeTotalReWrites.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.writeTotalReWrites.threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.writeTotalReWrites.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.writeTotalReWrites.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.writeTotalReWrites.threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.writeTotalReWrites.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.writeTotalReWrites);
-                                }
-                                break;
-                            case 3: // total errors corrected
-                                deviceStats->sasStatistics.writeErrorsCorrected.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.writeErrorsCorrected.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.writeErrorsCorrected.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.writeErrorsCorrected.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.writeErrorsCorrected.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.writeErrorsCorrected.threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.writeErrorsCorrected.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.writeErrorsCorrected);
-                                }
-                                break;
-                            case 4: // total times correction algorithm processed
-                                deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed);
-                                }
-                                break;
-                            case 5: // total bytes processed
-                                deviceStats->sasStatistics.writeTotalBytesProcessed.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.writeTotalBytesProcessed.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.writeTotalBytesProcessed.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.writeTotalBytesProcessed.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.writeTotalBytesProcessed.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.writeTotalBytesProcessed.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.writeTotalBytesProcessed.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.writeTotalBytesProcessed);
-                                }
-                                break;
-                            case 6: // total uncorrected errors
-                                deviceStats->sasStatistics.writeTotalUncorrectedErrors.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.writeTotalUncorrectedErrors.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.writeTotalUncorrectedErrors.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.writeTotalUncorrectedErrors.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.writeTotalUncorrectedErrors);
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                            if (parameterLength == 0)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-            break;
-        case LP_READ_ERROR_COUNTERS:
-            ret = SUCCESS;
-            if (subpageCode == 0)
-            {
-                safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                {
-                    deviceStats->sasStatistics.readErrorCountersSupported = true;
-                    uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                    uint8_t  parameterLength = UINT8_C(0);
-                    // loop through the data and gather the data from each parameter we care about getting.
-                    for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                         iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                    {
-                        uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                        parameterLength        = tempLogBuf[iter + 3];
-                        switch (parameterCode)
-                        {
-                        case 0: // Errors corrected without substantial delay
-                            deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.isSupported  = true;
-                            deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay.isValueValid =
-                                    false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 1: // Errors corrected with possible delays
-                            deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.isSupported  = true;
-                            deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 2: // total
-                            deviceStats->sasStatistics.readTotalRereads.isSupported  = true;
-                            deviceStats->sasStatistics.readTotalRereads.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readTotalRereads.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readTotalRereads.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readTotalRereads.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readTotalRereads.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readTotalRereads.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readTotalRereads.statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readTotalRereads.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readTotalRereads.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readTotalRereads.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readTotalRereads.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 3: // total errors corrected
-                            deviceStats->sasStatistics.readErrorsCorrected.isSupported  = true;
-                            deviceStats->sasStatistics.readErrorsCorrected.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readErrorsCorrected.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readErrorsCorrected.statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readErrorsCorrected.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readErrorsCorrected.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readErrorsCorrected.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readErrorsCorrected.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 4: // total times correction algorithm processed
-                            deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.isSupported  = true;
-                            deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.isValueValid =
-                                    false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 5: // total bytes processed
-                            deviceStats->sasStatistics.readTotalBytesProcessed.isSupported  = true;
-                            deviceStats->sasStatistics.readTotalBytesProcessed.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readTotalBytesProcessed.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readTotalBytesProcessed.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readTotalBytesProcessed.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readTotalBytesProcessed.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readTotalBytesProcessed.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readTotalBytesProcessed.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 6: // total uncorrected errors
-                            deviceStats->sasStatistics.readTotalUncorrectedErrors.isSupported  = true;
-                            deviceStats->sasStatistics.readTotalUncorrectedErrors.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readTotalUncorrectedErrors.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readTotalUncorrectedErrors.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readTotalUncorrectedErrors.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        default:
-                            break;
-                        }
-                        if (parameterLength == 0)
-                        {
-                            break;
-                        }
-                    }
-                    // thresholds
-                    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                    {
-                        pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                        parameterLength = 0;
-                        // loop through the data and gather the data from each parameter we care about getting.
-                        for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                             iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                        {
-                            uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                            parameterLength        = tempLogBuf[iter + 3];
-                            switch (parameterCode)
-                            {
-                            case 0: // Errors corrected without substantial delay
-                                deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readErrorsCorrectedWithoutSubstantialDelay);
-                                }
-                                break;
-                            case 1: // Errors corrected with possible delays
-                                deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.supportsNotification =
-                                    true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.isThresholdValid =
-                                        true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays);
-                                }
-                                break;
-                            case 2: // total
-                                deviceStats->sasStatistics.readTotalRereads.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readTotalRereads.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readTotalRereads.threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readTotalRereads.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readTotalRereads.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readTotalRereads.threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readTotalRereads.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.readTotalRereads);
-                                }
-                                break;
-                            case 3: // total errors corrected
-                                deviceStats->sasStatistics.readErrorsCorrected.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readErrorsCorrected.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readErrorsCorrected.threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readErrorsCorrected.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readErrorsCorrected.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readErrorsCorrected.threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readErrorsCorrected.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.readErrorsCorrected);
-                                }
-                                break;
-                            case 4: // total times correction algorithm processed
-                                deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed);
-                                }
-                                break;
-                            case 5: // total bytes processed
-                                deviceStats->sasStatistics.readTotalBytesProcessed.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readTotalBytesProcessed.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readTotalBytesProcessed.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readTotalBytesProcessed.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readTotalBytesProcessed.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readTotalBytesProcessed.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readTotalBytesProcessed.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.readTotalBytesProcessed);
-                                }
-                                break;
-                            case 6: // total uncorrected errors
-                                deviceStats->sasStatistics.readTotalUncorrectedErrors.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readTotalUncorrectedErrors.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readTotalUncorrectedErrors.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readTotalUncorrectedErrors.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readTotalUncorrectedErrors.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readTotalUncorrectedErrors.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readTotalUncorrectedErrors.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.readTotalUncorrectedErrors);
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                            if (parameterLength == 0)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-            break;
-        case LP_READ_REVERSE_ERROR_COUNTERS:
-            if (subpageCode == 0)
-            {
-                safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                {
-                    deviceStats->sasStatistics.readReverseErrorCountersSupported = true;
-                    uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                    uint8_t  parameterLength = UINT8_C(0);
-                    // loop through the data and gather the data from each parameter we care about getting.
-                    for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                         iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                    {
-                        uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                        parameterLength        = tempLogBuf[iter + 3];
-                        switch (parameterCode)
-                        {
-                        case 0: // Errors corrected without substantial delay
-                            deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay.isSupported =
-                                true;
-                            deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay.isValueValid =
-                                true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                        .threshType = THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                        .threshType = THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                        .threshType = THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                        .threshType = THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                    .statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                    .statisticValue = M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                    .statisticValue = M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                          tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                    .statisticValue = M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                          tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                          tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                          tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                    .isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 1: // Errors corrected with possible delays
-                            deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.isSupported  = true;
-                            deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays.isValueValid =
-                                    false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 2: // total
-                            deviceStats->sasStatistics.readReverseTotalReReads.isSupported  = true;
-                            deviceStats->sasStatistics.readReverseTotalReReads.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readReverseTotalReReads.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readReverseTotalReReads.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readReverseTotalReReads.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readReverseTotalReReads.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readReverseTotalReReads.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readReverseTotalReReads.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readReverseTotalReReads.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readReverseTotalReReads.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readReverseTotalReReads.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readReverseTotalReReads.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 3: // total errors corrected
-                            deviceStats->sasStatistics.readReverseErrorsCorrected.isSupported  = true;
-                            deviceStats->sasStatistics.readReverseErrorsCorrected.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readReverseErrorsCorrected.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readReverseErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readReverseErrorsCorrected.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readReverseErrorsCorrected.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readReverseErrorsCorrected.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readReverseErrorsCorrected.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readReverseErrorsCorrected.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 4: // total times correction algorithm processed
-                            deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed.isSupported =
-                                true;
-                            deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed.isValueValid =
-                                true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                        .threshType = THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                        .threshType = THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                        .threshType = THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                        .threshType = THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                    .statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                    .statisticValue = M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                    .statisticValue = M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                          tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                    .statisticValue = M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                          tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                          tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                          tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                    .isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 5: // total bytes processed
-                            deviceStats->sasStatistics.readReverseTotalBytesProcessed.isSupported  = true;
-                            deviceStats->sasStatistics.readReverseTotalBytesProcessed.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readReverseTotalBytesProcessed.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readReverseTotalBytesProcessed.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readReverseTotalBytesProcessed.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readReverseTotalBytesProcessed.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readReverseTotalBytesProcessed.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readReverseTotalBytesProcessed.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 6: // total uncorrected errors
-                            deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.isSupported  = true;
-                            deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        default:
-                            break;
-                        }
-                        if (parameterLength == 0)
-                        {
-                            break;
-                        }
-                    }
-                    // thresholds
-                    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                    {
-                        pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                        parameterLength = 0;
-                        // loop through the data and gather the data from each parameter we care about getting.
-                        for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                             iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                        {
-                            uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                            parameterLength        = tempLogBuf[iter + 3];
-                            switch (parameterCode)
-                            {
-                            case 0: // Errors corrected without substantial delay
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay);
-                                }
-                                break;
-                            case 1: // Errors corrected with possible delays
-                                deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays);
-                                }
-                                break;
-                            case 2: // total
-                                deviceStats->sasStatistics.readReverseTotalReReads.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readReverseTotalReReads.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readReverseTotalReReads.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readReverseTotalReReads.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readReverseTotalReReads.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readReverseTotalReReads.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readReverseTotalReReads.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.readReverseTotalReReads);
-                                }
-                                break;
-                            case 3: // total errors corrected
-                                deviceStats->sasStatistics.readReverseErrorsCorrected.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readReverseErrorsCorrected.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readReverseErrorsCorrected.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrected.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrected.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readReverseErrorsCorrected.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readReverseErrorsCorrected.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.readReverseErrorsCorrected);
-                                }
-                                break;
-                            case 4: // total times correction algorithm processed
-                                deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed);
-                                }
-                                break;
-                            case 5: // total bytes processed
-                                deviceStats->sasStatistics.readReverseTotalBytesProcessed.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readReverseTotalBytesProcessed.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readReverseTotalBytesProcessed.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readReverseTotalBytesProcessed.isThresholdValid =
-                                            false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readReverseTotalBytesProcessed);
-                                }
-                                break;
-                            case 6: // total uncorrected errors
-                                deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.supportsNotification =
-                                    true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.isThresholdValid =
-                                        true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.readReverseTotalUncorrectedErrors.isThresholdValid =
-                                            false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.readReverseTotalUncorrectedErrors);
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                            if (parameterLength == 0)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-            break;
-        case LP_VERIFY_ERROR_COUNTERS:
-            if (subpageCode == 0)
-            {
-                safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                {
-                    deviceStats->sasStatistics.verifyErrorCountersSupported = true;
-                    uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                    uint8_t  parameterLength = UINT8_C(0);
-                    // loop through the data and gather the data from each parameter we care about getting.
-                    for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                         iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                    {
-                        uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                        parameterLength        = tempLogBuf[iter + 3];
-                        switch (parameterCode)
-                        {
-                        case 0: // Errors corrected without substantial delay
-                            deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.isSupported  = true;
-                            deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay.isValueValid =
-                                    false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 1: // Errors corrected with possible delays
-                            deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.isSupported  = true;
-                            deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 2: // total revverifies
-                            deviceStats->sasStatistics.verifyTotalReVerifies.isSupported  = true;
-                            deviceStats->sasStatistics.verifyTotalReVerifies.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.verifyTotalReVerifies.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.verifyTotalReVerifies.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.verifyTotalReVerifies.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.verifyTotalReVerifies.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.verifyTotalReVerifies.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.verifyTotalReVerifies.statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.verifyTotalReVerifies.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.verifyTotalReVerifies.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.verifyTotalReVerifies.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.verifyTotalReVerifies.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 3: // total errors corrected
-                            deviceStats->sasStatistics.verifyErrorsCorrected.isSupported  = true;
-                            deviceStats->sasStatistics.verifyErrorsCorrected.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.verifyErrorsCorrected.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.verifyErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.verifyErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.verifyErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.verifyErrorsCorrected.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.verifyErrorsCorrected.statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.verifyErrorsCorrected.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.verifyErrorsCorrected.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.verifyErrorsCorrected.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.verifyErrorsCorrected.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 4: // total times correction algorithm processed
-                            deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.isSupported  = true;
-                            deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                .thresholdNotificationEnabled = tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed.isValueValid =
-                                    false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 5: // total bytes processed
-                            deviceStats->sasStatistics.verifyTotalBytesProcessed.isSupported  = true;
-                            deviceStats->sasStatistics.verifyTotalBytesProcessed.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.verifyTotalBytesProcessed.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.verifyTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.verifyTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.verifyTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.verifyTotalBytesProcessed.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.verifyTotalBytesProcessed.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.verifyTotalBytesProcessed.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.verifyTotalBytesProcessed.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.verifyTotalBytesProcessed.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.verifyTotalBytesProcessed.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 6: // total uncorrected errors
-                            deviceStats->sasStatistics.verifyTotalUncorrectedErrors.isSupported  = true;
-                            deviceStats->sasStatistics.verifyTotalUncorrectedErrors.isValueValid = true;
-                            // check if thresholds supported, etc
-                            deviceStats->sasStatistics.verifyTotalUncorrectedErrors.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.verifyTotalUncorrectedErrors.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.verifyTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.verifyTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.verifyTotalUncorrectedErrors.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.verifyTotalUncorrectedErrors.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        default:
-                            break;
-                        }
-                        if (parameterLength == 0)
-                        {
-                            break;
-                        }
-                    }
-                    // thresholds
-                    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                    {
-                        pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                        parameterLength = 0;
-                        // loop through the data and gather the data from each parameter we care about getting.
-                        for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                             iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                        {
-                            uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                            parameterLength        = tempLogBuf[iter + 3];
-                            switch (parameterCode)
-                            {
-                            case 0: // Errors corrected without substantial delay
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay);
-                                }
-                                break;
-                            case 1: // Errors corrected with possible delays
-                                deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays);
-                                }
-                                break;
-                            case 2: // total reverifies
-                                deviceStats->sasStatistics.verifyTotalReVerifies.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.verifyTotalReVerifies.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.verifyTotalReVerifies.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.verifyTotalReVerifies.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.verifyTotalReVerifies.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.verifyTotalReVerifies.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.verifyTotalReVerifies.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.verifyTotalReVerifies);
-                                }
-                                break;
-                            case 3: // total errors corrected
-                                deviceStats->sasStatistics.verifyErrorsCorrected.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.verifyErrorsCorrected.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.verifyErrorsCorrected.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.verifyErrorsCorrected.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.verifyErrorsCorrected.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.verifyErrorsCorrected.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.verifyErrorsCorrected.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.verifyErrorsCorrected);
-                                }
-                                break;
-                            case 4: // total times correction algorithm processed
-                                deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                    .supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                        .isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                            .threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed
-                                            .isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed);
-                                }
-                                break;
-                            case 5: // total bytes processed
-                                deviceStats->sasStatistics.verifyTotalBytesProcessed.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.verifyTotalBytesProcessed.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.verifyTotalBytesProcessed.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.verifyTotalBytesProcessed.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.verifyTotalBytesProcessed.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.verifyTotalBytesProcessed.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.verifyTotalBytesProcessed.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.verifyTotalBytesProcessed);
-                                }
-                                break;
-                            case 6: // total uncorrected errors
-                                deviceStats->sasStatistics.verifyTotalUncorrectedErrors.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.verifyTotalUncorrectedErrors.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.verifyTotalUncorrectedErrors.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.verifyTotalUncorrectedErrors.isThresholdValid =
-                                            false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.verifyTotalUncorrectedErrors);
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                            if (parameterLength == 0)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-            break;
-        case LP_NON_MEDIUM_ERROR:
-            if (subpageCode == 0)
-            {
-                safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                {
-                    deviceStats->sasStatistics.nonMediumErrorSupported = true;
-                    uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                    uint8_t  parameterLength = UINT8_C(0);
-                    // loop through the data and gather the data from each parameter we care about getting.
-                    for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                         iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                    {
-                        uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                        parameterLength        = tempLogBuf[iter + 3];
-                        switch (parameterCode)
-                        {
-                        case 0: // non medium error count
-                            deviceStats->sasStatistics.nonMediumErrorCount.isSupported  = true;
-                            deviceStats->sasStatistics.nonMediumErrorCount.isValueValid = true;
-                            deviceStats->sasStatistics.nonMediumErrorCount.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.nonMediumErrorCount.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.nonMediumErrorCount.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.nonMediumErrorCount.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.nonMediumErrorCount.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.nonMediumErrorCount.statisticValue = tempLogBuf[iter + 4];
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.nonMediumErrorCount.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.nonMediumErrorCount.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.nonMediumErrorCount.statisticValue = M_BytesTo8ByteValue(
-                                    tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                    tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                    tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.nonMediumErrorCount.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        default:
-                            break;
-                        }
-                        if (parameterLength == 0)
-                        {
-                            break;
-                        }
-                    }
-                    // thresholds
-                    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                    {
-                        pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                        parameterLength = 0;
-                        // loop through the data and gather the data from each parameter we care about getting.
-                        for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                             iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                        {
-                            uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                            parameterLength        = tempLogBuf[iter + 3];
-                            switch (parameterCode)
-                            {
-                            case 0: // non medium error count
-                                deviceStats->sasStatistics.nonMediumErrorCount.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.nonMediumErrorCount.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.nonMediumErrorCount.threshold = tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.nonMediumErrorCount.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.nonMediumErrorCount.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.nonMediumErrorCount.threshold = M_BytesTo8ByteValue(
-                                            tempLogBuf[iter + 4], tempLogBuf[iter + 5], tempLogBuf[iter + 6],
-                                            tempLogBuf[iter + 7], tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                            tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.nonMediumErrorCount.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.nonMediumErrorCount);
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                            if (parameterLength == 0)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-            break;
-        case LP_FORMAT_STATUS_LOG_PAGE:
-            if (subpageCode == 0)
-            {
-                safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                {
-                    deviceStats->sasStatistics.formatStatusSupported = true;
-                    uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                    uint8_t  parameterLength = UINT8_C(0);
-                    // loop through the data and gather the data from each parameter we care about getting.
-                    for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                         iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                    {
-                        uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                        parameterLength        = tempLogBuf[iter + 3];
-                        switch (parameterCode)
-                        {
-                        case 0: // format data out
-                            break;
-                        case 1: // grown defects during certification
-                            deviceStats->sasStatistics.grownDefectsDuringCertification.isSupported  = true;
-                            deviceStats->sasStatistics.grownDefectsDuringCertification.isValueValid = true;
-                            deviceStats->sasStatistics.grownDefectsDuringCertification.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                if (deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue ==
-                                    UINT8_MAX)
-                                {
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.isValueValid = false;
-                                }
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                if (deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue ==
-                                    UINT16_MAX)
-                                {
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.isValueValid = false;
-                                }
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                if (deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue ==
-                                    UINT32_MAX)
-                                {
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.isValueValid = false;
-                                }
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                if (deviceStats->sasStatistics.grownDefectsDuringCertification.statisticValue ==
-                                    UINT64_MAX)
-                                {
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.isValueValid = false;
-                                }
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.grownDefectsDuringCertification.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 2: // total blocks reassigned during format
-                            deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isSupported  = true;
-                            deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isValueValid = true;
-                            deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                if (deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue ==
-                                    UINT8_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isValueValid = false;
-                                }
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                if (deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue ==
-                                    UINT16_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isValueValid = false;
-                                }
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                if (deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue ==
-                                    UINT32_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isValueValid = false;
-                                }
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                if (deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.statisticValue ==
-                                    UINT64_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isValueValid = false;
-                                }
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 3: // total new blocks reassigned
-                            deviceStats->sasStatistics.totalNewBlocksReassigned.isSupported  = true;
-                            deviceStats->sasStatistics.totalNewBlocksReassigned.isValueValid = true;
-                            deviceStats->sasStatistics.totalNewBlocksReassigned.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                if (deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue == UINT8_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.isValueValid = false;
-                                }
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                if (deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue == UINT16_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.isValueValid = false;
-                                }
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                if (deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue == UINT32_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.isValueValid = false;
-                                }
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                if (deviceStats->sasStatistics.totalNewBlocksReassigned.statisticValue == UINT64_MAX)
-                                {
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.isValueValid = false;
-                                }
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.totalNewBlocksReassigned.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        case 4: // power on minutes since last format
-                            deviceStats->sasStatistics.powerOnMinutesSinceFormat.isSupported  = true;
-                            deviceStats->sasStatistics.powerOnMinutesSinceFormat.isValueValid = true;
-                            deviceStats->sasStatistics.powerOnMinutesSinceFormat.thresholdNotificationEnabled =
-                                tempLogBuf[iter + 2] & BIT4; // ETC bit
-                            if (tempLogBuf[iter + 2] & BIT4)
-                            {
-                                switch ((tempLogBuf[iter + 2] & (BIT2 | BIT3)) >> 2)
-                                {
-                                case 3:
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
-                                    break;
-                                case 2:
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
-                                    break;
-                                case 1:
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshType =
-                                        THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
-                                    break;
-                                case 0:
-                                default:
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshType =
-                                        THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
-                                    break;
-                                }
-                            }
-                            switch (parameterLength)
-                            {
-                            case 1: // single byte
-                                deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue =
-                                    tempLogBuf[iter + 4];
-                                if (deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue == UINT8_MAX)
-                                {
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.isValueValid = false;
-                                }
-                                break;
-                            case 2: // word
-                                deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue =
-                                    M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                if (deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue == UINT16_MAX)
-                                {
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.isValueValid = false;
-                                }
-                                break;
-                            case 4: // double word
-                                deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue =
-                                    M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                if (deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue == UINT32_MAX)
-                                {
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.isValueValid = false;
-                                }
-                                break;
-                            case 8: // quad word
-                                deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue =
-                                    M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                        tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                        tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                        tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                if (deviceStats->sasStatistics.powerOnMinutesSinceFormat.statisticValue == UINT64_MAX)
-                                {
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.isValueValid = false;
-                                }
-                                break;
-                            default: // don't bother trying to read the data since it's in a more complicated format to
-                                     // read than we care to handle in this code right now
-                                deviceStats->sasStatistics.powerOnMinutesSinceFormat.isValueValid = false;
-                                break;
-                            }
-                            ++deviceStats->sasStatistics.statisticsPopulated;
-                            break;
-                        default:
-                            break;
-                        }
-                        if (parameterLength == 0)
-                        {
-                            break;
-                        }
-                    }
-                    // thresholds
-                    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0001, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
-                    {
-                        pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
-                        parameterLength = 0;
-                        // loop through the data and gather the data from each parameter we care about getting.
-                        for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
-                             iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
-                        {
-                            uint16_t parameterCode = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
-                            parameterLength        = tempLogBuf[iter + 3];
-                            switch (parameterCode)
-                            {
-                            case 0: // format data out
-                                break;
-                            case 1: // grown defects during certification
-                                deviceStats->sasStatistics.grownDefectsDuringCertification.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.grownDefectsDuringCertification.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.grownDefectsDuringCertification.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.grownDefectsDuringCertification.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.grownDefectsDuringCertification.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.grownDefectsDuringCertification.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.grownDefectsDuringCertification.isThresholdValid =
-                                            false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.grownDefectsDuringCertification);
-                                }
-                                break;
-                            case 2: // total blocks reassigned during format
-                                deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.supportsNotification =
-                                    true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isThresholdValid =
-                                        true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.totalBlocksReassignedDuringFormat.isThresholdValid =
-                                            false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(
-                                        &deviceStats->sasStatistics.totalBlocksReassignedDuringFormat);
-                                }
-                                break;
-                            case 3: // total new blocks reassigned
-                                deviceStats->sasStatistics.totalNewBlocksReassigned.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.totalNewBlocksReassigned.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.totalNewBlocksReassigned.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.totalNewBlocksReassigned.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.totalNewBlocksReassigned.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.totalNewBlocksReassigned.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.totalNewBlocksReassigned.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.totalNewBlocksReassigned);
-                                }
-                                break;
-                            case 4: // power on minutes since format
-                                deviceStats->sasStatistics.powerOnMinutesSinceFormat.supportsNotification = true;
-                                if (tempLogBuf[iter + 2] & BIT4)
-                                {
-                                    deviceStats->sasStatistics.powerOnMinutesSinceFormat.isThresholdValid = true;
-                                    switch (parameterLength)
-                                    {
-                                    case 1: // single byte
-                                        deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshold =
-                                            tempLogBuf[iter + 4];
-                                        break;
-                                    case 2: // word
-                                        deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshold =
-                                            M_BytesTo2ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5]);
-                                        break;
-                                    case 4: // double word
-                                        deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshold =
-                                            M_BytesTo4ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7]);
-                                        break;
-                                    case 8: // quad word
-                                        deviceStats->sasStatistics.powerOnMinutesSinceFormat.threshold =
-                                            M_BytesTo8ByteValue(tempLogBuf[iter + 4], tempLogBuf[iter + 5],
-                                                                tempLogBuf[iter + 6], tempLogBuf[iter + 7],
-                                                                tempLogBuf[iter + 8], tempLogBuf[iter + 9],
-                                                                tempLogBuf[iter + 10], tempLogBuf[iter + 11]);
-                                        break;
-                                    default: // don't bother trying to read the data since it's in a more complicated
-                                             // format to read than we care to handle in this code right now
-                                        deviceStats->sasStatistics.powerOnMinutesSinceFormat.isThresholdValid = false;
-                                        break;
-                                    }
-                                    scsi_Threshold_Comparison(&deviceStats->sasStatistics.powerOnMinutesSinceFormat);
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                            if (parameterLength == 0)
-                            {
-                                break;
-                            }
-                        }
-                    }
+                                            devStatsNotificationsLog[offset + 5], devStatsNotificationsLog[offset + 4],
+                                            devStatsNotificationsLog[offset + 3], devStatsNotificationsLog[offset + 2],
+                                            devStatsNotificationsLog[offset + 1], devStatsNotificationsLog[offset]);
+                    uint64_t statisticCondition = M_BytesTo8ByteValue(
+                        devStatsNotificationsLog[offset + 15], devStatsNotificationsLog[offset + 14],
+                        devStatsNotificationsLog[offset + 13], devStatsNotificationsLog[offset + 12],
+                        devStatsNotificationsLog[offset + 11], devStatsNotificationsLog[offset + 10],
+                        devStatsNotificationsLog[offset + 9], devStatsNotificationsLog[offset + 8]);
+                    uint8_t statisticLogPage    = M_Byte3(statisticLocation);
+                    uint8_t statisticByteOffset = M_Byte0(statisticLocation);
+                    set_ATA_Dev_Stat_Notification_Info(
+                        statisticCondition,
+                        dev_stat_page_offset_map(deviceStats, statisticLogPage, statisticByteOffset));
+                }
+            }
+            safe_free_aligned(&devStatsNotificationsLog);
+        }
+        if (requestMask != DEVICE_STATISTICS_ALL_PAGES)
+        {
+            return get_Selected_ATA_Device_Statistics_Pages(device, logCache, directories, deviceStats, requestMask,
+                                                            deviceStatsSize);
+        }
+        uint8_t* deviceStatsLog = M_REINTERPRET_CAST(
+            uint8_t*, safe_calloc_aligned(deviceStatsSize, sizeof(uint8_t), device->os_info.minimumAlignment));
+        if (deviceStatsLog == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        if (SUCCESS == cached_ATA_Get_Log(device, logCache, ATA_LOG_DEVICE_STATISTICS, true, true, deviceStatsLog,
+                                          deviceStatsSize))
+        {
+            ret = SUCCESS;
+            for (uint8_t pageIter = UINT8_C(0); pageIter < deviceStatsLog[ATA_DEV_STATS_SUP_PG_LIST_LEN_OFFSET];
+                 ++pageIter)
+            {
+                uint8_t  statisticPage = deviceStatsLog[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + pageIter];
+                uint32_t offset        = C_CAST(uint32_t, statisticPage) * LEGACY_DRIVE_SEC_SIZE;
+                if (offset + LEGACY_DRIVE_SEC_SIZE > deviceStatsSize)
+                {
+                    // this exists for the hack loop above
+                    break;
+                }
+                if (get_ATA_Dev_Stat_Request_Mask(statisticPage) & requestMask)
+                {
+                    decode_ATA_Device_Statistics_Page(deviceStats, statisticPage, &deviceStatsLog[offset]);
+                }
+            }
+        }
+        safe_free_aligned(&deviceStatsLog);
+    }
+    return ret;
+}
+
+static M_INLINE eThresholdType get_SCSI_Threshold_Type(uint8_t parameterControl)
+{
+    switch ((parameterControl & (BIT2 | BIT3)) >> 2)
+    {
+    case 3:
+        return THRESHOLD_TYPE_TRIGGER_WHEN_GREATER;
+    case 2:
+        return THRESHOLD_TYPE_TRIGGER_WHEN_NOT_EQUAL;
+    case 1:
+        return THRESHOLD_TYPE_TRIGGER_WHEN_EQUAL;
+    case 0:
+    default:
+        return THRESHOLD_TYPE_ALWAYS_TRIGGER_ON_UPDATE;
+    }
+}
+
+// Reads the big endian value following the 4 byte parameter header. Only 1, 2, 4, and 8 byte values are read. Anything
+// else is in a more complicated format than is handled here.
+static bool get_SCSI_Statistic_Parameter_Value(const uint8_t* logBuf, uint16_t parameterOffset, uint64_t* value)
+{
+    uint8_t parameterLength = logBuf[parameterOffset + 3];
+    if ((parameterLength != 1 && parameterLength != 2 && parameterLength != 4 && parameterLength != 8) ||
+        parameterOffset + UINT16_C(4) + parameterLength > LEGACY_DRIVE_SEC_SIZE)
+    {
+        return false;
+    }
+    *value = UINT64_C(0);
+    for (uint8_t byteIter = UINT8_C(0); byteIter < parameterLength; ++byteIter)
+    {
+        *value = (*value << 8) | logBuf[parameterOffset + 4 + byteIter];
+    }
+    return true;
+}
+
+static uint32_t get_SCSI_Dev_Stat_Request_Mask(uint8_t pageCode)
+{
+    switch (pageCode)
+    {
+    case LP_WRITE_ERROR_COUNTERS:
+    case LP_READ_ERROR_COUNTERS:
+    case LP_READ_REVERSE_ERROR_COUNTERS:
+    case LP_VERIFY_ERROR_COUNTERS:
+    case LP_NON_MEDIUM_ERROR:
+    case LP_FORMAT_STATUS_LOG_PAGE:
+        return DEVICE_STATISTICS_GENERAL_ERRORS;
+    case LP_LOGICAL_BLOCK_PROVISIONING:
+    case LP_SOLID_STATE_MEDIA:
+        return DEVICE_STATISTICS_SSD;
+    case LP_TEMPERATURE: // also environmental reporting and limits
+        return DEVICE_STATISTICS_TEMPERATURE;
+    case LP_START_STOP_CYCLE_COUNTER: // also utilization
+    case LP_NON_VOLITILE_CACHE:
+    case LP_GENERAL_STATISTICS_AND_PERFORMANCE: // also cache memory statistics
+    case LP_POWER_CONDITIONS_TRANSITIONS:
+        return DEVICE_STATISTICS_GENERAL;
+    case LP_BACKGROUND_SCAN_RESULTS: // also pending defects
+        return DEVICE_STATISTICS_ROTATING_MEDIA;
+    case LP_ZONED_DEVICE_STATISTICS:
+        return DEVICE_STATISTICS_ZONED;
+    case LP_PROTOCOL_SPECIFIC_PORT:
+        return DEVICE_STATISTICS_TRANSPORT;
+    default:
+        return UINT32_C(0);
+    }
+}
+
+// Threshold values are only read when DEVICE_STATISTICS_THRESHOLDS was requested
+static eReturnValues read_SCSI_Log_Thresholds(tDevice* device,
+                                              uint32_t requestMask,
+                                              uint8_t  pageCode,
+                                              uint8_t  subpageCode,
+                                              uint16_t parameterPointer,
+                                              uint8_t* ptrData,
+                                              uint16_t dataSize)
+{
+    if ((requestMask & DEVICE_STATISTICS_THRESHOLDS) == UINT32_C(0))
+    {
+        return NOT_SUPPORTED;
+    }
+    return scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode, parameterPointer, ptrData,
+                              dataSize);
+}
+
+// Decodes a page from scsiDevStatPages: cumulative values first, then thresholds if the device reports them.
+static void get_SCSI_Counter_Page_Statistics(tDevice*            device,
+                                             ptrLogPageCache     logCache,
+                                             ptrDeviceStatistics deviceStats,
+                                             const devStatPage*  pageMap,
+                                             uint32_t            requestMask,
+                                             uint8_t*            tempLogBuf)
+{
+    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
+    if (SUCCESS != cached_SCSI_Log_Sense(device, logCache, pageMap->page, pageMap->subpage, pageMap->parameterPointer,
+                                         tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+    {
+        return;
+    }
+    *dev_Stat_Page_Supported(&deviceStats->sasStatistics, pageMap) = true;
+    uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
+    uint8_t  parameterLength = UINT8_C(0);
+    // loop through the data and gather the data from each parameter we care about getting.
+    for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
+         iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
+    {
+        uint16_t parameterCode    = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
+        uint8_t  parameterControl = tempLogBuf[iter + 2];
+        parameterLength           = tempLogBuf[iter + 3];
+        const devStatField* field = find_Dev_Stat_Field(pageMap, parameterCode);
+        if (field != M_NULLPTR)
+        {
+            statistic* stat                    = dev_Stat_Field(&deviceStats->sasStatistics, field);
+            uint64_t   value                   = UINT64_C(0);
+            stat->isSupported                  = true;
+            stat->thresholdNotificationEnabled = M_ToBool(parameterControl & BIT4); // ETC bit
+            if (parameterControl & BIT4)
+            {
+                stat->threshType = get_SCSI_Threshold_Type(parameterControl);
+            }
+            stat->isValueValid = get_SCSI_Statistic_Parameter_Value(tempLogBuf, iter, &value);
+            if (stat->isValueValid)
+            {
+                stat->statisticValue = value;
+                if ((pageMap->flags & DEV_STAT_PAGE_ALL_F_IS_INVALID) &&
+                    value == (parameterLength == 8 ? UINT64_MAX : (UINT64_C(1) << (parameterLength * 8)) - 1))
+                {
+                    stat->isValueValid = false;
                 }
             }
+            ++deviceStats->sasStatistics.statisticsPopulated;
+        }
+        if (parameterLength == 0)
+        {
             break;
+        }
+    }
+    // thresholds
+    safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
+    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageMap->page, pageMap->subpage,
+                                            pageMap->parameterPointer, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+    {
+        pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
+        parameterLength = 0;
+        for (uint16_t iter = UINT16_C(4); iter < pageLength && iter < LEGACY_DRIVE_SEC_SIZE;
+             iter += (C_CAST(uint16_t, parameterLength + UINT16_C(4))))
+        {
+            uint16_t parameterCode    = M_BytesTo2ByteValue(tempLogBuf[iter], tempLogBuf[iter + 1]);
+            parameterLength           = tempLogBuf[iter + 3];
+            const devStatField* field = find_Dev_Stat_Field(pageMap, parameterCode);
+            if (field != M_NULLPTR)
+            {
+                statistic* stat            = dev_Stat_Field(&deviceStats->sasStatistics, field);
+                stat->supportsNotification = true;
+                if (tempLogBuf[iter + 2] & BIT4)
+                {
+                    stat->isThresholdValid = get_SCSI_Statistic_Parameter_Value(tempLogBuf, iter, &stat->threshold);
+                    scsi_Threshold_Comparison(stat);
+                }
+            }
+            if (parameterLength == 0)
+            {
+                break;
+            }
+        }
+    }
+}
+
+static eReturnValues get_SCSI_DeviceStatistics(tDevice*            device,
+                                               ptrLogPageCache     logCache,
+                                               ptrDeviceStatistics deviceStats,
+                                               uint32_t            requestMask)
+{
+    eReturnValues ret = NOT_SUPPORTED;
+    if (deviceStats == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, supportedLogPages, LEGACY_DRIVE_SEC_SIZE);
+    // read list of supported logs, the with that list we'll populate the statistics data
+    bool dummyUpLogPages   = false;
+    bool subpagesSupported = true;
+    if (SUCCESS != cached_SCSI_Log_Sense(device, logCache, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF, 0,
+                                         supportedLogPages, LEGACY_DRIVE_SEC_SIZE))
+    {
+        // either device doesn't support logs, or it just doesn't support subpages, so let's try reading the list of
+        // supported pages (no subpages) before saying we need to dummy up the list
+        if (SUCCESS != cached_SCSI_Log_Sense(device, logCache, LP_SUPPORTED_LOG_PAGES, 0, 0, supportedLogPages,
+                                             LEGACY_DRIVE_SEC_SIZE))
+        {
+            dummyUpLogPages = true;
+        }
+        else
+        {
+            subpagesSupported = false;
+        }
+    }
+    if (!dummyUpLogPages)
+    {
+        // memcmp to make sure we weren't given zeros
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, zeroMem, LEGACY_DRIVE_SEC_SIZE);
+        if (memcmp(zeroMem, supportedLogPages, LEGACY_DRIVE_SEC_SIZE) == 0)
+        {
+            dummyUpLogPages = true;
+        }
+    }
+    // this is really a work-around for USB drives since some DO support pages, but the don't actually list them (same
+    // as the VPD pages above). Most USB drives don't work though - TJE
+    if (dummyUpLogPages)
+    {
+        subpagesSupported = true;
+        safe_memset(supportedLogPages, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
+        supportedLogPages[0] = 0;
+        supportedLogPages[1] = 0;
+        // page length
+        supportedLogPages[2] = 0;
+        supportedLogPages[3] = 0x29; // <---increment me when adding a new dummy page below
+        // descriptors (2 bytes per page for pages + subpage format)) if you add a new page here, make the page length
+        // above bigger
+        supportedLogPages[4]  = LP_SUPPORTED_LOG_PAGES; // just to be correct/accurate
+        supportedLogPages[5]  = 0;                      // subpage
+        supportedLogPages[6]  = LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES;
+        supportedLogPages[7]  = 0xFF; // supported subpages
+        supportedLogPages[8]  = LP_WRITE_ERROR_COUNTERS;
+        supportedLogPages[9]  = 0; // subpage
+        supportedLogPages[10] = LP_READ_ERROR_COUNTERS;
+        supportedLogPages[11] = 0; // subpage
+        supportedLogPages[12] = LP_READ_REVERSE_ERROR_COUNTERS;
+        supportedLogPages[13] = 0; // subpage
+        supportedLogPages[14] = LP_VERIFY_ERROR_COUNTERS;
+        supportedLogPages[15] = 0; // subpage
+        supportedLogPages[16] = LP_NON_MEDIUM_ERROR;
+        supportedLogPages[17] = 0; // subpage
+        supportedLogPages[18] = LP_FORMAT_STATUS_LOG_PAGE;
+        supportedLogPages[19] = 0; // subpage
+        supportedLogPages[20] = LP_LOGICAL_BLOCK_PROVISIONING;
+        supportedLogPages[21] = 0; // subpage
+        supportedLogPages[22] = LP_TEMPERATURE;
+        supportedLogPages[23] = 0; // subpage
+        supportedLogPages[24] = LP_ENVIRONMENTAL_REPORTING;
+        supportedLogPages[25] = 0x01; // subpage (page number is same as temperature)
+        supportedLogPages[26] = LP_ENVIRONMENTAL_LIMITS;
+        supportedLogPages[27] = 0x02; // subpage (page number is same as temperature)
+        supportedLogPages[28] = LP_START_STOP_CYCLE_COUNTER;
+        supportedLogPages[29] = 0;
+        supportedLogPages[30] = LP_UTILIZATION;
+        supportedLogPages[31] = 0x01; // subpage (page number is same as start stop cycle counter)
+        supportedLogPages[32] = LP_SOLID_STATE_MEDIA;
+        supportedLogPages[33] = 0; // subpage
+        supportedLogPages[34] = LP_BACKGROUND_SCAN_RESULTS;
+        supportedLogPages[35] = 0; // subpage
+        supportedLogPages[36] = LP_PENDING_DEFECTS;
+        supportedLogPages[37] = 0x01; // subpage (page number is same as background scan results)
+        supportedLogPages[38] = LP_LPS_MISALLIGNMENT;
+        supportedLogPages[39] = 0x03; // subpage (page number is same as background scan results)
+        supportedLogPages[40] = LP_NON_VOLITILE_CACHE;
+        supportedLogPages[41] = 0; // subpage
+        supportedLogPages[42] = LP_GENERAL_STATISTICS_AND_PERFORMANCE;
+        supportedLogPages[43] = 0; // subpage
+        supportedLogPages[44] = LP_CACHE_MEMORY_STATISTICS;
+        supportedLogPages[45] = 0x20; // subpage (page number is same as general statistics and performance)
+    }
+    // any selected page that is read adds to statisticsPopulated, which is what makes this a success
+    uint16_t populatedBeforePages = deviceStats->sasStatistics.statisticsPopulated;
+    uint32_t logPageIter = LOG_PAGE_HEADER_LENGTH; // log page descriptors start on offset 4 and are 2 bytes long each
+    uint16_t supportedPagesLength = M_BytesTo2ByteValue(supportedLogPages[2], supportedLogPages[3]);
+    uint8_t  incrementAmount      = subpagesSupported ? 2 : 1;
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, tempLogBuf, LEGACY_DRIVE_SEC_SIZE);
+    for (; logPageIter <
+           M_Min(M_STATIC_CAST(uint32_t, supportedPagesLength) + LOG_PAGE_HEADER_LENGTH, LEGACY_DRIVE_SEC_SIZE);
+         logPageIter += incrementAmount)
+    {
+        uint8_t pageCode    = supportedLogPages[logPageIter] & 0x3F; // outer switch statement
+        uint8_t subpageCode = UINT8_C(0);
+        if (subpagesSupported)
+        {
+            subpageCode = supportedLogPages[logPageIter + 1]; // inner switch statement
+        }
+        if ((get_SCSI_Dev_Stat_Request_Mask(pageCode) & requestMask) == UINT32_C(0))
+        {
+            continue;
+        }
+        switch (pageCode)
+        {
+        case LP_READ_ERROR_COUNTERS:
+        case LP_WRITE_ERROR_COUNTERS:
+        case LP_READ_REVERSE_ERROR_COUNTERS:
+        case LP_VERIFY_ERROR_COUNTERS:
+        case LP_NON_MEDIUM_ERROR:
+        case LP_FORMAT_STATUS_LOG_PAGE:
+        {
+            const devStatPage* pageMap =
+                find_Dev_Stat_Page(scsiDevStatPages, SIZE_OF_STACK_ARRAY(scsiDevStatPages), pageCode, subpageCode);
+            if (pageMap != M_NULLPTR)
+            {
+                get_SCSI_Counter_Page_Statistics(device, logCache, deviceStats, pageMap, requestMask, tempLogBuf);
+            }
+        }
+        break;
         case LP_LOGICAL_BLOCK_PROVISIONING:
             if (subpageCode == 0)
             {
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.logicalBlockProvisioningSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -4843,8 +1281,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0001, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0001,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -4944,8 +1382,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             {
             case 0: // temperature
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.temperatureSupported = true;
                     uint16_t pageLength                             = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -5030,8 +1468,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0000,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -5074,8 +1512,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                 break;
             case 1: // environmental reporting
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.environmentReportingSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -5319,8 +1757,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                 break;
             case 2: // environmental limits
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.environmentReportingSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -5550,8 +1988,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             {
             case 0: // start stop cycle counter
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.startStopCycleCounterSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -5774,8 +2212,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0001, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0001,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -5881,8 +2319,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                 break;
             case 1: // utilization
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.utilizationSupported = true;
                     uint16_t pageLength                             = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -5969,8 +2407,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0000,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -6024,8 +2462,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             if (subpageCode == 0)
             {
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.solidStateMediaSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -6079,8 +2517,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0001, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0001,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -6118,8 +2556,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             {
             case 0: // background scan results
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.backgroundScanResultsSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -6164,8 +2602,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0000,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -6220,8 +2658,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                 break;
             case 1: // pending defects
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.pendingDefectsSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -6276,8 +2714,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0000,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -6315,8 +2753,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                 break;
             case 3: // lps misalignment
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.lpsMisalignmentSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -6371,8 +2809,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0000,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -6413,8 +2851,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             if (subpageCode == 0)
             {
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.nvCacheSupported = true;
                     uint16_t pageLength                         = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -6501,8 +2939,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0000, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0000,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -6551,8 +2989,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             {
             case 0: // general statistics and performance
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.generalStatisticsAndPerformanceSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -6970,8 +3408,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0001, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0001,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -7194,8 +3632,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                 // group statistics (1 - 1f)
             case 0x20: // cache memory statistics
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.cacheMemoryStatisticsSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -7410,8 +3848,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                     }
                     // thresholds
                     safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_THRESHOLD_VALUES, pageCode, subpageCode,
-                                                      0x0001, tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                    if (SUCCESS == read_SCSI_Log_Thresholds(device, requestMask, pageCode, subpageCode, 0x0001,
+                                                            tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
                     {
                         pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
                         parameterLength = 0;
@@ -7504,8 +3942,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             case 0x01: // ZBD statistics
             {
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.cacheMemoryStatisticsSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -7647,8 +4085,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             {
             case 0:
                 safe_memset(tempLogBuf, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0000,
-                                                  tempLogBuf, LEGACY_DRIVE_SEC_SIZE))
+                if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0000, tempLogBuf,
+                                                     LEGACY_DRIVE_SEC_SIZE))
                 {
                     deviceStats->sasStatistics.powerConditionTransitionsSupported = true;
                     uint16_t pageLength      = M_BytesTo2ByteValue(tempLogBuf[2], tempLogBuf[3]);
@@ -7881,9 +4319,8 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
                                                                          device->os_info.minimumAlignment));
                     if (protSpData != M_NULLPTR)
                     {
-                        if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES,
-                                                          LP_PROTOCOL_SPECIFIC_PORT, 0, 0, protSpData,
-                                                          protocolSpecificDataLength))
+                        if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, LP_PROTOCOL_SPECIFIC_PORT, 0, 0,
+                                                             protSpData, protocolSpecificDataLength))
                         {
                             // mimimum page length for a SAS drive assuming only 1 port and 1 phy is 64B. Each
                             // additional port adds a minimum of another 60 bytes
@@ -8223,10 +4660,22 @@ static eReturnValues get_SCSI_DeviceStatistics(tDevice* device, ptrDeviceStatist
             }
         }
     }
+    if (deviceStats->sasStatistics.statisticsPopulated > populatedBeforePages)
+    {
+        ret = SUCCESS;
+    }
     return ret;
 }
 
 eReturnValues get_DeviceStatistics(tDevice* device, ptrDeviceStatistics deviceStats)
+{
+    return get_DeviceStatistics_Pages(device, M_NULLPTR, deviceStats, DEVICE_STATISTICS_ALL_PAGES);
+}
+
+eReturnValues get_DeviceStatistics_Pages(tDevice*            device,
+                                         ptrLogPageCache     logCache,
+                                         ptrDeviceStatistics deviceStats,
+                                         uint32_t            requestMask)
 {
     eReturnValues ret = NOT_SUPPORTED;
     DISABLE_NONNULL_COMPARE
@@ -8236,11 +4685,11 @@ eReturnValues get_DeviceStatistics(tDevice* device, ptrDeviceStatistics deviceSt
     }
     if (device->drive_info.drive_type == ATA_DRIVE)
     {
-        return get_ATA_DeviceStatistics(device, deviceStats);
+        return get_ATA_DeviceStatistics(device, logCache, deviceStats, requestMask);
     }
     else if (device->drive_info.drive_type == SCSI_DRIVE)
     {
-        return get_SCSI_DeviceStatistics(device, deviceStats);
+        return get_SCSI_DeviceStatistics(device, logCache, deviceStats, requestMask);
     }
     RESTORE_NONNULL_COMPARE
     return ret;
@@ -9293,137 +5742,73 @@ static void print_Humidity_Statistic(statistic theStatistic, const char* statist
     }
 }
 
-static eReturnValues print_ATA_DeviceStatistics(tDevice* device, ptrDeviceStatistics deviceStats)
+static void print_Dev_Stat_Field(statistic theStatistic, const devStatField* field)
 {
-    eReturnValues ret = SUCCESS;
-    if (deviceStats == M_NULLPTR)
+    switch (field->display)
     {
-        return MEMORY_FAILURE;
-    }
-    DECLARE_ZERO_INIT_ARRAY(char, flagPad, DEVICE_STATISTIC_FLAGS_LEN + 1);
-    safe_memset(flagPad, DEVICE_STATISTIC_FLAGS_LEN + 1, ' ', DEVICE_STATISTIC_FLAGS_LEN);
-    printf("===Device Statistics===\n");
-    printf("\t* = condition monitored with threshold (DSN Feature)\n");
-    printf("\t! = monitored condition met\n");
-    printf("\t- = supports notification (DSN Feature)\n");
-    printf("\t^ = supports reinitialization/reset\n");
-    printf("%s%-60s %-16s %-16s\n", flagPad, "Statistic Name:", "Threshold:", "Value:");
-    if (deviceStats->sataStatistics.generalStatisticsSupported)
-    {
-        printf("\n---General Statistics---\n");
-        print_Count_Statistic(deviceStats->sataStatistics.lifetimePoweronResets, "LifeTime Power-On Resets", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.powerOnHours, "Power-On Hours", "hours");
-        print_Count_Statistic(deviceStats->sataStatistics.logicalSectorsWritten, "Logical Sectors Written", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfWriteCommands, "Number Of Write Commands", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.logicalSectorsRead, "Logical Sectors Read", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfReadCommands, "Number Of Read Commands", M_NULLPTR);
-        print_Date_And_Time_Timestamp_Statistic(deviceStats->sataStatistics.dateAndTimeTimestamp,
-                                                "Date And Time Timestamp");
-        print_Count_Statistic(deviceStats->sataStatistics.pendingErrorCount, "Pending Error Count", M_NULLPTR);
-        print_Workload_Utilization_Statistic(deviceStats->sataStatistics.workloadUtilization, "Workload Utilization");
-        print_Utilization_Usage_Rate_Statistic(deviceStats->sataStatistics.utilizationUsageRate,
-                                               "Utilization Usage Rate");
-        print_Resource_Availability_Statistic(deviceStats->sataStatistics.resourceAvailability,
-                                              "Resource Availability");
-        print_Random_Write_Resources_Used_Statistic(deviceStats->sataStatistics.randomWriteResourcesUsed,
-                                                    "Random Write Resources Used");
-    }
-    if (deviceStats->sataStatistics.freeFallStatisticsSupported)
-    {
-        printf("\n---Free Fall Statistics---\n");
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfFreeFallEventsDetected,
-                              "Number Of Free-Fall Events Detected", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.overlimitShockEvents, "Overlimit Shock Events", M_NULLPTR);
-    }
-    if (deviceStats->sataStatistics.rotatingMediaStatisticsSupported)
-    {
-        printf("\n---Rotating Media Statistics---\n");
-        print_Count_Statistic(deviceStats->sataStatistics.spindleMotorPoweronHours, "Spindle Motor Power-On Hours",
-                              "hours");
-        print_Count_Statistic(deviceStats->sataStatistics.headFlyingHours, "Head Flying Hours", "hours");
-        print_Count_Statistic(deviceStats->sataStatistics.headLoadEvents, "Head Load Events", M_NULLPTR);
-        print_Count_Statistic(
-            deviceStats->sataStatistics.numberOfReallocatedLogicalSectors, "Number Of Reallocated Logical Sectors",
-            deviceStats->sataStatistics.numberOfReallocatedLogicalSectors.isNormalized ? "%" : M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.readRecoveryAttempts, "Read Recovery Attempts", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfMechanicalStartFailures,
-                              "Number Of Mechanical Start Failures", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfReallocationCandidateLogicalSectors,
-                              "Number Of Reallocation Candidate Logical Sectors", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfHighPriorityUnloadEvents,
-                              "Number Of High Priority Unload Events", M_NULLPTR);
-    }
-    if (deviceStats->sataStatistics.generalErrorsStatisticsSupported)
-    {
-        printf("\n---General Errors Statistics---\n");
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfReportedUncorrectableErrors,
-                              "Number Of Reported Uncorrectable Errors", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfResetsBetweenCommandAcceptanceAndCommandCompletion,
-                              "Number Of Resets Between Command Acceptance and Completion", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.physicalElementStatusChanged,
-                              "Physical Element Status Changed", M_NULLPTR);
-    }
-    if (deviceStats->sataStatistics.temperatureStatisticsSupported)
-    {
-        printf("\n---Temperature Statistics---\n");
-        print_Temperature_Statistic(deviceStats->sataStatistics.currentTemperature, "Current Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.averageShortTermTemperature,
-                                    "Average Short Term Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.averageLongTermTemperature,
-                                    "Average Long Term Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.highestTemperature, "Highest Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.lowestTemperature, "Lowest Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.highestAverageShortTermTemperature,
-                                    "Highest Average Short Term Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.lowestAverageShortTermTemperature,
-                                    "Lowest Average Short Term Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.highestAverageLongTermTemperature,
-                                    "Highest Average Long Term Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.lowestAverageLongTermTemperature,
-                                    "Lowest Average Long Term Temperature");
-        print_Time_Minutes_Statistic(deviceStats->sataStatistics.timeInOverTemperature, "Time In Over Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.specifiedMaximumOperatingTemperature,
-                                    "Specified Maximum Operating Temperature");
-        print_Time_Minutes_Statistic(deviceStats->sataStatistics.timeInUnderTemperature, "Time In Under Temperature");
-        print_Temperature_Statistic(deviceStats->sataStatistics.specifiedMinimumOperatingTemperature,
-                                    "Specified Minimum Operating Temperature");
-    }
-    if (deviceStats->sataStatistics.transportStatisticsSupported)
-    {
-        printf("\n---Transport Statistics---\n");
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfHardwareResets, "Number Of Hardware Resets",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfASREvents, "Number Of ASR Events", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.numberOfInterfaceCRCErrors, "Number Of Interface CRC Errors",
-                              M_NULLPTR);
+    case DEV_STAT_DISPLAY_COUNT:
+        print_Count_Statistic(theStatistic, field->name, field->unit);
+        break;
+    case DEV_STAT_DISPLAY_COUNT_PERCENT_IF_NORMALIZED:
+        print_Count_Statistic(theStatistic, field->name, theStatistic.isNormalized ? "%" : M_NULLPTR);
+        break;
+    case DEV_STAT_DISPLAY_DATE_AND_TIME:
+        print_Date_And_Time_Timestamp_Statistic(theStatistic, field->name);
+        break;
+    case DEV_STAT_DISPLAY_WORKLOAD_UTILIZATION:
+        print_Workload_Utilization_Statistic(theStatistic, field->name);
+        break;
+    case DEV_STAT_DISPLAY_UTILIZATION_USAGE_RATE:
+        print_Utilization_Usage_Rate_Statistic(theStatistic, field->name);
+        break;
+    case DEV_STAT_DISPLAY_RESOURCE_AVAILABILITY:
+        print_Resource_Availability_Statistic(theStatistic, field->name);
+        break;
+    case DEV_STAT_DISPLAY_RANDOM_WRITE_RESOURCES_USED:
+        print_Random_Write_Resources_Used_Statistic(theStatistic, field->name);
+        break;
+    case DEV_STAT_DISPLAY_TEMPERATURE:
+        print_Temperature_Statistic(theStatistic, field->name);
+        break;
+    case DEV_STAT_DISPLAY_TIME_MINUTES:
+        print_Time_Minutes_Statistic(theStatistic, field->name);
+        break;
     }
-    if (deviceStats->sataStatistics.ssdStatisticsSupported)
+}
+
+// Prints every page from a table that the device supports. Pages without a title are printed by the caller.
+static void print_Dev_Stat_Pages(void* statistics, const devStatPage* pages, size_t numberOfPages)
+{
+    for (size_t pageIter = SIZE_T_C(0); pageIter < numberOfPages; ++pageIter)
     {
-        printf("\n---Solid State Device Statistics---\n");
-        print_Count_Statistic(deviceStats->sataStatistics.percentageUsedIndicator, "Percent Used Indicator", "%");
+        if (pages[pageIter].title != M_NULLPTR && *dev_Stat_Page_Supported(statistics, &pages[pageIter]))
+        {
+            printf("\n---%s---\n", pages[pageIter].title);
+            for (size_t fieldIter = SIZE_T_C(0); fieldIter < pages[pageIter].numberOfFields; ++fieldIter)
+            {
+                const devStatField* field = &pages[pageIter].fields[fieldIter];
+                print_Dev_Stat_Field(*dev_Stat_Field(statistics, field), field);
+            }
+        }
     }
-    if (deviceStats->sataStatistics.zonedDeviceStatisticsSupported)
-    {
-        printf("\n---Zoned Device Statistics---\n");
-        print_Count_Statistic(deviceStats->sataStatistics.maximumOpenZones, "Maximum Open Zones", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.maximumExplicitlyOpenZones, "Maximum Explicitly Open Zones",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.maximumImplicitlyOpenZones, "Maximum Implicitly Open Zones",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.minimumEmptyZones, "Minumum Empty Zones", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.maximumNonSequentialZones, "Maximum Non-sequential Zones",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.zonesEmptied, "Zones Emptied", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.suboptimalWriteCommands, "Suboptimal Write Commands",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.commandsExceedingOptimalLimit,
-                              "Commands Exceeding Optimal Limit", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.failedExplicitOpens, "Failed Explicit Opens", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.readRuleViolations, "Read Rule Violations", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.writeRuleViolations, "Write Rule Violations", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sataStatistics.maximumImplicitOpenSequentialOrBeforeRequiredZones,
-                              "Max Implicitly Open Sequential or Before Required Zones", M_NULLPTR);
+}
+
+static eReturnValues print_ATA_DeviceStatistics(tDevice* device, ptrDeviceStatistics deviceStats)
+{
+    eReturnValues ret = SUCCESS;
+    if (deviceStats == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
     }
+    DECLARE_ZERO_INIT_ARRAY(char, flagPad, DEVICE_STATISTIC_FLAGS_LEN + 1);
+    safe_memset(flagPad, DEVICE_STATISTIC_FLAGS_LEN + 1, ' ', DEVICE_STATISTIC_FLAGS_LEN);
+    printf("===Device Statistics===\n");
+    printf("\t* = condition monitored with threshold (DSN Feature)\n");
+    printf("\t! = monitored condition met\n");
+    printf("\t- = supports notification (DSN Feature)\n");
+    printf("\t^ = supports reinitialization/reset\n");
+    printf("%s%-60s %-16s %-16s\n", flagPad, "Statistic Name:", "Threshold:", "Value:");
+    print_Dev_Stat_Pages(&deviceStats->sataStatistics, ataDevStatPages, SIZE_OF_STACK_ARRAY(ataDevStatPages));
     if (deviceStats->sataStatistics.cdlStatisticsSupported)
     {
         printf("\n---Command Duration Limit Statistics---\n");
@@ -9562,87 +5947,7 @@ static eReturnValues print_SCSI_DeviceStatistics(M_ATTR_UNUSED tDevice* device,
     printf("\t! = monitored condition met (Requires Threshold to be set and comparison enabled)\n");
     printf("\t- = supports notification (requires log page thresholds to be supported)\n");
     printf(" %-60s %-16s %-16s\n", "Statistic Name:", "Threshold:", "Value:");
-    if (deviceStats->sasStatistics.writeErrorCountersSupported)
-    {
-        printf("\n---Write Error Counters---\n");
-        print_Count_Statistic(deviceStats->sasStatistics.writeErrorsCorrectedWithoutSubstantialDelay,
-                              "Write Errors Corrected Without Substantial Delay", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.writeErrorsCorrectedWithPossibleDelays,
-                              "Write Errors Corrected With Possible Delay", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.writeTotalReWrites, "Write Total Rewrites", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.writeErrorsCorrected, "Write Errors Corrected", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.writeTotalTimeCorrectionAlgorithmProcessed,
-                              "Write Total Times Corrective Algorithm Processed", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.writeTotalBytesProcessed, "Write Total Bytes Processed",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.writeTotalUncorrectedErrors, "Write Total Uncorrected Errors",
-                              M_NULLPTR);
-    }
-    if (deviceStats->sasStatistics.readErrorCountersSupported)
-    {
-        printf("\n---Read Error Counters---\n");
-        print_Count_Statistic(deviceStats->sasStatistics.readErrorsCorrectedWithPossibleDelays,
-                              "Read Errors Corrected With Possible Delay", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readTotalRereads, "Read Total Rereads", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readErrorsCorrected, "Read Errors Corrected", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readTotalTimeCorrectionAlgorithmProcessed,
-                              "Read Total Times Corrective Algorithm Processed", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readTotalBytesProcessed, "Read Total Bytes Processed",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readTotalUncorrectedErrors, "Read Total Uncorrected Errors",
-                              M_NULLPTR);
-    }
-    if (deviceStats->sasStatistics.readReverseErrorCountersSupported)
-    {
-        printf("\n---Read Reverse Error Counters---\n");
-        print_Count_Statistic(deviceStats->sasStatistics.readReverseErrorsCorrectedWithoutSubstantialDelay,
-                              "Read Reverse Errors Corrected Without Substantial Delay", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readReverseErrorsCorrectedWithPossibleDelays,
-                              "Read Reverse Errors Corrected With Possible Delay", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readReverseTotalReReads, "Read Reverse Total Rereads",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readReverseErrorsCorrected, "Read Reverse Errors Corrected",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readReverseTotalTimeCorrectionAlgorithmProcessed,
-                              "Read Reverse Total Times Corrective Algorithm Processed", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readReverseTotalBytesProcessed,
-                              "Read Reverse Total Bytes Processed", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.readReverseTotalUncorrectedErrors,
-                              "Read Reverse Total Uncorrected Errors", M_NULLPTR);
-    }
-    if (deviceStats->sasStatistics.verifyErrorCountersSupported)
-    {
-        printf("\n---Verify Error Counters---\n");
-        print_Count_Statistic(deviceStats->sasStatistics.verifyErrorsCorrectedWithoutSubstantialDelay,
-                              "Verify Errors Corrected Without Substantial Delay", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.verifyErrorsCorrectedWithPossibleDelays,
-                              "Verify Errors Corrected With Possible Delay", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.verifyTotalReVerifies, "Verify Total Rereads", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.verifyErrorsCorrected, "Verify Errors Corrected", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.verifyTotalTimeCorrectionAlgorithmProcessed,
-                              "Verify Total Times Corrective Algorithm Processed", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.verifyTotalBytesProcessed, "Verify Total Bytes Processed",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.verifyTotalUncorrectedErrors,
-                              "Verify Total Uncorrected Errors", M_NULLPTR);
-    }
-    if (deviceStats->sasStatistics.nonMediumErrorSupported)
-    {
-        printf("\n---Non Medium Error---\n");
-        print_Count_Statistic(deviceStats->sasStatistics.nonMediumErrorCount, "Non-Medium Error Count", M_NULLPTR);
-    }
-    if (deviceStats->sasStatistics.formatStatusSupported)
-    {
-        printf("\n---Format Status---\n");
-        print_Count_Statistic(deviceStats->sasStatistics.grownDefectsDuringCertification,
-                              "Grown Defects During Certification", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.totalBlocksReassignedDuringFormat,
-                              "Total Blocks Reassigned During Format", M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.totalNewBlocksReassigned, "Total New Blocks Reassigned",
-                              M_NULLPTR);
-        print_Count_Statistic(deviceStats->sasStatistics.powerOnMinutesSinceFormat,
-                              "Power On Minutes Since Last Format", "minutes");
-    }
+    print_Dev_Stat_Pages(&deviceStats->sasStatistics, scsiDevStatPages, SIZE_OF_STACK_ARRAY(scsiDevStatPages));
     if (deviceStats->sasStatistics.logicalBlockProvisioningSupported)
     {
         printf("\n---Logical Block Provisioning---\n");
@@ -10112,7 +6417,7 @@ eReturnValues ata_Device_Statistics_Reinitialize(tDevice* device, eDeviceStatist
         {
             // Reinitialize all pages
             uint32_t devStatsFullLen = UINT32_C(0);
-            ret = get_ATA_Log_Size(device, ATA_LOG_DEVICE_STATISTICS, &devStatsFullLen, true, false);
+            ret = get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_DEVICE_STATISTICS, &devStatsFullLen, true, false);
             if (SUCCESS == ret)
             {
                 uint8_t* devStats = M_REINTERPRET_CAST(
@@ -10143,3 +6448,551 @@ eReturnValues ata_Device_Statistics_Reinitialize(tDevice* device, eDeviceStatist
     }
     return ret;
 }
+
+#define DEVICE_STATISTICS_SAMPLE_GROWTH (32)
+
+// SCSI pages holding counters the sampler can track. Only the ones the device lists as supported are read.
+static const deviceStatisticsSamplerPage scsiSamplerPages[] = {
+    {LP_WRITE_ERROR_COUNTERS, 0},
+    {LP_READ_ERROR_COUNTERS, 0},
+    {LP_VERIFY_ERROR_COUNTERS, 0},
+    {LP_NON_MEDIUM_ERROR, 0},
+    {LP_FORMAT_STATUS_LOG_PAGE, 0},
+    {LP_LOGICAL_BLOCK_PROVISIONING, 0},
+    {LP_TEMPERATURE, 0},
+    {LP_TEMPERATURE, 1}, // environmental reporting
+    {LP_START_STOP_CYCLE_COUNTER, 0},
+    {LP_START_STOP_CYCLE_COUNTER, 1}, // utilization
+    {LP_SOLID_STATE_MEDIA, 0},
+    {LP_BACKGROUND_SCAN_RESULTS, 1}, // pending defects
+    {LP_NON_VOLITILE_CACHE, 0},
+    {LP_GENERAL_STATISTICS_AND_PERFORMANCE, 0x20}, // cache memory statistics
+    {LP_POWER_CONDITIONS_TRANSITIONS, 0},
+    {LP_ZONED_DEVICE_STATISTICS, 1},
+};
+
+typedef struct s_deviceStatisticsSamplerPass
+{
+    bool            discovering; // adding the supported statistics instead of updating them
+    const uint32_t* ids;
+    uint32_t        numberOfIDs;
+    double          elapsedSeconds;
+    bool            memoryFailure;
+} deviceStatisticsSamplerPass;
+
+// upper 16 bits of a statistic ID, which say which page it came from
+static M_INLINE uint16_t sampler_Page_Key(bool isATA, uint8_t page, uint8_t subpage)
+{
+    return isATA ? M_STATIC_CAST(uint16_t, page) : M_BytesTo2ByteValue(page, subpage);
+}
+
+static bool is_Sampler_Page_Requested(deviceStatisticsSamplerPass* pass, bool isATA, uint8_t page, uint8_t subpage)
+{
+    if (pass->ids == M_NULLPTR || pass->numberOfIDs == UINT32_C(0))
+    {
+        return true;
+    }
+    for (uint32_t idIter = UINT32_C(0); idIter < pass->numberOfIDs; ++idIter)
+    {
+        if (M_STATIC_CAST(uint16_t, pass->ids[idIter] >> 16) == sampler_Page_Key(isATA, page, subpage))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_Sampler_ID_Requested(deviceStatisticsSamplerPass* pass, uint32_t id)
+{
+    if (pass->ids == M_NULLPTR || pass->numberOfIDs == UINT32_C(0))
+    {
+        return true;
+    }
+    for (uint32_t idIter = UINT32_C(0); idIter < pass->numberOfIDs; ++idIter)
+    {
+        if (pass->ids[idIter] == id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void add_Sampler_Page(ptrDeviceStatisticsSampler sampler, uint8_t page, uint8_t subpage)
+{
+    if (sampler->numberOfPages < DEVICE_STATISTICS_SAMPLER_MAX_PAGES)
+    {
+        sampler->pages[sampler->numberOfPages].page    = page;
+        sampler->pages[sampler->numberOfPages].subpage = subpage;
+        ++sampler->numberOfPages;
+    }
+}
+
+static deviceStatisticSample* add_Sampler_Sample(ptrDeviceStatisticsSampler sampler, uint32_t id, bool isCounter)
+{
+    if (sampler->numberOfSamples == sampler->samplesCapacity)
+    {
+        uint32_t newCapacity = sampler->samplesCapacity + DEVICE_STATISTICS_SAMPLE_GROWTH;
+        if (safe_reallocf(M_REINTERPRET_CAST(void**, &sampler->samples),
+                          uint32_to_sizet(newCapacity) * sizeof(deviceStatisticSample)) == M_NULLPTR)
+        {
+            sampler->numberOfSamples = UINT32_C(0);
+            sampler->samplesCapacity = UINT32_C(0);
+            return M_NULLPTR;
+        }
+        sampler->samplesCapacity = newCapacity;
+    }
+    deviceStatisticSample* sample = &sampler->samples[sampler->numberOfSamples];
+    safe_memset(sample, sizeof(deviceStatisticSample), 0, sizeof(deviceStatisticSample));
+    sample->id        = id;
+    sample->isCounter = isCounter;
+    ++sampler->numberOfSamples;
+    return sample;
+}
+
+// Pages return their statistics in the same order every time, so the search starts just past the last match and
+// normally finds the next statistic on the first comparison.
+static deviceStatisticSample* find_Sampler_Sample(ptrDeviceStatisticsSampler sampler, uint32_t id)
+{
+    for (uint32_t count = UINT32_C(0); count < sampler->numberOfSamples; ++count)
+    {
+        uint32_t index = (sampler->searchHint + count) % sampler->numberOfSamples;
+        if (sampler->samples[index].id == id)
+        {
+            sampler->searchHint = index + UINT32_C(1);
+            return &sampler->samples[index];
+        }
+    }
+    return M_NULLPTR;
+}
+
+static void record_Sampler_Statistic(ptrDeviceStatisticsSampler   sampler,
+                                     deviceStatisticsSamplerPass* pass,
+                                     uint32_t                     id,
+                                     bool                         isCounter,
+                                     bool                         valid,
+                                     uint64_t                     value)
+{
+    deviceStatisticSample* sample = M_NULLPTR;
+    if (pass->discovering)
+    {
+        if (pass->memoryFailure || !is_Sampler_ID_Requested(pass, id))
+        {
+            return;
+        }
+        sample = add_Sampler_Sample(sampler, id, isCounter);
+        if (sample == M_NULLPTR)
+        {
+            pass->memoryFailure = true;
+            return;
+        }
+        sample->valid = valid;
+        sample->value = valid ? value : UINT64_C(0);
+        return;
+    }
+    sample = find_Sampler_Sample(sampler, id);
+    if (sample == M_NULLPTR)
+    {
+        return;
+    }
+    sample->delta         = INT64_C(0);
+    sample->ratePerSecond = 0.0;
+    sample->reset         = false;
+    if (!valid)
+    {
+        // keep the last good value to compare against once the device reports a valid one again
+        sample->valid = false;
+        return;
+    }
+    if (sample->valid)
+    {
+        if (!sample->isCounter)
+        {
+            // Signed gauges are stored sign extended, so the wrapped difference is the signed change for both
+            sample->delta = M_STATIC_CAST(int64_t, value - sample->value);
+        }
+        else if (value >= sample->value)
+        {
+            sample->delta = M_STATIC_CAST(int64_t, value - sample->value);
+        }
+        else
+        {
+            sample->reset = true;
+        }
+        if (pass->elapsedSeconds > 0.0)
+        {
+            sample->ratePerSecond = M_STATIC_CAST(double, sample->delta) / pass->elapsedSeconds;
+        }
+    }
+    sample->valid = true;
+    sample->value = value;
+}
+
+// Gauges are statistics that can go down on their own, so a drop is a negative delta rather than a reset.
+static bool is_ATA_Sampler_Counter(uint8_t page, uint16_t offset)
+{
+    switch (page)
+    {
+    case ATA_DEVICE_STATS_LOG_GENERAL:
+        switch (offset)
+        {
+        case ATA_DEV_STAT_GENERAL_DATE_AND_TIME_TIMESTAMP:
+        case ATA_DEV_STAT_GENERAL_PENDING_ERR_CNT:
+        case ATA_DEV_STAT_GENERAL_WORKLOAD_UTIL:
+        case ATA_DEV_STAT_GENERAL_UTIL_USAGE_RATE:
+        case ATA_DEV_STAT_GENERAL_RESOURCE_AVAIL:
+        case ATA_DEV_STAT_GENERAL_RAND_WRITE_RESOURCE_USED:
+            return false;
+        default:
+            return true;
+        }
+    case ATA_DEVICE_STATS_LOG_ROTATING_MEDIA:
+        return offset != ATA_DEV_STAT_ROTATING_NUM_REALLOCATION_CANDIDATE_LBA;
+    case ATA_DEVICE_STATS_LOG_TEMP:
+        return offset == ATA_DEV_STAT_TEMP_TIME_OVER_TEMP || offset == ATA_DEV_STAT_TEMP_TIME_UNDER_TEMP;
+    case ATA_DEVICE_STATS_LOG_ZONED_DEVICE:
+        switch (offset)
+        {
+        case ATA_DEV_STAT_ZONED_MAX_OPEN_ZONES:
+        case ATA_DEV_STAT_ZONED_MAX_EXPLICIT_OPEN_ZONES:
+        case ATA_DEV_STAT_ZONED_MAX_IMPLICIT_OPEN_ZONES:
+        case ATA_DEV_STAT_ZONED_MIN_EMPTY_ZONES:
+        case ATA_DEV_STAT_ZONED_MAX_NON_SEQ_ZONES:
+        case ATA_DEV_STAT_ZONED_MAX_IMPLICIT_OPEN_SEQ_OR_BEF_REQ_ZONES:
+            return false;
+        default:
+            return true;
+        }
+    default:
+        return true;
+    }
+}
+
+static bool is_SCSI_Sampler_Counter(uint8_t page, uint8_t subpage, uint16_t parameterCode)
+{
+    switch (page)
+    {
+    case LP_TEMPERATURE:
+    case LP_LOGICAL_BLOCK_PROVISIONING:
+    case LP_NON_VOLITILE_CACHE:
+        return false;
+    case LP_START_STOP_CYCLE_COUNTER:
+        return subpage != 1; // utilization
+    case LP_BACKGROUND_SCAN_RESULTS:
+        return subpage != 1; // pending defects
+    case LP_ZONED_DEVICE_STATISTICS:
+        // maximum/minimum zone counts. The rest are event counters.
+        return !(parameterCode <= 4 || parameterCode == 0x0B);
+    default:
+        return true;
+    }
+}
+
+static eReturnValues sample_ATA_Statistics_Page(tDevice*                     device,
+                                                ptrDeviceStatisticsSampler   sampler,
+                                                deviceStatisticsSamplerPass* pass,
+                                                uint8_t                      page,
+                                                uint8_t*                     buffer)
+{
+    eReturnValues ret =
+        send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_DEVICE_STATISTICS, page, buffer, ATA_LOG_PAGE_LEN_BYTES, 0);
+    if (ret == SUCCESS)
+    {
+        // byte 2 of the header is the page number
+        if (buffer[2] != page)
+        {
+            return FAILURE;
+        }
+        for (uint16_t offset = UINT16_C(8); offset < ATA_LOG_PAGE_LEN_BYTES; offset += UINT16_C(8))
+        {
+            uint64_t qword = M_BytesTo8ByteValue(buffer[offset + 7], buffer[offset + 6], buffer[offset + 5],
+                                                 buffer[offset + 4], buffer[offset + 3], buffer[offset + 2],
+                                                 buffer[offset + 1], buffer[offset]);
+            if (qword & ATA_DEV_STATS_STATISTIC_SUPPORTED_BIT)
+            {
+                bool     isCounter = is_ATA_Sampler_Counter(page, offset);
+                uint64_t value = get_bit_range_uint64(qword, ATA_DEV_STATS_VALUE_MSB, ATA_DEV_STATS_VALUE_LSB);
+                if (page == ATA_DEVICE_STATS_LOG_TEMP && !isCounter)
+                {
+                    // temperatures are signed 8 bit values in bits 7:0
+                    value = M_STATIC_CAST(uint64_t, M_STATIC_CAST(int64_t, M_STATIC_CAST(int8_t, M_Byte0(qword))));
+                }
+                record_Sampler_Statistic(sampler, pass, DEVICE_STATISTIC_ID_ATA(page, offset), isCounter,
+                                         M_ToBool(qword & ATA_DEV_STATS_VALID_VALUE_BIT), value);
+            }
+        }
+    }
+    return ret;
+}
+
+// Parameters are read as big endian integers. ASCII parameters and parameters longer than 8 bytes are skipped.
+static eReturnValues sample_SCSI_Statistics_Page(tDevice*                     device,
+                                                 ptrDeviceStatisticsSampler   sampler,
+                                                 deviceStatisticsSamplerPass* pass,
+                                                 uint8_t                      page,
+                                                 uint8_t                      subpage,
+                                                 uint8_t*                     buffer)
+{
+    eReturnValues ret =
+        scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, page, subpage, 0, buffer, LEGACY_DRIVE_SEC_SIZE);
+    if (ret == SUCCESS)
+    {
+        // A device that does not support the subpage may return the page 0 data or a different page instead
+        bool subpageFormat = M_ToBool(buffer[0] & BIT6);
+        if ((buffer[0] & 0x3F) != page || (subpage != 0 && (!subpageFormat || buffer[1] != subpage)) ||
+            (subpage == 0 && subpageFormat && buffer[1] != 0))
+        {
+            return FAILURE;
+        }
+        uint32_t pageEnd = M_Min(C_CAST(uint32_t, M_BytesTo2ByteValue(buffer[2], buffer[3])) + LOG_PAGE_HEADER_LENGTH,
+                                 LEGACY_DRIVE_SEC_SIZE);
+        uint8_t  parameterLength = UINT8_C(0);
+        for (uint32_t offset = LOG_PAGE_HEADER_LENGTH; offset + UINT32_C(4) <= pageEnd;
+             offset += UINT32_C(4) + parameterLength)
+        {
+            uint16_t parameterCode = M_BytesTo2ByteValue(buffer[offset], buffer[offset + 1]);
+            uint8_t  formatAndLink = buffer[offset + 2] & 0x03;
+            parameterLength        = buffer[offset + 3];
+            if (parameterLength > 0 && parameterLength <= 8 && formatAndLink != 0x01 &&
+                offset + UINT32_C(4) + parameterLength <= pageEnd)
+            {
+                uint64_t value = UINT64_C(0);
+                for (uint8_t byteIter = UINT8_C(0); byteIter < parameterLength; ++byteIter)
+                {
+                    value = (value << 8) | buffer[offset + 4 + byteIter];
+                }
+                record_Sampler_Statistic(sampler, pass, DEVICE_STATISTIC_ID_SCSI(page, subpage, parameterCode),
+                                         is_SCSI_Sampler_Counter(page, subpage, parameterCode), true, value);
+            }
+        }
+    }
+    return ret;
+}
+
+static void invalidate_Sampler_Page(ptrDeviceStatisticsSampler sampler, uint16_t pageKey)
+{
+    for (uint32_t sampleIter = UINT32_C(0); sampleIter < sampler->numberOfSamples; ++sampleIter)
+    {
+        if (M_STATIC_CAST(uint16_t, sampler->samples[sampleIter].id >> 16) == pageKey)
+        {
+            sampler->samples[sampleIter].valid         = false;
+            sampler->samples[sampleIter].delta         = INT64_C(0);
+            sampler->samples[sampleIter].ratePerSecond = 0.0;
+            sampler->samples[sampleIter].reset         = false;
+        }
+    }
+}
+
+static eReturnValues read_Sampler_Pages(tDevice*                     device,
+                                        ptrDeviceStatisticsSampler   sampler,
+                                        deviceStatisticsSamplerPass* pass,
+                                        uint8_t*                     buffer)
+{
+    eReturnValues ret            = SUCCESS;
+    sampler->pagesReadLastSample = UINT32_C(0);
+    for (uint8_t pageIter = UINT8_C(0); pageIter < sampler->numberOfPages; ++pageIter)
+    {
+        uint8_t       page       = sampler->pages[pageIter].page;
+        uint8_t       subpage    = sampler->pages[pageIter].subpage;
+        eReturnValues pageResult = SUCCESS;
+        safe_memset(buffer, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
+        if (sampler->isATA)
+        {
+            pageResult = sample_ATA_Statistics_Page(device, sampler, pass, page, buffer);
+        }
+        else
+        {
+            pageResult = sample_SCSI_Statistics_Page(device, sampler, pass, page, subpage, buffer);
+        }
+        ++sampler->pagesReadLastSample;
+        if (pageResult != SUCCESS)
+        {
+            invalidate_Sampler_Page(sampler, sampler_Page_Key(sampler->isATA, page, subpage));
+            if (ret == SUCCESS)
+            {
+                ret = pageResult;
+            }
+        }
+    }
+    return ret;
+}
+
+static void find_ATA_Sampler_Pages(tDevice*                     device,
+                                   ptrDeviceStatisticsSampler   sampler,
+                                   deviceStatisticsSamplerPass* pass,
+                                   uint8_t*                     buffer)
+{
+    if (device->drive_info.ata_Options.generalPurposeLoggingSupported &&
+        SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_LIST, buffer,
+                                             ATA_LOG_PAGE_LEN_BYTES, 0))
+    {
+        sampler->isATA = true;
+        for (uint16_t pageIter = UINT16_C(0); pageIter < buffer[ATA_DEV_STATS_SUP_PG_LIST_LEN_OFFSET] &&
+                                              ATA_DEV_STATS_SUP_PG_LIST_OFFSET + pageIter < ATA_LOG_PAGE_LEN_BYTES;
+             ++pageIter)
+        {
+            uint8_t page = buffer[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + pageIter];
+            if (page != ATA_DEVICE_STATS_LOG_LIST && is_Sampler_Page_Requested(pass, true, page, 0))
+            {
+                add_Sampler_Page(sampler, page, 0);
+            }
+        }
+    }
+}
+
+static void find_SCSI_Sampler_Pages(tDevice*                     device,
+                                    ptrDeviceStatisticsSampler   sampler,
+                                    deviceStatisticsSamplerPass* pass,
+                                    uint8_t*                     buffer)
+{
+    bool subpagesSupported = true;
+    if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF,
+                                      0, buffer, LEGACY_DRIVE_SEC_SIZE))
+    {
+        safe_memset(buffer, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
+        if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0, 0, buffer,
+                                          LEGACY_DRIVE_SEC_SIZE))
+        {
+            return;
+        }
+        subpagesSupported = false;
+    }
+    uint32_t listEnd = M_Min(C_CAST(uint32_t, M_BytesTo2ByteValue(buffer[2], buffer[3])) + LOG_PAGE_HEADER_LENGTH,
+                             LEGACY_DRIVE_SEC_SIZE);
+    uint32_t increment = subpagesSupported ? UINT32_C(2) : UINT32_C(1);
+    for (uint32_t listIter = LOG_PAGE_HEADER_LENGTH; listIter + increment <= listEnd; listIter += increment)
+    {
+        uint8_t page    = buffer[listIter] & 0x3F;
+        uint8_t subpage = subpagesSupported ? buffer[listIter + 1] : UINT8_C(0);
+        for (size_t knownIter = SIZE_T_C(0); knownIter < SIZE_OF_STACK_ARRAY(scsiSamplerPages); ++knownIter)
+        {
+            if (scsiSamplerPages[knownIter].page == page && scsiSamplerPages[knownIter].subpage == subpage &&
+                is_Sampler_Page_Requested(pass, false, page, subpage))
+            {
+                add_Sampler_Page(sampler, page, subpage);
+                break;
+            }
+        }
+    }
+}
+
+// Drops pages that did not return any tracked statistic so later samples do not read them
+static void remove_Unused_Sampler_Pages(ptrDeviceStatisticsSampler sampler)
+{
+    uint8_t usedPages = UINT8_C(0);
+    for (uint8_t pageIter = UINT8_C(0); pageIter < sampler->numberOfPages; ++pageIter)
+    {
+        uint16_t pageKey =
+            sampler_Page_Key(sampler->isATA, sampler->pages[pageIter].page, sampler->pages[pageIter].subpage);
+        for (uint32_t sampleIter = UINT32_C(0); sampleIter < sampler->numberOfSamples; ++sampleIter)
+        {
+            if (M_STATIC_CAST(uint16_t, sampler->samples[sampleIter].id >> 16) == pageKey)
+            {
+                sampler->pages[usedPages] = sampler->pages[pageIter];
+                ++usedPages;
+                break;
+            }
+        }
+    }
+    sampler->numberOfPages = usedPages;
+}
+
+eReturnValues init_Device_Statistics_Sampler(tDevice*                   device,
+                                             ptrDeviceStatisticsSampler sampler,
+                                             const uint32_t*            ids,
+                                             uint32_t                   numberOfIDs)
+{
+    eReturnValues ret = NOT_SUPPORTED;
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || sampler == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(sampler, sizeof(deviceStatisticsSampler), 0, sizeof(deviceStatisticsSampler));
+    uint8_t* buffer = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (buffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    deviceStatisticsSamplerPass pass;
+    safe_memset(&pass, sizeof(deviceStatisticsSamplerPass), 0, sizeof(deviceStatisticsSamplerPass));
+    pass.discovering = true;
+    pass.ids         = ids;
+    pass.numberOfIDs = numberOfIDs;
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        find_ATA_Sampler_Pages(device, sampler, &pass, buffer);
+    }
+    else if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        find_SCSI_Sampler_Pages(device, sampler, &pass, buffer);
+    }
+    if (sampler->numberOfPages > 0)
+    {
+        // pages that fail to read here are treated as not supported
+        read_Sampler_Pages(device, sampler, &pass, buffer);
+        if (pass.memoryFailure)
+        {
+            ret = MEMORY_FAILURE;
+        }
+        else if (sampler->numberOfSamples > UINT32_C(0))
+        {
+            remove_Unused_Sampler_Pages(sampler);
+            sampler->lastSampleMilliseconds = get_Milliseconds_Since_Unix_Epoch();
+            sampler->sampleCount            = UINT32_C(1);
+            ret                             = SUCCESS;
+        }
+    }
+    safe_free_aligned(&buffer);
+    if (ret != SUCCESS)
+    {
+        free_Device_Statistics_Sampler(sampler);
+    }
+    return ret;
+}
+
+eReturnValues sample_Device_Statistics(tDevice* device, ptrDeviceStatisticsSampler sampler)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || sampler == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (sampler->samples == M_NULLPTR || sampler->numberOfPages == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    uint8_t* buffer = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (buffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    uint64_t                    now = get_Milliseconds_Since_Unix_Epoch();
+    deviceStatisticsSamplerPass pass;
+    safe_memset(&pass, sizeof(deviceStatisticsSamplerPass), 0, sizeof(deviceStatisticsSamplerPass));
+    if (now > sampler->lastSampleMilliseconds)
+    {
+        pass.elapsedSeconds = M_STATIC_CAST(double, now - sampler->lastSampleMilliseconds) / 1000.0;
+    }
+    ret                             = read_Sampler_Pages(device, sampler, &pass, buffer);
+    sampler->lastSampleMilliseconds = now;
+    ++sampler->sampleCount;
+    safe_free_aligned(&buffer);
+    return ret;
+}
+
+void free_Device_Statistics_Sampler(ptrDeviceStatisticsSampler sampler)
+{
+    DISABLE_NONNULL_COMPARE
+    if (sampler != M_NULLPTR)
+    {
+        safe_free_core(M_REINTERPRET_CAST(void**, &sampler->samples));
+        safe_memset(sampler, sizeof(deviceStatisticsSampler), 0, sizeof(deviceStatisticsSampler));
+    }
+    RESTORE_NONNULL_COMPARE
+}
@@ -39,34 +39,246 @@
 #include "vendor/seagate/seagate_scsi_types.h"
 #include <ctype.h>
 
-static bool add_Feature_To_Supported_List(char        featuresSupported[MAX_FEATURES][MAX_FEATURE_LENGTH],
-                                          uint8_t*    numberOfFeaturesSupported,
-                                          const char* featureString)
+static const char* const driveFeatureNames[DRIVE_FEATURE_COUNT] = {
+    [DRIVE_FEATURE_READ_WRITE_MULTIPLE]                    = "Read/Write Multiple",
+    [DRIVE_FEATURE_DOUBLEWORD_IO]                          = "Doubleword I/O",
+    [DRIVE_FEATURE_SANITIZE]                               = "Sanitize",
+    [DRIVE_FEATURE_ALL_WRITE_CACHE_NON_VOLATILE]           = "All Write Cache Non-Volatile",
+    [DRIVE_FEATURE_SATA_NCQ_PRIORITY]                      = "SATA NCQ Priority",
+    [DRIVE_FEATURE_SATA_NCQ]                               = "SATA NCQ",
+    [DRIVE_FEATURE_SATA_OUT_OF_BAND_MANAGEMENT]            = "SATA Out Of Band Management",
+    [DRIVE_FEATURE_SATA_NCQ_STREAMING]                     = "SATA NCQ Streaming",
+    [DRIVE_FEATURE_SATA_POWER_DISABLE]                     = "SATA Power Disable",
+    [DRIVE_FEATURE_SATA_REBUILD_ASSIST]                    = "SATA Rebuild Assist",
+    [DRIVE_FEATURE_SATA_HYBRID_INFORMATION]                = "SATA Hybrid Information",
+    [DRIVE_FEATURE_SATA_DEVICE_SLEEP]                      = "SATA Device Sleep",
+    [DRIVE_FEATURE_SATA_NCQ_AUTOSENSE]                     = "SATA NCQ Autosense",
+    [DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION]    = "SATA Software Settings Preservation",
+    [DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL]          = "SATA Hardware Feature Control",
+    [DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY]            = "SATA In-Order Data Delivery",
+    [DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT] = "SATA Device Initiated Power Management",
+    [DRIVE_FEATURE_HPA]                                    = "HPA",
+    [DRIVE_FEATURE_PACKET]                                 = "Packet",
+    [DRIVE_FEATURE_POWER_MANAGEMENT]                       = "Power Management",
+    [DRIVE_FEATURE_SECURITY]                               = "Security",
+    [DRIVE_FEATURE_SMART]                                  = "SMART",
+    [DRIVE_FEATURE_DCO]                                    = "DCO",
+    [DRIVE_FEATURE_48BIT_ADDRESS]                          = "48bit Address",
+    [DRIVE_FEATURE_AAM]                                    = "AAM",
+    [DRIVE_FEATURE_SET_MAX_SECURITY_EXTENSION]             = "Set Max Security Extension",
+    [DRIVE_FEATURE_PUIS]                                   = "PUIS",
+    [DRIVE_FEATURE_REMOVABLE_MEDIA_STATUS_NOTIFICATION]    = "Removable Media Status Notification",
+    [DRIVE_FEATURE_APM]                                    = "APM",
+    [DRIVE_FEATURE_CFA]                                    = "CFA",
+    [DRIVE_FEATURE_TCQ]                                    = "TCQ",
+    [DRIVE_FEATURE_GPL]                                    = "GPL",
+    [DRIVE_FEATURE_STREAMING]                              = "Streaming",
+    [DRIVE_FEATURE_MEDIA_CARD_PASS_THROUGH]                = "Media Card Pass-through",
+    [DRIVE_FEATURE_SMART_SELF_TEST]                        = "SMART Self-Test",
+    [DRIVE_FEATURE_SMART_ERROR_LOGGING]                    = "SMART Error Logging",
+    [DRIVE_FEATURE_DSN]                                    = "DSN",
+    [DRIVE_FEATURE_AMAC]                                   = "AMAC",
+    [DRIVE_FEATURE_EPC]                                    = "EPC",
+    [DRIVE_FEATURE_SENSE_DATA_REPORTING]                   = "Sense Data Reporting",
+    [DRIVE_FEATURE_FREE_FALL_CONTROL]                      = "Free-fall Control",
+    [DRIVE_FEATURE_WRITE_READ_VERIFY]                      = "Write-Read-Verify",
+    [DRIVE_FEATURE_TRIM]                                   = "TRIM",
+    [DRIVE_FEATURE_SCT_READ_WRITE_LONG]                    = "SCT Read/Write Long",
+    [DRIVE_FEATURE_SCT_WRITE_SAME]                         = "SCT Write Same",
+    [DRIVE_FEATURE_SCT_ERROR_RECOVERY_CONTROL]             = "SCT Error Recovery Control",
+    [DRIVE_FEATURE_SCT_FEATURE_CONTROL]                    = "SCT Feature Control",
+    [DRIVE_FEATURE_SCT_DATA_TABLES]                        = "SCT Data Tables",
+    [DRIVE_FEATURE_NV_CACHE]                               = "NV Cache",
+    [DRIVE_FEATURE_NV_CACHE_POWER_MODE]                    = "NV Cache Power Mode",
+    [DRIVE_FEATURE_MUTATE]                                 = "Mutate",
+    [DRIVE_FEATURE_ADVANCED_BACKGROUND_OPERATIONS]         = "Advanced Background Operations",
+    [DRIVE_FEATURE_SET_SECTOR_CONFIGURATION]               = "Set Sector Configuration",
+    [DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION_RESTORE]   = "Storage Element Depopulation + Restore",
+    [DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION]           = "Storage Element Depopulation",
+    [DRIVE_FEATURE_DEVICE_LIFE_CONTROL]                    = "Device Life Control",
+    [DRIVE_FEATURE_COMMAND_DURATION_LIMITS]                = "Command Duration Limits",
+    [DRIVE_FEATURE_REMOVE_ELEMENT_AND_MODIFY_ZONES]        = "Remove Element and Modify Zones",
+    [DRIVE_FEATURE_ZONE_DOMAINS]                           = "Zone Domains",
+    [DRIVE_FEATURE_ZONE_REALMS]                            = "Zone Realms",
+    [DRIVE_FEATURE_SEAGATE_IDD]                            = "Seagate In Drive Diagnostics (IDD)",
+    [DRIVE_FEATURE_SEAGATE_REMANUFACTURE]                  = "Seagate Remanufacture",
+    [DRIVE_FEATURE_HOST_LOGGING]                           = "Host Logging",
+    [DRIVE_FEATURE_FARM]                                   = "Field Accessible Reliability Metrics (FARM)",
+    [DRIVE_FEATURE_TCG]                                    = "TCG",
+    [DRIVE_FEATURE_IEEE_1667]                              = "IEEE 1667",
+    [DRIVE_FEATURE_SCSA]                                   = "SCSA",
+    [DRIVE_FEATURE_POWER_CONSUMPTION]                      = "Power Consumption",
+    [DRIVE_FEATURE_UNMAP]                                  = "UNMAP",
+    [DRIVE_FEATURE_WRITE_SAME]                             = "Write Same",
+    [DRIVE_FEATURE_ATOMIC_WRITES]                          = "Atomic Writes",
+    [DRIVE_FEATURE_SAT]                                    = "SAT",
+    [DRIVE_FEATURE_APPLICATION_CLIENT_LOGGING]             = "Application Client Logging",
+    [DRIVE_FEATURE_SELF_TEST]                              = "Self Test",
+    [DRIVE_FEATURE_FORMAT_CORRUPT]                         = "Format Corrupt - not all features identifiable.",
+    [DRIVE_FEATURE_PROTECTION_TYPE_1]                      = "Protection Type 1",
+    [DRIVE_FEATURE_PROTECTION_TYPE_2]                      = "Protection Type 2",
+    [DRIVE_FEATURE_PROTECTION_TYPE_3]                      = "Protection Type 3",
+    [DRIVE_FEATURE_AUTOMATIC_WRITE_REASSIGNMENT]           = "Automatic Write Reassignment",
+    [DRIVE_FEATURE_AUTOMATIC_READ_REASSIGNMENT]            = "Automatic Read Reassignment",
+    [DRIVE_FEATURE_IO_ADVICE_HINTS]                        = "IO Advice Hints",
+    [DRIVE_FEATURE_COMMAND_DURATION_LIMITS_T2]             = "Command Duration Limits T2",
+    [DRIVE_FEATURE_PATA_CONTROL]                           = "PATA Control",
+    [DRIVE_FEATURE_SATA_COMMAND_DURATION_LIMIT]            = "SATA Command Duration Limit",
+    [DRIVE_FEATURE_POWER_CONDITIONS]                       = "Power Conditions",
+    [DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS]               = "Informational Exceptions",
+    [DRIVE_FEATURE_BACKGROUND_MEDIA_SCAN]                  = "Background Media Scan",
+    [DRIVE_FEATURE_BACKGROUND_PRE_SCAN]                    = "Background Pre-Scan",
+    [DRIVE_FEATURE_TRANSLATE_ADDRESS]                      = "Translate Address",
+    [DRIVE_FEATURE_REBUILD_ASSIST]                         = "Rebuild Assist",
+    [DRIVE_FEATURE_FORMAT_UNIT]                            = "Format Unit",
+    [DRIVE_FEATURE_FAST_FORMAT]                            = "Fast Format",
+    [DRIVE_FEATURE_FORMAT_WITH_PRESET]                     = "Format With Preset",
+    [DRIVE_FEATURE_ATA_PASS_THROUGH_12]                    = "ATA Pass-Through 12",
+    [DRIVE_FEATURE_ATA_PASS_THROUGH_16]                    = "ATA Pass-Through 16",
+    [DRIVE_FEATURE_ATA_PASS_THROUGH_32]                    = "ATA Pass-Through 32",
+    [DRIVE_FEATURE_CBCS]                                   = "CbCS",
+    [DRIVE_FEATURE_TAPE_ENCRYPTION]                        = "Tape Encryption",
+    [DRIVE_FEATURE_DATA_ENCRYPTION_CONFIGURATION]          = "Data Encryption Configuration",
+    [DRIVE_FEATURE_SA_CREATION_CAPABILITIES]               = "SA Creation Capabilities",
+    [DRIVE_FEATURE_IKE_V2_SCSI]                            = "IKE V2 SCSI",
+    [DRIVE_FEATURE_SD_ASSOCIATION]                         = "SD Association",
+    [DRIVE_FEATURE_DMTF_SECURITY]                          = "DMTF Security",
+    [DRIVE_FEATURE_NVME_RESERVED]                          = "NVMe Reserved",
+    [DRIVE_FEATURE_NVME_RPMB]                              = "NVMe RPMB",
+    [DRIVE_FEATURE_JEDEC_UFS]                              = "JEDEC UFS",
+    [DRIVE_FEATURE_SD_TRUSTED_FLASH]                       = "SD Trusted Flash",
+    [DRIVE_FEATURE_ATA_SECURITY]                           = "ATA Security",
+    [DRIVE_FEATURE_PERSISTENT_RESERVATIONS]                = "Persistent Reservations",
+    [DRIVE_FEATURE_FORMAT_NVM]                             = "Format NVM",
+    [DRIVE_FEATURE_FIRMWARE_UPDATE]                        = "Firmware Update",
+    [DRIVE_FEATURE_NAMESPACE_MANAGEMENT]                   = "Namespace Management",
+    [DRIVE_FEATURE_DEVICE_SELF_TEST]                       = "Device Self Test",
+    [DRIVE_FEATURE_VIRTUALIZATION_MANAGEMENT]              = "Virtualization Management",
+    [DRIVE_FEATURE_DOORBELL_BUFFER_CONFIG]                 = "Doorbell Buffer Config",
+    [DRIVE_FEATURE_WRITE_UNCORRECTABLE]                    = "Write Uncorrectable",
+    [DRIVE_FEATURE_DATASET_MANAGEMENT]                     = "Dataset Management",
+    [DRIVE_FEATURE_WRITE_ZEROS]                            = "Write Zeros",
+    [DRIVE_FEATURE_NAMESPACE_SHARING]                      = "Namespace Sharing",
+};
+
+const char* get_Drive_Feature_Name(eDriveFeature feature)
 {
-    bool success = true;
-    if (featuresSupported && numberOfFeaturesSupported && featureString)
+    const char* name = "";
+    if (feature >= 0 && feature < DRIVE_FEATURE_COUNT && driveFeatureNames[feature] != M_NULLPTR)
     {
-        if ((*numberOfFeaturesSupported) < MAX_FEATURES)
-        {
-            snprintf_err_handle(featuresSupported[*numberOfFeaturesSupported], MAX_FEATURE_LENGTH, "%s", featureString);
-            (*numberOfFeaturesSupported) += 1;
-        }
-        else
+        name = driveFeatureNames[feature];
+    }
+    return name;
+}
+
+uint16_t get_Drive_Feature_Count(const driveFeatureSet* features)
+{
+    uint16_t count = UINT16_C(0);
+    DISABLE_NONNULL_COMPARE
+    if (features != M_NULLPTR)
+    {
+        for (uint16_t featureIter = UINT16_C(0); featureIter < DRIVE_FEATURE_COUNT; ++featureIter)
         {
-            success = false;
-#if defined(_DEBUG)
-            printf("Out of room in feature list!\n");
-#endif //_DEBUG
+            if (is_Drive_Feature_Supported(features, C_CAST(eDriveFeature, featureIter)))
+            {
+                ++count;
+            }
         }
     }
-    else
+    RESTORE_NONNULL_COMPARE
+    return count;
+}
+
+static M_INLINE void add_Feature_To_Supported_List(driveFeatureSet* features, eDriveFeature feature, bool enabled)
+{
+    features->supported[feature / 64] |= UINT64_C(1) << (feature % 64);
+    if (enabled)
     {
-        success = false;
-#if defined(_DEBUG)
-        printf("Out of room in feature list!\n");
-#endif //_DEBUG
+        features->enabled[feature / 64] |= UINT64_C(1) << (feature % 64);
+    }
+}
+
+static M_INLINE void add_Features_From_Set(driveFeatureSet* features, const driveFeatureSet* source)
+{
+    for (uint8_t wordIter = UINT8_C(0); wordIter < DRIVE_FEATURE_SET_WORDS; ++wordIter)
+    {
+        features->supported[wordIter] |= source->supported[wordIter];
+        features->enabled[wordIter] |= source->enabled[wordIter];
+    }
+}
+
+// prints each supported feature on its own line with its details and if it is enabled.
+// details are only available for SAS/SATA drive information and may be M_NULLPTR
+static void print_Drive_Features(const driveFeatureSet* features, const driveFeatureDetails* details)
+{
+    for (uint16_t featureIter = UINT16_C(0); featureIter < DRIVE_FEATURE_COUNT; ++featureIter)
+    {
+        eDriveFeature feature = C_CAST(eDriveFeature, featureIter);
+        if (!is_Drive_Feature_Supported(features, feature))
+        {
+            continue;
+        }
+        DECLARE_ZERO_INIT_ARRAY(char, featureDetails, 48);
+        if (details != M_NULLPTR)
+        {
+            switch (feature)
+            {
+            case DRIVE_FEATURE_SATA_NCQ:
+                snprintf_err_handle(featureDetails, 48, "QD=%" PRIu8, details->ncqQueueDepth);
+                break;
+            case DRIVE_FEATURE_TCQ:
+                snprintf_err_handle(featureDetails, 48, "QD=%" PRIu8, details->tcqQueueDepth);
+                break;
+            case DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS:
+                snprintf_err_handle(featureDetails, 48, "Mode %" PRIu8, details->informationalExceptionsMode);
+                break;
+            case DRIVE_FEATURE_TRIM:
+            case DRIVE_FEATURE_UNMAP:
+            {
+                const char* unmappedData = M_NULLPTR;
+                switch (details->unmappedData)
+                {
+                case UNMAPPED_DATA_ZEROES:
+                    unmappedData = "Zeroes";
+                    break;
+                case UNMAPPED_DATA_VENDOR_PATTERN:
+                    unmappedData = "Vendor Pattern";
+                    break;
+                case UNMAPPED_DATA_PROVISIONING_PATTERN:
+                    unmappedData = "Provisioning Pattern";
+                    break;
+                case UNMAPPED_DATA_NOT_REPORTED:
+                    break;
+                }
+                if (details->deterministicUnmap && unmappedData != M_NULLPTR)
+                {
+                    snprintf_err_handle(featureDetails, 48, "Deterministic, %s", unmappedData);
+                }
+                else if (details->deterministicUnmap)
+                {
+                    snprintf_err_handle(featureDetails, 48, "Deterministic");
+                }
+                else if (unmappedData != M_NULLPTR)
+                {
+                    snprintf_err_handle(featureDetails, 48, "%s", unmappedData);
+                }
+            }
+            break;
+            default:
+                break;
+            }
+        }
+        printf("\t\t%s", get_Drive_Feature_Name(feature));
+        if (safe_strlen(featureDetails) > 0)
+        {
+            printf(" [%s]", featureDetails);
+        }
+        if (is_Drive_Feature_Enabled(features, feature))
+        {
+            printf(" [Enabled]");
+        }
+        printf("\n");
     }
-    return success;
 }
 
 static bool add_Specification_To_Supported_List(char        specificationsSupported[MAX_SPECS][MAX_SPEC_LENGTH],
@@ -210,8 +422,7 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
 
     if (is_ATA_Identify_Word_Valid(le16_to_host(wordPtr[47])) && M_Byte0(le16_to_host(wordPtr[47])) > 0)
     {
-        add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                      "Read/Write Multiple");
+        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_READ_WRITE_MULTIPLE, false);
     }
 
     if (is_ATA_Identify_Word_Valid_With_Bits_14_And_15(le16_to_host(wordPtr[48])))
@@ -228,8 +439,7 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         //       version checks. Most likely this was only used by one vendor
         if (le16_to_host(wordPtr[48]) == 0x0001)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "Doubleword I/O");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DOUBLEWORD_IO, false);
         }
     }
 
@@ -384,8 +594,7 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
     {
         if (le16_to_host(wordPtr[59]) & BIT12)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "Sanitize");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SANITIZE, false);
         }
     }
 
@@ -725,8 +934,7 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
             }
             if (le16_to_host(wordPtr[69]) & BIT2)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "All Write Cache Non-Volatile");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ALL_WRITE_CACHE_NON_VOLATILE, false);
             }
             // zoned capabilities (ACS4)
             driveInfo->zonedDevice = C_CAST(uint8_t, le16_to_host(wordPtr[69]) & (BIT0 | BIT1));
@@ -751,15 +959,12 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         driveInfo->interfaceSpeedInfo.serialSpeed.activePortNumber = 0;
         if (le16_to_host(wordPtr[77]) & BIT12)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "SATA NCQ Priority");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_NCQ_PRIORITY, false);
         }
         if (le16_to_host(wordPtr[76]) & BIT8)
         {
-            DECLARE_ZERO_INIT_ARRAY(char, ncqFeatureString, MAX_FEATURE_LENGTH);
-            snprintf_err_handle(ncqFeatureString, MAX_FEATURE_LENGTH, "SATA NCQ [QD=%" PRIu8 "]", queueDepth);
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          ncqFeatureString);
+            driveInfo->featureDetails.ncqQueueDepth = queueDepth;
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_NCQ, false);
         }
         // Word 76 holds bits for supporteed signalling speeds (SATA)
         if (le16_to_host(wordPtr[76]) & BIT3)
@@ -784,13 +989,11 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
     {
         if (le16_to_host(wordPtr[77]) & BIT9)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "SATA Out Of Band Management");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_OUT_OF_BAND_MANAGEMENT, false);
         }
         if (le16_to_host(wordPtr[77]) & BIT4)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "SATA NCQ Streaming");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_NCQ_STREAMING, false);
         }
         // Word 77 has a coded value for the negotiated speed.
         switch (M_Nibble0(le16_to_host(wordPtr[77])) >> 1)
@@ -819,109 +1022,96 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         {
             if (le16_to_host(wordPtr[79]) & BIT10)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Power Disable [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_POWER_DISABLE, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Power Disable");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_POWER_DISABLE, false);
             }
         }
         if (le16_to_host(wordPtr[78]) & BIT11)
         {
             if (le16_to_host(wordPtr[79]) & BIT11)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Rebuild Assist [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_REBUILD_ASSIST, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Rebuild Assist");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_REBUILD_ASSIST, false);
             }
         }
         if (le16_to_host(wordPtr[78]) & BIT9)
         {
             if (le16_to_host(wordPtr[79]) & BIT9)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Hybrid Information [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_HYBRID_INFORMATION, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Hybrid Information");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_HYBRID_INFORMATION, false);
             }
         }
         if (le16_to_host(wordPtr[78]) & BIT8)
         {
             if (le16_to_host(wordPtr[79]) & BIT8)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Device Sleep [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_DEVICE_SLEEP, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Device Sleep");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_DEVICE_SLEEP, false);
             }
         }
         if (le16_to_host(wordPtr[78]) & BIT8)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "SATA NCQ Autosense");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_NCQ_AUTOSENSE, false);
         }
         if (le16_to_host(wordPtr[78]) & BIT6)
         {
             if (le16_to_host(wordPtr[79]) & BIT6)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Software Settings Preservation [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION,
+                                              true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Software Settings Preservation");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION,
+                                              false);
             }
         }
         if (le16_to_host(wordPtr[78]) & BIT5)
         {
             if (le16_to_host(wordPtr[79]) & BIT5)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Hardware Feature Control [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Hardware Feature Control");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL, false);
             }
         }
         if (le16_to_host(wordPtr[78]) & BIT4)
         {
             if (le16_to_host(wordPtr[79]) & BIT4)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA In-Order Data Delivery [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA In-Order Data Delivery");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY, false);
             }
         }
         if (le16_to_host(wordPtr[78]) & BIT3)
         {
             if (le16_to_host(wordPtr[79]) & BIT3)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Device Initiated Power Management [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features,
+                                              DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SATA Device Initiated Power Management");
+                add_Feature_To_Supported_List(&driveInfo->features,
+                                              DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT, false);
             }
         }
     }
@@ -1257,7 +1447,7 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
     {
         if (le16_to_host(wordPtr[82]) & BIT10 || le16_to_host(wordPtr[85]) & BIT10)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported, "HPA");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_HPA, false);
         }
         // read look ahead
         if (le16_to_host(wordPtr[82]) & BIT6)
@@ -1279,38 +1469,32 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         }
         if (le16_to_host(wordPtr[82]) & BIT4 || le16_to_host(wordPtr[85]) & BIT4)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "Packet");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PACKET, false);
         }
         if (le16_to_host(wordPtr[82]) & BIT3)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "Power Management");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_POWER_MANAGEMENT, false);
         }
         if (le16_to_host(wordPtr[82]) & BIT1)
         {
             if (le16_to_host(wordPtr[85]) & BIT1)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Security [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SECURITY, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Security");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SECURITY, false);
             }
         }
         if (le16_to_host(wordPtr[82]) & BIT0)
         {
             if (le16_to_host(wordPtr[85]) & BIT0)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SMART [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SMART, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SMART");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SMART, false);
             }
         }
     }
@@ -1325,97 +1509,84 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         }
         if (le16_to_host(wordPtr[83]) & BIT11 || le16_to_host(wordPtr[86]) & BIT11)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported, "DCO");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DCO, false);
         }
         if (le16_to_host(wordPtr[83]) & BIT10 || le16_to_host(wordPtr[86]) & BIT10)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "48bit Address");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_48BIT_ADDRESS, false);
         }
         if (le16_to_host(wordPtr[83]) & BIT9)
         {
             if (le16_to_host(wordPtr[86]) & BIT9)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "AAM [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_AAM, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "AAM");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_AAM, false);
             }
         }
         if (le16_to_host(wordPtr[83]) & BIT8)
         {
             if (le16_to_host(wordPtr[86]) & BIT8)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Set Max Security Extension [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SET_MAX_SECURITY_EXTENSION, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Set Max Security Extension");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SET_MAX_SECURITY_EXTENSION, false);
             }
         }
         if (le16_to_host(wordPtr[83]) & BIT5)
         {
             if (le16_to_host(wordPtr[86]) & BIT5)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "PUIS [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PUIS, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "PUIS");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PUIS, false);
             }
         }
         if (le16_to_host(wordPtr[83]) & BIT4)
         {
             if (le16_to_host(wordPtr[86]) & BIT4)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Removable Media Status Notification [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_REMOVABLE_MEDIA_STATUS_NOTIFICATION,
+                                              true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Removable Media Status Notification");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_REMOVABLE_MEDIA_STATUS_NOTIFICATION,
+                                              false);
             }
         }
         if (le16_to_host(wordPtr[83]) & BIT3)
         {
             if (le16_to_host(wordPtr[86]) & BIT3)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "APM [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_APM, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "APM");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_APM, false);
             }
         }
         if (le16_to_host(wordPtr[83]) & BIT2)
         {
             if (le16_to_host(wordPtr[86]) & BIT2)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "CFA [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_CFA, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "CFA");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_CFA, false);
             }
         }
         if (le16_to_host(wordPtr[83]) & BIT1 || le16_to_host(wordPtr[86]) & BIT1)
         {
-            DECLARE_ZERO_INIT_ARRAY(char, tcqFeatureString, MAX_FEATURE_LENGTH);
-            snprintf_err_handle(tcqFeatureString, MAX_FEATURE_LENGTH, "TCQ [QD=%" PRIu8 "]", queueDepth);
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          tcqFeatureString);
+            driveInfo->featureDetails.tcqQueueDepth = queueDepth;
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_TCQ, false);
         }
         if (le16_to_host(wordPtr[83]) & BIT0 || le16_to_host(wordPtr[86]) & BIT0)
         {
@@ -1443,28 +1614,25 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
     }
     if ((word84Valid && le16_to_host(wordPtr[84]) & BIT5) || (word87Valid && le16_to_host(wordPtr[87]) & BIT5))
     {
-        add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported, "GPL");
+        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_GPL, false);
         ataCapabilities->gplSupported = true;
     }
     if (word84Valid && le16_to_host(wordPtr[84]) & BIT4)
     {
-        add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported, "Streaming");
+        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_STREAMING, false);
     }
     if ((word84Valid && le16_to_host(wordPtr[84]) & BIT3) || (word87Valid && le16_to_host(wordPtr[87]) & BIT3))
     {
-        add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                      "Media Card Pass-through");
+        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_MEDIA_CARD_PASS_THROUGH, false);
     }
     if ((word84Valid && le16_to_host(wordPtr[84]) & BIT1) || (word87Valid && le16_to_host(wordPtr[87]) & BIT1))
     {
-        add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                      "SMART Self-Test");
+        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SMART_SELF_TEST, false);
     }
     if ((word84Valid && le16_to_host(wordPtr[84]) & BIT0) || (word87Valid && le16_to_host(wordPtr[87]) & BIT0))
     {
         ataCapabilities->smartErrorLoggingSupported = true;
-        add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                      "SMART Error Logging");
+        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SMART_ERROR_LOGGING, false);
     }
 
     if (word88Valid && is_ATA_Identify_Word_Valid(le16_to_host(wordPtr[88])) &&
@@ -1733,56 +1901,48 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         {
             if (le16_to_host(wordPtr[120]) & BIT9)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "DSN [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DSN, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "DSN");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DSN, false);
             }
         }
         if (le16_to_host(wordPtr[119]) & BIT8)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported, "AMAC");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_AMAC, false);
         }
         if (le16_to_host(wordPtr[119]) & BIT7)
         {
             if (le16_to_host(wordPtr[120]) & BIT7)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "EPC [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_EPC, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "EPC");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_EPC, false);
             }
         }
         if (le16_to_host(wordPtr[119]) & BIT6)
         {
             if (le16_to_host(wordPtr[120]) & BIT6)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Sense Data Reporting [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SENSE_DATA_REPORTING, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Sense Data Reporting");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SENSE_DATA_REPORTING, false);
             }
         }
         if (le16_to_host(wordPtr[119]) & BIT5)
         {
             if (le16_to_host(wordPtr[120]) & BIT5)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Free-fall Control [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FREE_FALL_CONTROL, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Free-fall Control");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FREE_FALL_CONTROL, false);
             }
         }
         if (le16_to_host(wordPtr[119]) & BIT4 || le16_to_host(wordPtr[120]) & BIT4)
@@ -1793,13 +1953,11 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         {
             if (le16_to_host(wordPtr[120]) & BIT1)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Write-Read-Verify [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_WRITE_READ_VERIFY, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Write-Read-Verify");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_WRITE_READ_VERIFY, false);
             }
         }
     }
@@ -1845,29 +2003,12 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
         if (le16_to_host(wordPtr[169]) & BIT0)
         {
             // add additional info for deterministic and zeroes
-            DECLARE_ZERO_INIT_ARRAY(char, trimDetails, 30);
-            if (deterministicTrim || zeroesAfterTrim)
+            driveInfo->featureDetails.deterministicUnmap = deterministicTrim;
+            if (zeroesAfterTrim)
             {
-                if (deterministicTrim && zeroesAfterTrim)
-                {
-                    snprintf_err_handle(trimDetails, 30, "TRIM [Deterministic, Zeroes]");
-                }
-                else if (deterministicTrim)
-                {
-                    snprintf_err_handle(trimDetails, 30, "TRIM [Deterministic]");
-                }
-                else if (zeroesAfterTrim)
-                {
-                    snprintf_err_handle(trimDetails, 30, "TRIM [Zeroes]");
-                }
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              trimDetails);
-            }
-            else
-            {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "TRIM");
+                driveInfo->featureDetails.unmappedData = UNMAPPED_DATA_ZEROES;
             }
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_TRIM, false);
         }
     }
     if (is_ATA_Identify_Word_Valid(le16_to_host(wordPtr[206])))
@@ -1877,28 +2018,23 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
             ataCapabilities->sctSupported = true;
             if (le16_to_host(wordPtr[206]) & BIT1)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SCT Read/Write Long");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SCT_READ_WRITE_LONG, false);
             }
             if (le16_to_host(wordPtr[206]) & BIT2)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SCT Write Same");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SCT_WRITE_SAME, false);
             }
             if (le16_to_host(wordPtr[206]) & BIT3)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SCT Error Recovery Control");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SCT_ERROR_RECOVERY_CONTROL, false);
             }
             if (le16_to_host(wordPtr[206]) & BIT4)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SCT Feature Control");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SCT_FEATURE_CONTROL, false);
             }
             if (le16_to_host(wordPtr[206]) & BIT5)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "SCT Data Tables");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SCT_DATA_TABLES, false);
             }
         }
     }
@@ -1912,20 +2048,17 @@ static eReturnValues get_ATA_Drive_Info_From_Identify(ptrDriveInformationSAS_SAT
     {
         if (M_Byte3(le16_to_host(wordPtr[214])) > 0)
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "NV Cache");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_NV_CACHE, false);
         }
         if (le16_to_host(wordPtr[214]) & BIT0)
         {
             if (le16_to_host(wordPtr[214]) & BIT1)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "NV Cache Power Mode [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_NV_CACHE_POWER_MODE, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "NV Cache Power Mode");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_NV_CACHE_POWER_MODE, false);
             }
         }
     }
@@ -2268,20 +2401,17 @@ static eReturnValues get_ATA_Drive_Info_From_ID_Data_Log(ptrDriveInformationSAS_
                 {
                     if (supportedCapabilitiesQWord & BIT55)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "Mutate");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_MUTATE, false);
                     }
                     if (supportedCapabilitiesQWord & BIT54)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Advanced Background Operations");
+                        add_Feature_To_Supported_List(&driveInfo->features,
+                                                      DRIVE_FEATURE_ADVANCED_BACKGROUND_OPERATIONS, false);
                     }
                     if (supportedCapabilitiesQWord & BIT49)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Set Sector Configuration");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SET_SECTOR_CONFIGURATION,
+                                                      false);
                     }
                     if (supportedCapabilitiesQWord & BIT46)
                     {
@@ -2323,15 +2453,13 @@ static eReturnValues get_ATA_Drive_Info_From_ID_Data_Log(ptrDriveInformationSAS_
                     {
                         if (supportedCapabilitiesQWord18 & BIT2)
                         {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported,
-                                                          "Storage Element Depopulation + Restore");
+                            add_Feature_To_Supported_List(&driveInfo->features,
+                                                          DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION_RESTORE, false);
                         }
                         else
                         {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported,
-                                                          "Storage Element Depopulation");
+                            add_Feature_To_Supported_List(&driveInfo->features,
+                                                          DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION, false);
                         }
                     }
                 }
@@ -2378,26 +2506,22 @@ static eReturnValues get_ATA_Drive_Info_From_ID_Data_Log(ptrDriveInformationSAS_
         {
             if (dlcEnabled)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Device Life Control [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DEVICE_LIFE_CONTROL, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Device Life Control");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DEVICE_LIFE_CONTROL, false);
             }
         }
         if (cdlSupported)
         {
             if (cdlEnabled)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Command Duration Limits [Enabled]");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_COMMAND_DURATION_LIMITS, true);
             }
             else
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Command Duration Limits");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_COMMAND_DURATION_LIMITS, false);
             }
         }
         /*offset = ATA_LOG_PAGE_LEN_BYTES * ATA_ID_DATA_LOG_ATA_STRINGS;
@@ -2462,9 +2586,8 @@ static eReturnValues get_ATA_Drive_Info_From_ID_Data_Log(ptrDriveInformationSAS_
                 {
                     if (zonedSettingsQWord & BIT1)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Remove Element And Modify Zones");
+                        add_Feature_To_Supported_List(&driveInfo->features,
+                                                      DRIVE_FEATURE_REMOVE_ELEMENT_AND_MODIFY_ZONES, false);
                     }
                 }
                 if (versionQWord & ATA_ID_DATA_QWORD_VALID_BIT)
@@ -2506,13 +2629,11 @@ static eReturnValues get_ATA_Drive_Info_From_ID_Data_Log(ptrDriveInformationSAS_
                 {
                     if (zoneActCapQWord & BIT0)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "Zone Domains");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ZONE_DOMAINS, false);
                     }
                     if (zoneActCapQWord & BIT1)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "Zone Realms");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ZONE_REALMS, false);
                     }
                 }
             }
@@ -2783,13 +2904,11 @@ static eReturnValues get_ATA_Drive_Info_From_SMART_Data(ptrDriveInformationSAS_S
             // set features supported
             if (iddSupported)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Seagate In Drive Diagnostics (IDD)");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SEAGATE_IDD, false);
             }
             if (remanSupported)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "Seagate Remanufacture");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SEAGATE_REMANUFACTURE, false);
             }
         }
         // first get the SMART attributes that we care about
@@ -3177,10 +3296,15 @@ static eReturnValues get_Security_Features_From_Security_Protocol(tDevice*
     return ret;
 }
 
-eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_SATA driveInfo)
+eReturnValues get_ATA_Drive_Information_Fields(tDevice*                    device,
+                                               ptrLogPageCache             logCache,
+                                               ptrDriveInformationSAS_SATA driveInfo,
+                                               uint32_t                    fieldMask)
 {
     eReturnValues                  ret                         = SUCCESS;
     bool                           smartStatusFromSCTStatusLog = false;
+    bool                           wantFeatures                = fieldMask & DRIVE_INFO_FIELD_FEATURES;
+    bool                           wantHealth                  = fieldMask & DRIVE_INFO_FIELD_HEALTH;
     idDataCapabilitiesForDriveInfo ataCap;
     safe_memset(&ataCap, sizeof(idDataCapabilitiesForDriveInfo), 0, sizeof(idDataCapabilitiesForDriveInfo));
     DISABLE_NONNULL_COMPARE
@@ -3206,6 +3330,12 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
         }
     }
     driveInfo->percentEnduranceUsed = -1; // start with this to filter out this value later if necessary
+    bool wantSettings               = wantFeatures || (fieldMask & DRIVE_INFO_FIELD_SETTINGS);
+    if (!wantSettings && !wantHealth)
+    {
+        // everything for identity and capacity is in the identify data
+        return ret;
+    }
 
     // Read Log data
     uint32_t logBufferSize = ATA_LOG_PAGE_LEN_BYTES;
@@ -3216,11 +3346,13 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
         return MEMORY_FAILURE;
     }
 
-    bool gotLogDirectory = false;
+    // share the directories held by the cache so later log size checks on this device do not reread them
+    ptrATALogDirectories directories     = logCache != M_NULLPTR ? &logCache->directories : M_NULLPTR;
+    bool                 gotLogDirectory = false;
     if ((ataCap.gplSupported &&
-         SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_DIRECTORY, 0, logBuffer, logBufferSize, 0)) ||
+         SUCCESS == get_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_GPL, logBuffer, logBufferSize)) ||
         (ataCap.smartErrorLoggingSupported &&
-         SUCCESS == ata_SMART_Read_Log(device, ATA_LOG_DIRECTORY, logBuffer, logBufferSize)))
+         SUCCESS == get_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_SMART, logBuffer, logBufferSize)))
     {
         gotLogDirectory = true;
     }
@@ -3263,20 +3395,20 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
             // test
             //  as these are the only other single sector logs that will show up on old drives like these
         }
-        if (hostlogging == (UINT32_C(16) * ATA_LOG_PAGE_LEN_BYTES))
+        if (wantFeatures && hostlogging == (UINT32_C(16) * ATA_LOG_PAGE_LEN_BYTES))
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "Host Logging");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_HOST_LOGGING, false);
         }
 
-        if (idDataLogSize > 0)
+        // the current settings page has settings that can change without changing identify, such as DLC and CDL
+        if (wantSettings && idDataLogSize > 0)
         {
             uint8_t* idDataLog = M_REINTERPRET_CAST(
                 uint8_t*, safe_calloc_aligned(idDataLogSize, sizeof(uint8_t), device->os_info.minimumAlignment));
             if (idDataLog != M_NULLPTR)
             {
-                if (SUCCESS == get_ATA_Log(device, ATA_LOG_IDENTIFY_DEVICE_DATA, M_NULLPTR, M_NULLPTR, true, true, true,
-                                           idDataLog, idDataLogSize, M_NULLPTR, 0, 0))
+                if (SUCCESS == cached_ATA_Get_Log(device, logCache, ATA_LOG_IDENTIFY_DEVICE_DATA, true, true, idDataLog,
+                                                  idDataLogSize))
                 {
                     // call function to fill in data from ID data log
                     get_ATA_Drive_Info_From_ID_Data_Log(driveInfo, &ataCap, idDataLog, idDataLogSize);
@@ -3285,14 +3417,14 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
             safe_free_aligned(&idDataLog);
         }
         // read device statistics log (only some pages are needed)
-        if (devStatsSize > 0) // can come from GPL or SMART
+        if (wantHealth && devStatsSize > 0) // can come from GPL or SMART
         {
             uint8_t* devStats = M_REINTERPRET_CAST(
                 uint8_t*, safe_calloc_aligned(devStatsSize, sizeof(uint8_t), device->os_info.minimumAlignment));
             if (devStats != M_NULLPTR)
             {
-                if (SUCCESS == get_ATA_Log(device, ATA_LOG_DEVICE_STATISTICS, M_NULLPTR, M_NULLPTR, true, true, true,
-                                           devStats, devStatsSize, M_NULLPTR, 0, 0))
+                if (SUCCESS ==
+                    cached_ATA_Get_Log(device, logCache, ATA_LOG_DEVICE_STATISTICS, true, true, devStats, devStatsSize))
                 {
                     // call function to fill in data from ID data log
                     get_ATA_Drive_Info_From_Device_Statistics_Log(driveInfo, &ataCap, devStats, devStatsSize);
@@ -3300,7 +3432,8 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
             }
             safe_free_aligned(&devStats);
         }
-        if (ataCap.gplSupported && hybridInfoSize > 0) // GPL only. Page is also only a size of 1 512B block
+        // GPL only. Page is also only a size of 1 512B block
+        if (wantFeatures && ataCap.gplSupported && hybridInfoSize > 0)
         {
             if (SUCCESS ==
                 send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_HYBRID_INFORMATION, 0, logBuffer, LEGACY_DRIVE_SEC_SIZE, 0))
@@ -3311,7 +3444,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
                     driveInfo->logicalSectorSize;
             }
         }
-        if (extSelfTest > 0 || smartSelfTest > 0)
+        if (wantHealth && (extSelfTest > 0 || smartSelfTest > 0))
         {
             dstLogEntries dstEntries;
             safe_memset(&dstEntries, sizeof(dstLogEntries), 0, sizeof(dstLogEntries));
@@ -3337,7 +3470,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
                 }
             }
         }
-        if (ataCap.sctSupported && sctStatus > 0) // GPL or SMART
+        if (wantHealth && ataCap.sctSupported && sctStatus > 0) // GPL or SMART
         {
             safe_memset(logBuffer, logBufferSize, 0, LEGACY_DRIVE_SEC_SIZE);
             // Read the SCT status log
@@ -3387,7 +3520,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
                 }
             }
         }
-        if (ataCap.gplSupported && concurrentRangesSize)
+        if (wantFeatures && ataCap.gplSupported && concurrentRangesSize)
         {
             safe_memset(logBuffer, logBufferSize, 0, logBufferSize);
             // NOTE: Only reading first 512B since this has the counter we need. Max log size is 1024 in ACS5 - TJE
@@ -3397,7 +3530,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
                 driveInfo->concurrentPositioningRanges = logBuffer[0];
             }
         }
-        if (ataCap.gplSupported && farmLogSize)
+        if (wantFeatures && ataCap.gplSupported && farmLogSize)
         {
             uint8_t* farmData = M_REINTERPRET_CAST(
                 uint8_t*, safe_calloc_aligned(16384, sizeof(uint8_t), device->os_info.minimumAlignment));
@@ -3412,9 +3545,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
                     if (farmSignature & BIT63 && farmSignature & BIT62 &&
                         (farmSignature & UINT64_C(0x00FFFFFFFFFFFF)) == SEAGATE_FARM_LOG_SIGNATURE)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Field Accessible Reliability Metrics (FARM)");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FARM, false);
                         // Now read the next page to get the DOM (and possibly other useful data)
                         if (SUCCESS ==
                             send_ATA_Read_Log_Ext_Cmd(device, SEAGATE_ATA_LOG_FIELD_ACCESSIBLE_RELIABILITY_METRICS,
@@ -3463,7 +3594,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
     safe_free_aligned(&logBuffer);
 
     DECLARE_ZERO_INIT_ARRAY(uint8_t, smartData, LEGACY_DRIVE_SEC_SIZE);
-    if (SUCCESS == ata_SMART_Read_Data(device, smartData, LEGACY_DRIVE_SEC_SIZE))
+    if (wantHealth && SUCCESS == cached_ATA_SMART_Read_Data(device, logCache, smartData, LEGACY_DRIVE_SEC_SIZE))
     {
         get_ATA_Drive_Info_From_SMART_Data(driveInfo, &ataCap, smartData, LEGACY_DRIVE_SEC_SIZE);
     }
@@ -3472,7 +3603,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
     driveInfo->totalBytesWritten = driveInfo->totalLBAsWritten * driveInfo->logicalSectorSize;
 
     // get security protocol info
-    if (ataCap.tcgSupported)
+    if (wantFeatures && ataCap.tcgSupported)
     {
         // TCG - SED drive (need to test a trusted command to see if it is being blocked or not)
         if (SUCCESS != ata_Trusted_Non_Data(device, 0, true, 0))
@@ -3480,13 +3611,11 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
             driveInfo->trustedCommandsBeingBlocked = true;
             if (ataCap.tcgSupported)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "TCG");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_TCG, false);
             }
             if (ataCap.ieee1667Supported)
             {
-                add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                              "IEEE 1667");
+                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_IEEE_1667, false);
             }
         }
         else
@@ -3506,18 +3635,15 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
                         if (driveInfo->securityInfo.tcg)
                         {
                             driveInfo->encryptionSupport = ENCRYPTION_SELF_ENCRYPTING;
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, "TCG");
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_TCG, false);
                         }
                         if (driveInfo->securityInfo.scsa)
                         {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, "SCSA");
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SCSA, false);
                         }
                         if (driveInfo->securityInfo.ieee1667)
                         {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, "IEEE 1667");
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_IEEE_1667, false);
                         }
                     }
                 }
@@ -3526,12 +3652,15 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
         }
     }
 
-    // get the native maxLBA
-    ata_Get_Native_Max_LBA(device, &driveInfo->nativeMaxLBA);
-    if (!smartStatusFromSCTStatusLog)
+    if (wantFeatures)
+    {
+        // get the native maxLBA
+        ata_Get_Native_Max_LBA(device, &driveInfo->nativeMaxLBA);
+    }
+    if (wantHealth && !smartStatusFromSCTStatusLog)
     {
         // SMART status
-        switch (ata_SMART_Check(device, M_NULLPTR))
+        switch (run_SMART_Check_Cached(device, logCache, M_NULLPTR))
         {
         case SUCCESS:
             driveInfo->smartStatus = 0;
@@ -3544,7 +3673,7 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
             break;
         }
     }
-    if (is_Seagate_Family(device) == SEAGATE)
+    if (wantFeatures && is_Seagate_Family(device) == SEAGATE)
     {
         driveInfo->lowCurrentSpinupValid   = true;
         driveInfo->lowCurrentSpinupViaSCT  = is_SCT_Low_Current_Spinup_Supported(device);
@@ -3553,17 +3682,23 @@ eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_
     return ret;
 }
 
+eReturnValues get_ATA_Drive_Information(tDevice* device, ptrDriveInformationSAS_SATA driveInfo)
+{
+    return get_ATA_Drive_Information_Fields(device, M_NULLPTR, driveInfo, DRIVE_INFO_FIELD_ALL);
+}
+
 typedef struct s_scsiIdentifyInfo
 {
-    uint8_t version;
-    uint8_t peripheralQualifier;
-    uint8_t peripheralDeviceType;
-    bool    ccs; // scsi1, but reporting according to CCS (response format 1)
-    bool    protectionSupported;
-    bool    protectionType1Supported;
-    bool    protectionType2Supported;
-    bool    protectionType3Supported;
-    bool    zoneDomainsOrRealms;
+    uint8_t  version;
+    uint8_t  peripheralQualifier;
+    uint8_t  peripheralDeviceType;
+    bool     ccs; // scsi1, but reporting according to CCS (response format 1)
+    bool     protectionSupported;
+    bool     protectionType1Supported;
+    bool     protectionType2Supported;
+    bool     protectionType3Supported;
+    bool     zoneDomainsOrRealms;
+    uint32_t fieldMask; // DRIVE_INFO_FIELD_* groups being collected
 } scsiIdentifyInfo, *ptrSCSIIdentifyInfo;
 
 static eReturnValues get_SCSI_Inquiry_Data(ptrDriveInformationSAS_SATA driveInfo,
@@ -3690,6 +3825,36 @@ static eReturnValues get_SCSI_Inquiry_Data(ptrDriveInformationSAS_SATA driveInfo
     return ret;
 }
 
+// Identity needs the serial number and WWN pages, the block device characteristics page for the rotation rate and
+// form factor, and the ATA information page for the SAT vendor, product and revision. Extended inquiry data reports
+// the protection types that are needed along with read capacity. Every other page is only read for features.
+static bool is_SCSI_VPD_Page_Needed(uint8_t pageCode, uint32_t fieldMask)
+{
+    bool needed = false;
+    if (fieldMask & DRIVE_INFO_FIELD_FEATURES)
+    {
+        needed = true;
+    }
+    else
+    {
+        switch (pageCode)
+        {
+        case UNIT_SERIAL_NUMBER:
+        case DEVICE_IDENTIFICATION:
+        case BLOCK_DEVICE_CHARACTERISTICS:
+        case ATA_INFORMATION:
+            needed = fieldMask & DRIVE_INFO_FIELD_IDENTITY;
+            break;
+        case EXTENDED_INQUIRY_DATA:
+            needed = fieldMask & DRIVE_INFO_FIELD_CAPACITY;
+            break;
+        default:
+            break;
+        }
+    }
+    return needed;
+}
+
 static eReturnValues get_SCSI_VPD_Data(tDevice*                    device,
                                        ptrDriveInformationSAS_SATA driveInfo,
                                        ptrSCSIIdentifyInfo         scsiInfo)
@@ -3803,6 +3968,10 @@ static eReturnValues get_SCSI_VPD_Data(tDevice*                    device,
                  vpdIter < supportedVPDPagesLength && !device->drive_info.passThroughHacks.scsiHacks.noVPDPages;
                  vpdIter++)
             {
+                if (!is_SCSI_VPD_Page_Needed(supportedVPDPages[vpdIter], scsiInfo->fieldMask))
+                {
+                    continue;
+                }
                 switch (supportedVPDPages[vpdIter])
                 {
                 case UNIT_SERIAL_NUMBER:
@@ -4131,12 +4300,10 @@ static eReturnValues get_SCSI_VPD_Data(tDevice*                    device,
                 }
                 case POWER_CONDITION:
                     // reading this information has been moved to the mode pages below. - TJE
-                    // add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                    // &driveInfo->numberOfFeaturesSupported, "EPC");
+                    // add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_EPC, false);
                     break;
                 case POWER_CONSUMPTION:
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Power Consumption");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_POWER_CONSUMPTION, false);
                     break;
                 case LOGICAL_BLOCK_PROVISIONING:
                 {
@@ -4153,40 +4320,25 @@ static eReturnValues get_SCSI_VPD_Data(tDevice*                    device,
                     {
                         if (logicalBlockProvisioning[5] & BIT7)
                         {
-                            DECLARE_ZERO_INIT_ARRAY(char, unmapDetails, 48);
                             uint8_t lbprz = get_bit_range_uint8(logicalBlockProvisioning[5], 4, 2);
+                            driveInfo->featureDetails.deterministicUnmap = logicalBlockProvisioning[5] & BIT1;
                             if (logicalBlockProvisioning[5] & BIT1 || lbprz)
                             {
-                                DECLARE_ZERO_INIT_ARRAY(char, lbprzStr, 22);
                                 if (lbprz == 0)
                                 {
                                     // vendor unique
-                                    snprintf_err_handle(lbprzStr, 22, "Vendor Pattern");
+                                    driveInfo->featureDetails.unmappedData = UNMAPPED_DATA_VENDOR_PATTERN;
                                 }
                                 else if (lbprz & BIT0)
                                 {
-                                    snprintf_err_handle(lbprzStr, 22, "Zeros");
+                                    driveInfo->featureDetails.unmappedData = UNMAPPED_DATA_ZEROES;
                                 }
                                 else if (lbprz == 0x02)
                                 {
-                                    snprintf_err_handle(lbprzStr, 22, "Provisioning Pattern");
-                                }
-                                if (logicalBlockProvisioning[5] & BIT1)
-                                {
-                                    snprintf_err_handle(unmapDetails, 48, "UNMAP [Deterministic, %s]", lbprzStr);
-                                }
-                                else if (safe_strlen(lbprzStr))
-                                {
-                                    snprintf_err_handle(unmapDetails, 48, "UNMAP [%s]", lbprzStr);
+                                    driveInfo->featureDetails.unmappedData = UNMAPPED_DATA_PROVISIONING_PATTERN;
                                 }
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, unmapDetails);
-                            }
-                            else
-                            {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, "UNMAP");
                             }
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_UNMAP, false);
                         }
                     }
                     safe_free_aligned(&logicalBlockProvisioning);
@@ -4219,14 +4371,12 @@ static eReturnValues get_SCSI_VPD_Data(tDevice*                    device,
                             M_BytesTo4ByteValue(blockLimits[60], blockLimits[61], blockLimits[62], blockLimits[63]);
                         if (writeSameLength > 0)
                         {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, "Write Same");
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_WRITE_SAME, false);
                         }
                         if (maxAtomicLen > 0 || atomicAlign > 0 || atomicXferLenGran > 0 ||
                             maxAtomicLenWAtomicBoundary > 0 || maxAtomicBoundarySize > 0)
                         {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, "Atomic Writes");
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ATOMIC_WRITES, false);
                         }
                     }
                     safe_free_aligned(&blockLimits);
@@ -4245,8 +4395,7 @@ static eReturnValues get_SCSI_VPD_Data(tDevice*                    device,
                     if (SUCCESS ==
                         scsi_Inquiry(device, ataInformation, VPD_ATA_INFORMATION_LEN, ATA_INFORMATION, true, false))
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "SAT");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SAT, false);
                         safe_memcpy(driveInfo->satVendorID, T10_VENDOR_ID_LEN + 1, &ataInformation[8], 8);
                         safe_memcpy(driveInfo->satProductID, MODEL_NUM_LEN + 1, &ataInformation[16], 16);
                         safe_memcpy(driveInfo->satProductRevision, FW_REV_LEN + 1, &ataInformation[32], 4);
@@ -4326,6 +4475,7 @@ static eReturnValues get_SCSI_VPD_Data(tDevice*                    device,
 }
 
 static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
+                                       ptrLogPageCache             logCache,
                                        ptrDriveInformationSAS_SATA driveInfo,
                                        ptrSCSIIdentifyInfo         scsiInfo)
 {
@@ -4344,13 +4494,13 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
             if (scsiLogBuf != M_NULLPTR)
             {
                 if (!device->drive_info.passThroughHacks.scsiHacks.noLogSubPages &&
-                    SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES,
-                                                  LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF, 0, scsiLogBuf, 512))
+                    SUCCESS != cached_SCSI_Log_Sense(device, logCache, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF, 0,
+                                                     scsiLogBuf, 512))
                 {
                     // either device doesn't support logs, or it just doesn't support subpages, so let's try reading the
                     // list of supported pages (no subpages) before saying we need to dummy up the list
-                    if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0,
-                                                      0, scsiLogBuf, 512))
+                    if (SUCCESS != cached_SCSI_Log_Sense(device, logCache, LP_SUPPORTED_LOG_PAGES, 0, 0, scsiLogBuf,
+                                                         512))
                     {
                         dummyUpLogPages = true;
                     }
@@ -4362,8 +4512,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                 else if (device->drive_info.passThroughHacks.scsiHacks.noLogSubPages)
                 {
                     // device doesn't support subpages, so read the list of pages without subpages before continuing.
-                    if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0,
-                                                      0, scsiLogBuf, 512))
+                    if (SUCCESS != cached_SCSI_Log_Sense(device, logCache, LP_SUPPORTED_LOG_PAGES, 0, 0, scsiLogBuf,
+                                                         512))
                     {
                         dummyUpLogPages = true;
                     }
@@ -4530,8 +4680,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0x0005, writeErrorData, 16))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0005,
+                                                                 writeErrorData, 16))
                             {
                                 // check the length before we start trying to read the number of bytes in.
                                 if (M_BytesTo2ByteValue(writeErrorData[4], writeErrorData[5]) == 0x0005)
@@ -4583,8 +4733,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0x0005, readErrorData, 16))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0005,
+                                                                 readErrorData, 16))
                             {
                                 if (M_BytesTo2ByteValue(readErrorData[4], readErrorData[5]) == 0x0005)
                                 {
@@ -4640,8 +4790,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, temperatureData, 10))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0,
+                                                                 temperatureData, 10))
                             {
                                 driveInfo->temperatureData.temperatureDataValid = true;
                                 driveInfo->temperatureData.currentTemperature   = temperatureData[9];
@@ -4658,8 +4808,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                                 break;
                             }
                             // get temperature data first
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, environmentReporting, 16))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0,
+                                                                 environmentReporting, 16))
                             {
                                 // NOTE: Lots of casts in here to avoid clang-tidy warnings and cert-c warnings about
                                 // possible string conversion errors
@@ -4676,8 +4826,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                                 driveInfo->temperatureData.lowestValid  = true;
                             }
                             // now get humidity data if available
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0x0100, environmentReporting, 16))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0100,
+                                                                 environmentReporting, 16))
                             {
                                 driveInfo->humidityData.humidityDataValid = true;
                                 driveInfo->humidityData.currentHumidity   = environmentReporting[9];
@@ -4704,8 +4854,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0x0001, startStopCounterLog, 14))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001,
+                                                                 startStopCounterLog, 14))
                             {
                                 // check that we have the correct page
                                 if (!(startStopCounterLog[0] & BIT6) &&
@@ -4748,8 +4898,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, utilizationData, 10))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0,
+                                                                 utilizationData, 10))
                             {
                                 // bytes 9 & 10
                                 driveInfo->deviceReportedUtilizationRate =
@@ -4774,13 +4924,12 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, applicationClient, 4))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0,
+                                                                 applicationClient, 4))
                             {
                                 // add "Application Client Logging" to supported features :)
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported,
-                                                              "Application Client Logging");
+                                add_Feature_To_Supported_List(&driveInfo->features,
+                                                              DRIVE_FEATURE_APPLICATION_CLIENT_LOGGING, false);
                             }
                             safe_free_aligned(&applicationClient);
                         }
@@ -4799,13 +4948,11 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, selfTestResults,
-                                                              LP_SELF_TEST_RESULTS_LEN))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0,
+                                                                 selfTestResults, LP_SELF_TEST_RESULTS_LEN))
                             {
                                 uint8_t parameterOffset = UINT8_C(4);
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, "Self Test");
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SELF_TEST, false);
                                 // get the last DST information (parameter code 1)
                                 driveInfo->dstInfo.informationValid = true;
                                 driveInfo->dstInfo.resultOrStatus   = M_Nibble0(selfTestResults[parameterOffset + 4]);
@@ -4831,8 +4978,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0x0001, ssdEnduranceData, 12))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001,
+                                                                 ssdEnduranceData, 12))
                             {
                                 // bytes 7 of parameter 1 (or byte 12)
                                 driveInfo->percentEnduranceUsed = C_CAST(double, ssdEnduranceData[11]);
@@ -4850,8 +4997,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, backgroundScanResults, 19))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0,
+                                                                 backgroundScanResults, 19))
                             {
                                 // bytes 8 to 11
                                 driveInfo->powerOnMinutes =
@@ -4872,8 +5019,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0x0001, generalStatsAndPerformance, 72))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0x0001,
+                                                                 generalStatsAndPerformance, 72))
                             {
                                 // total lbas written (number of logical blocks received)
                                 driveInfo->totalLBAsWritten =
@@ -4905,8 +5052,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, informationExceptions, 11))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0,
+                                                                 informationExceptions, 11))
                             {
                                 smartStatusRead = true;
                                 if (informationExceptions[8] == 0) // if the ASC is 0, then no trip
@@ -4943,8 +5090,8 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode,
-                                                              subpageCode, 0, farmData, 76))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, subpageCode, 0, farmData,
+                                                                 76))
                             {
                                 uint64_t farmSignature =
                                     M_BytesTo8ByteValue(farmData[4], farmData[5], farmData[6], farmData[7], farmData[8],
@@ -4952,9 +5099,7 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                                 if (farmSignature & BIT63 && farmSignature & BIT62 &&
                                     (farmSignature & UINT64_C(0x00FFFFFFFFFFFF)) == SEAGATE_FARM_LOG_SIGNATURE)
                                 {
-                                    add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                                  &driveInfo->numberOfFeaturesSupported,
-                                                                  "Field Accessible Reliability Metrics (FARM)");
+                                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FARM, false);
                                 }
                                 // NOTE: If for any reason DOM was not already read from standard page, can read it here
                                 // too
@@ -4972,8 +5117,7 @@ static eReturnValues get_SCSI_Log_Data(tDevice*                    device,
                             {
                                 break;
                             }
-                            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, 0, 0x8004,
-                                                              ssdUsage, 12))
+                            if (SUCCESS == cached_SCSI_Log_Sense(device, logCache, pageCode, 0, 0x8004, ssdUsage, 12))
                             {
                                 driveInfo->percentEnduranceUsed =
                                     (C_CAST(double,
@@ -5050,9 +5194,7 @@ static eReturnValues get_SCSI_Read_Capacity_Data(tDevice*                    dev
                 {
                     if (!driveInfo->isFormatCorrupt)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Format Corrupt - not all features identifiable.");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FORMAT_CORRUPT, false);
                     }
                     driveInfo->isFormatCorrupt = true;
                 }
@@ -5068,39 +5210,33 @@ static eReturnValues get_SCSI_Read_Capacity_Data(tDevice*                    dev
             {
                 if (protectionTypeEnabled == 1)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Protection Type 1 [Enabled]");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_1, true);
                 }
                 else
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Protection Type 1");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_1, false);
                 }
             }
             if (scsiInfo->protectionType2Supported)
             {
                 if (protectionTypeEnabled == 2)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Protection Type 2 [Enabled]");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_2, true);
                 }
                 else
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Protection Type 2");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_2, false);
                 }
             }
             if (scsiInfo->protectionType3Supported)
             {
                 if (protectionTypeEnabled == 3)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Protection Type 3 [Enabled]");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_3, true);
                 }
                 else
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Protection Type 3");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_3, false);
                 }
             }
         }
@@ -5261,10 +5397,6 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                         // check if AWRE and ARRE are supported or can be changed before checking if they are enabled or
                         // not.
                         {
-                            char*    awreString       = M_NULLPTR;
-                            char*    arreString       = M_NULLPTR;
-                            uint32_t awreStringLength = UINT32_C(0);
-                            uint32_t arreStringLength = UINT32_C(0);
                             DECLARE_ZERO_INIT_ARRAY(
                                 uint8_t, readWriteErrorRecovery,
                                 12 + SCSI_MODE_PAGE_MIN_HEADER_LENGTH); // need to include header length in this
@@ -5305,56 +5437,14 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                                 // awre
                                 if (readWriteErrorRecovery[headerLength + 2] & BIT7)
                                 {
-                                    if (awreString == M_NULLPTR)
-                                    {
-                                        awreStringLength = 30;
-                                        awreString =
-                                            M_REINTERPRET_CAST(char*, safe_calloc(awreStringLength, sizeof(char)));
-                                    }
-                                    else
-                                    {
-                                        awreStringLength = 30;
-                                        char* temp       = M_REINTERPRET_CAST(
-                                            char*, safe_reallocf(M_REINTERPRET_CAST(void**, &awreString),
-                                                                       awreStringLength * sizeof(char)));
-                                        if (temp != M_NULLPTR)
-                                        {
-                                            awreString = temp;
-                                            safe_memset(awreString, awreStringLength, 0, awreStringLength);
-                                        }
-                                    }
-                                    if (awreString != M_NULLPTR && awreStringLength >= 30)
-                                    {
-                                        snprintf_err_handle(awreString, awreStringLength,
-                                                            "Automatic Write Reassignment");
-                                    }
+                                    add_Feature_To_Supported_List(&driveInfo->features,
+                                                                  DRIVE_FEATURE_AUTOMATIC_WRITE_REASSIGNMENT, false);
                                 }
                                 // arre
                                 if (readWriteErrorRecovery[headerLength + 2] & BIT6)
                                 {
-                                    if (arreString == M_NULLPTR)
-                                    {
-                                        arreStringLength = 30;
-                                        arreString =
-                                            M_REINTERPRET_CAST(char*, safe_calloc(arreStringLength, sizeof(char)));
-                                    }
-                                    else
-                                    {
-                                        arreStringLength = 30;
-                                        char* temp       = M_REINTERPRET_CAST(
-                                            char*, safe_reallocf(M_REINTERPRET_CAST(void**, &arreString),
-                                                                       arreStringLength * sizeof(char)));
-                                        if (temp != M_NULLPTR)
-                                        {
-                                            arreString = temp;
-                                            safe_memset(arreString, arreStringLength, 0, arreStringLength);
-                                        }
-                                    }
-                                    if (arreString != M_NULLPTR && arreStringLength >= 30)
-                                    {
-                                        snprintf_err_handle(arreString, arreStringLength,
-                                                            "Automatic Read Reassignment");
-                                    }
+                                    add_Feature_To_Supported_List(&driveInfo->features,
+                                                                  DRIVE_FEATURE_AUTOMATIC_READ_REASSIGNMENT, false);
                                 }
                             }
                             if (SUCCESS == get_SCSI_Mode_Page(device, MPC_CURRENT_VALUES, pageCode, subPageCode,
@@ -5388,70 +5478,16 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                                 // awre
                                 if (readWriteErrorRecovery[headerLength + 2] & BIT7)
                                 {
-                                    if (awreString == M_NULLPTR)
-                                    {
-                                        awreStringLength = 40;
-                                        awreString =
-                                            M_REINTERPRET_CAST(char*, safe_calloc(awreStringLength, sizeof(char)));
-                                    }
-                                    else
-                                    {
-                                        awreStringLength = 40;
-                                        char* temp       = M_REINTERPRET_CAST(
-                                            char*, safe_reallocf(M_REINTERPRET_CAST(void**, &awreString),
-                                                                       awreStringLength * sizeof(char)));
-                                        if (temp != M_NULLPTR)
-                                        {
-                                            awreString = temp;
-                                            safe_memset(awreString, awreStringLength, 0, awreStringLength);
-                                        }
-                                    }
-                                    if (awreString != M_NULLPTR && awreStringLength >= 40)
-                                    {
-                                        snprintf_err_handle(awreString, awreStringLength,
-                                                            "Automatic Write Reassignment [Enabled]");
-                                    }
+                                    add_Feature_To_Supported_List(&driveInfo->features,
+                                                                  DRIVE_FEATURE_AUTOMATIC_WRITE_REASSIGNMENT, true);
                                 }
                                 // arre
                                 if (readWriteErrorRecovery[headerLength + 2] & BIT6)
                                 {
-                                    if (arreString == M_NULLPTR)
-                                    {
-                                        arreStringLength = 40;
-                                        arreString =
-                                            M_REINTERPRET_CAST(char*, safe_calloc(arreStringLength, sizeof(char)));
-                                    }
-                                    else
-                                    {
-                                        arreStringLength = 40;
-                                        char* temp       = M_REINTERPRET_CAST(
-                                            char*, safe_reallocf(M_REINTERPRET_CAST(void**, &arreString),
-                                                                       arreStringLength * sizeof(char)));
-                                        if (temp != M_NULLPTR)
-                                        {
-                                            arreString = temp;
-                                            safe_memset(arreString, arreStringLength, 0, arreStringLength);
-                                        }
-                                    }
-                                    if (arreString != M_NULLPTR && arreStringLength >= 40)
-                                    {
-                                        snprintf_err_handle(arreString, arreStringLength,
-                                                            "Automatic Read Reassignment [Enabled]");
-                                    }
+                                    add_Feature_To_Supported_List(&driveInfo->features,
+                                                                  DRIVE_FEATURE_AUTOMATIC_READ_REASSIGNMENT, true);
                                 }
                             }
-                            if (awreString != M_NULLPTR)
-                            {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, awreString);
-                                safe_free(&awreString);
-                            }
-                            if (arreString != M_NULLPTR)
-                            {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, arreString);
-                                safe_free(&arreString);
-                            }
                         }
                         break;
                     default:
@@ -5673,8 +5709,6 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                     case 1: // controlExtension
                     {
                         // check if DLC is supported or can be changed before checking if they are enabled or not.
-                        char*    dlcString       = M_NULLPTR;
-                        uint32_t dlcStringLength = UINT32_C(0);
                         DECLARE_ZERO_INIT_ARRAY(
                             uint8_t, controlExtensionPage,
                             MP_CONTROL_EXTENSION_LEN +
@@ -5716,27 +5750,8 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                             // dlc
                             if (controlExtensionPage[headerLength + 4] & BIT3)
                             {
-                                if (dlcString == M_NULLPTR)
-                                {
-                                    dlcStringLength = 50;
-                                    dlcString = M_REINTERPRET_CAST(char*, safe_calloc(dlcStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    dlcStringLength = 50;
-                                    char* temp =
-                                        M_REINTERPRET_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &dlcString),
-                                                                                dlcStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        dlcString = temp;
-                                        safe_memset(dlcString, dlcStringLength, 0, dlcStringLength);
-                                    }
-                                }
-                                if (dlcString != M_NULLPTR && dlcStringLength >= 50)
-                                {
-                                    snprintf_err_handle(dlcString, dlcStringLength, "Device Life Control");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DEVICE_LIFE_CONTROL,
+                                                              false);
                             }
                         }
                         if (SUCCESS == get_SCSI_Mode_Page(device, MPC_CURRENT_VALUES, pageCode, subPageCode, M_NULLPTR,
@@ -5770,35 +5785,10 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                             // dlc
                             if (controlExtensionPage[headerLength + 4] & BIT3)
                             {
-                                if (dlcString == M_NULLPTR)
-                                {
-                                    dlcStringLength = 50;
-                                    dlcString = M_REINTERPRET_CAST(char*, safe_calloc(dlcStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    dlcStringLength = 50;
-                                    char* temp =
-                                        M_REINTERPRET_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &dlcString),
-                                                                                dlcStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        dlcString = temp;
-                                        safe_memset(dlcString, dlcStringLength, 0, dlcStringLength);
-                                    }
-                                }
-                                if (dlcString != M_NULLPTR && dlcStringLength >= 50)
-                                {
-                                    snprintf_err_handle(dlcString, dlcStringLength, "Device Life Control [Enabled]");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DEVICE_LIFE_CONTROL,
+                                                              true);
                             }
                         }
-                        if (dlcString != M_NULLPTR)
-                        {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, dlcString);
-                            safe_free(&dlcString);
-                        }
                     }
                     break;
                     case 0x03: // CDL A
@@ -5813,9 +5803,8 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                                                device, MPC_CURRENT_VALUES, pageCode, subPageCode, M_NULLPTR, M_NULLPTR,
                                                true, cdl, 36 + SCSI_MODE_PAGE_MIN_HEADER_LENGTH, M_NULLPTR, &sixByte))
                             {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported,
-                                                              "Command Duration Limits");
+                                add_Feature_To_Supported_List(&driveInfo->features,
+                                                              DRIVE_FEATURE_COMMAND_DURATION_LIMITS, false);
                             }
                         }
                         break;
@@ -5869,14 +5858,13 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                             }
                             if (valid)
                             {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported,
-                                                              "IO Advice Hints [Enabled]");
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_IO_ADVICE_HINTS,
+                                                              true);
                             }
                             else
                             {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, "IO Advice Hints");
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_IO_ADVICE_HINTS,
+                                                              false);
                             }
                         }
                     }
@@ -5893,9 +5881,8 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                                                device, MPC_CURRENT_VALUES, pageCode, subPageCode, M_NULLPTR, M_NULLPTR,
                                                true, cdl, 232 + SCSI_MODE_PAGE_MIN_HEADER_LENGTH, M_NULLPTR, &sixByte))
                             {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported,
-                                                              "Command Duration Limits T2");
+                                add_Feature_To_Supported_List(&driveInfo->features,
+                                                              DRIVE_FEATURE_COMMAND_DURATION_LIMITS_T2, false);
                             }
                         }
                         break;
@@ -5935,8 +5922,7 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                         }
                         if (pageRead && modeDataLen > 0)
                         {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, "PATA Control");
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PATA_CONTROL, false);
                         }
                     }
                     break;
@@ -5977,9 +5963,8 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                         {
                             if (get_bit_range_uint8(ataFeatureControl[headerLength + 4], 2, 0))
                             {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported,
-                                                              "SATA Command Duration Limit [Enabled]");
+                                add_Feature_To_Supported_List(&driveInfo->features,
+                                                              DRIVE_FEATURE_SATA_COMMAND_DURATION_LIMIT, true);
                             }
                         }
                     }
@@ -6400,8 +6385,6 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                     {
                     case 0x00: // EPC
                     {
-                        char*    epcFeatureString       = M_NULLPTR;
-                        uint32_t epcFeatureStringLength = UINT32_C(0);
                         // read the default values to check if it's supported...then try the current page...
                         bool defaultsRead = false;
                         bool sixByte      = false;
@@ -6440,55 +6423,12 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                         {
                             if (powerConditions[1 + headerLength] > 0x0A)
                             {
-                                if (epcFeatureString == M_NULLPTR)
-                                {
-                                    epcFeatureStringLength = 4;
-                                    epcFeatureString =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(epcFeatureStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    epcFeatureStringLength = 4;
-                                    char* temp =
-                                        C_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &epcFeatureString),
-                                                                    epcFeatureStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        epcFeatureString = temp;
-                                        safe_memset(epcFeatureString, epcFeatureStringLength, 0,
-                                                    epcFeatureStringLength);
-                                    }
-                                }
-                                if (epcFeatureString != M_NULLPTR && epcFeatureStringLength >= 4)
-                                {
-                                    snprintf_err_handle(epcFeatureString, epcFeatureStringLength, "EPC");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_EPC, false);
                             }
                             else
                             {
-                                if (epcFeatureString == M_NULLPTR)
-                                {
-                                    epcFeatureStringLength = 17;
-                                    epcFeatureString =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(epcFeatureStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    epcFeatureStringLength = 17;
-                                    char* temp =
-                                        C_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &epcFeatureString),
-                                                                    epcFeatureStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        epcFeatureString = temp;
-                                        safe_memset(epcFeatureString, epcFeatureStringLength, 0,
-                                                    epcFeatureStringLength);
-                                    }
-                                }
-                                if (epcFeatureString != M_NULLPTR && epcFeatureStringLength >= 17)
-                                {
-                                    snprintf_err_handle(epcFeatureString, epcFeatureStringLength, "Power Conditions");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_POWER_CONDITIONS,
+                                                              false);
                             }
                         }
                         // Now read the current page to see if it's more than just supported :)
@@ -6523,65 +6463,15 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                                  powerConditions[3 + headerLength] & BIT1 || powerConditions[3 + headerLength] & BIT2 ||
                                  powerConditions[3 + headerLength] & BIT3))
                             {
-                                if (epcFeatureString == M_NULLPTR)
-                                {
-                                    epcFeatureStringLength = 14;
-                                    epcFeatureString =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(epcFeatureStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    epcFeatureStringLength = 14;
-                                    char* temp =
-                                        C_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &epcFeatureString),
-                                                                    epcFeatureStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        epcFeatureString = temp;
-                                        safe_memset(epcFeatureString, epcFeatureStringLength, 0,
-                                                    epcFeatureStringLength);
-                                    }
-                                }
-                                if (epcFeatureString != M_NULLPTR && epcFeatureStringLength >= 14)
-                                {
-                                    snprintf_err_handle(epcFeatureString, epcFeatureStringLength, "EPC [Enabled]");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_EPC, true);
                             }
                             else if (powerConditions[3 + headerLength] & BIT0 ||
                                      powerConditions[3 + headerLength] & BIT1)
                             {
-                                if (epcFeatureString == M_NULLPTR)
-                                {
-                                    epcFeatureStringLength = 27;
-                                    epcFeatureString =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(epcFeatureStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    epcFeatureStringLength = 27;
-                                    char* temp =
-                                        C_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &epcFeatureString),
-                                                                    epcFeatureStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        epcFeatureString = temp;
-                                        safe_memset(epcFeatureString, epcFeatureStringLength, 0,
-                                                    epcFeatureStringLength);
-                                    }
-                                }
-                                if (epcFeatureString != M_NULLPTR && epcFeatureStringLength >= 27)
-                                {
-                                    snprintf_err_handle(epcFeatureString, epcFeatureStringLength,
-                                                        "Power Conditions [Enabled]");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_POWER_CONDITIONS,
+                                                              true);
                             }
                         }
-                        if (epcFeatureString != M_NULLPTR)
-                        {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, epcFeatureString);
-                            safe_free(&epcFeatureString);
-                        }
                     }
                     break;
                     case 0xF1: // ata power conditions
@@ -6621,13 +6511,11 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                         {
                             if (ataPowerConditions[headerLength + 0x05] & BIT0)
                             {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, "APM [Enabled]");
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_APM, true);
                             }
                             else
                             {
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, "APM");
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_APM, false);
                             }
                         }
                     }
@@ -6674,21 +6562,16 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                         }
                         if (pageRead && modeDataLen > 0)
                         {
-                            DECLARE_ZERO_INIT_ARRAY(char, temp, MAX_FEATURE_LENGTH);
-                            snprintf_err_handle(temp, MAX_FEATURE_LENGTH, "Informational Exceptions [Mode %" PRIu8 "]",
-                                                M_Nibble0(informationalExceptions[headerLength + 3]));
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, temp);
+                            driveInfo->featureDetails.informationalExceptionsMode =
+                                M_Nibble0(informationalExceptions[headerLength + 3]);
+                            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS,
+                                                          false);
                         }
                     }
                     break;
                     case 0x01: // Background control
                     {
                         // check if DLC is supported or can be changed before checking if they are enabled or not.
-                        char*    bmsString         = M_NULLPTR;
-                        char*    bmsPSString       = M_NULLPTR;
-                        uint32_t bmsStringLength   = UINT32_C(0);
-                        uint32_t bmsPSStringLength = UINT32_C(0);
                         DECLARE_ZERO_INIT_ARRAY(
                             uint8_t, backgroundControl,
                             16 + SCSI_MODE_PAGE_MIN_HEADER_LENGTH); // need to include header length in this
@@ -6727,53 +6610,14 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                             // bms
                             if (backgroundControl[headerLength + 4] & BIT0)
                             {
-                                if (bmsString == M_NULLPTR)
-                                {
-                                    bmsStringLength = 50;
-                                    bmsString = M_REINTERPRET_CAST(char*, safe_calloc(bmsStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    bmsStringLength = 50;
-                                    char* temp =
-                                        M_REINTERPRET_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &bmsString),
-                                                                                bmsStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        bmsString = temp;
-                                        safe_memset(bmsString, bmsStringLength, 0, bmsStringLength);
-                                    }
-                                }
-                                if (bmsString != M_NULLPTR && bmsStringLength >= 50)
-                                {
-                                    snprintf_err_handle(bmsString, bmsStringLength, "Background Media Scan");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_BACKGROUND_MEDIA_SCAN,
+                                                              false);
                             }
                             // bms-ps
                             if (backgroundControl[headerLength + 5] & BIT0)
                             {
-                                if (bmsPSString == M_NULLPTR)
-                                {
-                                    bmsPSStringLength = 50;
-                                    bmsPSString =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(bmsPSStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    bmsPSStringLength = 50;
-                                    char* temp        = M_REINTERPRET_CAST(
-                                        char*, safe_reallocf(M_REINTERPRET_CAST(void**, &bmsPSString),
-                                                                    bmsPSStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        bmsPSString = temp;
-                                        safe_memset(bmsPSString, bmsPSStringLength, 0, bmsPSStringLength);
-                                    }
-                                }
-                                if (bmsPSString != M_NULLPTR && bmsPSStringLength >= 50)
-                                {
-                                    snprintf_err_handle(bmsPSString, bmsPSStringLength, "Background Pre-Scan");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_BACKGROUND_PRE_SCAN,
+                                                              false);
                             }
                         }
                         if (SUCCESS == get_SCSI_Mode_Page(device, MPC_CURRENT_VALUES, pageCode, subPageCode, M_NULLPTR,
@@ -6805,68 +6649,16 @@ static eReturnValues get_SCSI_Mode_Data(tDevice*                    device,
                             // bms
                             if (backgroundControl[headerLength + 4] & BIT0)
                             {
-                                if (bmsString == M_NULLPTR)
-                                {
-                                    bmsStringLength = 50;
-                                    bmsString = M_REINTERPRET_CAST(char*, safe_calloc(bmsStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    bmsStringLength = 50;
-                                    char* temp =
-                                        M_REINTERPRET_CAST(char*, safe_reallocf(M_REINTERPRET_CAST(void**, &bmsString),
-                                                                                bmsStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        bmsString = temp;
-                                        safe_memset(bmsString, bmsStringLength, 0, bmsStringLength);
-                                    }
-                                }
-                                if (bmsString != M_NULLPTR && bmsStringLength >= 50)
-                                {
-                                    snprintf_err_handle(bmsString, bmsStringLength, "Background Media Scan [Enabled]");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_BACKGROUND_MEDIA_SCAN,
+                                                              true);
                             }
                             // bms-ps
                             if (backgroundControl[headerLength + 5] & BIT0)
                             {
-                                if (bmsPSString == M_NULLPTR)
-                                {
-                                    bmsPSStringLength = 50;
-                                    bmsPSString =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(bmsPSStringLength, sizeof(char)));
-                                }
-                                else
-                                {
-                                    bmsPSStringLength = 50;
-                                    char* temp        = M_REINTERPRET_CAST(
-                                        char*, safe_reallocf(M_REINTERPRET_CAST(void**, &bmsPSString),
-                                                                    bmsPSStringLength * sizeof(char)));
-                                    if (temp != M_NULLPTR)
-                                    {
-                                        bmsPSString = temp;
-                                        safe_memset(bmsPSString, bmsPSStringLength, 0, bmsPSStringLength);
-                                    }
-                                }
-                                if (bmsPSString != M_NULLPTR && bmsPSStringLength >= 50)
-                                {
-                                    snprintf_err_handle(bmsPSString, bmsPSStringLength,
-                                                        "Background Pre-Scan [Enabled]");
-                                }
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_BACKGROUND_PRE_SCAN,
+                                                              true);
                             }
                         }
-                        if (bmsString != M_NULLPTR)
-                        {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, bmsString);
-                            safe_free(&bmsString);
-                        }
-                        if (bmsPSString != M_NULLPTR)
-                        {
-                            add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                          &driveInfo->numberOfFeaturesSupported, bmsPSString);
-                            safe_free(&bmsPSString);
-                        }
                     }
                     break;
                     default:
@@ -6948,29 +6740,26 @@ static eReturnValues get_SCSI_Diagnostic_Data(tDevice*                    device
                             {
                                 // Add more diagnostic pages in here if we want to check them for supported features.
                             case DIAG_PAGE_TRANSLATE_ADDRESS:
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported,
-                                                              "Translate Address");
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_TRANSLATE_ADDRESS,
+                                                              false);
                                 break;
                             case DIAG_PAGE_REBUILD_ASSIST:
-                                add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                              &driveInfo->numberOfFeaturesSupported, "Rebuild Assist");
+                                add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_REBUILD_ASSIST,
+                                                              false);
                                 break;
                             case 0x90:
                                 if (is_Seagate_Family(device) == SEAGATE)
                                 {
-                                    add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                                  &driveInfo->numberOfFeaturesSupported,
-                                                                  "Seagate Remanufacture");
+                                    add_Feature_To_Supported_List(&driveInfo->features,
+                                                                  DRIVE_FEATURE_SEAGATE_REMANUFACTURE, false);
                                     break;
                                 }
                                 break;
                             case 0x98:
                                 if (is_Seagate_Family(device) == SEAGATE)
                                 {
-                                    add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                                  &driveInfo->numberOfFeaturesSupported,
-                                                                  "Seagate In Drive Diagnostics (IDD)");
+                                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SEAGATE_IDD,
+                                                                  false);
                                     break;
                                 }
                                 break;
@@ -7046,20 +6835,16 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
                 {
                     if (!driveInfo->isFormatCorrupt)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Format Corrupt - not all features identifiable.");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FORMAT_CORRUPT, false);
                     }
                 }
                 if (formatSupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Format Unit");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FORMAT_UNIT, false);
                 }
                 if (fastFormatSupported)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Fast Format");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FAST_FORMAT, false);
                 }
 
                 safe_memset(&supportedOpRequest, sizeof(scsiOperationCodeInfoRequest), 0,
@@ -7069,8 +6854,7 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
                 eSCSICmdSupport formatPresetSupported = is_SCSI_Operation_Code_Supported(device, &supportedOpRequest);
                 if (formatPresetSupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Format With Preset");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_FORMAT_WITH_PRESET, false);
                 }
 
                 safe_memset(&supportedOpRequest, sizeof(scsiOperationCodeInfoRequest), 0,
@@ -7088,8 +6872,7 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
                     sanitizeBlockSupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD ||
                     sanitizeCryptoSupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Sanitize");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SANITIZE, false);
                 }
 
                 safe_memset(&supportedOpRequest, sizeof(scsiOperationCodeInfoRequest), 0,
@@ -7117,22 +6900,20 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
                 {
                     if (restoreElementsSupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Storage Element Depopulation + Restore");
+                        add_Feature_To_Supported_List(&driveInfo->features,
+                                                      DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION_RESTORE, false);
                     }
                     else
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Storage Element Depopulation");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION,
+                                                      false);
                     }
                 }
                 // Add checking that this is zbd first?
                 if (removeAndModifySupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "Remove Element and Modify Zones");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_REMOVE_ELEMENT_AND_MODIFY_ZONES,
+                                                  false);
                 }
                 if (scsiInfo->zoneDomainsOrRealms &&
                     scsiInfo->peripheralDeviceType == PERIPHERAL_HOST_MANAGED_ZONED_BLOCK_DEVICE)
@@ -7146,15 +6927,13 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
                         is_SCSI_Operation_Code_Supported(device, &supportedOpRequest);
                     if (zoneDomainsSupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "Zone Domains");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ZONE_DOMAINS, false);
                     }
                     supportedOpRequest.serviceAction    = 0x06;
                     eSCSICmdSupport zoneRealmsSupported = is_SCSI_Operation_Code_Supported(device, &supportedOpRequest);
                     if (zoneRealmsSupported == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "Zone Realms");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ZONE_REALMS, false);
                     }
                 }
 
@@ -7204,15 +6983,13 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
                 {
                     // TODO: make sure this isn't the "blank" command being supported by a MMC device.
                     //       do this by checking the cmdsupport bits in the CDB
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "ATA Pass-Through 12");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_12, false);
                 }
                 supportedOpRequest.operationCode = ATA_PASS_THROUGH_16;
                 eSCSICmdSupport ataPT16          = is_SCSI_Operation_Code_Supported(device, &supportedOpRequest);
                 if (ataPT16 == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "ATA Pass-Through 16");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_16, false);
                 }
                 supportedOpRequest.operationCode      = 0x7F;
                 supportedOpRequest.serviceActionValid = true;
@@ -7220,8 +6997,7 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
                 eSCSICmdSupport ataPT32               = is_SCSI_Operation_Code_Supported(device, &supportedOpRequest);
                 if (ataPT32 == SCSI_CMD_SUPPORT_SUPPORTED_TO_SCSI_STANDARD)
                 {
-                    add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                                  "ATA Pass-Through 32");
+                    add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_32, false);
                 }
             }
         }
@@ -7229,7 +7005,10 @@ static eReturnValues get_SCSI_Report_Op_Codes_Data(tDevice*                    d
     return ret;
 }
 
-eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS_SATA driveInfo)
+eReturnValues get_SCSI_Drive_Information_Fields(tDevice*                    device,
+                                                ptrLogPageCache             logCache,
+                                                ptrDriveInformationSAS_SATA driveInfo,
+                                                uint32_t                    fieldMask)
 {
     eReturnValues ret = SUCCESS;
     DISABLE_NONNULL_COMPARE
@@ -7241,6 +7020,7 @@ eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS
     safe_memset(driveInfo, sizeof(driveInformationSAS_SATA), 0, sizeof(driveInformationSAS_SATA));
     scsiIdentifyInfo scsiInfo;
     safe_memset(&scsiInfo, sizeof(scsiIdentifyInfo), 0, sizeof(scsiIdentifyInfo));
+    scsiInfo.fieldMask = fieldMask;
     // start with standard inquiry data
     uint8_t* inquiryData =
         M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(255, sizeof(uint8_t), device->os_info.minimumAlignment));
@@ -7256,7 +7036,8 @@ eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS
                 sizeof(adapterInfo));
 
     // TODO: add checking peripheral device type as well to make sure it's only direct access and zoned block devices?
-    if ((device->drive_info.interface_type == SCSI_INTERFACE || device->drive_info.interface_type == RAID_INTERFACE) &&
+    if ((fieldMask & DRIVE_INFO_FIELD_FEATURES) &&
+        (device->drive_info.interface_type == SCSI_INTERFACE || device->drive_info.interface_type == RAID_INTERFACE) &&
         (device->drive_info.drive_type != ATA_DRIVE && device->drive_info.drive_type != NVME_DRIVE))
     {
         // send report luns to see how many luns are attached. This SHOULD be the way to detect multi-actuator drives
@@ -7266,11 +7047,18 @@ eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS
         driveInfo->lunCount = get_LUN_Count(device);
     }
 
-    get_SCSI_VPD_Data(device, driveInfo, &scsiInfo);
+    if (fieldMask & (DRIVE_INFO_FIELD_IDENTITY | DRIVE_INFO_FIELD_CAPACITY | DRIVE_INFO_FIELD_FEATURES))
+    {
+        get_SCSI_VPD_Data(device, driveInfo, &scsiInfo);
+    }
 
-    get_SCSI_Read_Capacity_Data(device, driveInfo, &scsiInfo);
+    // sector size is also used to convert LBAs read/written to bytes
+    if (fieldMask & (DRIVE_INFO_FIELD_CAPACITY | DRIVE_INFO_FIELD_FEATURES | DRIVE_INFO_FIELD_HEALTH))
+    {
+        get_SCSI_Read_Capacity_Data(device, driveInfo, &scsiInfo);
+    }
 
-    if (scsiInfo.version >= 6 &&
+    if ((fieldMask & DRIVE_INFO_FIELD_FEATURES) && scsiInfo.version >= 6 &&
         (device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported ||
          SUCCESS == scsi_SecurityProtocol_In(device, SECURITY_PROTOCOL_INFORMATION, 0, false, 0,
                                              M_NULLPTR))) // security protocol commands introduced in SPC4. TODO: may
@@ -7291,80 +7079,65 @@ eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS
                     if (driveInfo->securityInfo.tcg)
                     {
                         driveInfo->encryptionSupport = ENCRYPTION_SELF_ENCRYPTING;
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "TCG");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_TCG, false);
                     }
                     if (driveInfo->securityInfo.cbcs)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "CbCS");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_CBCS, false);
                     }
                     if (driveInfo->securityInfo.tapeEncryption)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "Tape Encryption");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_TAPE_ENCRYPTION, false);
                     }
                     if (driveInfo->securityInfo.dataEncryptionConfig)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "Data Encryption Configuration");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DATA_ENCRYPTION_CONFIGURATION,
+                                                      false);
                     }
                     if (driveInfo->securityInfo.saCreationCapabilities)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported,
-                                                      "SA Creation Capabilities");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SA_CREATION_CAPABILITIES,
+                                                      false);
                     }
                     if (driveInfo->securityInfo.ikev2scsi)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "IKE V2 SCSI");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_IKE_V2_SCSI, false);
                     }
                     if (driveInfo->securityInfo.sdAssociation)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "SD Association");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SD_ASSOCIATION, false);
                     }
                     if (driveInfo->securityInfo.dmtfSecurity)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "DMTF Security");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_DMTF_SECURITY, false);
                     }
                     if (driveInfo->securityInfo.nvmeReserved)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "NVMe Reserved");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_NVME_RESERVED, false);
                     }
                     if (driveInfo->securityInfo.nvme)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "NVMe RPMB");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_NVME_RPMB, false);
                     }
                     if (driveInfo->securityInfo.scsa)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "SCSA");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SCSA, false);
                     }
                     if (driveInfo->securityInfo.jedecUFS)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "JEDEC UFS");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_JEDEC_UFS, false);
                     }
                     if (driveInfo->securityInfo.sdTrustedFlash)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "SD Trusted Flash");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_SD_TRUSTED_FLASH, false);
                     }
                     if (driveInfo->securityInfo.ieee1667)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "IEEE 1667");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_IEEE_1667, false);
                     }
                     if (driveInfo->securityInfo.ataDeviceServer)
                     {
-                        add_Feature_To_Supported_List(driveInfo->featuresSupported,
-                                                      &driveInfo->numberOfFeaturesSupported, "ATA Security");
+                        add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_ATA_SECURITY, false);
                         safe_memcpy(&driveInfo->ataSecurityInformation, sizeof(ataSecurityStatus),
                                     &driveInfo->securityInfo.ataSecurityInfo, sizeof(ataSecurityStatus));
                     }
@@ -7375,19 +7148,24 @@ eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS
     }
     driveInfo->percentEnduranceUsed = -1; // set to this to filter out later
 
-    if (scsiInfo.version == 2)
+    if ((fieldMask & DRIVE_INFO_FIELD_FEATURES) && scsiInfo.version == 2)
     {
         // Check for persistent reservation support
         if (SUCCESS == scsi_Persistent_Reserve_In(device, SCSI_PERSISTENT_RESERVE_IN_READ_KEYS, 0, M_NULLPTR))
         {
-            add_Feature_To_Supported_List(driveInfo->featuresSupported, &driveInfo->numberOfFeaturesSupported,
-                                          "Persistent Reservations");
+            add_Feature_To_Supported_List(&driveInfo->features, DRIVE_FEATURE_PERSISTENT_RESERVATIONS, false);
         }
     }
 
-    get_SCSI_Log_Data(device, driveInfo, &scsiInfo);
+    if (fieldMask & DRIVE_INFO_FIELD_HEALTH)
+    {
+        get_SCSI_Log_Data(device, logCache, driveInfo, &scsiInfo);
+    }
 
-    get_SCSI_Mode_Data(device, driveInfo, &scsiInfo);
+    if (fieldMask & (DRIVE_INFO_FIELD_FEATURES | DRIVE_INFO_FIELD_SETTINGS))
+    {
+        get_SCSI_Mode_Data(device, driveInfo, &scsiInfo);
+    }
 
     if (!driveInfo->interfaceSpeedInfo.speedIsValid)
     {
@@ -7412,20 +7190,29 @@ eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS
         }
     }
 
-    get_SCSI_Diagnostic_Data(device, driveInfo, &scsiInfo);
+    if (fieldMask & DRIVE_INFO_FIELD_FEATURES)
+    {
+        get_SCSI_Diagnostic_Data(device, driveInfo, &scsiInfo);
 
-    get_SCSI_Report_Op_Codes_Data(device, driveInfo, &scsiInfo);
+        get_SCSI_Report_Op_Codes_Data(device, driveInfo, &scsiInfo);
+    }
 
     driveInfo->lowCurrentSpinupValid = false;
     return ret;
 }
 
+eReturnValues get_SCSI_Drive_Information(tDevice* device, ptrDriveInformationSAS_SATA driveInfo)
+{
+    return get_SCSI_Drive_Information_Fields(device, M_NULLPTR, driveInfo, DRIVE_INFO_FIELD_ALL);
+}
+
 // currently using the bitfields in here, other commands are sometimes run to read additional information
 // may need to reorganize more in the future to eliminate needing to pass in tDevice -TJE
 static eReturnValues get_NVMe_Controller_Identify_Data(tDevice*                device,
                                                        ptrDriveInformationNVMe driveInfo,
                                                        uint8_t*                nvmeIdentifyData,
-                                                       uint32_t                identifyDataLength)
+                                                       uint32_t                identifyDataLength,
+                                                       uint32_t                fieldMask)
 {
     eReturnValues ret = SUCCESS;
     if (!device || !driveInfo || !nvmeIdentifyData || identifyDataLength != NVME_IDENTIFY_DATA_LEN)
@@ -7466,7 +7253,10 @@ static eReturnValues get_NVMe_Controller_Identify_Data(tDevice*                d
     if (nvmeIdentifyData[96] & BIT0)
     {
         driveInfo->controllerData.hostIdentifierSupported = true;
-        // host identifier is supported
+    }
+    if ((fieldMask & (DRIVE_INFO_FIELD_FEATURES | DRIVE_INFO_FIELD_SETTINGS)) &&
+        driveInfo->controllerData.hostIdentifierSupported)
+    {
         nvmeFeaturesCmdOpt getHostIdentifier;
         safe_memset(&getHostIdentifier, sizeof(nvmeFeaturesCmdOpt), 0, sizeof(nvmeFeaturesCmdOpt));
         getHostIdentifier.fid = 0x81;
@@ -7521,7 +7311,7 @@ static eReturnValues get_NVMe_Controller_Identify_Data(tDevice*                d
     driveInfo->controllerData.unallocatedNVMCapacityD =
         convert_128bit_to_double(&driveInfo->controllerData.unallocatedNVMCapacity[0]);
     // DST info
-    if (nvmeIdentifyData[256] & BIT4) // DST command is supported
+    if ((fieldMask & DRIVE_INFO_FIELD_HEALTH) && (nvmeIdentifyData[256] & BIT4)) // DST command is supported
     {
         // set Long DST Time before reading the log
         driveInfo->controllerData.longDSTTimeMinutes =
@@ -7566,14 +7356,13 @@ static eReturnValues get_NVMe_Controller_Identify_Data(tDevice*                d
     // Sanitize
     if (nvmeIdentifyData[328] & BIT0) // Sanitize supported
     {
-        add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                      &driveInfo->controllerData.numberOfControllerFeatures, "Sanitize");
+        add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_SANITIZE, false);
     }
     // max namespaces
     driveInfo->controllerData.maxNumberOfNamespaces =
         M_BytesTo4ByteValue(nvmeIdentifyData[519], nvmeIdentifyData[518], nvmeIdentifyData[517], nvmeIdentifyData[516]);
     // volatile write cache
-    if (nvmeIdentifyData[525] & BIT0)
+    if ((fieldMask & (DRIVE_INFO_FIELD_FEATURES | DRIVE_INFO_FIELD_SETTINGS)) && (nvmeIdentifyData[525] & BIT0))
     {
         driveInfo->controllerData.volatileWriteCacheSupported = true;
         nvmeFeaturesCmdOpt getWriteCache;
@@ -7602,7 +7391,7 @@ static eReturnValues get_NVMe_Controller_Identify_Data(tDevice*                d
     // firmware slots
     driveInfo->controllerData.numberOfFirmwareSlots = get_bit_range_uint8(nvmeIdentifyData[260], 3, 1);
     // Add in other controller "Features" as needed
-    if (nvmeIdentifyData[256] & BIT0)
+    if ((fieldMask & DRIVE_INFO_FIELD_FEATURES) && (nvmeIdentifyData[256] & BIT0))
     {
         // Supports security send/receive. Check for TCG and other security protocols
         DECLARE_ZERO_INIT_ARRAY(uint8_t, supportedSecurityProtocols, LEGACY_DRIVE_SEC_SIZE);
@@ -7615,86 +7404,72 @@ static eReturnValues get_NVMe_Controller_Identify_Data(tDevice*                d
                 if (driveInfo->securityInfo.tcg)
                 {
                     driveInfo->controllerData.encryptionSupport = ENCRYPTION_SELF_ENCRYPTING;
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures, "TCG");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_TCG, false);
                 }
                 if (driveInfo->securityInfo.cbcs)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures, "CbCS");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_CBCS, false);
                 }
                 if (driveInfo->securityInfo.tapeEncryption)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "Tape Encryption");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_TAPE_ENCRYPTION,
+                                                  false);
                 }
                 if (driveInfo->securityInfo.dataEncryptionConfig)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "Data Encryption Configuration");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features,
+                                                  DRIVE_FEATURE_DATA_ENCRYPTION_CONFIGURATION, false);
                 }
                 if (driveInfo->securityInfo.saCreationCapabilities)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "SA Creation Capabilities");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features,
+                                                  DRIVE_FEATURE_SA_CREATION_CAPABILITIES, false);
                 }
                 if (driveInfo->securityInfo.ikev2scsi)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures, "IKE V2 SCSI");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_IKE_V2_SCSI,
+                                                  false);
                 }
                 if (driveInfo->securityInfo.sdAssociation)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "SD Association");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_SD_ASSOCIATION,
+                                                  false);
                 }
                 if (driveInfo->securityInfo.dmtfSecurity)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "DMTF Security");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_DMTF_SECURITY,
+                                                  false);
                 }
                 if (driveInfo->securityInfo.nvmeReserved)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "NVMe Reserved");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_NVME_RESERVED,
+                                                  false);
                 }
                 if (driveInfo->securityInfo.nvme)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures, "NVMe RPMB");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_NVME_RPMB, false);
                 }
                 if (driveInfo->securityInfo.scsa)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures, "SCSA");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_SCSA, false);
                 }
                 if (driveInfo->securityInfo.jedecUFS)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures, "JEDEC UFS");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_JEDEC_UFS, false);
                 }
                 if (driveInfo->securityInfo.sdTrustedFlash)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "SD Trusted Flash");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_SD_TRUSTED_FLASH,
+                                                  false);
                 }
                 if (driveInfo->securityInfo.ieee1667)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures, "IEEE 1667");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_IEEE_1667, false);
                 }
                 if (driveInfo->securityInfo.ataDeviceServer)
                 {
-                    add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                                  &driveInfo->controllerData.numberOfControllerFeatures,
-                                                  "ATA Security");
+                    add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_ATA_SECURITY,
+                                                  false);
                 }
             }
         }
@@ -7708,56 +7483,46 @@ static eReturnValues get_NVMe_Controller_Identify_Data(tDevice*                d
     }
     if (nvmeIdentifyData[256] & BIT1)
     {
-        add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                      &driveInfo->controllerData.numberOfControllerFeatures, "Format NVM");
+        add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_FORMAT_NVM, false);
     }
     if (nvmeIdentifyData[256] & BIT2)
     {
-        add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                      &driveInfo->controllerData.numberOfControllerFeatures, "Firmware Update");
+        add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_FIRMWARE_UPDATE, false);
     }
     if (nvmeIdentifyData[256] & BIT3)
     {
-        add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                      &driveInfo->controllerData.numberOfControllerFeatures, "Namespace Management");
+        add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_NAMESPACE_MANAGEMENT, false);
     }
     if (nvmeIdentifyData[256] & BIT4)
     {
-        add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                      &driveInfo->controllerData.numberOfControllerFeatures, "Device Self Test");
+        add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_DEVICE_SELF_TEST, false);
     }
     if (nvmeIdentifyData[256] & BIT7)
     {
-        add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                      &driveInfo->controllerData.numberOfControllerFeatures,
-                                      "Virtualization Management");
+        add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_VIRTUALIZATION_MANAGEMENT,
+                                      false);
     }
     if (nvmeIdentifyData[257] & BIT1)
     {
-        add_Feature_To_Supported_List(driveInfo->controllerData.controllerFeaturesSupported,
-                                      &driveInfo->controllerData.numberOfControllerFeatures, "Doorbell Buffer Config");
+        add_Feature_To_Supported_List(&driveInfo->controllerData.features, DRIVE_FEATURE_DOORBELL_BUFFER_CONFIG, false);
     }
 
     // Before we memset the identify data, add some namespace features
     if (nvmeIdentifyData[520] & BIT1)
     {
-        add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                      &driveInfo->namespaceData.numberOfNamespaceFeatures, "Write Uncorrectable");
+        add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_WRITE_UNCORRECTABLE, false);
     }
     if (nvmeIdentifyData[520] & BIT2)
     {
-        add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                      &driveInfo->namespaceData.numberOfNamespaceFeatures, "Dataset Management");
+        add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_DATASET_MANAGEMENT, false);
     }
     if (nvmeIdentifyData[520] & BIT3)
     {
-        add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                      &driveInfo->namespaceData.numberOfNamespaceFeatures, "Write Zeros");
+        add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_WRITE_ZEROS, false);
     }
     if (nvmeIdentifyData[520] & BIT5)
     {
-        add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                      &driveInfo->namespaceData.numberOfNamespaceFeatures, "Persistent Reservations");
+        add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_PERSISTENT_RESERVATIONS, false);
     }
     return ret;
 }
@@ -7830,48 +7595,38 @@ static eReturnValues get_NVMe_Namespace_Identify_Data(ptrDriveInformationNVMe dr
     {
         if (protectionEnabled == 1)
         {
-            add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                          &driveInfo->namespaceData.numberOfNamespaceFeatures,
-                                          "Protection Type 1 [Enabled]");
+            add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_PROTECTION_TYPE_1, true);
         }
         else
         {
-            add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                          &driveInfo->namespaceData.numberOfNamespaceFeatures, "Protection Type 1");
+            add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_PROTECTION_TYPE_1, false);
         }
     }
     if (nvmeIdentifyData[28] & BIT1)
     {
         if (protectionEnabled == 2)
         {
-            add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                          &driveInfo->namespaceData.numberOfNamespaceFeatures,
-                                          "Protection Type 2 [Enabled]");
+            add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_PROTECTION_TYPE_2, true);
         }
         else
         {
-            add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                          &driveInfo->namespaceData.numberOfNamespaceFeatures, "Protection Type 2");
+            add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_PROTECTION_TYPE_2, false);
         }
     }
     if (nvmeIdentifyData[28] & BIT2)
     {
         if (protectionEnabled == 3)
         {
-            add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                          &driveInfo->namespaceData.numberOfNamespaceFeatures,
-                                          "Protection Type 3 [Enabled]");
+            add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_PROTECTION_TYPE_3, true);
         }
         else
         {
-            add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                          &driveInfo->namespaceData.numberOfNamespaceFeatures, "Protection Type 3");
+            add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_PROTECTION_TYPE_3, false);
         }
     }
     if (nvmeIdentifyData[30] & BIT0)
     {
-        add_Feature_To_Supported_List(driveInfo->namespaceData.namespaceFeaturesSupported,
-                                      &driveInfo->namespaceData.numberOfNamespaceFeatures, "Namespace Sharing");
+        add_Feature_To_Supported_List(&driveInfo->namespaceData.features, DRIVE_FEATURE_NAMESPACE_SHARING, false);
     }
     return ret;
 }
@@ -7929,7 +7684,9 @@ static eReturnValues get_NVMe_Log_Data(tDevice* device, ptrDriveInformationNVMe
     return ret;
 }
 
-eReturnValues get_NVMe_Drive_Information(tDevice* device, ptrDriveInformationNVMe driveInfo)
+eReturnValues get_NVMe_Drive_Information_Fields(tDevice*                device,
+                                                ptrDriveInformationNVMe driveInfo,
+                                                uint32_t                fieldMask)
 {
     eReturnValues ret = NOT_SUPPORTED;
     DISABLE_NONNULL_COMPARE
@@ -7949,18 +7706,30 @@ eReturnValues get_NVMe_Drive_Information(tDevice* device, ptrDriveInformationNVM
     }
     if (SUCCESS == nvme_Identify(device, nvmeIdentifyData, 0, NVME_IDENTIFY_CTRL))
     {
-        get_NVMe_Controller_Identify_Data(device, driveInfo, nvmeIdentifyData, NVME_IDENTIFY_DATA_LEN);
+        get_NVMe_Controller_Identify_Data(device, driveInfo, nvmeIdentifyData, NVME_IDENTIFY_DATA_LEN, fieldMask);
     }
-    safe_memset(nvmeIdentifyData, NVME_IDENTIFY_DATA_LEN, 0, NVME_IDENTIFY_DATA_LEN);
-    if (SUCCESS == nvme_Identify(device, nvmeIdentifyData, device->drive_info.namespaceID, NVME_IDENTIFY_NS))
+    // namespace identify has the capacity and the EUI64/NGUID identifiers
+    if (fieldMask & (DRIVE_INFO_FIELD_IDENTITY | DRIVE_INFO_FIELD_CAPACITY | DRIVE_INFO_FIELD_FEATURES))
     {
-        get_NVMe_Namespace_Identify_Data(driveInfo, nvmeIdentifyData, NVME_IDENTIFY_DATA_LEN);
+        safe_memset(nvmeIdentifyData, NVME_IDENTIFY_DATA_LEN, 0, NVME_IDENTIFY_DATA_LEN);
+        if (SUCCESS == nvme_Identify(device, nvmeIdentifyData, device->drive_info.namespaceID, NVME_IDENTIFY_NS))
+        {
+            get_NVMe_Namespace_Identify_Data(driveInfo, nvmeIdentifyData, NVME_IDENTIFY_DATA_LEN);
+        }
     }
     safe_free_aligned(&nvmeIdentifyData);
-    get_NVMe_Log_Data(device, driveInfo);
+    if (fieldMask & DRIVE_INFO_FIELD_HEALTH)
+    {
+        get_NVMe_Log_Data(device, driveInfo);
+    }
     return ret;
 }
 
+eReturnValues get_NVMe_Drive_Information(tDevice* device, ptrDriveInformationNVMe driveInfo)
+{
+    return get_NVMe_Drive_Information_Fields(device, driveInfo, DRIVE_INFO_FIELD_ALL);
+}
+
 // This is for use with ATA or SCSI drives where we only want to show the applicable information for each drive type.
 // NOT RECOMMENDED ON EXTERNAL USB/IEEE1394 PRODUCTS!
 void print_Device_Information(ptrDriveInformation driveInfo)
@@ -8224,11 +7993,7 @@ void print_NVMe_Device_Information(ptrDriveInformationNVMe driveInfo)
     printf("\tNumber of Firmware Slots: %" PRIu8 "\n", driveInfo->controllerData.numberOfFirmwareSlots);
     // Print out Controller features! (admin commands, etc)
     printf("\tController Features:\n");
-    for (uint16_t featureIter = UINT16_C(0); featureIter < driveInfo->controllerData.numberOfControllerFeatures;
-         ++featureIter)
-    {
-        printf("\t\t%s\n", driveInfo->controllerData.controllerFeaturesSupported[featureIter]);
-    }
+    print_Drive_Features(&driveInfo->controllerData.features, M_NULLPTR);
 
     printf("\nNVMe Namespace Information:\n");
     if (driveInfo->namespaceData.valid)
@@ -8330,11 +8095,7 @@ void print_NVMe_Device_Information(ptrDriveInformationNVMe driveInfo)
         }
         // Namespace features.
         printf("\tNamespace Features:\n");
-        for (uint16_t featureIter = UINT16_C(0); featureIter < driveInfo->namespaceData.numberOfNamespaceFeatures;
-             ++featureIter)
-        {
-            printf("\t\t%s\n", driveInfo->namespaceData.namespaceFeaturesSupported[featureIter]);
-        }
+        print_Drive_Features(&driveInfo->namespaceData.features, M_NULLPTR);
     }
     else
     {
@@ -9235,14 +8996,9 @@ void print_SAS_Sata_Device_Information(ptrDriveInformationSAS_SATA driveInfo)
     }
     // Features Supported
     printf("\tFeatures Supported:\n");
-    if (driveInfo->numberOfFeaturesSupported > 0)
+    if (get_Drive_Feature_Count(&driveInfo->features) > 0)
     {
-        uint8_t featuresIter = UINT8_C(0);
-        for (featuresIter = 0; featuresIter < driveInfo->numberOfFeaturesSupported && featuresIter < MAX_FEATURES;
-             featuresIter++)
-        {
-            printf("\t\t%s\n", driveInfo->featuresSupported[featuresIter]);
-        }
+        print_Drive_Features(&driveInfo->features, &driveInfo->featureDetails);
     }
     else
     {
@@ -9471,38 +9227,17 @@ void generate_External_NVMe_Drive_Information(ptrDriveInformationSAS_SATA extern
         ++(externalDriveInfo->numberOfSpecificationsSupported);
 
         // now copy over features such as sanitize and dst
-        // copy specifications supported into the external drive info.
-        uint16_t extFeatNumber  = externalDriveInfo->numberOfFeaturesSupported;
-        uint16_t nvmeFeatNumber = UINT16_C(0);
-        // controller features
-        for (;
-             extFeatNumber < MAX_FEATURES && nvmeFeatNumber < nvmeDriveInfo->controllerData.numberOfControllerFeatures;
-             ++extFeatNumber, ++nvmeFeatNumber)
+        add_Features_From_Set(&externalDriveInfo->features, &nvmeDriveInfo->controllerData.features);
+        if (is_Drive_Feature_Supported(&nvmeDriveInfo->controllerData.features, DRIVE_FEATURE_FIRMWARE_UPDATE))
         {
-            safe_memcpy(&externalDriveInfo->featuresSupported[extFeatNumber], MAX_FEATURE_LENGTH,
-                        &nvmeDriveInfo->controllerData.controllerFeaturesSupported[nvmeFeatNumber], MAX_FEATURE_LENGTH);
-            if (strcmp(nvmeDriveInfo->controllerData.controllerFeaturesSupported[nvmeFeatNumber], "Firmware Update") ==
-                0)
-            {
-                // this is not the best way to handle this, but will keep capabilities listed more consistent with NVMe
-                externalDriveInfo->fwdlSupport.downloadSupported = true;
-                externalDriveInfo->fwdlSupport.deferredSupported = true;
-            }
-            ++(externalDriveInfo->numberOfFeaturesSupported);
+            // this is not the best way to handle this, but will keep capabilities listed more consistent with NVMe
+            externalDriveInfo->fwdlSupport.downloadSupported = true;
+            externalDriveInfo->fwdlSupport.deferredSupported = true;
         }
         if (nvmeDriveInfo->namespaceData.valid)
         {
             // namespace features
-            nvmeFeatNumber = 0;
-            for (; extFeatNumber < MAX_FEATURES &&
-                   nvmeFeatNumber < nvmeDriveInfo->namespaceData.numberOfNamespaceFeatures;
-                 ++extFeatNumber, ++nvmeFeatNumber)
-            {
-                safe_memcpy(&externalDriveInfo->featuresSupported[extFeatNumber], MAX_FEATURE_LENGTH,
-                            &nvmeDriveInfo->namespaceData.namespaceFeaturesSupported[nvmeFeatNumber],
-                            MAX_FEATURE_LENGTH);
-                ++(externalDriveInfo->numberOfFeaturesSupported);
-            }
+            add_Features_From_Set(&externalDriveInfo->features, &nvmeDriveInfo->namespaceData.features);
         }
     }
     RESTORE_NONNULL_COMPARE
@@ -0,0 +1,410 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_info_cache.c
+// \brief This file defines the functions for keeping static drive information in an on-disk cache between runs.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "error_translation.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "secure_file.h"
+#include "string_utils.h"
+#include "type_conversion.h"
+
+#include "drive_info.h"
+#include "drive_info_cache.h"
+#include "operations.h"
+
+#define DRIVE_INFO_CACHE_SIGNATURE        "SEADRVIC"
+#define DRIVE_INFO_CACHE_SIGNATURE_LENGTH (8)
+#define DRIVE_INFO_CACHE_EXTENSION        ".dic"
+#define DRIVE_INFO_CACHE_VPD_LENGTH       UINT16_C(512)
+
+typedef enum eDriveInfoCacheTypeEnum
+{
+    DRIVE_INFO_CACHE_ATA,
+    DRIVE_INFO_CACHE_SCSI,
+    DRIVE_INFO_CACHE_NVME,
+} eDriveInfoCacheType;
+
+// Written at the start of each cache file, followed by the drive information structure.
+typedef struct s_driveInfoCacheHeader
+{
+    char     signature[DRIVE_INFO_CACHE_SIGNATURE_LENGTH];
+    uint16_t version;
+    uint16_t type;
+    uint32_t dataLength;
+    uint64_t fingerprint;
+    uint64_t worldWideName;
+    char     serialNumber[SERIAL_NUM_LEN + 1];
+    char     firmwareRevision[FW_REV_LEN + 1];
+} driveInfoCacheHeader;
+
+// FNV-1a. Only used to tell whether the identify data changed since the cache was written, so a fast
+// non-cryptographic hash is enough.
+static uint64_t fingerprint_Drive_Info_Data(uint64_t hash, const uint8_t* data, size_t dataLength)
+{
+    for (size_t iter = SIZE_T_C(0); iter < dataLength; ++iter)
+    {
+        hash ^= data[iter];
+        hash *= UINT64_C(0x100000001B3);
+    }
+    return hash;
+}
+
+static uint64_t get_Drive_Info_Cache_Fingerprint(tDevice* device, eDriveInfoCacheType type)
+{
+    uint64_t hash = UINT64_C(0xCBF29CE484222325);
+    switch (type)
+    {
+    case DRIVE_INFO_CACHE_ATA:
+        hash = fingerprint_Drive_Info_Data(hash, C_CAST(uint8_t*, &device->drive_info.IdentifyData.ata),
+                                           sizeof(device->drive_info.IdentifyData.ata));
+        break;
+    case DRIVE_INFO_CACHE_NVME:
+        hash = fingerprint_Drive_Info_Data(hash, C_CAST(uint8_t*, &device->drive_info.IdentifyData.nvme.ctrl),
+                                           sizeof(device->drive_info.IdentifyData.nvme.ctrl));
+        // the namespace has the capacity and the current LBA format, which change with a format or namespace resize
+        hash = fingerprint_Drive_Info_Data(hash, C_CAST(uint8_t*, &device->drive_info.IdentifyData.nvme.ns),
+                                           sizeof(device->drive_info.IdentifyData.nvme.ns));
+        break;
+    case DRIVE_INFO_CACHE_SCSI:
+    {
+        hash = fingerprint_Drive_Info_Data(hash, device->drive_info.scsiVpdData.inquiryData,
+                                           sizeof(device->drive_info.scsiVpdData.inquiryData));
+        // The device identification page has the target port identifiers, so a dual ported drive seen through its
+        // other port, which reports a different active port, does not use the cache written through the first one.
+        uint8_t* deviceIdentification =
+            M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(DRIVE_INFO_CACHE_VPD_LENGTH, sizeof(uint8_t),
+                                                             device->os_info.minimumAlignment));
+        if (deviceIdentification != M_NULLPTR)
+        {
+            if (SUCCESS == scsi_Inquiry(device, deviceIdentification, DRIVE_INFO_CACHE_VPD_LENGTH,
+                                        DEVICE_IDENTIFICATION, true, false))
+            {
+                uint16_t pageLength = M_BytesTo2ByteValue(deviceIdentification[2], deviceIdentification[3]) + 4;
+                hash                = fingerprint_Drive_Info_Data(hash, deviceIdentification,
+                                                                  M_Min(pageLength, DRIVE_INFO_CACHE_VPD_LENGTH));
+            }
+            safe_free_aligned(&deviceIdentification);
+        }
+        // Inquiry data does not change with a format or a capacity change, so read capacity is part of the
+        // fingerprint too. This covers the max LBA, block sizes and protection type.
+        readCapacityData readCapData;
+        safe_memset(&readCapData, sizeof(readCapacityData), 0, sizeof(readCapacityData));
+        if (SUCCESS == scsi_Read_Capacity_Cmd_Helper(device, &readCapData))
+        {
+            hash = fingerprint_Drive_Info_Data(hash, C_CAST(uint8_t*, &readCapData), sizeof(readCapacityData));
+        }
+    }
+    break;
+    }
+    return hash;
+}
+
+// Only letters, digits and dashes from the serial number and firmware revision go into the file name.
+static void copy_Drive_Info_Cache_Name_Part(char* namePart, size_t namePartLength, const char* value)
+{
+    snprintf_err_handle(namePart, namePartLength, "%s", value);
+    for (size_t iter = SIZE_T_C(0); iter < namePartLength && namePart[iter] != '\0'; ++iter)
+    {
+        char current = namePart[iter];
+        if (!((current >= '0' && current <= '9') || (current >= 'A' && current <= 'Z') ||
+              (current >= 'a' && current <= 'z') || current == '-'))
+        {
+            namePart[iter] = '_';
+        }
+    }
+}
+
+static bool set_Drive_Info_Cache_Key(tDevice*              device,
+                                     eDriveInfoCacheType   type,
+                                     const char*           cacheDirectory,
+                                     driveInfoCacheHeader* header,
+                                     char*                 fileName,
+                                     size_t                fileNameLength)
+{
+    static const char* cacheTypeNames[] = {"ata", "scsi", "nvme"};
+    DECLARE_ZERO_INIT_ARRAY(char, serialNumber, SERIAL_NUM_LEN + 1);
+    DECLARE_ZERO_INIT_ARRAY(char, firmwareRevision, FW_REV_LEN + 1);
+    if (safe_strlen(device->drive_info.serialNumber) == 0 && device->drive_info.worldWideName == UINT64_C(0))
+    {
+        // nothing to tell this drive apart from any other, so do not cache it
+        return false;
+    }
+    safe_memset(header, sizeof(driveInfoCacheHeader), 0, sizeof(driveInfoCacheHeader));
+    safe_memcpy(header->signature, DRIVE_INFO_CACHE_SIGNATURE_LENGTH, DRIVE_INFO_CACHE_SIGNATURE,
+                DRIVE_INFO_CACHE_SIGNATURE_LENGTH);
+    header->version       = DRIVE_INFO_CACHE_VERSION;
+    header->type          = C_CAST(uint16_t, type);
+    header->worldWideName = device->drive_info.worldWideName;
+    snprintf_err_handle(header->serialNumber, SERIAL_NUM_LEN + 1, "%s", device->drive_info.serialNumber);
+    snprintf_err_handle(header->firmwareRevision, FW_REV_LEN + 1, "%s", device->drive_info.product_revision);
+    copy_Drive_Info_Cache_Name_Part(serialNumber, SERIAL_NUM_LEN + 1, header->serialNumber);
+    copy_Drive_Info_Cache_Name_Part(firmwareRevision, FW_REV_LEN + 1, header->firmwareRevision);
+    snprintf_err_handle(fileName, fileNameLength, "%s%s%s_%016" PRIX64 "_%s_%s" DRIVE_INFO_CACHE_EXTENSION,
+                        cacheDirectory, SYSTEM_PATH_SEPARATOR_STR, cacheTypeNames[type], header->worldWideName,
+                        serialNumber, firmwareRevision);
+    return true;
+}
+
+static bool is_Drive_Info_Cache_Header_Match(const driveInfoCacheHeader* header, const driveInfoCacheHeader* expected)
+{
+    return memcmp(header->signature, expected->signature, DRIVE_INFO_CACHE_SIGNATURE_LENGTH) == 0 &&
+           header->version == expected->version && header->type == expected->type &&
+           header->dataLength == expected->dataLength && header->fingerprint == expected->fingerprint &&
+           header->worldWideName == expected->worldWideName &&
+           strncmp(header->serialNumber, expected->serialNumber, SERIAL_NUM_LEN + 1) == 0 &&
+           strncmp(header->firmwareRevision, expected->firmwareRevision, FW_REV_LEN + 1) == 0;
+}
+
+static bool load_Drive_Info_Cache(const char* fileName, const driveInfoCacheHeader* expected, void* driveInfo)
+{
+    bool            loaded    = false;
+    secureFileInfo* cacheFile = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (cacheFile == M_NULLPTR || cacheFile->error != SEC_FILE_SUCCESS)
+    {
+        // no cache file yet
+        free_Secure_File_Info(&cacheFile);
+        return false;
+    }
+    if (cacheFile->fileSize == sizeof(driveInfoCacheHeader) + uint32_to_sizet(expected->dataLength))
+    {
+        driveInfoCacheHeader header;
+        safe_memset(&header, sizeof(driveInfoCacheHeader), 0, sizeof(driveInfoCacheHeader));
+        if (SEC_FILE_SUCCESS == secure_Read_File(cacheFile, &header, sizeof(driveInfoCacheHeader),
+                                                 sizeof(driveInfoCacheHeader), 1, M_NULLPTR) &&
+            is_Drive_Info_Cache_Header_Match(&header, expected) &&
+            SEC_FILE_SUCCESS == secure_Read_File(cacheFile, driveInfo, uint32_to_sizet(expected->dataLength),
+                                                 sizeof(uint8_t), uint32_to_sizet(expected->dataLength), M_NULLPTR))
+        {
+            loaded = true;
+        }
+    }
+    secure_Close_File(cacheFile);
+    free_Secure_File_Info(&cacheFile);
+    return loaded;
+}
+
+static eReturnValues save_Drive_Info_Cache(const char*                 fileName,
+                                           const driveInfoCacheHeader* header,
+                                           const void*                 driveInfo)
+{
+    eReturnValues   ret       = SUCCESS;
+    secureFileInfo* cacheFile = secure_Open_File(fileName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (cacheFile == M_NULLPTR || cacheFile->error != SEC_FILE_SUCCESS)
+    {
+        ret = FILE_OPEN_ERROR;
+    }
+    else
+    {
+        if (SEC_FILE_SUCCESS != secure_Write_File(cacheFile, header, sizeof(driveInfoCacheHeader),
+                                                  sizeof(driveInfoCacheHeader), 1, M_NULLPTR) ||
+            SEC_FILE_SUCCESS != secure_Write_File(cacheFile, driveInfo, uint32_to_sizet(header->dataLength),
+                                                  sizeof(uint8_t), uint32_to_sizet(header->dataLength), M_NULLPTR) ||
+            SEC_FILE_SUCCESS != secure_Flush_File(cacheFile))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        if (SEC_FILE_SUCCESS != secure_Close_File(cacheFile))
+        {
+            printf("Error closing file!\n");
+        }
+    }
+    free_Secure_File_Info(&cacheFile);
+    return ret;
+}
+
+static eReturnValues read_Drive_Info_Fields(tDevice*            device,
+                                            eDriveInfoCacheType type,
+                                            void*               driveInfo,
+                                            uint32_t            fieldMask)
+{
+    switch (type)
+    {
+    case DRIVE_INFO_CACHE_ATA:
+        return get_ATA_Drive_Information_Fields(device, M_NULLPTR,
+                                                M_REINTERPRET_CAST(ptrDriveInformationSAS_SATA, driveInfo), fieldMask);
+    case DRIVE_INFO_CACHE_SCSI:
+        return get_SCSI_Drive_Information_Fields(device, M_NULLPTR,
+                                                 M_REINTERPRET_CAST(ptrDriveInformationSAS_SATA, driveInfo), fieldMask);
+    case DRIVE_INFO_CACHE_NVME:
+        return get_NVMe_Drive_Information_Fields(device, M_REINTERPRET_CAST(ptrDriveInformationNVMe, driveInfo),
+                                                 fieldMask);
+    }
+    return BAD_PARAMETER;
+}
+
+// Features the live read reports take their supported and enabled state from it. Everything else keeps what was
+// cached, since the live read only sent the commands for health and settings.
+static void merge_Live_Drive_Features(driveFeatureSet* features, const driveFeatureSet* liveFeatures)
+{
+    for (size_t iter = SIZE_T_C(0); iter < DRIVE_FEATURE_SET_WORDS; ++iter)
+    {
+        features->supported[iter] |= liveFeatures->supported[iter];
+        features->enabled[iter] = (features->enabled[iter] & ~liveFeatures->supported[iter]) |
+                                  (liveFeatures->enabled[iter] & liveFeatures->supported[iter]);
+    }
+}
+
+// Copies everything DRIVE_INFO_FIELD_HEALTH and DRIVE_INFO_FIELD_SETTINGS read from the live structure into the one
+// loaded from the cache.
+static void copy_Live_SAS_SATA_Information(ptrDriveInformationSAS_SATA     driveInfo,
+                                           const driveInformationSAS_SATA* liveInfo)
+{
+    driveInfo->temperatureData               = liveInfo->temperatureData;
+    driveInfo->humidityData                  = liveInfo->humidityData;
+    driveInfo->powerOnMinutesValid           = liveInfo->powerOnMinutesValid;
+    driveInfo->powerOnMinutes                = liveInfo->powerOnMinutes;
+    driveInfo->percentEnduranceUsed          = liveInfo->percentEnduranceUsed;
+    driveInfo->totalLBAsRead                 = liveInfo->totalLBAsRead;
+    driveInfo->totalLBAsWritten              = liveInfo->totalLBAsWritten;
+    driveInfo->totalWritesToFlash            = liveInfo->totalWritesToFlash;
+    driveInfo->totalBytesRead                = liveInfo->totalBytesRead;
+    driveInfo->totalBytesWritten             = liveInfo->totalBytesWritten;
+    driveInfo->deviceReportedUtilizationRate = liveInfo->deviceReportedUtilizationRate;
+    driveInfo->smartStatus                   = liveInfo->smartStatus;
+    driveInfo->dstInfo                       = liveInfo->dstInfo;
+    // the adapter can change when the drive is moved, even though the drive itself did not
+    safe_memcpy(&driveInfo->adapterInformation, sizeof(adapterInfo), &liveInfo->adapterInformation,
+                sizeof(adapterInfo));
+    // Settings. On SCSI these come from the mode pages (EPC, BMS, AWRE/ARRE, DLC, CDL, MRIE, caching, negotiated
+    // link rate). On ATA the identify data is part of the fingerprint, so only the identify device data log adds
+    // anything here. Each one is only copied when the live read got it.
+    merge_Live_Drive_Features(&driveInfo->features, &liveInfo->features);
+    if (is_Drive_Feature_Supported(&liveInfo->features, DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS))
+    {
+        driveInfo->featureDetails.informationalExceptionsMode = liveInfo->featureDetails.informationalExceptionsMode;
+    }
+    if (liveInfo->writeCacheSupported)
+    {
+        driveInfo->writeCacheEnabled = liveInfo->writeCacheEnabled;
+        driveInfo->nvCacheEnabled    = liveInfo->nvCacheEnabled;
+    }
+    if (liveInfo->readLookAheadSupported)
+    {
+        driveInfo->readLookAheadEnabled = liveInfo->readLookAheadEnabled;
+    }
+    if (liveInfo->interfaceSpeedInfo.speedIsValid)
+    {
+        driveInfo->interfaceSpeedInfo = liveInfo->interfaceSpeedInfo;
+    }
+    driveInfo->isWriteProtected = liveInfo->isWriteProtected;
+}
+
+static void copy_Live_NVMe_Information(ptrDriveInformationNVMe driveInfo, const driveInformationNVMe* liveInfo)
+{
+    safe_memcpy(&driveInfo->smartData, sizeof(driveInfo->smartData), &liveInfo->smartData,
+                sizeof(liveInfo->smartData));
+    driveInfo->dstInfo = liveInfo->dstInfo;
+    if (liveInfo->controllerData.volatileWriteCacheSupported)
+    {
+        driveInfo->controllerData.volatileWriteCacheEnabled = liveInfo->controllerData.volatileWriteCacheEnabled;
+    }
+    if (liveInfo->controllerData.hostIdentifierSupported)
+    {
+        driveInfo->controllerData.hostIdentifierIs128Bits = liveInfo->controllerData.hostIdentifierIs128Bits;
+        safe_memcpy(driveInfo->controllerData.hostIdentifier, 16, liveInfo->controllerData.hostIdentifier, 16);
+    }
+}
+
+static eReturnValues get_Drive_Information_Cached(tDevice*            device,
+                                                  eDriveInfoCacheType type,
+                                                  void*               driveInfo,
+                                                  uint32_t            driveInfoLength,
+                                                  const char*         cacheDirectory)
+{
+    eReturnValues        ret = SUCCESS;
+    driveInfoCacheHeader header;
+    DECLARE_ZERO_INIT_ARRAY(char, fileName, OPENSEA_PATH_MAX);
+    if (cacheDirectory == M_NULLPTR ||
+        !set_Drive_Info_Cache_Key(device, type, cacheDirectory, &header, fileName, OPENSEA_PATH_MAX))
+    {
+        return read_Drive_Info_Fields(device, type, driveInfo, DRIVE_INFO_FIELD_ALL);
+    }
+    header.dataLength  = driveInfoLength;
+    header.fingerprint = get_Drive_Info_Cache_Fingerprint(device, type);
+    if (load_Drive_Info_Cache(fileName, &header, driveInfo))
+    {
+        void* liveInfo = safe_calloc(uint32_to_sizet(driveInfoLength), sizeof(uint8_t));
+        if (liveInfo == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        ret = read_Drive_Info_Fields(device, type, liveInfo, DRIVE_INFO_FIELD_HEALTH | DRIVE_INFO_FIELD_SETTINGS);
+        if (type == DRIVE_INFO_CACHE_NVME)
+        {
+            copy_Live_NVMe_Information(M_REINTERPRET_CAST(ptrDriveInformationNVMe, driveInfo),
+                                       M_REINTERPRET_CAST(const driveInformationNVMe*, liveInfo));
+        }
+        else
+        {
+            copy_Live_SAS_SATA_Information(M_REINTERPRET_CAST(ptrDriveInformationSAS_SATA, driveInfo),
+                                           M_REINTERPRET_CAST(const driveInformationSAS_SATA*, liveInfo));
+        }
+        safe_free(&liveInfo);
+        return ret;
+    }
+    ret = read_Drive_Info_Fields(device, type, driveInfo, DRIVE_INFO_FIELD_ALL);
+    // only cache a complete read, otherwise whatever failed would be missing until the drive changes
+    if (ret == SUCCESS && SUCCESS != save_Drive_Info_Cache(fileName, &header, driveInfo) &&
+        VERBOSITY_DEFAULT < device->deviceVerbosity)
+    {
+        printf("Unable to write drive information cache file %s\n", fileName);
+    }
+    return ret;
+}
+
+eReturnValues get_ATA_Drive_Information_Cached(tDevice*                    device,
+                                               ptrDriveInformationSAS_SATA driveInfo,
+                                               const char*                 cacheDirectory)
+{
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || driveInfo == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    return get_Drive_Information_Cached(device, DRIVE_INFO_CACHE_ATA, driveInfo, sizeof(driveInformationSAS_SATA),
+                                        cacheDirectory);
+}
+
+eReturnValues get_SCSI_Drive_Information_Cached(tDevice*                    device,
+                                                ptrDriveInformationSAS_SATA driveInfo,
+                                                const char*                 cacheDirectory)
+{
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || driveInfo == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    return get_Drive_Information_Cached(device, DRIVE_INFO_CACHE_SCSI, driveInfo, sizeof(driveInformationSAS_SATA),
+                                        cacheDirectory);
+}
+
+eReturnValues get_NVMe_Drive_Information_Cached(tDevice*                device,
+                                                ptrDriveInformationNVMe driveInfo,
+                                                const char*             cacheDirectory)
+{
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || driveInfo == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    return get_Drive_Information_Cached(device, DRIVE_INFO_CACHE_NVME, driveInfo, sizeof(driveInformationNVMe),
+                                        cacheDirectory);
+}
@@ -1226,8 +1226,9 @@ eReturnValues get_Long_DST_Time(tDevice* device, uint8_t* hours, uint8_t* minute
             return MEMORY_FAILURE;
         }
         // read the control MP to get the long DST time, but it is reported in SECONDS here
-        if (SUCCESS == scsi_Mode_Sense_10(device, MP_CONTROL, MP_CONTROL_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true,
-                                          false, MPC_DEFAULT_VALUES, controlMP))
+        if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CONTROL,
+                                                 MP_CONTROL_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
+                                                 MPC_DEFAULT_VALUES, controlMP))
         {
             longDSTTime = M_BytesTo2ByteValue(controlMP[MODE_PARAMETER_HEADER_10_LEN + 10],
                                               controlMP[MODE_PARAMETER_HEADER_10_LEN + 11]);
@@ -1641,7 +1642,8 @@ static eReturnValues get_ATA_DST_Log_Entries(tDevice* device, ptrDstLogEntries e
     // used for compatibility purposes with drives that may have GPL, but not support the ext log...
     // device->drive_info.ata_Options.generalPurposeLoggingSupported = false;//for debugging SMART log version
     if (device->drive_info.ata_Options.generalPurposeLoggingSupported &&
-        SUCCESS == get_ATA_Log_Size(device, ATA_LOG_EXTENDED_SMART_SELF_TEST_LOG, &logSize, true, false) && logSize > 0)
+        SUCCESS == get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_EXTENDED_SMART_SELF_TEST_LOG, &logSize, true, false) &&
+        logSize > 0)
     {
         uint32_t extLogSize = logSize;
         selfTestResults     = M_REINTERPRET_CAST(
@@ -1845,7 +1847,8 @@ static eReturnValues get_ATA_DST_Log_Entries(tDevice* device, ptrDstLogEntries e
         }
     }
     else if (is_SMART_Enabled(device) && is_SMART_Error_Logging_Supported(device) &&
-             SUCCESS == get_ATA_Log_Size(device, ATA_LOG_SMART_SELF_TEST_LOG, &logSize, false, true) && logSize > 0)
+             SUCCESS == get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_SMART_SELF_TEST_LOG, &logSize, false, true) &&
+             logSize > 0)
     {
         selfTestResults = C_CAST(
             uint8_t*, safe_calloc_aligned(LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
@@ -2350,7 +2350,15 @@ static void sas_Read_FARM_Reliability_Info(uint8_t*                   ptrData,
 //       Unlike SATA, there is not as much padding or reserved bytes around to deal with.
 //       ASCII data may require special handling in both SAS and SATA FARM logs. These are mostly on page 1 (generic
 //       drive info)
-static farmLogData* sas_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, farmLogData* farmdata)
+#define FARM_PAGE_MASK(page) M_STATIC_CAST(uint8_t, UINT8_C(1) << (page))
+#define FARM_ALL_PAGES_MASK  UINT8_C(0x3F)
+
+// pageMask selects which of the farmLogData pages get filled in, one FARM_PAGE_MASK bit per eFarmPage.
+// Some reliability parameters also carry drive info and error fields, so those are decoded for any of the 3 pages.
+static farmLogData* sas_Read_FARM_Log_Pages(uint8_t*     ptrData,
+                                            uint32_t     dataLength,
+                                            farmLogData* farmdata,
+                                            uint8_t      pageMask)
 {
     DISABLE_NONNULL_COMPARE
     if (ptrData != M_NULLPTR && farmdata != M_NULLPTR)
@@ -2376,15 +2384,24 @@ static farmLogData* sas_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, far
                 switch (parameterCode)
                 {
                 case 0x0000: // header
-                    sas_Read_FARM_Header_Param(&ptrData[farmoffset], &farmdata->header);
+                    if (pageMask & FARM_PAGE_MASK(FARM_PAGE_HEADER))
+                    {
+                        sas_Read_FARM_Header_Param(&ptrData[farmoffset], &farmdata->header);
+                    }
                     break;
                 case 0x0001: // drive info
                 case 0x0006: // Drive info continued
-                    sas_Read_FARM_General_Drive_Info(&ptrData[farmoffset], &farmdata->driveinfo);
+                    if (pageMask & FARM_PAGE_MASK(FARM_PAGE_DRIVE_INFO))
+                    {
+                        sas_Read_FARM_General_Drive_Info(&ptrData[farmoffset], &farmdata->driveinfo);
+                    }
                     break;
                 case 0x0002: // Workload
                 case 0x0008: // workload continued
-                    sas_Read_FARM_Workload_Info(&ptrData[farmoffset], &farmdata->workload);
+                    if (pageMask & FARM_PAGE_MASK(FARM_PAGE_WORKLOAD))
+                    {
+                        sas_Read_FARM_Workload_Info(&ptrData[farmoffset], &farmdata->workload);
+                    }
                     break;
                 case 0x0003: // error
                 case 0x0028: // cumulative lifetime unrec read repeat by head (error)
@@ -2393,11 +2410,17 @@ static farmLogData* sas_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, far
                 case 0x0062: // actuator 1 realloc stats (error)
                 case 0x0107: // unique unrec read since last frame (error)
                 case 0x0108: // unique unrec read between N, N-1 frame (error)
-                    sas_Read_FARM_Error_Info(&ptrData[farmoffset], &farmdata->error);
+                    if (pageMask & FARM_PAGE_MASK(FARM_PAGE_ERROR_STATS))
+                    {
+                        sas_Read_FARM_Error_Info(&ptrData[farmoffset], &farmdata->error);
+                    }
                     break;
                 case 0x0004: // environment
                 case 0x0007: // environment continued
-                    sas_Read_FARM_Environment_Info(&ptrData[farmoffset], &farmdata->environment);
+                    if (pageMask & FARM_PAGE_MASK(FARM_PAGE_ENVIRONMENT_STATS))
+                    {
+                        sas_Read_FARM_Environment_Info(&ptrData[farmoffset], &farmdata->environment);
+                    }
                     break;
                 case 0x0005: // reliability
                 case 0x001A: // head resistance (reliability)
@@ -2418,8 +2441,13 @@ static farmLogData* sas_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, far
                 case 0x0060: // actuator 1 reli stats (reliability)
                 case 0x0061: // actuator 1 fled stats (reliability)
                 case 0x0100: // terabytes written by head (reliability)
-                    sas_Read_FARM_Reliability_Info(&ptrData[farmoffset], &farmdata->reliability, &farmdata->error,
-                                                   &farmdata->driveinfo);
+                    if (pageMask &
+                        (FARM_PAGE_MASK(FARM_PAGE_RELIABILITY_STATS) | FARM_PAGE_MASK(FARM_PAGE_ERROR_STATS) |
+                         FARM_PAGE_MASK(FARM_PAGE_DRIVE_INFO)))
+                    {
+                        sas_Read_FARM_Reliability_Info(&ptrData[farmoffset], &farmdata->reliability,
+                                                       &farmdata->error, &farmdata->driveinfo);
+                    }
                     break;
                 }
             }
@@ -2429,6 +2457,11 @@ static farmLogData* sas_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, far
     return farmdata;
 }
 
+static farmLogData* sas_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, farmLogData* farmdata)
+{
+    return sas_Read_FARM_Log_Pages(ptrData, dataLength, farmdata, FARM_ALL_PAGES_MASK);
+}
+
 static farmLogData* sata_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, farmLogData* farmdata)
 {
     DISABLE_NONNULL_COMPARE
@@ -2471,45 +2504,701 @@ static farmLogData* sata_Read_FARM_Log(uint8_t* ptrData, uint32_t dataLength, fa
     return farmdata;
 }
 
+// Reads the current FARM log into a new buffer. ATA reads all 6 pages, SAS reads the whole log page in one transfer.
+static eReturnValues read_Raw_FARM_Log(tDevice* device, uint8_t** rawFarmData, uint32_t* rawFarmDataLength)
+{
+    eReturnValues ret     = NOT_SUPPORTED;
+    uint32_t      datalen = UINT32_C(0);
+    *rawFarmData          = M_NULLPTR;
+    *rawFarmDataLength    = UINT32_C(0);
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        datalen = FARM_PAGE_LEN * (FARM_PAGE_RELIABILITY_STATS + 1); // 96KiB
+    }
+    else if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        datalen = UINT16_MAX; // reading FARM on SAS can be done in one 64k transfer
+    }
+    else
+    {
+        return NOT_SUPPORTED;
+    }
+    uint8_t* farmData =
+        M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(datalen, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (farmData == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        ret = get_ATA_Log(device, SEAGATE_ATA_LOG_FIELD_ACCESSIBLE_RELIABILITY_METRICS, M_NULLPTR, M_NULLPTR, true,
+                          false, true, farmData, datalen, M_NULLPTR, 0, 0);
+    }
+    else
+    {
+        ret = get_SCSI_Log(device, SEAGATE_LP_FARM, SEAGATE_FARM_SP_CURRENT, M_NULLPTR, M_NULLPTR, true, farmData,
+                           datalen, M_NULLPTR);
+    }
+    if (ret == SUCCESS)
+    {
+        *rawFarmData       = farmData;
+        *rawFarmDataLength = datalen;
+    }
+    else
+    {
+        safe_free_aligned(&farmData);
+    }
+    return ret;
+}
+
 // TODO: Option to select which FARM data between current, saved, factory
 eReturnValues read_FARM_Data(tDevice* device, farmLogData* farmdata)
 {
-    eReturnValues ret = NOT_SUPPORTED;
-    if (device->drive_info.drive_type == ATA_DRIVE)
+    uint8_t*      rawFarmData = M_NULLPTR;
+    uint32_t      datalen     = UINT32_C(0);
+    eReturnValues ret         = read_Raw_FARM_Log(device, &rawFarmData, &datalen);
+    if (ret == SUCCESS)
+    {
+        if (device->drive_info.drive_type == ATA_DRIVE)
+        {
+            sata_Read_FARM_Log(rawFarmData, datalen, farmdata);
+        }
+        else
+        {
+            sas_Read_FARM_Log(rawFarmData, datalen, farmdata);
+        }
+    }
+    safe_free_aligned(&rawFarmData);
+    return ret;
+}
+
+eReturnValues init_FARM_View(ptrFarmLogView      view,
+                             uint8_t*            rawFarmData,
+                             uint32_t            rawFarmDataLength,
+                             eFARMDriveInterface driveInterface)
+{
+    DISABLE_NONNULL_COMPARE
+    if (view == M_NULLPTR || rawFarmData == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(view, sizeof(farmLogView), 0, sizeof(farmLogView));
+    if (driveInterface == FARM_DRIVE_INTERFACE_SATA)
+    {
+        // the header page starts with the signature, which is all that is needed to trust the page layout
+        if (rawFarmDataLength < FARM_PAGE_LEN ||
+            get_Farm_Qword_Data(M_BytesTo8ByteValue(rawFarmData[7], rawFarmData[6], rawFarmData[5], rawFarmData[4],
+                                                    rawFarmData[3], rawFarmData[2], rawFarmData[1], rawFarmData[0])) !=
+                FARM_LOG_SIGNATURE_VAL_QWORD)
+        {
+            return FAILURE;
+        }
+    }
+    else
     {
-        uint32_t datalen     = FARM_PAGE_LEN * (FARM_PAGE_RELIABILITY_STATS + 1); // 96KiB
-        uint8_t* rawFarmData = M_REINTERPRET_CAST(
-            uint8_t*, safe_calloc_aligned(datalen, sizeof(uint8_t), device->os_info.minimumAlignment));
-        if (rawFarmData != M_NULLPTR)
+        if (rawFarmDataLength < LOG_PAGE_HEADER_LENGTH || get_bit_range_uint8(rawFarmData[0], 5, 0) != 0x3D ||
+            (rawFarmData[1] != 0x03 && rawFarmData[1] != 0x04))
         {
-            ret = get_ATA_Log(device, SEAGATE_ATA_LOG_FIELD_ACCESSIBLE_RELIABILITY_METRICS, M_NULLPTR, M_NULLPTR, true,
-                              false, true, rawFarmData, datalen, M_NULLPTR, 0, 0);
-            if (ret == SUCCESS)
+            return FAILURE;
+        }
+    }
+    view->driveInterface    = driveInterface;
+    view->rawFarmData       = rawFarmData;
+    view->rawFarmDataLength = rawFarmDataLength;
+    return SUCCESS;
+}
+
+eReturnValues read_FARM_View(tDevice* device, ptrFarmLogView view)
+{
+    uint8_t*      rawFarmData = M_NULLPTR;
+    uint32_t      datalen     = UINT32_C(0);
+    eReturnValues ret         = read_Raw_FARM_Log(device, &rawFarmData, &datalen);
+    if (ret == SUCCESS)
+    {
+        ret = init_FARM_View(view, rawFarmData, datalen,
+                             device->drive_info.drive_type == ATA_DRIVE ? FARM_DRIVE_INTERFACE_SATA
+                                                                        : FARM_DRIVE_INTERFACE_SAS);
+        if (ret == SUCCESS)
+        {
+            view->ownsRawFarmData = true;
+        }
+        else
+        {
+            safe_free_aligned(&rawFarmData);
+        }
+    }
+    return ret;
+}
+
+void free_FARM_View(ptrFarmLogView view)
+{
+    DISABLE_NONNULL_COMPARE
+    if (view == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (view->ownsRawFarmData)
+    {
+        safe_free_aligned(&view->rawFarmData);
+    }
+    safe_free_core(M_REINTERPRET_CAST(void**, &view->sasFarmData));
+    safe_memset(view, sizeof(farmLogView), 0, sizeof(farmLogView));
+}
+
+uint8_t get_FARM_View_Fields(ptrFarmLogView view,
+                             eFarmPage      page,
+                             size_t         fieldOffset,
+                             uint64_t*      values,
+                             uint8_t        numberOfFields)
+{
+    uint8_t fieldsRead = UINT8_C(0);
+    DISABLE_NONNULL_COMPARE
+    if (view == M_NULLPTR || values == M_NULLPTR || view->rawFarmData == M_NULLPTR || page < FARM_PAGE_HEADER ||
+        page > FARM_PAGE_RELIABILITY_STATS || fieldOffset % sizeof(uint64_t) != 0)
+    {
+        return fieldsRead;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (view->driveInterface == FARM_DRIVE_INTERFACE_SATA)
+    {
+        // The SATA pages are laid out exactly like the page structures, so only the requested qwords are converted.
+        size_t pageOffset = C_CAST(size_t, page) * FARM_PAGE_LEN;
+        for (; fieldsRead < numberOfFields; ++fieldsRead)
+        {
+            size_t offset = pageOffset + fieldOffset + (C_CAST(size_t, fieldsRead) * sizeof(uint64_t));
+            if (fieldOffset + ((C_CAST(size_t, fieldsRead) + 1) * sizeof(uint64_t)) > FARM_PAGE_LEN ||
+                offset + sizeof(uint64_t) > view->rawFarmDataLength)
             {
-                sata_Read_FARM_Log(rawFarmData, datalen, farmdata);
+                break;
             }
-            safe_free_aligned(&rawFarmData);
+            const uint8_t* qword = &view->rawFarmData[offset];
+            values[fieldsRead] =
+                M_BytesTo8ByteValue(qword[7], qword[6], qword[5], qword[4], qword[3], qword[2], qword[1], qword[0]);
         }
     }
-    else if (device->drive_info.drive_type == SCSI_DRIVE)
+    else
     {
-        uint32_t datalen     = UINT16_MAX; // reading FARM on SAS can be done in one 64k transfer
-        uint8_t* rawFarmData = M_REINTERPRET_CAST(
-            uint8_t*, safe_calloc_aligned(datalen, sizeof(uint8_t), device->os_info.minimumAlignment));
-        if (rawFarmData != M_NULLPTR)
+        // SAS parameters do not line up with the page structures, so decode only the page asked for, once.
+        if (!(view->decodedPages & FARM_PAGE_MASK(page)))
         {
-            ret = get_SCSI_Log(device, SEAGATE_LP_FARM, SEAGATE_FARM_SP_CURRENT, M_NULLPTR, M_NULLPTR, true,
-                               rawFarmData, datalen, M_NULLPTR);
-            if (ret == SUCCESS)
+            if (view->sasFarmData == M_NULLPTR)
             {
-                sas_Read_FARM_Log(rawFarmData, datalen, farmdata);
+                view->sasFarmData = M_REINTERPRET_CAST(farmLogData*, safe_calloc(1, sizeof(farmLogData)));
+                if (view->sasFarmData == M_NULLPTR)
+                {
+                    return fieldsRead;
+                }
             }
-            safe_free_aligned(&rawFarmData);
+            sas_Read_FARM_Log_Pages(view->rawFarmData, view->rawFarmDataLength, view->sasFarmData,
+                                    FARM_PAGE_MASK(page));
+            view->decodedPages |= FARM_PAGE_MASK(page);
+        }
+        const uint8_t* pageData = M_REINTERPRET_CAST(const uint8_t*, view->sasFarmData) +
+                                  (C_CAST(size_t, page) * FARM_PAGE_LEN);
+        for (; fieldsRead < numberOfFields &&
+               fieldOffset + ((C_CAST(size_t, fieldsRead) + 1) * sizeof(uint64_t)) <= FARM_PAGE_LEN;
+             ++fieldsRead)
+        {
+            safe_memcpy(&values[fieldsRead], sizeof(uint64_t),
+                        &pageData[fieldOffset + (C_CAST(size_t, fieldsRead) * sizeof(uint64_t))], sizeof(uint64_t));
         }
     }
+    return fieldsRead;
+}
+
+bool get_FARM_View_Field(ptrFarmLogView view, eFarmPage page, size_t fieldOffset, uint64_t* value)
+{
+    return get_FARM_View_Fields(view, page, fieldOffset, value, 1) == UINT8_C(1);
+}
+
+// Frames are decoded per data set. ATA frames are the 6 FARM pages back to back. SAS frames are whole log pages,
+// every frame in a data set is the same size as the first one since they are all read with the same allocation length.
+static uint32_t get_FARM_Combined_Frame_Size(eFARMDriveInterface driveInterface,
+                                             const uint8_t*      dataSet,
+                                             uint32_t            length)
+{
+    if (driveInterface == FARM_DRIVE_INTERFACE_SATA)
+    {
+        return ATA_FARM_LOG_PAGE_SIZE;
+    }
+    if (length < LOG_PAGE_HEADER_LENGTH)
+    {
+        return UINT32_C(0);
+    }
+    return M_BytesTo2ByteValue(dataSet[2], dataSet[3]) + C_CAST(uint32_t, LOG_PAGE_HEADER_LENGTH);
+}
+
+static bool is_FARM_Combined_Frame_Valid(eFARMDriveInterface driveInterface, const uint8_t* frame)
+{
+    if (driveInterface == FARM_DRIVE_INTERFACE_SATA)
+    {
+        return get_Farm_Qword_Data(M_BytesTo8ByteValue(frame[7], frame[6], frame[5], frame[4], frame[3], frame[2],
+                                                       frame[1], frame[0])) == FARM_LOG_SIGNATURE_VAL_QWORD;
+    }
+    return get_bit_range_uint8(frame[0], 5, 0) == SEAGATE_LP_FARM;
+}
+
+static void copy_FARM_Combined_String(char* dest, size_t destSize, const uint8_t* source, size_t sourceLength)
+{
+    safe_memset(dest, destSize, 0, destSize);
+    safe_memcpy(dest, destSize, source, sourceLength);
+    remove_Leading_And_Trailing_Whitespace_Len(dest, destSize);
+}
+
+eReturnValues parse_FARM_Combined_Log_Buffer(uint8_t* combinedLog, uint32_t combinedLogLength, ptrFarmCombinedLog log)
+{
+    uint16_t numberOfDataSets = UINT16_C(0);
+    uint32_t totalFrames      = UINT32_C(0);
+    DISABLE_NONNULL_COMPARE
+    if (combinedLog == M_NULLPTR || log == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    log->numberOfDataSets = UINT16_C(0);
+    log->framesDecoded    = UINT32_C(0);
+    log->rawData          = M_NULLPTR;
+    log->rawDataLength    = UINT32_C(0);
+    if (combinedLogLength < FARMC_LOG_HEADER_LENGTH ||
+        memcmp(combinedLog, FARMC_SIGNATURE_ID, FARM_SIGNATURE_LENGTH) != 0)
+    {
+        return FAILURE;
+    }
+    if (memcmp(&combinedLog[24], "SATA", 4) == 0)
+    {
+        log->driveInterface = FARM_DRIVE_INTERFACE_SATA;
+    }
+    else if (memcmp(&combinedLog[24], "SAS ", 4) == 0)
+    {
+        log->driveInterface = FARM_DRIVE_INTERFACE_SAS;
+    }
+    else
+    {
+        return NOT_SUPPORTED;
+    }
+    // the header fields are written in host byte order by pull_FARM_Combined_Log()
+    safe_memcpy(&log->patchVersion, sizeof(uint16_t), &combinedLog[18], sizeof(uint16_t));
+    safe_memcpy(&log->minorVersion, sizeof(uint16_t), &combinedLog[20], sizeof(uint16_t));
+    safe_memcpy(&log->majorVersion, sizeof(uint16_t), &combinedLog[22], sizeof(uint16_t));
+    safe_memcpy(&numberOfDataSets, sizeof(uint16_t), &combinedLog[252], sizeof(uint16_t));
+    copy_FARM_Combined_String(log->modelNumber, MODEL_NUM_LEN + 1, &combinedLog[32], MODEL_NUM_LEN);
+    copy_FARM_Combined_String(log->serialNumber, SERIAL_NUM_LEN + 1, &combinedLog[80], SERIAL_NUM_LEN);
+    copy_FARM_Combined_String(log->firmwareRevision, FW_REV_LEN + 1, &combinedLog[104], FW_REV_LEN);
+    if (numberOfDataSets > FARM_COMBINED_LOG_MAX_DATA_SETS ||
+        FARMC_LOG_HEADER_LENGTH + (C_CAST(uint32_t, numberOfDataSets) * FARMC_LOG_DATA_SET_HEADER_LENGTH) >
+            combinedLogLength)
+    {
+        return FAILURE;
+    }
+    // First pass: validate every data set and count the frames so they can all be decoded into one allocation.
+    for (uint16_t setIter = UINT16_C(0); setIter < numberOfDataSets; ++setIter)
+    {
+        const uint8_t* dataSetHeader =
+            &combinedLog[FARMC_LOG_HEADER_LENGTH + (C_CAST(uint32_t, setIter) * FARMC_LOG_DATA_SET_HEADER_LENGTH)];
+        farmCombinedDataSet* dataSet = &log->dataSets[setIter];
+        DECLARE_ZERO_INIT_ARRAY(char, signature, FARM_DATASET_SIGNATURE_LENGTH + 1);
+        safe_memset(dataSet, sizeof(farmCombinedDataSet), 0, sizeof(farmCombinedDataSet));
+        safe_memcpy(signature, FARM_DATASET_SIGNATURE_LENGTH + 1, dataSetHeader, FARM_DATASET_SIGNATURE_LENGTH);
+        remove_Leading_And_Trailing_Whitespace_Len(signature, FARM_DATASET_SIGNATURE_LENGTH + 1);
+        dataSet->type = FARM_DATA_SET_UNKNOWN;
+        for (int32_t typeIter = SUBPAGE_TYPE_FARM_CURRENT; typeIter < SUBPAGE_TYPE_MAX; ++typeIter)
+        {
+            if (strcmp(signature, farmSubPageSignatureId[typeIter]) == 0)
+            {
+                dataSet->type = M_STATIC_CAST(eFarmCombinedDataSet, typeIter);
+                break;
+            }
+        }
+        safe_memcpy(&dataSet->offset, sizeof(uint32_t), &dataSetHeader[8], sizeof(uint32_t));
+        safe_memcpy(&dataSet->length, sizeof(uint32_t), &dataSetHeader[12], sizeof(uint32_t));
+        safe_memcpy(&dataSet->startTimestamp, sizeof(uint64_t), &dataSetHeader[16], sizeof(uint64_t));
+        safe_memcpy(&dataSet->endTimestamp, sizeof(uint64_t), &dataSetHeader[24], sizeof(uint64_t));
+        if (dataSet->offset > combinedLogLength || dataSet->length > combinedLogLength - dataSet->offset)
+        {
+            return FAILURE;
+        }
+        if (dataSet->type != FARM_DATA_SET_WORKLOAD_TRACE && dataSet->type != FARM_DATA_SET_UNKNOWN)
+        {
+            uint32_t frameSize =
+                get_FARM_Combined_Frame_Size(log->driveInterface, &combinedLog[dataSet->offset], dataSet->length);
+            if (frameSize > C_CAST(uint32_t, LOG_PAGE_HEADER_LENGTH))
+            {
+                dataSet->numberOfFrames = dataSet->length / frameSize;
+                totalFrames += dataSet->numberOfFrames;
+            }
+        }
+    }
+    if (totalFrames > log->frameStorageCount)
+    {
+        safe_free_core(M_REINTERPRET_CAST(void**, &log->frameStorage));
+        log->frameStorageCount = UINT32_C(0);
+        log->frameStorage = M_REINTERPRET_CAST(farmLogData*, safe_calloc(totalFrames, sizeof(farmLogData)));
+        if (log->frameStorage == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        log->frameStorageCount = totalFrames;
+    }
+    else if (totalFrames > UINT32_C(0))
+    {
+        safe_memset(log->frameStorage, uint32_to_sizet(log->frameStorageCount) * sizeof(farmLogData), 0,
+                    uint32_to_sizet(totalFrames) * sizeof(farmLogData));
+    }
+    // Second pass: decode the frames
+    farmLogData* nextFrame = log->frameStorage;
+    for (uint16_t setIter = UINT16_C(0); setIter < numberOfDataSets; ++setIter)
+    {
+        farmCombinedDataSet* dataSet = &log->dataSets[setIter];
+        if (dataSet->numberOfFrames == UINT32_C(0))
+        {
+            continue;
+        }
+        uint32_t frameSize =
+            get_FARM_Combined_Frame_Size(log->driveInterface, &combinedLog[dataSet->offset], dataSet->length);
+        dataSet->frames = nextFrame;
+        for (uint32_t frameIter = UINT32_C(0); frameIter < dataSet->numberOfFrames; ++frameIter, ++nextFrame)
+        {
+            uint8_t* frame = &combinedLog[dataSet->offset + (frameIter * frameSize)];
+            if (!is_FARM_Combined_Frame_Valid(log->driveInterface, frame))
+            {
+                continue;
+            }
+            if (log->driveInterface == FARM_DRIVE_INTERFACE_SATA)
+            {
+                sata_Read_FARM_Log(frame, frameSize, nextFrame);
+            }
+            else
+            {
+                sas_Read_FARM_Log(frame, frameSize, nextFrame);
+            }
+            ++log->framesDecoded;
+        }
+    }
+    log->numberOfDataSets = numberOfDataSets;
+    log->rawData          = combinedLog;
+    log->rawDataLength    = combinedLogLength;
+    return SUCCESS;
+}
+
+eReturnValues parse_FARM_Combined_Log_File(const char* fileName, ptrFarmCombinedLog log)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (fileName == M_NULLPTR || log == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    secureFileInfo* farmFile = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (farmFile == M_NULLPTR || farmFile->error != SEC_FILE_SUCCESS)
+    {
+        free_Secure_File_Info(&farmFile);
+        return FILE_OPEN_ERROR;
+    }
+    size_t fileSize = farmFile->fileSize;
+    if (fileSize < FARMC_LOG_HEADER_LENGTH || fileSize > UINT32_MAX)
+    {
+        ret = FAILURE;
+    }
+    else if (fileSize > log->fileBufferSize)
+    {
+        safe_free(&log->fileBuffer);
+        log->fileBufferSize = SIZE_T_C(0);
+        log->fileBuffer     = M_REINTERPRET_CAST(uint8_t*, safe_calloc(fileSize, sizeof(uint8_t)));
+        if (log->fileBuffer == M_NULLPTR)
+        {
+            ret = MEMORY_FAILURE;
+        }
+        else
+        {
+            log->fileBufferSize = fileSize;
+        }
+    }
+    if (ret == SUCCESS &&
+        SEC_FILE_SUCCESS !=
+            secure_Read_File(farmFile, log->fileBuffer, log->fileBufferSize, sizeof(uint8_t), fileSize, M_NULLPTR))
+    {
+        ret = FILE_OPEN_ERROR;
+    }
+    secure_Close_File(farmFile);
+    free_Secure_File_Info(&farmFile);
+    if (ret == SUCCESS)
+    {
+        ret = parse_FARM_Combined_Log_Buffer(log->fileBuffer, C_CAST(uint32_t, fileSize), log);
+    }
+    return ret;
+}
+
+eReturnValues parse_FARM_Combined_Log_Files(const char**                      fileNames,
+                                            uint32_t                          numberOfFiles,
+                                            farmCombinedLogCallback           callback,
+                                            void*                             context,
+                                            ptrFarmCombinedLogBatchStatistics statistics)
+{
+    eReturnValues   ret   = SUCCESS;
+    farmCombinedLog log;
+    uint64_t        start = get_Milliseconds_Since_Unix_Epoch();
+    DISABLE_NONNULL_COMPARE
+    if (fileNames == M_NULLPTR || callback == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    if (statistics != M_NULLPTR)
+    {
+        safe_memset(statistics, sizeof(farmCombinedLogBatchStatistics), 0, sizeof(farmCombinedLogBatchStatistics));
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(&log, sizeof(farmCombinedLog), 0, sizeof(farmCombinedLog));
+    for (uint32_t fileIter = UINT32_C(0); fileIter < numberOfFiles; ++fileIter)
+    {
+        eReturnValues parseResult = BAD_PARAMETER;
+        if (fileNames[fileIter] != M_NULLPTR)
+        {
+            parseResult = parse_FARM_Combined_Log_File(fileNames[fileIter], &log);
+        }
+        if (parseResult != SUCCESS)
+        {
+            ret = FAILURE;
+        }
+        DISABLE_NONNULL_COMPARE
+        if (statistics != M_NULLPTR)
+        {
+            if (parseResult == SUCCESS)
+            {
+                ++statistics->filesParsed;
+                statistics->bytesRead += log.rawDataLength;
+                statistics->framesDecoded += log.framesDecoded;
+            }
+            else
+            {
+                ++statistics->filesFailed;
+            }
+        }
+        RESTORE_NONNULL_COMPARE
+        eReturnValues callbackResult = callback(fileNames[fileIter], parseResult, &log, context);
+        if (callbackResult != SUCCESS)
+        {
+            ret = callbackResult;
+            break;
+        }
+    }
+    free_FARM_Combined_Log(&log);
+    DISABLE_NONNULL_COMPARE
+    if (statistics != M_NULLPTR)
+    {
+        statistics->totalMilliseconds = get_Milliseconds_Since_Unix_Epoch() - start;
+    }
+    RESTORE_NONNULL_COMPARE
     return ret;
 }
 
+void free_FARM_Combined_Log(ptrFarmCombinedLog log)
+{
+    DISABLE_NONNULL_COMPARE
+    if (log == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_free_core(M_REINTERPRET_CAST(void**, &log->frameStorage));
+    safe_free(&log->fileBuffer);
+    safe_memset(log, sizeof(farmCombinedLog), 0, sizeof(farmCombinedLog));
+}
+
+typedef struct s_farmSeriesField
+{
+    const char* name;
+    eFarmPage   page;
+    size_t      offset;     // offset of the field, or of head 0 for by head fields, in the page structure
+    size_t      headStride; // bytes between heads. 0 when the field is not kept by head
+    bool        isSigned;
+} farmSeriesField;
+
+// Same order as eFarmSeriesStatistic
+static const farmSeriesField farmSeriesFields[FARM_SERIES_STATISTIC_COUNT] = {
+    {"Power on Hours", FARM_PAGE_DRIVE_INFO, offsetof(farmDriveInfo, powerOnHours), 0, false},
+    {"Head Flight Hours", FARM_PAGE_DRIVE_INFO, offsetof(farmDriveInfo, headFlightHours), 0, false},
+    {"Logical Sectors Written", FARM_PAGE_WORKLOAD, offsetof(farmWorkload, logicalSectorsWritten), 0, false},
+    {"Logical Sectors Read", FARM_PAGE_WORKLOAD, offsetof(farmWorkload, logicalSectorsRead), 0, false},
+    {"Current Temperature (C)", FARM_PAGE_ENVIRONMENT_STATS, offsetof(farmEnvironmentStatistics, currentTemperature),
+     0, false},
+    {"# Reallocated Sectors", FARM_PAGE_ERROR_STATS, offsetof(farmErrorStatistics, numberOfReallocatedSectors), 0,
+     false},
+    {"# Reallocation Candidate Sectors", FARM_PAGE_ERROR_STATS,
+     offsetof(farmErrorStatistics, numberOfReallocationCandidateSectors), 0, false},
+    {"# Reallocated Sectors by Head", FARM_PAGE_RELIABILITY_STATS,
+     offsetof(farmReliabilityStatistics, numReallocatedSectorsByHead), sizeof(uint64_t), false},
+    {"# Reallocation Candidate Sectors by Head", FARM_PAGE_RELIABILITY_STATS,
+     offsetof(farmReliabilityStatistics, numReallocationCandidateSectorsByHead), sizeof(uint64_t), false},
+    {"FAFH Appd Clr Delta OD (1/1000 A)", FARM_PAGE_RELIABILITY_STATS,
+     offsetof(farmReliabilityStatistics, appliedFlyHeightClearanceDeltaByHead), FARM_DIAMETERS * sizeof(uint64_t),
+     true},
+    {"FAFH Appd Clr Delta ID (1/1000 A)", FARM_PAGE_RELIABILITY_STATS,
+     offsetof(farmReliabilityStatistics, appliedFlyHeightClearanceDeltaByHead) + sizeof(uint64_t),
+     FARM_DIAMETERS * sizeof(uint64_t), true},
+    {"FAFH Appd Clr Delta MD (1/1000 A)", FARM_PAGE_RELIABILITY_STATS,
+     offsetof(farmReliabilityStatistics, appliedFlyHeightClearanceDeltaByHead) + (2 * sizeof(uint64_t)),
+     FARM_DIAMETERS * sizeof(uint64_t), true},
+};
+
+static M_INLINE uint64_t get_FARM_Frame_Qword(const farmLogData* frame, eFarmPage page, size_t offset)
+{
+    uint64_t field = UINT64_C(0);
+    safe_memcpy(&field, sizeof(uint64_t),
+                M_REINTERPRET_CAST(const uint8_t*, frame) + (C_CAST(size_t, page) * FARM_PAGE_LEN) + offset,
+                sizeof(uint64_t));
+    return field;
+}
+
+static M_INLINE bool is_FARM_Field_Supported_And_Valid(uint64_t field)
+{
+    return (get_Farm_Status_Byte(field) & (FARM_FIELD_SUPPORTED_BIT | FARM_FIELD_VALID_BIT)) ==
+           (FARM_FIELD_SUPPORTED_BIT | FARM_FIELD_VALID_BIT);
+}
+
+eReturnValues build_FARM_Series_Table(const farmCombinedDataSet* dataSet, ptrFarmSeriesTable table)
+{
+    DECLARE_ZERO_INIT_ARRAY(const farmLogData*, frames, FARM_TIME_SERIES_PAGES);
+    const farmLogData** orderedFrames  = frames;
+    uint32_t            numberOfFrames = UINT32_C(0);
+    size_t              totalEntries   = SIZE_T_C(0);
+    DISABLE_NONNULL_COMPARE
+    if (dataSet == M_NULLPTR || table == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(table, sizeof(farmSeriesTable), 0, sizeof(farmSeriesTable));
+    if (dataSet->frames == M_NULLPTR || dataSet->numberOfFrames == UINT32_C(0))
+    {
+        return NOT_SUPPORTED;
+    }
+    if (dataSet->numberOfFrames > FARM_TIME_SERIES_PAGES)
+    {
+        orderedFrames = M_REINTERPRET_CAST(const farmLogData**,
+                                           safe_calloc(dataSet->numberOfFrames, sizeof(const farmLogData*)));
+        if (orderedFrames == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+    }
+    // Keep frames that decoded, ordered by power on hours. There are only a few frames so an insertion sort is fine.
+    for (uint32_t frameIter = UINT32_C(0); frameIter < dataSet->numberOfFrames; ++frameIter)
+    {
+        const farmLogData* frame = &dataSet->frames[frameIter];
+        if (get_Farm_Qword_Data(frame->header.signature) != FARM_LOG_SIGNATURE_VAL_QWORD)
+        {
+            continue;
+        }
+        uint64_t hours    = get_Farm_Qword_Data(frame->driveinfo.powerOnHours);
+        uint32_t insertAt = numberOfFrames;
+        while (insertAt > UINT32_C(0) &&
+               get_Farm_Qword_Data(orderedFrames[insertAt - 1]->driveinfo.powerOnHours) > hours)
+        {
+            orderedFrames[insertAt] = orderedFrames[insertAt - 1];
+            --insertAt;
+        }
+        orderedFrames[insertAt] = frame;
+        ++numberOfFrames;
+    }
+    if (numberOfFrames == UINT32_C(0))
+    {
+        if (orderedFrames != frames)
+        {
+            safe_free_core(M_REINTERPRET_CAST(void**, &orderedFrames));
+        }
+        return NOT_SUPPORTED;
+    }
+    // use the newest frame's head count
+    uint64_t heads        = get_Farm_Qword_Data(orderedFrames[numberOfFrames - 1]->driveinfo.numberOfHeads);
+    table->numberOfFrames = numberOfFrames;
+    table->numberOfHeads  = M_STATIC_CAST(uint8_t, M_Min(heads, FARM_MAX_HEADS));
+    if (table->numberOfHeads == UINT8_C(0))
+    {
+        table->numberOfHeads = UINT8_C(1);
+    }
+    for (uint8_t statIter = UINT8_C(0); statIter < FARM_SERIES_STATISTIC_COUNT; ++statIter)
+    {
+        table->columns[statIter].name          = farmSeriesFields[statIter].name;
+        table->columns[statIter].numberOfHeads = farmSeriesFields[statIter].headStride > 0 ? table->numberOfHeads : 1;
+        totalEntries += C_CAST(size_t, table->columns[statIter].numberOfHeads) * numberOfFrames;
+    }
+    table->valueStorage = M_REINTERPRET_CAST(int64_t*, safe_calloc(totalEntries, sizeof(int64_t)));
+    table->deltaStorage = M_REINTERPRET_CAST(int64_t*, safe_calloc(totalEntries, sizeof(int64_t)));
+    table->rateStorage  = M_REINTERPRET_CAST(double*, safe_calloc(totalEntries, sizeof(double)));
+    table->validStorage = M_REINTERPRET_CAST(bool*, safe_calloc(totalEntries, sizeof(bool)));
+    if (table->valueStorage == M_NULLPTR || table->deltaStorage == M_NULLPTR || table->rateStorage == M_NULLPTR ||
+        table->validStorage == M_NULLPTR)
+    {
+        if (orderedFrames != frames)
+        {
+            safe_free_core(M_REINTERPRET_CAST(void**, &orderedFrames));
+        }
+        free_FARM_Series_Table(table);
+        return MEMORY_FAILURE;
+    }
+    size_t columnStart = SIZE_T_C(0);
+    for (uint8_t statIter = UINT8_C(0); statIter < FARM_SERIES_STATISTIC_COUNT; ++statIter)
+    {
+        const farmSeriesField* field  = &farmSeriesFields[statIter];
+        farmSeriesColumn*      column = &table->columns[statIter];
+        column->values                = &table->valueStorage[columnStart];
+        column->deltas                = &table->deltaStorage[columnStart];
+        column->ratesPerHour          = &table->rateStorage[columnStart];
+        column->valid                 = &table->validStorage[columnStart];
+        columnStart += C_CAST(size_t, column->numberOfHeads) * numberOfFrames;
+        for (uint8_t headIter = UINT8_C(0); headIter < column->numberOfHeads; ++headIter)
+        {
+            size_t headOffset = field->offset + (C_CAST(size_t, headIter) * field->headStride);
+            size_t rowStart   = C_CAST(size_t, headIter) * numberOfFrames;
+            for (uint32_t frameIter = UINT32_C(0); frameIter < numberOfFrames; ++frameIter)
+            {
+                size_t   entry = rowStart + frameIter;
+                uint64_t raw   = get_FARM_Frame_Qword(orderedFrames[frameIter], field->page, headOffset);
+                column->valid[entry] = is_FARM_Field_Supported_And_Valid(raw);
+                if (!column->valid[entry])
+                {
+                    continue;
+                }
+                column->values[entry] = field->isSigned ? get_Farm_Signed_Qword_Data(raw)
+                                                        : M_STATIC_CAST(int64_t, get_Farm_Qword_Data(raw));
+                if (frameIter > UINT32_C(0) && column->valid[entry - 1])
+                {
+                    uint64_t hours = get_Farm_Qword_Data(orderedFrames[frameIter]->driveinfo.powerOnHours) -
+                                     get_Farm_Qword_Data(orderedFrames[frameIter - 1]->driveinfo.powerOnHours);
+                    column->deltas[entry] = column->values[entry] - column->values[entry - 1];
+                    if (hours > UINT64_C(0))
+                    {
+                        column->ratesPerHour[entry] = C_CAST(double, column->deltas[entry]) / C_CAST(double, hours);
+                    }
+                }
+            }
+        }
+    }
+    if (orderedFrames != frames)
+    {
+        safe_free_core(M_REINTERPRET_CAST(void**, &orderedFrames));
+    }
+    return SUCCESS;
+}
+
+void free_FARM_Series_Table(ptrFarmSeriesTable table)
+{
+    DISABLE_NONNULL_COMPARE
+    if (table == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_free_core(M_REINTERPRET_CAST(void**, &table->valueStorage));
+    safe_free_core(M_REINTERPRET_CAST(void**, &table->deltaStorage));
+    safe_free_core(M_REINTERPRET_CAST(void**, &table->rateStorage));
+    safe_free_core(M_REINTERPRET_CAST(void**, &table->validStorage));
+    safe_memset(table, sizeof(farmSeriesTable), 0, sizeof(farmSeriesTable));
+}
+
 static M_INLINE void print_Statistic_Name(const char* statisticname)
 {
     const char* stat = statisticname;
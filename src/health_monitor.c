@@ -0,0 +1,541 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file health_monitor.c
+// \brief This file defines the functions for tracking trends in SMART, device statistics and defect counts over time.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "error_translation.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "health_monitor.h"
+#include "smart.h"
+
+#define HEALTH_MONITOR_SECONDS_PER_DAY (86400.0)
+
+void init_Health_Monitor(ptrHealthMonitor monitor, uint32_t intervalSeconds)
+{
+    DISABLE_NONNULL_COMPARE
+    if (monitor != M_NULLPTR)
+    {
+        safe_memset(monitor, sizeof(healthMonitor), 0, sizeof(healthMonitor));
+        monitor->intervalSeconds               = intervalSeconds;
+        monitor->deviceStatisticsSamplerStatus = UNKNOWN;
+    }
+    RESTORE_NONNULL_COMPARE
+}
+
+eReturnValues add_Health_Monitor_Metric(ptrHealthMonitor          monitor,
+                                        eHealthMetricSource       source,
+                                        uint32_t                  id,
+                                        const healthMetricPolicy* policy)
+{
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR || policy == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    switch (source)
+    {
+    case HEALTH_METRIC_SMART_ATTRIBUTE_RAW:
+    case HEALTH_METRIC_SMART_ATTRIBUTE_CURRENT:
+        // attributes are numbered 1 - 254
+        if (id == UINT32_C(0) || id >= UINT8_MAX)
+        {
+            return BAD_PARAMETER;
+        }
+        break;
+    case HEALTH_METRIC_NVME_HEALTH:
+        if (id > NVME_HEALTH_CRITICAL_TEMPERATURE_TIME)
+        {
+            return BAD_PARAMETER;
+        }
+        break;
+    case HEALTH_METRIC_DEVICE_STATISTIC:
+    case HEALTH_METRIC_PENDING_LIST_COUNT:
+    case HEALTH_METRIC_GROWN_LIST_COUNT:
+        break;
+    default:
+        return BAD_PARAMETER;
+    }
+    if (monitor->numberOfMetrics >= HEALTH_MONITOR_MAX_METRICS)
+    {
+        return FAILURE;
+    }
+    healthTrendMetric* metric = &monitor->metrics[monitor->numberOfMetrics];
+    safe_memset(metric, sizeof(healthTrendMetric), 0, sizeof(healthTrendMetric));
+    metric->source = source;
+    metric->id     = id;
+    safe_memcpy(&metric->policy, sizeof(healthMetricPolicy), policy, sizeof(healthMetricPolicy));
+    ++monitor->numberOfMetrics;
+    if (source == HEALTH_METRIC_DEVICE_STATISTIC && monitor->deviceStatisticsSamplerStatus != UNKNOWN)
+    {
+        // The sampler only reads the pages holding the statistics it was set up with
+        if (monitor->deviceStatisticsSamplerStatus == SUCCESS)
+        {
+            free_Device_Statistics_Sampler(&monitor->deviceStatisticsSampler);
+        }
+        monitor->deviceStatisticsSamplerStatus = UNKNOWN;
+    }
+    return SUCCESS;
+}
+
+bool is_Health_Monitor_Sample_Due(const healthMonitor* monitor)
+{
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR)
+    {
+        return false;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (monitor->lastSampleMilliseconds == UINT64_C(0))
+    {
+        return true;
+    }
+    uint64_t now = get_Milliseconds_Since_Unix_Epoch();
+    // A clock that moved backwards also means a sample is due rather than waiting for it to catch up
+    return now < monitor->lastSampleMilliseconds ||
+           (now - monitor->lastSampleMilliseconds) >= (C_CAST(uint64_t, monitor->intervalSeconds) * UINT64_C(1000));
+}
+
+static void recalculate_Trend_Sums(healthTrendMetric* metric)
+{
+    metric->sumTimes        = 0.0;
+    metric->sumValues       = 0.0;
+    metric->sumTimesSquared = 0.0;
+    metric->sumTimesValues  = 0.0;
+    for (uint16_t iter = UINT16_C(0); iter < metric->count; ++iter)
+    {
+        metric->sumTimes += metric->times[iter];
+        metric->sumValues += metric->values[iter];
+        metric->sumTimesSquared += metric->times[iter] * metric->times[iter];
+        metric->sumTimesValues += metric->times[iter] * metric->values[iter];
+    }
+}
+
+// Called when the ring wraps. Moves the time base to the oldest sample so times stay within one history of zero, and
+// recalculates the sums so rounding from adding and removing samples does not build up over months of sampling.
+static void rebase_Trend_History(healthTrendMetric* metric)
+{
+    double   oldest  = metric->times[metric->next];
+    uint64_t shiftMs = C_CAST(uint64_t, (oldest * 1000.0) + 0.5);
+    double   shift   = C_CAST(double, shiftMs) / 1000.0;
+    metric->timeBaseMilliseconds += shiftMs;
+    for (uint16_t iter = UINT16_C(0); iter < metric->count; ++iter)
+    {
+        metric->times[iter] -= shift;
+    }
+    recalculate_Trend_Sums(metric);
+}
+
+static void add_Trend_Sample(healthTrendMetric* metric, uint64_t nowMilliseconds, double value)
+{
+    if (metric->count == UINT16_C(0))
+    {
+        metric->timeBaseMilliseconds = nowMilliseconds;
+    }
+    double seconds = 0.0;
+    if (nowMilliseconds > metric->timeBaseMilliseconds)
+    {
+        seconds = C_CAST(double, nowMilliseconds - metric->timeBaseMilliseconds) / 1000.0;
+    }
+    if (metric->count == HEALTH_MONITOR_HISTORY_LENGTH)
+    {
+        double oldTime  = metric->times[metric->next];
+        double oldValue = metric->values[metric->next];
+        metric->sumTimes -= oldTime;
+        metric->sumValues -= oldValue;
+        metric->sumTimesSquared -= oldTime * oldTime;
+        metric->sumTimesValues -= oldTime * oldValue;
+    }
+    else
+    {
+        ++metric->count;
+    }
+    metric->times[metric->next]  = seconds;
+    metric->values[metric->next] = value;
+    metric->sumTimes += seconds;
+    metric->sumValues += value;
+    metric->sumTimesSquared += seconds * seconds;
+    metric->sumTimesValues += seconds * value;
+    metric->next = C_CAST(uint16_t, (metric->next + UINT16_C(1)) % HEALTH_MONITOR_HISTORY_LENGTH);
+    if (metric->next == UINT16_C(0))
+    {
+        rebase_Trend_History(metric);
+    }
+}
+
+static void update_Trend(healthTrendMetric* metric)
+{
+    metric->slopeValid = false;
+    if (metric->count >= HEALTH_MONITOR_MIN_TREND_SAMPLES)
+    {
+        double n           = C_CAST(double, metric->count);
+        double denominator = (n * metric->sumTimesSquared) - (metric->sumTimes * metric->sumTimes);
+        // samples taken at the same time do not give a slope
+        if (denominator > 0.0)
+        {
+            metric->slopePerSecond =
+                ((n * metric->sumTimesValues) - (metric->sumTimes * metric->sumValues)) / denominator;
+            metric->slopeValid = true;
+        }
+    }
+    if (!metric->latestValid)
+    {
+        // keep the flag from the last good sample so a drive that stops answering is not cleared
+        return;
+    }
+    metric->timeToThresholdValid = false;
+    metric->flagged              = false;
+    double remaining = metric->policy.threshold - metric->latest;
+    if (metric->policy.rising ? remaining <= 0.0 : remaining >= 0.0)
+    {
+        metric->secondsToThreshold   = 0.0;
+        metric->timeToThresholdValid = true;
+        metric->flagged              = true;
+    }
+    else if (metric->slopeValid &&
+             (metric->policy.rising ? metric->slopePerSecond > 0.0 : metric->slopePerSecond < 0.0))
+    {
+        metric->secondsToThreshold   = remaining / metric->slopePerSecond;
+        metric->timeToThresholdValid = true;
+        if (metric->policy.horizonSeconds > UINT32_C(0) &&
+            metric->secondsToThreshold <= C_CAST(double, metric->policy.horizonSeconds))
+        {
+            metric->flagged = true;
+        }
+    }
+}
+
+static bool get_SMART_Metric_Value(tDevice*                 device,
+                                   const healthTrendMetric* metric,
+                                   smartLogData*            smartData,
+                                   double*                  value)
+{
+    if (device->drive_info.drive_type == ATA_DRIVE && metric->source != HEALTH_METRIC_NVME_HEALTH)
+    {
+        ataSMARTValue* attribute = &smartData->attributes.ataSMARTAttr.attributes[metric->id];
+        if (!attribute->valid)
+        {
+            return false;
+        }
+        if (metric->source == HEALTH_METRIC_SMART_ATTRIBUTE_CURRENT)
+        {
+            *value = C_CAST(double, attribute->data.nominal);
+        }
+        else
+        {
+            const uint8_t* raw = attribute->data.rawData;
+            *value = C_CAST(double, M_BytesTo8ByteValue(0, 0, raw[5], raw[4], raw[3], raw[2], raw[1], raw[0]));
+        }
+        return true;
+    }
+    else if (device->drive_info.drive_type == NVME_DRIVE && metric->source == HEALTH_METRIC_NVME_HEALTH)
+    {
+        nvmeSmartLog* health = &smartData->attributes.nvmeSMARTAttr;
+        switch (metric->id)
+        {
+        case NVME_HEALTH_COMPOSITE_TEMPERATURE:
+            // Kelvin in the log
+            *value = C_CAST(double,
+                            C_CAST(int32_t, M_BytesTo2ByteValue(health->temperature[1], health->temperature[0])) -
+                                INT32_C(273));
+            break;
+        case NVME_HEALTH_AVAILABLE_SPARE:
+            *value = C_CAST(double, health->availSpare);
+            break;
+        case NVME_HEALTH_PERCENTAGE_USED:
+            *value = C_CAST(double, health->percentUsed);
+            break;
+        case NVME_HEALTH_MEDIA_ERRORS:
+            *value = convert_128bit_to_double(health->mediaErrors);
+            break;
+        case NVME_HEALTH_ERROR_LOG_ENTRIES:
+            *value = convert_128bit_to_double(health->numErrLogEntries);
+            break;
+        case NVME_HEALTH_UNSAFE_SHUTDOWNS:
+            *value = convert_128bit_to_double(health->unsafeShutdowns);
+            break;
+        case NVME_HEALTH_WARNING_TEMPERATURE_TIME:
+            *value = C_CAST(double, le32_to_host(health->warningTempTime));
+            break;
+        case NVME_HEALTH_CRITICAL_TEMPERATURE_TIME:
+            *value = C_CAST(double, le32_to_host(health->criticalCompTime));
+            break;
+        default:
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+static bool get_Device_Statistic_Metric_Value(const deviceStatisticsSampler* sampler,
+                                              const healthTrendMetric*       metric,
+                                              double*                        value)
+{
+    for (uint32_t iter = UINT32_C(0); iter < sampler->numberOfSamples; ++iter)
+    {
+        if (sampler->samples[iter].id == metric->id)
+        {
+            if (sampler->samples[iter].valid)
+            {
+                if (sampler->samples[iter].isCounter)
+                {
+                    *value = C_CAST(double, sampler->samples[iter].value);
+                }
+                else
+                {
+                    // gauges such as temperatures can be negative and are stored sign extended
+                    *value = C_CAST(double, C_CAST(int64_t, sampler->samples[iter].value));
+                }
+                return true;
+            }
+            break;
+        }
+    }
+    return false;
+}
+
+// Sets up the sampler with only the statistics this monitor tracks. Setting it up takes the first sample.
+static eReturnValues sample_Health_Monitor_Device_Statistics(tDevice* device, ptrHealthMonitor monitor)
+{
+    if (monitor->deviceStatisticsSamplerStatus == UNKNOWN)
+    {
+        DECLARE_ZERO_INIT_ARRAY(uint32_t, ids, HEALTH_MONITOR_MAX_METRICS);
+        uint32_t numberOfIDs = UINT32_C(0);
+        for (uint8_t iter = UINT8_C(0); iter < monitor->numberOfMetrics; ++iter)
+        {
+            if (monitor->metrics[iter].source == HEALTH_METRIC_DEVICE_STATISTIC)
+            {
+                ids[numberOfIDs] = monitor->metrics[iter].id;
+                ++numberOfIDs;
+            }
+        }
+        eReturnValues ret = init_Device_Statistics_Sampler(device, &monitor->deviceStatisticsSampler, ids, numberOfIDs);
+        if (ret == SUCCESS || ret == NOT_SUPPORTED)
+        {
+            // Any other failure may be temporary, so it is tried again on the next sample
+            monitor->deviceStatisticsSamplerStatus = ret;
+        }
+        return ret;
+    }
+    else if (monitor->deviceStatisticsSamplerStatus == SUCCESS)
+    {
+        return sample_Device_Statistics(device, &monitor->deviceStatisticsSampler);
+    }
+    // Not supported when first set up. Do not send the commands again on every sample.
+    return monitor->deviceStatisticsSamplerStatus;
+}
+
+eReturnValues sample_Health_Monitor(tDevice* device, ptrHealthMonitor monitor)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || monitor == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    bool needSMART            = false;
+    bool needDeviceStatistics = false;
+    bool needPendingList      = false;
+    bool needGrownList        = false;
+    for (uint8_t iter = UINT8_C(0); iter < monitor->numberOfMetrics; ++iter)
+    {
+        monitor->metrics[iter].latestValid = false;
+        switch (monitor->metrics[iter].source)
+        {
+        case HEALTH_METRIC_SMART_ATTRIBUTE_RAW:
+        case HEALTH_METRIC_SMART_ATTRIBUTE_CURRENT:
+        case HEALTH_METRIC_NVME_HEALTH:
+            needSMART = true;
+            break;
+        case HEALTH_METRIC_DEVICE_STATISTIC:
+            needDeviceStatistics = true;
+            break;
+        case HEALTH_METRIC_PENDING_LIST_COUNT:
+            needPendingList = true;
+            break;
+        case HEALTH_METRIC_GROWN_LIST_COUNT:
+            needGrownList = true;
+            break;
+        }
+    }
+    smartLogData  smartData;
+    eReturnValues smartStatus            = NOT_SUPPORTED;
+    eReturnValues deviceStatisticsStatus = NOT_SUPPORTED;
+    eReturnValues pendingStatus          = NOT_SUPPORTED;
+    eReturnValues grownStatus            = NOT_SUPPORTED;
+    uint32_t      pendingCount           = UINT32_C(0);
+    uint32_t      grownCount             = UINT32_C(0);
+    safe_memset(&smartData, sizeof(smartLogData), 0, sizeof(smartLogData));
+    if (needSMART)
+    {
+        smartStatus = get_SMART_Attributes(device, &smartData);
+        if (smartStatus != SUCCESS && ret == SUCCESS)
+        {
+            ret = smartStatus;
+        }
+    }
+    if (needDeviceStatistics)
+    {
+        deviceStatisticsStatus = sample_Health_Monitor_Device_Statistics(device, monitor);
+        if (deviceStatisticsStatus != SUCCESS && ret == SUCCESS)
+        {
+            ret = deviceStatisticsStatus;
+        }
+    }
+    if (needPendingList)
+    {
+        pendingStatus = get_Pending_List_Count(device, &pendingCount);
+        if (pendingStatus != SUCCESS && ret == SUCCESS)
+        {
+            ret = pendingStatus;
+        }
+    }
+    if (needGrownList)
+    {
+        grownStatus = get_Grown_List_Count(device, &grownCount);
+        if (grownStatus != SUCCESS && ret == SUCCESS)
+        {
+            ret = grownStatus;
+        }
+    }
+    uint64_t now     = get_Milliseconds_Since_Unix_Epoch();
+    monitor->flagged = false;
+    for (uint8_t iter = UINT8_C(0); iter < monitor->numberOfMetrics; ++iter)
+    {
+        healthTrendMetric* metric = &monitor->metrics[iter];
+        double             value  = 0.0;
+        switch (metric->source)
+        {
+        case HEALTH_METRIC_SMART_ATTRIBUTE_RAW:
+        case HEALTH_METRIC_SMART_ATTRIBUTE_CURRENT:
+        case HEALTH_METRIC_NVME_HEALTH:
+            metric->latestValid = smartStatus == SUCCESS && get_SMART_Metric_Value(device, metric, &smartData, &value);
+            break;
+        case HEALTH_METRIC_DEVICE_STATISTIC:
+            // a sampler that failed to read some pages still has valid values for the pages that were read
+            metric->latestValid = monitor->deviceStatisticsSamplerStatus == SUCCESS &&
+                                  get_Device_Statistic_Metric_Value(&monitor->deviceStatisticsSampler, metric, &value);
+            break;
+        case HEALTH_METRIC_PENDING_LIST_COUNT:
+            metric->latestValid = pendingStatus == SUCCESS;
+            value               = C_CAST(double, pendingCount);
+            break;
+        case HEALTH_METRIC_GROWN_LIST_COUNT:
+            metric->latestValid = grownStatus == SUCCESS;
+            value               = C_CAST(double, grownCount);
+            break;
+        }
+        if (metric->latestValid)
+        {
+            metric->latest = value;
+            add_Trend_Sample(metric, now, value);
+        }
+        update_Trend(metric);
+        if (metric->flagged)
+        {
+            monitor->flagged = true;
+        }
+    }
+    monitor->lastSampleMilliseconds = now;
+    ++monitor->sampleCount;
+    return ret;
+}
+
+static const char* health_Metric_Source_String(eHealthMetricSource source)
+{
+    switch (source)
+    {
+    case HEALTH_METRIC_SMART_ATTRIBUTE_RAW:
+        return "SMART Raw";
+    case HEALTH_METRIC_SMART_ATTRIBUTE_CURRENT:
+        return "SMART Current";
+    case HEALTH_METRIC_DEVICE_STATISTIC:
+        return "Device Statistic";
+    case HEALTH_METRIC_NVME_HEALTH:
+        return "NVMe Health";
+    case HEALTH_METRIC_PENDING_LIST_COUNT:
+        return "Pending List";
+    case HEALTH_METRIC_GROWN_LIST_COUNT:
+        return "Grown List";
+    }
+    return "Unknown";
+}
+
+void print_Health_Monitor(const healthMonitor* monitor)
+{
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    printf("\n===Health Trends===\n");
+    printf("Samples: %" PRIu32 "\n", monitor->sampleCount);
+    printf(" Source           ID          Latest          Slope/Day       Threshold       Days To Threshold\n");
+    for (uint8_t iter = UINT8_C(0); iter < monitor->numberOfMetrics; ++iter)
+    {
+        const healthTrendMetric* metric = &monitor->metrics[iter];
+        printf("%c%-16s 0x%08" PRIX32 " ", metric->flagged ? '!' : ' ', health_Metric_Source_String(metric->source),
+               metric->id);
+        if (metric->latestValid)
+        {
+            printf("%-15.0f ", metric->latest);
+        }
+        else
+        {
+            printf("%-15s ", "N/A");
+        }
+        if (metric->slopeValid)
+        {
+            printf("%-15.3f ", metric->slopePerSecond * HEALTH_MONITOR_SECONDS_PER_DAY);
+        }
+        else
+        {
+            printf("%-15s ", "N/A");
+        }
+        printf("%-15.0f ", metric->policy.threshold);
+        if (metric->timeToThresholdValid)
+        {
+            printf("%.1f\n", metric->secondsToThreshold / HEALTH_MONITOR_SECONDS_PER_DAY);
+        }
+        else
+        {
+            printf("N/A\n");
+        }
+    }
+    printf("! - the metric is past its threshold or is expected to reach it within its horizon\n");
+}
+
+void free_Health_Monitor(ptrHealthMonitor monitor)
+{
+    DISABLE_NONNULL_COMPARE
+    if (monitor != M_NULLPTR)
+    {
+        if (monitor->deviceStatisticsSamplerStatus == SUCCESS)
+        {
+            free_Device_Statistics_Sampler(&monitor->deviceStatisticsSampler);
+        }
+        safe_memset(monitor, sizeof(healthMonitor), 0, sizeof(healthMonitor));
+        monitor->deviceStatisticsSamplerStatus = UNKNOWN;
+    }
+    RESTORE_NONNULL_COMPARE
+}
@@ -0,0 +1,876 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file incremental_logs.c
+// \brief This file defines the functions for collecting only the parts of device logs that changed since the last
+// sample.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "error_translation.h"
+#include "io_utils.h"
+#include "math_utils.h"
+#include "memory_safety.h"
+#include "secure_file.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "incremental_logs.h"
+#include "logs.h"
+#include "nvme_operations.h"
+#include "operations_Common.h"
+#include "vendor/seagate/seagate_ata_types.h"
+
+#define INCREMENTAL_LOG_STATE_GROWTH           UINT32_C(16)
+#define INCREMENTAL_LOG_ATA_TRANSFER_PAGES     UINT16_C(32)
+#define INCREMENTAL_LOG_NVME_ERROR_ENTRY_BYTES UINT32_C(64)
+#define INCREMENTAL_LOG_STATE_FLAG_GENERATION  (UINT16_C(1))
+
+// FNV-1a. Only used to tell whether a chunk changed between samples, so a fast non-cryptographic hash is enough.
+static uint64_t fingerprint_Log_Chunk(const uint8_t* data, uint32_t dataLength)
+{
+    uint64_t hash = UINT64_C(0xCBF29CE484222325);
+    for (uint32_t iter = UINT32_C(0); iter < dataLength; ++iter)
+    {
+        hash ^= data[iter];
+        hash *= UINT64_C(0x100000001B3);
+    }
+    return hash;
+}
+
+static M_INLINE uint32_t get_Incremental_Log_Chunk_Count(uint32_t length)
+{
+    return (length + INCREMENTAL_LOG_CHUNK_SIZE - UINT32_C(1)) / INCREMENTAL_LOG_CHUNK_SIZE;
+}
+
+static void set_Incremental_Log_Field(uint8_t* dataBuf, size_t offset, uint64_t value, uint8_t fieldLength)
+{
+    for (uint8_t byteIter = UINT8_C(0); byteIter < fieldLength; ++byteIter)
+    {
+        dataBuf[offset + byteIter] = M_Byte0(value >> (UINT64_C(8) * byteIter));
+    }
+}
+
+static uint64_t get_Incremental_Log_Field(const uint8_t* dataBuf, size_t offset, uint8_t fieldLength)
+{
+    uint64_t value = UINT64_C(0);
+    for (uint8_t byteIter = fieldLength; byteIter > UINT8_C(0); --byteIter)
+    {
+        value = (value << UINT64_C(8)) | dataBuf[offset + byteIter - UINT8_C(1)];
+    }
+    return value;
+}
+
+void free_Incremental_Log_State(ptrIncrementalLogState state)
+{
+    DISABLE_NONNULL_COMPARE
+    if (state != M_NULLPTR)
+    {
+        for (uint32_t logIter = UINT32_C(0); logIter < state->numberOfLogs; ++logIter)
+        {
+            safe_free_core(M_REINTERPRET_CAST(void**, &state->logs[logIter].chunkFingerprints));
+        }
+        safe_free_core(M_REINTERPRET_CAST(void**, &state->logs));
+        safe_memset(state, sizeof(incrementalLogState), 0, sizeof(incrementalLogState));
+    }
+    RESTORE_NONNULL_COMPARE
+}
+
+static ptrIncrementalLogPageState add_Incremental_Log_Page_State(ptrIncrementalLogState state,
+                                                                 eLogBundleEntryType    type,
+                                                                 uint32_t               logID)
+{
+    if (state->numberOfLogs == state->logCapacity)
+    {
+        uint32_t newCapacity = state->logCapacity + INCREMENTAL_LOG_STATE_GROWTH;
+        if (safe_reallocf(M_REINTERPRET_CAST(void**, &state->logs),
+                          uint32_to_sizet(newCapacity) * sizeof(incrementalLogPageState)) == M_NULLPTR)
+        {
+            // the fingerprint arrays were lost with the table, so there is nothing left to free
+            state->numberOfLogs = UINT32_C(0);
+            state->logCapacity  = UINT32_C(0);
+            return M_NULLPTR;
+        }
+        state->logCapacity = newCapacity;
+    }
+    ptrIncrementalLogPageState logState = &state->logs[state->numberOfLogs];
+    safe_memset(logState, sizeof(incrementalLogPageState), 0, sizeof(incrementalLogPageState));
+    logState->type  = type;
+    logState->logID = logID;
+    state->numberOfLogs += UINT32_C(1);
+    return logState;
+}
+
+static ptrIncrementalLogPageState find_Incremental_Log_Page_State(ptrIncrementalLogState state,
+                                                                  eLogBundleEntryType    type,
+                                                                  uint32_t               logID)
+{
+    for (uint32_t logIter = UINT32_C(0); logIter < state->numberOfLogs; ++logIter)
+    {
+        if (state->logs[logIter].type == type && state->logs[logIter].logID == logID)
+        {
+            return &state->logs[logIter];
+        }
+    }
+    return M_NULLPTR;
+}
+
+eReturnValues load_Incremental_Log_State(const char* stateFileName, ptrIncrementalLogState state)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (stateFileName == M_NULLPTR || state == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(state, sizeof(incrementalLogState), 0, sizeof(incrementalLogState));
+    secureFileInfo* stateFile = secure_Open_File(stateFileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (stateFile == M_NULLPTR || stateFile->error != SEC_FILE_SUCCESS)
+    {
+        free_Secure_File_Info(&stateFile);
+        return FILE_OPEN_ERROR;
+    }
+    size_t   stateSize = stateFile->fileSize;
+    uint8_t* stateData = M_NULLPTR;
+    if (stateSize < INCREMENTAL_LOG_STATE_HEADER_LENGTH)
+    {
+        ret = FAILURE;
+    }
+    else
+    {
+        stateData = M_REINTERPRET_CAST(uint8_t*, safe_calloc(stateSize, sizeof(uint8_t)));
+        if (stateData == M_NULLPTR)
+        {
+            ret = MEMORY_FAILURE;
+        }
+        else if (SEC_FILE_SUCCESS !=
+                 secure_Read_File(stateFile, stateData, stateSize, sizeof(uint8_t), stateSize, M_NULLPTR))
+        {
+            ret = FAILURE;
+        }
+    }
+    secure_Close_File(stateFile);
+    free_Secure_File_Info(&stateFile);
+    if (ret == SUCCESS &&
+        (memcmp(stateData, INCREMENTAL_LOG_STATE_SIGNATURE, LOG_BUNDLE_SIGNATURE_LENGTH) != 0 ||
+         get_Incremental_Log_Field(stateData, 8, 2) != INCREMENTAL_LOG_STATE_VERSION ||
+         get_Incremental_Log_Field(stateData, 10, 2) != INCREMENTAL_LOG_CHUNK_SIZE))
+    {
+        // a state saved with a different chunk size cannot be compared against, so start over from a baseline
+        ret = FAILURE;
+    }
+    if (ret == SUCCESS)
+    {
+        uint32_t numberOfLogs         = C_CAST(uint32_t, get_Incremental_Log_Field(stateData, 12, 4));
+        size_t   offset               = INCREMENTAL_LOG_STATE_HEADER_LENGTH;
+        state->lastSampleMilliseconds = get_Incremental_Log_Field(stateData, 16, 8);
+        state->sampleCount            = C_CAST(uint32_t, get_Incremental_Log_Field(stateData, 24, 4));
+        safe_memcpy(state->serialNumber, SERIAL_NUM_LEN + 1, &stateData[32], SERIAL_NUM_LEN);
+        // remove the space padding
+        for (size_t serialIter = SERIAL_NUM_LEN; serialIter > SIZE_T_C(0) && state->serialNumber[serialIter - 1] == ' ';
+             --serialIter)
+        {
+            state->serialNumber[serialIter - 1] = '\0';
+        }
+        for (uint32_t logIter = UINT32_C(0); logIter < numberOfLogs && ret == SUCCESS; ++logIter)
+        {
+            if (offset + INCREMENTAL_LOG_STATE_ENTRY_LENGTH > stateSize)
+            {
+                ret = FAILURE;
+                break;
+            }
+            uint16_t flags          = C_CAST(uint16_t, get_Incremental_Log_Field(stateData, offset + 2, 2));
+            uint32_t length         = C_CAST(uint32_t, get_Incremental_Log_Field(stateData, offset + 8, 4));
+            uint32_t numberOfChunks = C_CAST(uint32_t, get_Incremental_Log_Field(stateData, offset + 12, 4));
+            size_t   chunkBytes     = uint32_to_sizet(numberOfChunks) * sizeof(uint64_t);
+            if (numberOfChunks != get_Incremental_Log_Chunk_Count(length) ||
+                offset + INCREMENTAL_LOG_STATE_ENTRY_LENGTH + chunkBytes > stateSize)
+            {
+                ret = FAILURE;
+                break;
+            }
+            ptrIncrementalLogPageState logState = add_Incremental_Log_Page_State(
+                state, M_STATIC_CAST(eLogBundleEntryType, get_Incremental_Log_Field(stateData, offset, 2)),
+                C_CAST(uint32_t, get_Incremental_Log_Field(stateData, offset + 4, 4)));
+            if (logState == M_NULLPTR)
+            {
+                ret = MEMORY_FAILURE;
+                break;
+            }
+            logState->length        = length;
+            logState->hasGeneration = (flags & INCREMENTAL_LOG_STATE_FLAG_GENERATION) > 0;
+            logState->generation    = get_Incremental_Log_Field(stateData, offset + 16, 8);
+            offset += INCREMENTAL_LOG_STATE_ENTRY_LENGTH;
+            if (numberOfChunks > UINT32_C(0))
+            {
+                logState->chunkFingerprints =
+                    M_REINTERPRET_CAST(uint64_t*, safe_calloc(uint32_to_sizet(numberOfChunks), sizeof(uint64_t)));
+                if (logState->chunkFingerprints == M_NULLPTR)
+                {
+                    ret = MEMORY_FAILURE;
+                    break;
+                }
+                logState->numberOfChunks = numberOfChunks;
+                for (uint32_t chunkIter = UINT32_C(0); chunkIter < numberOfChunks; ++chunkIter)
+                {
+                    logState->chunkFingerprints[chunkIter] = get_Incremental_Log_Field(stateData, offset, 8);
+                    offset += sizeof(uint64_t);
+                }
+            }
+        }
+    }
+    safe_free(&stateData);
+    if (ret != SUCCESS)
+    {
+        free_Incremental_Log_State(state);
+    }
+    return ret;
+}
+
+eReturnValues save_Incremental_Log_State(const char* stateFileName, ptrIncrementalLogState state)
+{
+    eReturnValues ret       = SUCCESS;
+    size_t        stateSize = INCREMENTAL_LOG_STATE_HEADER_LENGTH;
+    size_t        offset    = INCREMENTAL_LOG_STATE_HEADER_LENGTH;
+    DISABLE_NONNULL_COMPARE
+    if (stateFileName == M_NULLPTR || state == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    for (uint32_t logIter = UINT32_C(0); logIter < state->numberOfLogs; ++logIter)
+    {
+        stateSize += INCREMENTAL_LOG_STATE_ENTRY_LENGTH +
+                     (uint32_to_sizet(state->logs[logIter].numberOfChunks) * sizeof(uint64_t));
+    }
+    uint8_t* stateData = M_REINTERPRET_CAST(uint8_t*, safe_calloc(stateSize, sizeof(uint8_t)));
+    if (stateData == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    safe_memcpy(stateData, stateSize, INCREMENTAL_LOG_STATE_SIGNATURE, LOG_BUNDLE_SIGNATURE_LENGTH);
+    set_Incremental_Log_Field(stateData, 8, INCREMENTAL_LOG_STATE_VERSION, 2);
+    set_Incremental_Log_Field(stateData, 10, INCREMENTAL_LOG_CHUNK_SIZE, 2);
+    set_Incremental_Log_Field(stateData, 12, state->numberOfLogs, 4);
+    set_Incremental_Log_Field(stateData, 16, state->lastSampleMilliseconds, 8);
+    set_Incremental_Log_Field(stateData, 24, state->sampleCount, 4);
+    safe_memset(&stateData[32], 32, ' ', 32);
+    safe_memcpy(&stateData[32], 32, state->serialNumber, safe_strnlen(state->serialNumber, SERIAL_NUM_LEN));
+    for (uint32_t logIter = UINT32_C(0); logIter < state->numberOfLogs; ++logIter)
+    {
+        ptrIncrementalLogPageState logState = &state->logs[logIter];
+        set_Incremental_Log_Field(stateData, offset, C_CAST(uint64_t, logState->type), 2);
+        set_Incremental_Log_Field(stateData, offset + 2,
+                                  logState->hasGeneration ? INCREMENTAL_LOG_STATE_FLAG_GENERATION : UINT16_C(0), 2);
+        set_Incremental_Log_Field(stateData, offset + 4, logState->logID, 4);
+        set_Incremental_Log_Field(stateData, offset + 8, logState->length, 4);
+        set_Incremental_Log_Field(stateData, offset + 12, logState->numberOfChunks, 4);
+        set_Incremental_Log_Field(stateData, offset + 16, logState->generation, 8);
+        offset += INCREMENTAL_LOG_STATE_ENTRY_LENGTH;
+        for (uint32_t chunkIter = UINT32_C(0); chunkIter < logState->numberOfChunks; ++chunkIter)
+        {
+            set_Incremental_Log_Field(stateData, offset, logState->chunkFingerprints[chunkIter], 8);
+            offset += sizeof(uint64_t);
+        }
+    }
+    secureFileInfo* stateFile = secure_Open_File(stateFileName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (stateFile == M_NULLPTR || stateFile->error != SEC_FILE_SUCCESS)
+    {
+        ret = FILE_OPEN_ERROR;
+    }
+    else
+    {
+        if (SEC_FILE_SUCCESS != secure_Write_File(stateFile, stateData, stateSize, sizeof(uint8_t), stateSize,
+                                                  M_NULLPTR) ||
+            SEC_FILE_SUCCESS != secure_Flush_File(stateFile))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        if (SEC_FILE_SUCCESS != secure_Close_File(stateFile))
+        {
+            printf("Error closing file!\n");
+        }
+    }
+    free_Secure_File_Info(&stateFile);
+    safe_free(&stateData);
+    return ret;
+}
+
+// The delta file is only created once the first change is found so that samples where nothing changed cost no
+// storage at all.
+typedef struct s_incrementalDeltaWriter
+{
+    tDevice*                    device;
+    const char*                 filePath;
+    secureFileInfo*             file;
+    uint64_t                    sampleMilliseconds;
+    uint64_t                    previousSampleMilliseconds;
+    ptrIncrementalLogStatistics statistics;
+} incrementalDeltaWriter, *ptrIncrementalDeltaWriter;
+
+static eReturnValues write_Incremental_Delta_Data(ptrIncrementalDeltaWriter writer,
+                                                  const uint8_t*            data,
+                                                  uint32_t                  dataLength)
+{
+    if (SEC_FILE_SUCCESS != secure_Write_File(writer->file, data, uint32_to_sizet(dataLength), sizeof(uint8_t),
+                                              uint32_to_sizet(dataLength), M_NULLPTR))
+    {
+        return ERROR_WRITING_FILE;
+    }
+    writer->statistics->deltaBytesWritten += dataLength;
+    return SUCCESS;
+}
+
+static eReturnValues write_Incremental_Delta_Record(ptrIncrementalDeltaWriter  writer,
+                                                    ptrIncrementalLogPageState logState,
+                                                    uint16_t                   flags,
+                                                    const uint8_t*             logData,
+                                                    uint32_t                   offset,
+                                                    uint32_t                   length)
+{
+    eReturnValues ret = SUCCESS;
+    if (writer->file == M_NULLPTR)
+    {
+        if (SUCCESS != create_And_Open_Secure_Log_File_Dev_EZ(writer->device, &writer->file,
+                                                              NAMING_SERIAL_NUMBER_DATE_TIME, writer->filePath,
+                                                              "LOG_DELTA", "bin"))
+        {
+            if (writer->file != M_NULLPTR && writer->file->error == SEC_FILE_INSECURE_PATH)
+            {
+                ret = INSECURE_PATH;
+            }
+            else
+            {
+                ret = FILE_OPEN_ERROR;
+            }
+            free_Secure_File_Info(&writer->file);
+            return ret;
+        }
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, deltaHeader, INCREMENTAL_LOG_DELTA_HEADER_LENGTH);
+        safe_memcpy(deltaHeader, INCREMENTAL_LOG_DELTA_HEADER_LENGTH, INCREMENTAL_LOG_DELTA_SIGNATURE,
+                    LOG_BUNDLE_SIGNATURE_LENGTH);
+        set_Incremental_Log_Field(deltaHeader, 8, INCREMENTAL_LOG_STATE_VERSION, 2);
+        set_Incremental_Log_Field(deltaHeader, 10, INCREMENTAL_LOG_CHUNK_SIZE, 2);
+        set_Incremental_Log_Field(deltaHeader, 16, writer->sampleMilliseconds, 8);
+        set_Incremental_Log_Field(deltaHeader, 24, writer->previousSampleMilliseconds, 8);
+        ret = write_Incremental_Delta_Data(writer, deltaHeader, INCREMENTAL_LOG_DELTA_HEADER_LENGTH);
+        if (ret != SUCCESS)
+        {
+            return ret;
+        }
+    }
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, record, INCREMENTAL_LOG_RECORD_LENGTH);
+    set_Incremental_Log_Field(record, 0, C_CAST(uint64_t, logState->type), 2);
+    set_Incremental_Log_Field(record, 2, flags, 2);
+    set_Incremental_Log_Field(record, 4, logState->logID, 4);
+    set_Incremental_Log_Field(record, 8, logState->length, 4);
+    set_Incremental_Log_Field(record, 12, offset, 4);
+    set_Incremental_Log_Field(record, 16, length, 4);
+    ret = write_Incremental_Delta_Data(writer, record, INCREMENTAL_LOG_RECORD_LENGTH);
+    if (ret == SUCCESS)
+    {
+        ret = write_Incremental_Delta_Data(writer, &logData[offset], length);
+    }
+    return ret;
+}
+
+// Compares a freshly read log against its fingerprints and writes each run of changed chunks as one record.
+static eReturnValues process_Incremental_Log(ptrIncrementalDeltaWriter writer,
+                                             ptrIncrementalLogState    state,
+                                             eLogBundleEntryType       type,
+                                             uint32_t                  logID,
+                                             const uint8_t*            logData,
+                                             uint32_t                  logLength,
+                                             bool                      hasGeneration,
+                                             uint64_t                  generation)
+{
+    eReturnValues              ret            = SUCCESS;
+    uint32_t                   numberOfChunks = get_Incremental_Log_Chunk_Count(logLength);
+    uint64_t*                  fingerprints   = M_NULLPTR;
+    bool                       baseline       = false;
+    uint32_t                   changedChunks  = UINT32_C(0);
+    ptrIncrementalLogPageState logState       = find_Incremental_Log_Page_State(state, type, logID);
+    if (logState == M_NULLPTR)
+    {
+        logState = add_Incremental_Log_Page_State(state, type, logID);
+        if (logState == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        baseline = true;
+    }
+    else if (logState->length != logLength)
+    {
+        baseline = true;
+    }
+    if (numberOfChunks > UINT32_C(0))
+    {
+        fingerprints = M_REINTERPRET_CAST(uint64_t*, safe_calloc(uint32_to_sizet(numberOfChunks), sizeof(uint64_t)));
+        if (fingerprints == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+    }
+    for (uint32_t chunkIter = UINT32_C(0); chunkIter < numberOfChunks; ++chunkIter)
+    {
+        uint32_t chunkOffset    = chunkIter * INCREMENTAL_LOG_CHUNK_SIZE;
+        fingerprints[chunkIter] = fingerprint_Log_Chunk(
+            &logData[chunkOffset], M_Min(INCREMENTAL_LOG_CHUNK_SIZE, logLength - chunkOffset));
+    }
+    logState->length = logLength;
+    if (baseline)
+    {
+        changedChunks = numberOfChunks;
+        ret = write_Incremental_Delta_Record(writer, logState, INCREMENTAL_LOG_RECORD_FLAG_BASELINE, logData, 0,
+                                             logLength);
+    }
+    else
+    {
+        uint32_t chunkIter = UINT32_C(0);
+        while (chunkIter < numberOfChunks && ret == SUCCESS)
+        {
+            if (fingerprints[chunkIter] == logState->chunkFingerprints[chunkIter])
+            {
+                ++chunkIter;
+                continue;
+            }
+            uint32_t runStart = chunkIter;
+            while (chunkIter < numberOfChunks && fingerprints[chunkIter] != logState->chunkFingerprints[chunkIter])
+            {
+                ++chunkIter;
+            }
+            uint32_t runOffset = runStart * INCREMENTAL_LOG_CHUNK_SIZE;
+            uint32_t runLength = M_Min(chunkIter * INCREMENTAL_LOG_CHUNK_SIZE, logLength) - runOffset;
+            changedChunks += chunkIter - runStart;
+            ret = write_Incremental_Delta_Record(writer, logState, UINT16_C(0), logData, runOffset, runLength);
+        }
+    }
+    safe_free_core(M_REINTERPRET_CAST(void**, &logState->chunkFingerprints));
+    logState->chunkFingerprints = fingerprints;
+    logState->numberOfChunks    = numberOfChunks;
+    logState->hasGeneration     = hasGeneration;
+    logState->generation        = generation;
+    if (changedChunks > UINT32_C(0))
+    {
+        writer->statistics->logsChanged += UINT32_C(1);
+        writer->statistics->chunksChanged += changedChunks;
+    }
+    return ret;
+}
+
+static eReturnValues read_Incremental_ATA_Log(tDevice*                    device,
+                                              ptrATALogDirectories        directories,
+                                              uint8_t                     logAddress,
+                                              uint16_t                    featureRegister,
+                                              uint8_t**                   logData,
+                                              uint32_t*                   logLength,
+                                              ptrIncrementalLogStatistics statistics)
+{
+    eReturnValues ret              = SUCCESS;
+    uint32_t      logSize          = UINT32_C(0);
+    uint16_t      pagesPerTransfer = INCREMENTAL_LOG_ATA_TRANSFER_PAGES;
+    // collect_Incremental_ATA_Logs() already read (and counted) the GPL directory, so this does not send a command
+    if (SUCCESS != get_ATA_Log_Size(device, directories, logAddress, &logSize, true, false) || logSize == UINT32_C(0))
+    {
+        return NOT_SUPPORTED;
+    }
+    if (device->drive_info.interface_type == USB_INTERFACE || device->drive_info.interface_type == IEEE_1394_INTERFACE)
+    {
+        pagesPerTransfer = UINT16_C(1);
+    }
+    *logData = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(uint32_to_sizet(logSize), sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (*logData == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    // counted in 32 bits so that stepping past the last page of a 65535 page log cannot wrap back to page 0
+    uint32_t numberOfPages = logSize / LEGACY_DRIVE_SEC_SIZE;
+    for (uint32_t currentPage = UINT32_C(0); currentPage < numberOfPages && ret == SUCCESS;
+         currentPage += pagesPerTransfer)
+    {
+        uint32_t pagesNow = M_Min(C_CAST(uint32_t, pagesPerTransfer), numberOfPages - currentPage);
+        uint32_t bytesNow = pagesNow * LEGACY_DRIVE_SEC_SIZE;
+        ret = send_ATA_Read_Log_Ext_Cmd(device, logAddress, C_CAST(uint16_t, currentPage),
+                                        &(*logData)[currentPage * LEGACY_DRIVE_SEC_SIZE], bytesNow, featureRegister);
+        statistics->commandsIssued += UINT32_C(1);
+        if (ret == SUCCESS)
+        {
+            statistics->bytesRead += bytesNow;
+        }
+    }
+    if (ret != SUCCESS)
+    {
+        safe_free_aligned(logData);
+        return ret;
+    }
+    *logLength = logSize;
+    return SUCCESS;
+}
+
+// Reads a SCSI log page using the length from the last sample as the allocation length, so an unchanged page size
+// takes a single command. A page seen for the first time, or one that grew, is read again with its reported length.
+static eReturnValues read_Incremental_SCSI_Log(tDevice*                    device,
+                                               uint8_t                     pageCode,
+                                               uint8_t                     subpageCode,
+                                               uint32_t                    lastLength,
+                                               uint8_t**                   logData,
+                                               uint32_t*                   logLength,
+                                               ptrIncrementalLogStatistics statistics)
+{
+    eReturnValues ret              = SUCCESS;
+    uint32_t      allocationLength = lastLength > UINT32_C(0) ? lastLength : LOG_PAGE_HEADER_LENGTH;
+    for (uint8_t attempt = UINT8_C(0); attempt < UINT8_C(2); ++attempt)
+    {
+        *logData = M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(uint32_to_sizet(allocationLength), sizeof(uint8_t),
+                                                                    device->os_info.minimumAlignment));
+        if (*logData == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        ret = scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, *logData,
+                                 C_CAST(uint16_t, allocationLength));
+        statistics->commandsIssued += UINT32_C(1);
+        if (ret != SUCCESS)
+        {
+            break;
+        }
+        uint32_t pageLength =
+            C_CAST(uint32_t, M_BytesTo2ByteValue((*logData)[2], (*logData)[3])) + LOG_PAGE_HEADER_LENGTH;
+        statistics->bytesRead += M_Min(pageLength, allocationLength);
+        if (pageLength <= allocationLength)
+        {
+            *logLength = pageLength;
+            return SUCCESS;
+        }
+        safe_free_aligned(logData);
+        allocationLength = M_Min(pageLength, C_CAST(uint32_t, UINT16_MAX));
+        ret              = FAILURE;
+    }
+    safe_free_aligned(logData);
+    return ret;
+}
+
+static eReturnValues read_Incremental_NVMe_Log(tDevice*                    device,
+                                               uint8_t                     logID,
+                                               uint8_t**                   logData,
+                                               uint32_t*                   logLength,
+                                               ptrIncrementalLogStatistics statistics)
+{
+    eReturnValues ret     = SUCCESS;
+    uint64_t      logSize = UINT64_C(0);
+    if (SUCCESS != nvme_Get_Log_Size(device, logID, &logSize) || logSize == UINT64_C(0) || logSize > UINT32_MAX)
+    {
+        return NOT_SUPPORTED;
+    }
+    *logData = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(uint64_to_sizet(logSize), sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (*logData == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    nvmeGetLogPageCmdOpts logOpts;
+    safe_memset(&logOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+    logOpts.nsid    = NVME_ALL_NAMESPACES;
+    logOpts.addr    = *logData;
+    logOpts.dataLen = C_CAST(uint32_t, logSize);
+    logOpts.lid     = logID;
+    logOpts.rae     = true;
+    ret             = nvme_Get_Log_Page(device, &logOpts);
+    statistics->commandsIssued += UINT32_C(1);
+    if (ret != SUCCESS)
+    {
+        safe_free_aligned(logData);
+        return ret;
+    }
+    statistics->bytesRead += logSize;
+    *logLength = C_CAST(uint32_t, logSize);
+    return SUCCESS;
+}
+
+// The first entry of the error information log is the newest one, and its error count goes up by one for every
+// error the controller logs. Reading just that entry tells whether the rest of the log can have changed.
+static eReturnValues get_NVMe_Error_Log_Generation(tDevice*                    device,
+                                                   uint64_t*                   generation,
+                                                   ptrIncrementalLogStatistics statistics)
+{
+    eReturnValues ret = SUCCESS;
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, errorEntry, INCREMENTAL_LOG_NVME_ERROR_ENTRY_BYTES);
+    nvmeGetLogPageCmdOpts logOpts;
+    safe_memset(&logOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+    logOpts.nsid    = NVME_ALL_NAMESPACES;
+    logOpts.addr    = errorEntry;
+    logOpts.dataLen = INCREMENTAL_LOG_NVME_ERROR_ENTRY_BYTES;
+    logOpts.lid     = NVME_LOG_ERROR_ID;
+    logOpts.rae     = true;
+    ret             = nvme_Get_Log_Page(device, &logOpts);
+    statistics->commandsIssued += UINT32_C(1);
+    if (ret == SUCCESS)
+    {
+        statistics->bytesRead += INCREMENTAL_LOG_NVME_ERROR_ENTRY_BYTES;
+        *generation = get_Incremental_Log_Field(errorEntry, 0, 8);
+    }
+    return ret;
+}
+
+static eReturnValues collect_Incremental_ATA_Logs(tDevice*                  device,
+                                                  ptrATALogDirectories      directories,
+                                                  ptrIncrementalLogState    state,
+                                                  ptrIncrementalDeltaWriter writer)
+{
+    eReturnValues ret          = NOT_SUPPORTED;
+    uint16_t      logsToRead[] = {ATA_LOG_DEVICE_STATISTICS, SEAGATE_ATA_LOG_FIELD_ACCESSIBLE_RELIABILITY_METRICS};
+    uint16_t      features[]   = {UINT16_C(0), SEAGATE_FARM_CURRENT};
+    // Every log size below comes from the GPL directory. Read it here the first time so the command is counted, and
+    // so a directory that cannot be read is not tried again for each log.
+    if (directories->gplDirectoryStatus != SUCCESS)
+    {
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, gplDirectory, ATA_LOG_PAGE_LEN_BYTES);
+        if (!device->drive_info.ata_Options.generalPurposeLoggingSupported)
+        {
+            return NOT_SUPPORTED;
+        }
+        ret = get_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_GPL, gplDirectory, ATA_LOG_PAGE_LEN_BYTES);
+        writer->statistics->commandsIssued += UINT32_C(1);
+        if (ret != SUCCESS)
+        {
+            return NOT_SUPPORTED;
+        }
+        writer->statistics->bytesRead += ATA_LOG_PAGE_LEN_BYTES;
+        ret = NOT_SUPPORTED;
+    }
+    for (size_t logIter = SIZE_T_C(0); logIter < SIZE_OF_STACK_ARRAY(logsToRead); ++logIter)
+    {
+        uint8_t* logData   = M_NULLPTR;
+        uint32_t logLength = UINT32_C(0);
+        uint32_t logSize   = UINT32_C(0);
+        if (SUCCESS != get_ATA_Log_Size(device, directories, C_CAST(uint8_t, logsToRead[logIter]), &logSize, true,
+                                        false) ||
+            logSize == UINT32_C(0))
+        {
+            continue;
+        }
+        writer->statistics->logsChecked += UINT32_C(1);
+        if (SUCCESS == read_Incremental_ATA_Log(device, directories, C_CAST(uint8_t, logsToRead[logIter]),
+                                                features[logIter], &logData, &logLength, writer->statistics))
+        {
+            uint32_t logID = (C_CAST(uint32_t, features[logIter]) << 8) | logsToRead[logIter];
+            ret = process_Incremental_Log(writer, state, LOG_BUNDLE_ENTRY_ATA_GPL_LOG, logID, logData, logLength,
+                                          false, UINT64_C(0));
+            safe_free_aligned(&logData);
+            if (ret != SUCCESS)
+            {
+                break;
+            }
+        }
+    }
+    return ret;
+}
+
+static eReturnValues collect_Incremental_SCSI_Logs(tDevice*                  device,
+                                                   ptrIncrementalLogState    state,
+                                                   ptrIncrementalDeltaWriter writer)
+{
+    eReturnValues ret               = NOT_SUPPORTED;
+    bool          subpagesSupported = true;
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, pageList, LEGACY_DRIVE_SEC_SIZE);
+    if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF,
+                                      0, pageList, LEGACY_DRIVE_SEC_SIZE))
+    {
+        subpagesSupported = false;
+        writer->statistics->commandsIssued += UINT32_C(1);
+        if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0, 0, pageList,
+                                          LEGACY_DRIVE_SEC_SIZE))
+        {
+            writer->statistics->commandsIssued += UINT32_C(1);
+            return NOT_SUPPORTED;
+        }
+    }
+    writer->statistics->commandsIssued += UINT32_C(1);
+    uint32_t listLength =
+        M_Min(C_CAST(uint32_t, M_BytesTo2ByteValue(pageList[2], pageList[3])) + LOG_PAGE_HEADER_LENGTH,
+              LEGACY_DRIVE_SEC_SIZE);
+    uint8_t descriptorSize = subpagesSupported ? UINT8_C(2) : UINT8_C(1);
+    for (uint32_t listIter = LOG_PAGE_HEADER_LENGTH; listIter < listLength; listIter += descriptorSize)
+    {
+        uint8_t  pageCode    = pageList[listIter] & 0x3F;
+        uint8_t  subpageCode = subpagesSupported ? pageList[listIter + 1] : UINT8_C(0);
+        uint32_t logID       = (C_CAST(uint32_t, pageCode) << 8) | subpageCode;
+        uint32_t lastLength  = UINT32_C(0);
+        uint8_t* logData     = M_NULLPTR;
+        uint32_t logLength   = UINT32_C(0);
+        if ((pageCode == LP_SUPPORTED_LOG_PAGES && subpageCode == 0) ||
+            (pageCode == LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES && subpageCode == 0xFF))
+        {
+            // the list of pages was just read above
+            continue;
+        }
+        ptrIncrementalLogPageState logState =
+            find_Incremental_Log_Page_State(state, LOG_BUNDLE_ENTRY_SCSI_LOG_PAGE, logID);
+        if (logState != M_NULLPTR)
+        {
+            lastLength = logState->length;
+        }
+        writer->statistics->logsChecked += UINT32_C(1);
+        if (SUCCESS == read_Incremental_SCSI_Log(device, pageCode, subpageCode, lastLength, &logData, &logLength,
+                                                 writer->statistics))
+        {
+            ret = process_Incremental_Log(writer, state, LOG_BUNDLE_ENTRY_SCSI_LOG_PAGE, logID, logData, logLength,
+                                          false, UINT64_C(0));
+            safe_free_aligned(&logData);
+            if (ret != SUCCESS)
+            {
+                break;
+            }
+        }
+    }
+    return ret;
+}
+
+static eReturnValues collect_Incremental_NVMe_Logs(tDevice*                  device,
+                                                   ptrIncrementalLogState    state,
+                                                   ptrIncrementalDeltaWriter writer)
+{
+    eReturnValues ret        = NOT_SUPPORTED;
+    uint64_t      generation = UINT64_C(0);
+    uint8_t*      logData    = M_NULLPTR;
+    uint32_t      logLength  = UINT32_C(0);
+
+    writer->statistics->logsChecked += UINT32_C(1);
+    if (SUCCESS == get_NVMe_Error_Log_Generation(device, &generation, writer->statistics))
+    {
+        ptrIncrementalLogPageState logState =
+            find_Incremental_Log_Page_State(state, LOG_BUNDLE_ENTRY_NVME_LOG_PAGE, NVME_LOG_ERROR_ID);
+        if (logState != M_NULLPTR && logState->hasGeneration && logState->generation == generation)
+        {
+            writer->statistics->logsSkippedByGeneration += UINT32_C(1);
+            ret = SUCCESS;
+        }
+        else if (SUCCESS == read_Incremental_NVMe_Log(device, NVME_LOG_ERROR_ID, &logData, &logLength,
+                                                      writer->statistics))
+        {
+            ret = process_Incremental_Log(writer, state, LOG_BUNDLE_ENTRY_NVME_LOG_PAGE, NVME_LOG_ERROR_ID, logData,
+                                          logLength, true, generation);
+            safe_free_aligned(&logData);
+        }
+    }
+    if (ret != SUCCESS && ret != NOT_SUPPORTED)
+    {
+        return ret;
+    }
+    writer->statistics->logsChecked += UINT32_C(1);
+    if (SUCCESS == read_Incremental_NVMe_Log(device, NVME_LOG_SMART_ID, &logData, &logLength, writer->statistics))
+    {
+        ret = process_Incremental_Log(writer, state, LOG_BUNDLE_ENTRY_NVME_LOG_PAGE, NVME_LOG_SMART_ID, logData,
+                                      logLength, false, UINT64_C(0));
+        safe_free_aligned(&logData);
+    }
+    return ret;
+}
+
+eReturnValues collect_Incremental_Logs(tDevice*                    device,
+                                       ptrATALogDirectories        directories,
+                                       ptrIncrementalLogState      state,
+                                       const char*                 deltaFilePath,
+                                       ptrIncrementalLogStatistics statistics)
+{
+    eReturnValues            ret = NOT_SUPPORTED;
+    incrementalLogStatistics localStatistics;
+    incrementalDeltaWriter   writer;
+    ataLogDirectories        localDirectories;
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || state == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    if (directories == M_NULLPTR)
+    {
+        init_ATA_Log_Directories(&localDirectories);
+        directories = &localDirectories;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(&localStatistics, sizeof(incrementalLogStatistics), 0, sizeof(incrementalLogStatistics));
+    safe_memset(&writer, sizeof(incrementalDeltaWriter), 0, sizeof(incrementalDeltaWriter));
+    if (state->numberOfLogs > UINT32_C(0) &&
+        strncmp(state->serialNumber, device->drive_info.serialNumber, SERIAL_NUM_LEN) != 0)
+    {
+        // fingerprints from another drive are meaningless here
+        free_Incremental_Log_State(state);
+    }
+    snprintf_err_handle(state->serialNumber, SERIAL_NUM_LEN + 1, "%s", device->drive_info.serialNumber);
+    writer.device                     = device;
+    writer.filePath                   = deltaFilePath;
+    writer.sampleMilliseconds         = get_Milliseconds_Since_Unix_Epoch();
+    writer.previousSampleMilliseconds = state->lastSampleMilliseconds;
+    writer.statistics                 = &localStatistics;
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+        ret = collect_Incremental_ATA_Logs(device, directories, state, &writer);
+        break;
+    case SCSI_DRIVE:
+        ret = collect_Incremental_SCSI_Logs(device, state, &writer);
+        break;
+    case NVME_DRIVE:
+        ret = collect_Incremental_NVMe_Logs(device, state, &writer);
+        break;
+    default:
+        break;
+    }
+    if (writer.file != M_NULLPTR)
+    {
+        if (SEC_FILE_SUCCESS != secure_Flush_File(writer.file) && ret == SUCCESS)
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        if (SEC_FILE_SUCCESS != secure_Close_File(writer.file))
+        {
+            printf("Error closing file!\n");
+        }
+        if (VERBOSITY_QUIET < device->deviceVerbosity)
+        {
+            printf("Log changes saved to: %s\n", writer.file->fullpath);
+        }
+        free_Secure_File_Info(&writer.file);
+    }
+    if (ret == SUCCESS)
+    {
+        state->lastSampleMilliseconds = writer.sampleMilliseconds;
+        state->sampleCount += UINT32_C(1);
+    }
+    if (statistics != M_NULLPTR)
+    {
+        safe_memcpy(statistics, sizeof(incrementalLogStatistics), &localStatistics, sizeof(incrementalLogStatistics));
+    }
+    return ret;
+}
+
+void print_Incremental_Log_Statistics(ptrIncrementalLogStatistics statistics)
+{
+    DISABLE_NONNULL_COMPARE
+    if (statistics == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    printf("\nIncremental Log Collection\n");
+    printf("\tLogs checked:                  %" PRIu32 "\n", statistics->logsChecked);
+    printf("\tSkipped, generation unchanged: %" PRIu32 "\n", statistics->logsSkippedByGeneration);
+    printf("\tLogs changed:                  %" PRIu32 "\n", statistics->logsChanged);
+    printf("\tChunks changed:                %" PRIu32 "\n", statistics->chunksChanged);
+    printf("\tCommands issued:               %" PRIu32 "\n", statistics->commandsIssued);
+    printf("\tBytes read:                    %" PRIu64 "\n", statistics->bytesRead);
+    printf("\tDelta bytes written:           %" PRIu64 "\n", statistics->deltaBytesWritten);
+}
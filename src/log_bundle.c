@@ -0,0 +1,693 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_bundle.c
+// \brief This file defines the functions for collecting many device logs into a single indexed bundle file.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "error_translation.h"
+#include "io_utils.h"
+#include "math_utils.h"
+#include "memory_safety.h"
+#include "secure_file.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "log_bundle.h"
+#include "logs.h"
+#include "nvme_operations.h"
+#include "operations_Common.h"
+
+#define LOG_BUNDLE_CRC32_POLYNOMIAL UINT32_C(0xEDB88320) // reflected form of 04C11DB7h
+#define LOG_BUNDLE_ENTRY_GROWTH     UINT32_C(32)
+
+// Standard CRC-32 (same as zip and gzip) so that bundle payloads can be checked with common tools.
+// Start with UINT32_MAX, pass the result back in for each block of data, then invert the final value.
+static uint32_t update_Log_Bundle_CRC_32(uint32_t crc32, const uint8_t* dataBuf, uint32_t dataLength)
+{
+    static bool     crcTableInitialized     = false;
+    static uint32_t crcTable[UINT8_MAX + 1] = {UINT32_C(0)};
+
+    if (!crcTableInitialized)
+    {
+        for (uint32_t tableIndex = UINT32_C(0); tableIndex < (UINT8_MAX + 1); ++tableIndex)
+        {
+            uint32_t value = tableIndex;
+            for (uint8_t bitIndex = UINT8_C(0); bitIndex < UINT8_C(8); ++bitIndex)
+            {
+                if ((value & BIT0) != UINT32_C(0))
+                {
+                    value = (value >> UINT32_C(1)) ^ LOG_BUNDLE_CRC32_POLYNOMIAL;
+                }
+                else
+                {
+                    value >>= UINT32_C(1);
+                }
+            }
+            crcTable[tableIndex] = value;
+        }
+        crcTableInitialized = true;
+    }
+    for (uint32_t iter = UINT32_C(0); iter < dataLength; ++iter)
+    {
+        uint8_t tableIndex = (crc32 ^ dataBuf[iter]) & UINT8_MAX;
+        crc32              = (crc32 >> UINT32_C(8)) ^ crcTable[tableIndex];
+    }
+    return crc32;
+}
+
+static void set_Log_Bundle_Field_LE(uint8_t* dataBuf, uint32_t offset, uint64_t value, uint8_t fieldLength)
+{
+    for (uint8_t byteIter = UINT8_C(0); byteIter < fieldLength; ++byteIter)
+    {
+        dataBuf[offset + byteIter] = M_Byte0(value >> (UINT64_C(8) * byteIter));
+    }
+}
+
+// Copies a string into a fixed width header field padded with spaces, the same way identify and inquiry data is padded.
+static void set_Log_Bundle_String_Field(uint8_t* dataBuf, uint32_t offset, uint32_t fieldLength, const char* string)
+{
+    size_t stringLength = safe_strnlen(string, uint32_to_sizet(fieldLength));
+    safe_memset(&dataBuf[offset], uint32_to_sizet(fieldLength), ' ', uint32_to_sizet(fieldLength));
+    safe_memcpy(&dataBuf[offset], uint32_to_sizet(fieldLength), string, stringLength);
+}
+
+static eReturnValues write_Log_Bundle_Data(ptrLogBundle bundle, const uint8_t* data, uint32_t dataLength)
+{
+    if (dataLength == UINT32_C(0))
+    {
+        return SUCCESS;
+    }
+    if (SEC_FILE_SUCCESS != secure_Write_File(bundle->file, data, uint32_to_sizet(dataLength), sizeof(uint8_t),
+                                              uint32_to_sizet(dataLength), M_NULLPTR))
+    {
+        return ERROR_WRITING_FILE;
+    }
+    bundle->fileOffset += dataLength;
+    return SUCCESS;
+}
+
+// Writes zeros until the file offset is a multiple of the alignment so the next payload starts aligned.
+static eReturnValues pad_Log_Bundle_To_Alignment(ptrLogBundle bundle)
+{
+    eReturnValues ret       = SUCCESS;
+    uint64_t      remainder = bundle->fileOffset % bundle->alignment;
+    if (remainder != UINT64_C(0))
+    {
+        uint32_t padLength = C_CAST(uint32_t, bundle->alignment - remainder);
+        uint8_t* padding   = M_REINTERPRET_CAST(uint8_t*, safe_calloc(uint32_to_sizet(padLength), sizeof(uint8_t)));
+        if (padding == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        ret = write_Log_Bundle_Data(bundle, padding, padLength);
+        safe_free(&padding);
+    }
+    return ret;
+}
+
+eReturnValues open_Log_Bundle(tDevice* device, const char* filePath, uint32_t alignment, ptrLogBundle bundle)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || bundle == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (alignment == UINT32_C(0))
+    {
+        alignment = LOG_BUNDLE_DEFAULT_ALIGNMENT;
+    }
+    if ((alignment & (alignment - UINT32_C(1))) != UINT32_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(bundle, sizeof(logBundle), 0, sizeof(logBundle));
+    bundle->alignment = alignment;
+    if (SUCCESS != create_And_Open_Secure_Log_File_Dev_EZ(device, &bundle->file, NAMING_SERIAL_NUMBER_DATE_TIME,
+                                                          filePath, "LOG_BUNDLE", "bin"))
+    {
+        if (bundle->file != M_NULLPTR && bundle->file->error == SEC_FILE_INSECURE_PATH)
+        {
+            ret = INSECURE_PATH;
+        }
+        else
+        {
+            ret = FILE_OPEN_ERROR;
+        }
+        free_Secure_File_Info(&bundle->file);
+        return ret;
+    }
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, LOG_BUNDLE_HEADER_LENGTH);
+    safe_memcpy(header, LOG_BUNDLE_HEADER_LENGTH, LOG_BUNDLE_SIGNATURE, LOG_BUNDLE_SIGNATURE_LENGTH);
+    set_Log_Bundle_Field_LE(header, 8, LOG_BUNDLE_FORMAT_VERSION, 2);
+    set_Log_Bundle_Field_LE(header, 10, LOG_BUNDLE_HEADER_LENGTH, 2);
+    set_Log_Bundle_Field_LE(header, 12, alignment, 4);
+    set_Log_Bundle_Field_LE(header, 16, get_Milliseconds_Since_Unix_Epoch(), 8);
+    set_Log_Bundle_String_Field(header, 32, 32, device->drive_info.serialNumber);
+    set_Log_Bundle_String_Field(header, 64, 48, device->drive_info.product_identification);
+    set_Log_Bundle_String_Field(header, 112, 16, device->drive_info.product_revision);
+    ret = write_Log_Bundle_Data(bundle, header, LOG_BUNDLE_HEADER_LENGTH);
+    if (ret != SUCCESS)
+    {
+        secure_Close_File(bundle->file);
+        free_Secure_File_Info(&bundle->file);
+    }
+    return ret;
+}
+
+eReturnValues begin_Log_Bundle_Entry(ptrLogBundle bundle, eLogBundleEntryType type, uint32_t logID)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (bundle == M_NULLPTR || bundle->file == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (bundle->entryOpen)
+    {
+        return BAD_PARAMETER;
+    }
+    if (bundle->numberOfEntries == bundle->entryCapacity)
+    {
+        uint32_t newCapacity = bundle->entryCapacity + LOG_BUNDLE_ENTRY_GROWTH;
+        if (safe_reallocf(M_REINTERPRET_CAST(void**, &bundle->entries),
+                          uint32_to_sizet(newCapacity) * sizeof(logBundleEntry)) == M_NULLPTR)
+        {
+            bundle->numberOfEntries = UINT32_C(0);
+            bundle->entryCapacity   = UINT32_C(0);
+            return MEMORY_FAILURE;
+        }
+        bundle->entryCapacity = newCapacity;
+    }
+    ret = pad_Log_Bundle_To_Alignment(bundle);
+    if (ret == SUCCESS)
+    {
+        ptrLogBundleEntry entry = &bundle->entries[bundle->numberOfEntries];
+        safe_memset(entry, sizeof(logBundleEntry), 0, sizeof(logBundleEntry));
+        entry->type                    = type;
+        entry->logID                   = logID;
+        entry->offset                  = bundle->fileOffset;
+        entry->captureTimeMilliseconds = get_Milliseconds_Since_Unix_Epoch();
+        bundle->runningCRC             = UINT32_MAX;
+        bundle->entryStartMilliseconds = entry->captureTimeMilliseconds;
+        bundle->entryOpen              = true;
+    }
+    return ret;
+}
+
+eReturnValues append_Log_Bundle_Entry_Data(ptrLogBundle bundle, const uint8_t* data, uint32_t dataLength)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (bundle == M_NULLPTR || data == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (!bundle->entryOpen)
+    {
+        return BAD_PARAMETER;
+    }
+    ret = write_Log_Bundle_Data(bundle, data, dataLength);
+    if (ret == SUCCESS)
+    {
+        bundle->runningCRC = update_Log_Bundle_CRC_32(bundle->runningCRC, data, dataLength);
+        bundle->entries[bundle->numberOfEntries].length += dataLength;
+    }
+    return ret;
+}
+
+eReturnValues end_Log_Bundle_Entry(ptrLogBundle bundle, eReturnValues captureResult)
+{
+    DISABLE_NONNULL_COMPARE
+    if (bundle == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (!bundle->entryOpen)
+    {
+        return BAD_PARAMETER;
+    }
+    ptrLogBundleEntry entry = &bundle->entries[bundle->numberOfEntries];
+    uint64_t          now   = get_Milliseconds_Since_Unix_Epoch();
+    entry->crc32            = bundle->runningCRC ^ UINT32_MAX;
+    entry->captureResult    = captureResult;
+    if (captureResult != SUCCESS)
+    {
+        entry->flags |= LOG_BUNDLE_ENTRY_FLAG_PARTIAL;
+    }
+    if (now > bundle->entryStartMilliseconds)
+    {
+        entry->captureDurationMilliseconds = now - bundle->entryStartMilliseconds;
+    }
+    bundle->numberOfEntries += UINT32_C(1);
+    bundle->entryOpen = false;
+    return SUCCESS;
+}
+
+eReturnValues add_Log_To_Bundle(ptrLogBundle        bundle,
+                                eLogBundleEntryType type,
+                                uint32_t            logID,
+                                const uint8_t*      data,
+                                uint32_t            dataLength)
+{
+    eReturnValues ret = begin_Log_Bundle_Entry(bundle, type, logID);
+    if (ret == SUCCESS)
+    {
+        ret = append_Log_Bundle_Entry_Data(bundle, data, dataLength);
+        end_Log_Bundle_Entry(bundle, ret);
+    }
+    return ret;
+}
+
+eReturnValues close_Log_Bundle(ptrLogBundle bundle)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (bundle == M_NULLPTR || bundle->file == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (bundle->entryOpen)
+    {
+        end_Log_Bundle_Entry(bundle, FAILURE);
+    }
+    uint64_t tocOffset = bundle->fileOffset;
+    uint32_t tocCRC    = UINT32_MAX;
+    for (uint32_t entryIter = UINT32_C(0); entryIter < bundle->numberOfEntries && ret == SUCCESS; ++entryIter)
+    {
+        ptrLogBundleEntry entry = &bundle->entries[entryIter];
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, tocEntry, LOG_BUNDLE_TOC_ENTRY_LENGTH);
+        set_Log_Bundle_Field_LE(tocEntry, 0, C_CAST(uint64_t, entry->type), 2);
+        set_Log_Bundle_Field_LE(tocEntry, 2, entry->flags, 2);
+        set_Log_Bundle_Field_LE(tocEntry, 4, entry->logID, 4);
+        set_Log_Bundle_Field_LE(tocEntry, 8, entry->offset, 8);
+        set_Log_Bundle_Field_LE(tocEntry, 16, entry->length, 8);
+        set_Log_Bundle_Field_LE(tocEntry, 24, entry->crc32, 4);
+        set_Log_Bundle_Field_LE(tocEntry, 28, C_CAST(uint32_t, entry->captureResult), 4);
+        set_Log_Bundle_Field_LE(tocEntry, 32, entry->captureTimeMilliseconds, 8);
+        set_Log_Bundle_Field_LE(tocEntry, 40, entry->captureDurationMilliseconds, 8);
+        tocCRC = update_Log_Bundle_CRC_32(tocCRC, tocEntry, LOG_BUNDLE_TOC_ENTRY_LENGTH);
+        ret    = write_Log_Bundle_Data(bundle, tocEntry, LOG_BUNDLE_TOC_ENTRY_LENGTH);
+    }
+    if (ret == SUCCESS)
+    {
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, trailer, LOG_BUNDLE_TRAILER_LENGTH);
+        safe_memcpy(trailer, LOG_BUNDLE_TRAILER_LENGTH, LOG_BUNDLE_TRAILER_SIGNATURE, LOG_BUNDLE_SIGNATURE_LENGTH);
+        set_Log_Bundle_Field_LE(trailer, 8, tocOffset, 8);
+        set_Log_Bundle_Field_LE(trailer, 16, bundle->numberOfEntries, 4);
+        set_Log_Bundle_Field_LE(trailer, 20, tocCRC ^ UINT32_MAX, 4);
+        ret = write_Log_Bundle_Data(bundle, trailer, LOG_BUNDLE_TRAILER_LENGTH);
+    }
+    if (SEC_FILE_SUCCESS != secure_Flush_File(bundle->file) && ret == SUCCESS)
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    if (SEC_FILE_SUCCESS != secure_Close_File(bundle->file))
+    {
+        printf("Error closing file!\n");
+    }
+    free_Secure_File_Info(&bundle->file);
+    safe_free_core(M_REINTERPRET_CAST(void**, &bundle->entries));
+    bundle->numberOfEntries = UINT32_C(0);
+    bundle->entryCapacity   = UINT32_C(0);
+    return ret;
+}
+
+// Reads one ATA log into the bundle a transfer at a time so that large logs are never held in memory all at once.
+// A log that fails part way through is kept, flagged partial, with the pages that were read.
+static eReturnValues add_ATA_Log_To_Bundle(tDevice*     device,
+                                           ptrLogBundle bundle,
+                                           uint8_t      logAddress,
+                                           uint16_t     numberOfPages,
+                                           bool         gpl,
+                                           uint8_t*     transferBuffer,
+                                           uint16_t     pagesPerTransfer)
+{
+    eReturnValues ret = begin_Log_Bundle_Entry(
+        bundle, gpl ? LOG_BUNDLE_ENTRY_ATA_GPL_LOG : LOG_BUNDLE_ENTRY_ATA_SMART_LOG, C_CAST(uint32_t, logAddress));
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    eReturnValues captureResult = SUCCESS;
+    if (gpl)
+    {
+        // counted in 32 bits so that stepping past the last page of a 65535 page log cannot wrap back to page 0
+        for (uint32_t currentPage = UINT32_C(0); currentPage < numberOfPages && captureResult == SUCCESS;
+             currentPage += pagesPerTransfer)
+        {
+            uint32_t pagesNow = M_Min(C_CAST(uint32_t, pagesPerTransfer), numberOfPages - currentPage);
+            uint32_t bytesNow = pagesNow * LEGACY_DRIVE_SEC_SIZE;
+            captureResult     = send_ATA_Read_Log_Ext_Cmd(device, logAddress, C_CAST(uint16_t, currentPage),
+                                                          transferBuffer, bytesNow, 0);
+            if (captureResult == SUCCESS)
+            {
+                ret = append_Log_Bundle_Entry_Data(bundle, transferBuffer, bytesNow);
+                if (ret != SUCCESS)
+                {
+                    captureResult = ret;
+                }
+            }
+        }
+    }
+    else
+    {
+        // SMART logs are at most 255 pages and are read in a single command
+        uint32_t logSize = C_CAST(uint32_t, numberOfPages) * LEGACY_DRIVE_SEC_SIZE;
+        captureResult    = ata_SMART_Read_Log(device, logAddress, transferBuffer, logSize);
+        if (captureResult == SUCCESS)
+        {
+            ret = append_Log_Bundle_Entry_Data(bundle, transferBuffer, logSize);
+            if (ret != SUCCESS)
+            {
+                captureResult = ret;
+            }
+        }
+    }
+    end_Log_Bundle_Entry(bundle, captureResult);
+    if (ret == ERROR_WRITING_FILE)
+    {
+        return ret;
+    }
+    return captureResult;
+}
+
+static bool is_ATA_Log_Excluded_From_Bundle(uint8_t logAddress)
+{
+    switch (logAddress)
+    {
+    case ATA_LOG_CURRENT_DEVICE_INTERNAL_STATUS_DATA_LOG: // reading page 0 with the feature set triggers a new capture
+    case ATA_LOG_SAVED_DEVICE_INTERNAL_STATUS_DATA_LOG:   // pulled with pull_Telemetry_Log2 instead
+    case ATA_SCT_COMMAND_STATUS:                          // contents depend on the SCT command that was just sent
+    case ATA_SCT_DATA_TRANSFER:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static eReturnValues collect_ATA_Logs_Into_Bundle(tDevice*             device,
+                                                  ptrATALogDirectories directories,
+                                                  ptrLogBundle         bundle,
+                                                  uint32_t             transferSizeBytes,
+                                                  uint32_t*            logsAdded)
+{
+    eReturnValues ret      = SUCCESS;
+    uint16_t      maxPages = UINT16_C(1);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, gplDirectory, ATA_LOG_PAGE_LEN_BYTES);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, smartDirectory, ATA_LOG_PAGE_LEN_BYTES);
+    bool gplDirectoryRead = SUCCESS == get_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_GPL, gplDirectory,
+                                                             ATA_LOG_PAGE_LEN_BYTES);
+    bool smartDirectoryRead = SUCCESS == get_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_SMART,
+                                                               smartDirectory, ATA_LOG_PAGE_LEN_BYTES);
+    uint16_t pagesPerTransfer = UINT16_C(1);
+
+    if (!gplDirectoryRead && !smartDirectoryRead)
+    {
+        return NOT_SUPPORTED;
+    }
+    if (transferSizeBytes > UINT32_C(0))
+    {
+        // a read log ext transfer is at most UINT16_MAX pages, and never less than one
+        pagesPerTransfer = C_CAST(uint16_t, M_Max(UINT32_C(1), M_Min(transferSizeBytes / LEGACY_DRIVE_SEC_SIZE,
+                                                                     C_CAST(uint32_t, UINT16_MAX))));
+    }
+    else if (device->drive_info.interface_type != USB_INTERFACE &&
+             device->drive_info.interface_type != IEEE_1394_INTERFACE)
+    {
+        pagesPerTransfer = C_CAST(uint16_t, LOG_BUNDLE_DEFAULT_TRANSFER_BYTES / LEGACY_DRIVE_SEC_SIZE);
+    }
+    // SMART logs are read all at once, so the transfer buffer must hold the largest one of those as well
+    for (uint16_t logAddress = UINT16_C(0); logAddress <= UINT8_MAX; ++logAddress)
+    {
+        uint16_t smartPages =
+            M_BytesTo2ByteValue(smartDirectory[(logAddress * 2) + 1], smartDirectory[(logAddress * 2)]);
+        if (smartDirectoryRead && smartPages > maxPages)
+        {
+            maxPages = smartPages;
+        }
+    }
+    maxPages = M_Max(maxPages, pagesPerTransfer);
+    uint8_t* transferBuffer = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(C_CAST(size_t, maxPages) * LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t),
+                                      device->os_info.minimumAlignment));
+    if (transferBuffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (gplDirectoryRead)
+    {
+        ret = add_Log_To_Bundle(bundle, LOG_BUNDLE_ENTRY_ATA_GPL_LOG, ATA_LOG_DIRECTORY, gplDirectory,
+                                ATA_LOG_PAGE_LEN_BYTES);
+        if (ret == SUCCESS)
+        {
+            *logsAdded += UINT32_C(1);
+        }
+    }
+    else if (smartDirectoryRead)
+    {
+        ret = add_Log_To_Bundle(bundle, LOG_BUNDLE_ENTRY_ATA_SMART_LOG, ATA_LOG_DIRECTORY, smartDirectory,
+                                ATA_LOG_PAGE_LEN_BYTES);
+        if (ret == SUCCESS)
+        {
+            *logsAdded += UINT32_C(1);
+        }
+    }
+    for (uint16_t logAddress = UINT16_C(1);
+         logAddress <= UINT8_MAX && ret != ERROR_WRITING_FILE && ret != MEMORY_FAILURE; ++logAddress)
+    {
+        uint16_t gplPages   = UINT16_C(0);
+        uint16_t smartPages = UINT16_C(0);
+        if (is_ATA_Log_Excluded_From_Bundle(C_CAST(uint8_t, logAddress)))
+        {
+            continue;
+        }
+        if (gplDirectoryRead)
+        {
+            gplPages = M_BytesTo2ByteValue(gplDirectory[(logAddress * 2) + 1], gplDirectory[(logAddress * 2)]);
+        }
+        if (smartDirectoryRead)
+        {
+            smartPages = M_BytesTo2ByteValue(smartDirectory[(logAddress * 2) + 1], smartDirectory[(logAddress * 2)]);
+        }
+        if (gplPages > UINT16_C(0))
+        {
+            ret = add_ATA_Log_To_Bundle(device, bundle, C_CAST(uint8_t, logAddress), gplPages, true, transferBuffer,
+                                        pagesPerTransfer);
+        }
+        else if (smartPages > UINT16_C(0))
+        {
+            ret = add_ATA_Log_To_Bundle(device, bundle, C_CAST(uint8_t, logAddress), smartPages, false,
+                                        transferBuffer, pagesPerTransfer);
+        }
+        else
+        {
+            continue;
+        }
+        *logsAdded += UINT32_C(1);
+    }
+    safe_free_aligned(&transferBuffer);
+    if (ret != ERROR_WRITING_FILE && ret != MEMORY_FAILURE)
+    {
+        ret = SUCCESS;
+    }
+    return ret;
+}
+
+static eReturnValues collect_SCSI_Logs_Into_Bundle(tDevice* device, ptrLogBundle bundle, uint32_t* logsAdded)
+{
+    eReturnValues ret               = SUCCESS;
+    bool          subpagesSupported = true;
+    uint8_t*      pageList          = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (pageList == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF,
+                                      0, pageList, LEGACY_DRIVE_SEC_SIZE))
+    {
+        subpagesSupported = false;
+        if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0, 0, pageList,
+                                          LEGACY_DRIVE_SEC_SIZE))
+        {
+            safe_free_aligned(&pageList);
+            return NOT_SUPPORTED;
+        }
+    }
+    uint32_t listLength     = M_Min(C_CAST(uint32_t, M_BytesTo2ByteValue(pageList[2], pageList[3])) +
+                                        LOG_PAGE_HEADER_LENGTH,
+                                    LEGACY_DRIVE_SEC_SIZE);
+    uint8_t  descriptorSize = subpagesSupported ? UINT8_C(2) : UINT8_C(1);
+    for (uint32_t listIter = LOG_PAGE_HEADER_LENGTH; listIter < listLength && ret != ERROR_WRITING_FILE;
+         listIter += descriptorSize)
+    {
+        uint8_t  pageCode    = pageList[listIter] & 0x3F;
+        uint8_t  subpageCode = subpagesSupported ? pageList[listIter + 1] : UINT8_C(0);
+        uint32_t pageSize    = UINT32_C(0);
+        if (SUCCESS != get_SCSI_Log_Size(device, pageCode, subpageCode, &pageSize) || pageSize == UINT32_C(0))
+        {
+            continue;
+        }
+        uint8_t* pageData = M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(uint32_to_sizet(pageSize), sizeof(uint8_t),
+                                                                            device->os_info.minimumAlignment));
+        if (pageData == M_NULLPTR)
+        {
+            ret = MEMORY_FAILURE;
+            break;
+        }
+        uint32_t      logID         = (C_CAST(uint32_t, pageCode) << 8) | subpageCode;
+        eReturnValues captureResult = get_SCSI_Log(device, pageCode, subpageCode, M_NULLPTR, M_NULLPTR, true,
+                                                   pageData, pageSize, M_NULLPTR);
+        ret = begin_Log_Bundle_Entry(bundle, LOG_BUNDLE_ENTRY_SCSI_LOG_PAGE, logID);
+        if (ret == SUCCESS)
+        {
+            if (captureResult == SUCCESS)
+            {
+                ret = append_Log_Bundle_Entry_Data(bundle, pageData, pageSize);
+            }
+            end_Log_Bundle_Entry(bundle, captureResult == SUCCESS ? ret : captureResult);
+            *logsAdded += UINT32_C(1);
+        }
+        safe_free_aligned(&pageData);
+    }
+    safe_free_aligned(&pageList);
+    return ret;
+}
+
+static eReturnValues collect_NVMe_Logs_Into_Bundle(tDevice* device, ptrLogBundle bundle, uint32_t* logsAdded)
+{
+    eReturnValues ret = SUCCESS;
+    // Standard controller scope log pages. Telemetry and persistent event logs are left out since they need a
+    // trigger or a context to be established before they can be read.
+    const uint8_t nvmeBundleLogs[] = {NVME_LOG_SUPPORTED_PAGES_ID,
+                                      NVME_LOG_ERROR_ID,
+                                      NVME_LOG_SMART_ID,
+                                      NVME_LOG_FW_SLOT_ID,
+                                      NVME_LOG_CMD_SPT_EFET_ID,
+                                      NVME_LOG_DEV_SELF_TEST_ID,
+                                      NVME_LOG_ENDURANCE_GROUP_INFO_ID,
+                                      NVME_LOG_SANITIZE_ID};
+    for (size_t logIter = SIZE_T_C(0); logIter < SIZE_OF_STACK_ARRAY(nvmeBundleLogs) && ret != ERROR_WRITING_FILE;
+         ++logIter)
+    {
+        uint64_t logSize = UINT64_C(0);
+        if (SUCCESS != nvme_Get_Log_Size(device, nvmeBundleLogs[logIter], &logSize) || logSize == UINT64_C(0) ||
+            logSize > UINT32_MAX)
+        {
+            continue;
+        }
+        uint8_t* logData = M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(uint64_to_sizet(logSize), sizeof(uint8_t),
+                                                                           device->os_info.minimumAlignment));
+        if (logData == M_NULLPTR)
+        {
+            ret = MEMORY_FAILURE;
+            break;
+        }
+        nvmeGetLogPageCmdOpts logOpts;
+        safe_memset(&logOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+        logOpts.nsid                = NVME_ALL_NAMESPACES;
+        logOpts.addr                = logData;
+        logOpts.dataLen             = C_CAST(uint32_t, logSize);
+        logOpts.lid                 = nvmeBundleLogs[logIter];
+        logOpts.rae                 = true; // do not clear asynchronous events just because the log was collected
+        eReturnValues captureResult = nvme_Get_Log_Page(device, &logOpts);
+        ret = begin_Log_Bundle_Entry(bundle, LOG_BUNDLE_ENTRY_NVME_LOG_PAGE, nvmeBundleLogs[logIter]);
+        if (ret == SUCCESS)
+        {
+            if (captureResult == SUCCESS)
+            {
+                ret = append_Log_Bundle_Entry_Data(bundle, logData, C_CAST(uint32_t, logSize));
+            }
+            end_Log_Bundle_Entry(bundle, captureResult == SUCCESS ? ret : captureResult);
+            *logsAdded += UINT32_C(1);
+        }
+        safe_free_aligned(&logData);
+    }
+    return ret;
+}
+
+eReturnValues collect_Log_Bundle(tDevice*             device,
+                                 ptrATALogDirectories directories,
+                                 const char*          filePath,
+                                 uint32_t             logSelection,
+                                 uint32_t             transferSizeBytes)
+{
+    eReturnValues ret       = SUCCESS;
+    logBundle     bundle;
+    uint32_t      logsAdded = UINT32_C(0);
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (transferSizeBytes % LEGACY_DRIVE_SEC_SIZE)
+    {
+        return BAD_PARAMETER;
+    }
+    ret = open_Log_Bundle(device, filePath, LOG_BUNDLE_DEFAULT_ALIGNMENT, &bundle);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+        if (logSelection & LOG_BUNDLE_ATA_LOGS)
+        {
+            ret = collect_ATA_Logs_Into_Bundle(device, directories, &bundle, transferSizeBytes, &logsAdded);
+        }
+        break;
+    case NVME_DRIVE:
+        if (logSelection & LOG_BUNDLE_NVME_LOGS)
+        {
+            ret = collect_NVMe_Logs_Into_Bundle(device, &bundle, &logsAdded);
+        }
+        break;
+    case SCSI_DRIVE:
+        if (logSelection & LOG_BUNDLE_SCSI_LOGS)
+        {
+            ret = collect_SCSI_Logs_Into_Bundle(device, &bundle, &logsAdded);
+        }
+        break;
+    default:
+        break;
+    }
+    if (VERBOSITY_QUIET < device->deviceVerbosity)
+    {
+        printf("Log bundle saved to: %s\n", bundle.file->fullpath);
+    }
+    eReturnValues closeResult = close_Log_Bundle(&bundle);
+    if (ret == SUCCESS || ret == NOT_SUPPORTED)
+    {
+        ret = closeResult;
+    }
+    if (ret == SUCCESS && logsAdded == UINT32_C(0))
+    {
+        ret = NOT_SUPPORTED;
+    }
+    if (VERBOSITY_QUIET < device->deviceVerbosity && ret == SUCCESS)
+    {
+        printf("Collected %" PRIu32 " logs into the bundle\n", logsAdded);
+    }
+    return ret;
+}
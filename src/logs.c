@@ -80,41 +80,216 @@ eReturnValues create_And_Open_Secure_Log_File_Dev_EZ(
                                            logName, safe_strlen(logName), logExt, safe_strlen(logExt));
 }
 
-eReturnValues get_ATA_Log_Size(tDevice* device, uint8_t logAddress, uint32_t* logFileSize, bool gpl, bool smart)
+void init_ATA_Log_Directories(ptrATALogDirectories directories)
 {
-    eReturnValues ret        = NOT_SUPPORTED; // assume the log is not supported
-    bool          foundInGPL = false;
+    DISABLE_NONNULL_COMPARE
+    if (directories != M_NULLPTR)
+    {
+        safe_memset(directories, sizeof(ataLogDirectories), 0, sizeof(ataLogDirectories));
+        directories->gplDirectoryStatus   = UNKNOWN;
+        directories->smartDirectoryStatus = UNKNOWN;
+        directories->idDataPagesStatus    = UNKNOWN;
+    }
+    RESTORE_NONNULL_COMPARE
+}
 
-#ifdef _DEBUG
-    printf("%s: logAddress %d, gpl=%s, smart=%s\n", __FUNCTION__, logAddress, gpl ? "true" : "false",
-           smart ? "true" : "false");
-#endif
+// Reads a directory into the structure unless it is already there. Only a successful read is kept, so a directory
+// that failed to read is tried again the next time it is needed.
+static eReturnValues load_ATA_Log_Directory(tDevice*             device,
+                                            ptrATALogDirectories directories,
+                                            eATALogDirectoryType directory)
+{
+    eReturnValues* status = &directories->smartDirectoryStatus;
+    if (directory == ATA_LOG_DIRECTORY_GPL)
+    {
+        status = &directories->gplDirectoryStatus;
+    }
+    if (*status == SUCCESS)
+    {
+        return SUCCESS;
+    }
+    if (directory == ATA_LOG_DIRECTORY_GPL && !device->drive_info.ata_Options.generalPurposeLoggingSupported)
+    {
+        return NOT_SUPPORTED;
+    }
+    eReturnValues ret = UNKNOWN;
+    uint8_t*      logBuffer =
+        M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(ATA_LOG_PAGE_LEN_BYTES, sizeof(uint8_t),
+                                                         device->os_info.minimumAlignment));
+    if (logBuffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (directory == ATA_LOG_DIRECTORY_GPL)
+    {
+        ret = send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_DIRECTORY, 0, logBuffer, ATA_LOG_PAGE_LEN_BYTES, 0);
+        if (ret == SUCCESS)
+        {
+            safe_memcpy(directories->gplDirectory, ATA_LOG_PAGE_LEN_BYTES, logBuffer, ATA_LOG_PAGE_LEN_BYTES);
+        }
+    }
+    else
+    {
+        ret = ata_SMART_Read_Log(device, ATA_LOG_DIRECTORY, logBuffer, ATA_LOG_PAGE_LEN_BYTES);
+        if (ret == SUCCESS)
+        {
+            safe_memcpy(directories->smartDirectory, ATA_LOG_PAGE_LEN_BYTES, logBuffer, ATA_LOG_PAGE_LEN_BYTES);
+        }
+    }
+    if (ret == SUCCESS)
+    {
+        *status = SUCCESS;
+    }
+    safe_free_aligned(&logBuffer);
+    return ret;
+}
 
+static eReturnValues load_ATA_Identify_Data_Log_Pages(tDevice* device, ptrATALogDirectories directories)
+{
+    eReturnValues ret = SUCCESS;
+    if (directories->idDataPagesStatus == SUCCESS)
+    {
+        return SUCCESS;
+    }
+    ret = load_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_GPL);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    if (get_ATA_Log_Size_From_Directory(directories->gplDirectory, ATA_LOG_PAGE_LEN_BYTES,
+                                        ATA_LOG_IDENTIFY_DEVICE_DATA) == UINT32_C(0))
+    {
+        return NOT_SUPPORTED;
+    }
     uint8_t* logBuffer = M_REINTERPRET_CAST(
-        uint8_t*, safe_calloc_aligned(LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+        uint8_t*, safe_calloc_aligned(ATA_LOG_PAGE_LEN_BYTES, sizeof(uint8_t), device->os_info.minimumAlignment));
     if (logBuffer == M_NULLPTR)
     {
         return MEMORY_FAILURE;
     }
-    *logFileSize = 0; // make sure we set this to zero in case we don't find it.
-    if (gpl && device->drive_info.ata_Options
-                   .generalPurposeLoggingSupported) // greater than one means check for it in the GPL directory
+    ret = send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_IDENTIFY_DEVICE_DATA, ATA_ID_DATA_LOG_SUPPORTED_PAGES, logBuffer,
+                                    ATA_LOG_PAGE_LEN_BYTES, 0);
+    if (ret == SUCCESS)
     {
-        // first, check to see if the log is in the GPL directory.
-        if (send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_DIRECTORY, 0, logBuffer, LEGACY_DRIVE_SEC_SIZE, 0) == SUCCESS)
+        uint8_t  pageNumber = logBuffer[2];
+        uint16_t revision   = M_BytesTo2ByteValue(logBuffer[1], logBuffer[0]);
+        if (pageNumber == C_CAST(uint8_t, ATA_ID_DATA_LOG_SUPPORTED_PAGES) && revision >= ATA_ID_DATA_VERSION_1)
         {
-            *logFileSize = get_ATA_Log_Size_From_Directory(logBuffer, LEGACY_DRIVE_SEC_SIZE, logAddress);
-            if (*logFileSize > 0)
+            uint8_t listLen = logBuffer[ATA_ID_DATA_SUP_PG_LIST_LEN_OFFSET];
+            safe_memset(directories->idDataPages, sizeof(directories->idDataPages), 0,
+                        sizeof(directories->idDataPages));
+            for (uint16_t iter = ATA_ID_DATA_SUP_PG_LIST_OFFSET;
+                 iter < C_CAST(uint16_t, listLen + ATA_ID_DATA_SUP_PG_LIST_OFFSET) && iter < ATA_LOG_PAGE_LEN_BYTES;
+                 ++iter)
             {
-                ret        = SUCCESS;
-                foundInGPL = true;
+                directories->idDataPages[logBuffer[iter]] = true;
             }
-            else
-            {
+            directories->idDataPagesStatus = SUCCESS;
+        }
+        else
+        {
+            ret = NOT_SUPPORTED;
+        }
+    }
+    safe_free_aligned(&logBuffer);
+    return ret;
+}
+
+eReturnValues get_ATA_Log_Directory(tDevice*             device,
+                                    ptrATALogDirectories directories,
+                                    eATALogDirectoryType directory,
+                                    uint8_t*             directoryData,
+                                    uint32_t             dataSize)
+{
+    ataLogDirectories localDirectories;
+    eReturnValues     ret = UNKNOWN;
+    DISABLE_NONNULL_COMPARE
+    if (directoryData == M_NULLPTR || dataSize < ATA_LOG_PAGE_LEN_BYTES)
+    {
+        return BAD_PARAMETER;
+    }
+    if (directories == M_NULLPTR)
+    {
+        init_ATA_Log_Directories(&localDirectories);
+        directories = &localDirectories;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (device->drive_info.drive_type != ATA_DRIVE)
+    {
+        return NOT_SUPPORTED;
+    }
+    ret = load_ATA_Log_Directory(device, directories, directory);
+    if (ret == SUCCESS)
+    {
+        if (directory == ATA_LOG_DIRECTORY_GPL)
+        {
+            safe_memcpy(directoryData, dataSize, directories->gplDirectory, ATA_LOG_PAGE_LEN_BYTES);
+        }
+        else
+        {
+            safe_memcpy(directoryData, dataSize, directories->smartDirectory, ATA_LOG_PAGE_LEN_BYTES);
+        }
+    }
+    return ret;
+}
+
+bool is_ATA_Identify_Data_Log_Page_Supported(tDevice* device, ptrATALogDirectories directories, uint8_t pageNumber)
+{
+    ataLogDirectories localDirectories;
+    bool              supported = false;
+    DISABLE_NONNULL_COMPARE
+    if (directories == M_NULLPTR)
+    {
+        init_ATA_Log_Directories(&localDirectories);
+        directories = &localDirectories;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (device->drive_info.drive_type == ATA_DRIVE &&
+        SUCCESS == load_ATA_Identify_Data_Log_Pages(device, directories))
+    {
+        supported = directories->idDataPages[pageNumber];
+    }
+    return supported;
+}
+
+eReturnValues get_ATA_Log_Size(tDevice*             device,
+                               ptrATALogDirectories directories,
+                               uint8_t              logAddress,
+                               uint32_t*            logFileSize,
+                               bool                 gpl,
+                               bool                 smart)
+{
+    eReturnValues     ret        = NOT_SUPPORTED; // assume the log is not supported
+    bool              foundInGPL = false;
+    ataLogDirectories localDirectories;
+
 #ifdef _DEBUG
-                printf("\t Didn't find it in GPL\n");
+    printf("%s: logAddress %d, gpl=%s, smart=%s\n", __FUNCTION__, logAddress, gpl ? "true" : "false",
+           smart ? "true" : "false");
+#endif
+
+    DISABLE_NONNULL_COMPARE
+    if (directories == M_NULLPTR)
+    {
+        init_ATA_Log_Directories(&localDirectories);
+        directories = &localDirectories;
+    }
+    RESTORE_NONNULL_COMPARE
+    *logFileSize = 0; // make sure we set this to zero in case we don't find it.
+    // load_ATA_Log_Directory() does not send anything when GPL is not supported or the directory was already read
+    if (gpl && SUCCESS == load_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_GPL))
+    {
+        *logFileSize = get_ATA_Log_Size_From_Directory(directories->gplDirectory, ATA_LOG_PAGE_LEN_BYTES, logAddress);
+        if (*logFileSize > 0)
+        {
+            ret        = SUCCESS;
+            foundInGPL = true;
+        }
+        else
+        {
+#ifdef _DEBUG
+            printf("\t Didn't find it in GPL\n");
 #endif
-            }
         }
     }
     else
@@ -125,14 +300,10 @@ eReturnValues get_ATA_Log_Size(tDevice* device, uint8_t logAddress, uint32_t* lo
     }
     if (smart && !foundInGPL)
     {
-        if (gpl)
-        {
-            // if we already tried the GPL buffer, make sure we clean it back up before we check again just to be safe.
-            safe_memset(logBuffer, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-        }
-        if (ata_SMART_Read_Log(device, ATA_LOG_DIRECTORY, logBuffer, LEGACY_DRIVE_SEC_SIZE) == SUCCESS)
+        if (SUCCESS == load_ATA_Log_Directory(device, directories, ATA_LOG_DIRECTORY_SMART))
         {
-            *logFileSize = get_ATA_Log_Size_From_Directory(logBuffer, LEGACY_DRIVE_SEC_SIZE, logAddress);
+            *logFileSize =
+                get_ATA_Log_Size_From_Directory(directories->smartDirectory, ATA_LOG_PAGE_LEN_BYTES, logAddress);
             if (*logFileSize > UINT32_C(0))
             {
                 ret = SUCCESS;
@@ -184,7 +355,6 @@ eReturnValues get_ATA_Log_Size(tDevice* device, uint8_t logAddress, uint32_t* lo
             }
         }
     }
-    safe_free_aligned(&logBuffer);
     return ret;
 }
 
@@ -816,103 +986,633 @@ eReturnValues get_SCSI_Mode_Page(tDevice*             device,
     return ret;
 }
 
-static M_INLINE void modify_Short_Blk_Desc_Num_Blocks(uint8_t* mp, uint8_t mpheaderlen, uint32_t lba)
+static void drop_SCSI_Mode_Page_Cache_Entry(scsiModePageCacheEntry* entry)
 {
-    mp[mpheaderlen + 0] = M_Byte3(lba);
-    mp[mpheaderlen + 1] = M_Byte2(lba);
-    mp[mpheaderlen + 2] = M_Byte1(lba);
-    mp[mpheaderlen + 3] = M_Byte0(lba);
+    safe_free(&entry->modeData);
+    safe_memset(entry, sizeof(scsiModePageCacheEntry), 0, sizeof(scsiModePageCacheEntry));
 }
 
-static M_INLINE void modify_Short_Blk_Desc_Block_Len(uint8_t* mp, uint8_t mpheaderlen, uint32_t len)
+void init_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache)
 {
-    mp[mpheaderlen + 5] = M_Byte2(len);
-    mp[mpheaderlen + 6] = M_Byte1(len);
-    mp[mpheaderlen + 7] = M_Byte0(len);
+    DISABLE_NONNULL_COMPARE
+    if (cache != M_NULLPTR)
+    {
+        safe_memset(cache, sizeof(scsiModePageCache), 0, sizeof(scsiModePageCache));
+    }
+    RESTORE_NONNULL_COMPARE
 }
 
-static M_INLINE void modify_Long_Blk_Desc_Num_Blocks(uint8_t* mp, uint8_t mpheaderlen, uint64_t lba)
+void invalidate_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache)
 {
-    mp[mpheaderlen + 0] = M_Byte7(lba);
-    mp[mpheaderlen + 1] = M_Byte6(lba);
-    mp[mpheaderlen + 2] = M_Byte5(lba);
-    mp[mpheaderlen + 3] = M_Byte4(lba);
-    mp[mpheaderlen + 4] = M_Byte3(lba);
-    mp[mpheaderlen + 5] = M_Byte2(lba);
-    mp[mpheaderlen + 6] = M_Byte1(lba);
-    mp[mpheaderlen + 7] = M_Byte0(lba);
+    DISABLE_NONNULL_COMPARE
+    if (cache != M_NULLPTR)
+    {
+        for (uint8_t iter = UINT8_C(0); iter < SCSI_MODE_PAGE_CACHE_ENTRIES; ++iter)
+        {
+            drop_SCSI_Mode_Page_Cache_Entry(&cache->entries[iter]);
+        }
+    }
+    RESTORE_NONNULL_COMPARE
 }
 
-static M_INLINE void modify_Long_Blk_Desc_Block_Len(uint8_t* mp, uint8_t mpheaderlen, uint32_t len)
+void free_SCSI_Mode_Page_Cache(ptrSCSIModePageCache cache)
 {
-    mp[mpheaderlen + 12] = M_Byte3(len);
-    mp[mpheaderlen + 13] = M_Byte2(len);
-    mp[mpheaderlen + 14] = M_Byte1(len);
-    mp[mpheaderlen + 15] = M_Byte0(len);
+    DISABLE_NONNULL_COMPARE
+    if (cache != M_NULLPTR)
+    {
+        invalidate_SCSI_Mode_Page_Cache(cache);
+        safe_memset(cache, sizeof(scsiModePageCache), 0, sizeof(scsiModePageCache));
+    }
+    RESTORE_NONNULL_COMPARE
 }
 
-static eReturnValues modify_SCSI_Block_Descriptor_10B(tDevice*                 device,
-                                                      modifyScsiBlkDescFields  modifications,
-                                                      modifyScsiBlkDescFields* endingBlockDescriptor)
+static scsiModePageCacheEntry* find_SCSI_Mode_Page_Cache_Entry(ptrSCSIModePageCache cache,
+                                                               uint8_t              modePage,
+                                                               uint8_t              subpage,
+                                                               eScsiModePageControl mpc)
 {
-    eReturnValues ret = SUCCESS;
-    // SPC2 added concept of long LBA, so use that to determine when to request long lba info.
-    // NOTE: SBC allows returning 0 when requesting longlba format data, so need to check that as well if long lba is
-    // not supported-TJE
-    bool    llbaa        = M_ToBool(device->drive_info.scsiVersion >= SCSI_VERSION_SPC_2);
-    uint8_t attemptCount = UINT8_C(
-        0); // to prevent weird case of misbehaving hardware that fails to respond correctly with and without llbaa
-    // Use a do-while here. If reaching the end and llbaa is false, exit the loop.
-    // this will allow for a retry when needed or only run the command once if llbaa is not supported on older products
-    do
+    for (uint8_t iter = UINT8_C(0); iter < SCSI_MODE_PAGE_CACHE_ENTRIES; ++iter)
     {
-        uint8_t  mpalloclen = MODE_PARAMETER_HEADER_10_LEN + LONG_LBA_BLOCK_DESCRIPTOR_LEN;
-        uint8_t* mp =
-            M_STATIC_CAST(uint8_t*, safe_calloc_aligned(mpalloclen, sizeof(uint8_t), device->os_info.minimumAlignment));
-        if (mp == M_NULLPTR)
+        scsiModePageCacheEntry* entry = &cache->entries[iter];
+        if (entry->valid && entry->modePage == modePage && entry->subpage == subpage && entry->mpc == mpc)
         {
-            return MEMORY_FAILURE;
+            return entry;
         }
-        ++attemptCount;
-        if (SUCCESS == scsi_Mode_Sense_10(device, 0, mpalloclen, 0, false, llbaa, MPC_CURRENT_VALUES, mp))
+    }
+    return M_NULLPTR;
+}
+
+static void add_SCSI_Mode_Page_Cache_Entry(ptrSCSIModePageCache cache,
+                                           uint8_t              modePage,
+                                           uint8_t              subpage,
+                                           eScsiModePageControl mpc,
+                                           const uint8_t*       modeData,
+                                           uint32_t             length)
+{
+    scsiModePageCacheEntry* entry = &cache->entries[0];
+    for (uint8_t iter = UINT8_C(0); iter < SCSI_MODE_PAGE_CACHE_ENTRIES; ++iter)
+    {
+        if (!cache->entries[iter].valid)
         {
-            uint16_t modeDataLen   = UINT16_C(0);
-            uint16_t blockDescLen  = UINT16_C(0);
-            bool     returnedllbaa = false;
-            get_mode_param_header_10_fields(mp, mpalloclen, &modeDataLen, M_NULLPTR, M_NULLPTR, &returnedllbaa,
-                                            &blockDescLen);
-            if (blockDescLen > 0)
+            entry = &cache->entries[iter];
+            break;
+        }
+        if (cache->entries[iter].lastUsed < entry->lastUsed)
+        {
+            entry = &cache->entries[iter];
+        }
+    }
+    drop_SCSI_Mode_Page_Cache_Entry(entry);
+    entry->modeData = M_REINTERPRET_CAST(uint8_t*, safe_malloc(uint32_to_sizet(length)));
+    if (entry->modeData == M_NULLPTR)
+    {
+        return;
+    }
+    safe_memcpy(entry->modeData, uint32_to_sizet(length), modeData, uint32_to_sizet(length));
+    entry->modePage = modePage;
+    entry->subpage  = subpage;
+    entry->mpc      = mpc;
+    entry->length   = length;
+    entry->lastUsed = ++cache->useCounter;
+    entry->valid    = true;
+}
+
+eReturnValues cached_SCSI_Mode_Sense_10(tDevice*             device,
+                                        ptrSCSIModePageCache cache,
+                                        uint8_t              pageCode,
+                                        uint32_t             allocationLength,
+                                        uint8_t              subPageCode,
+                                        bool                 DBD,
+                                        bool                 LLBAA,
+                                        eScsiModePageControl pageControl,
+                                        uint8_t*             ptrData)
+{
+    eReturnValues ret = UNKNOWN;
+    if (cache == M_NULLPTR || !DBD || LLBAA ||
+        (pageControl != MPC_CHANGABLE_VALUES && pageControl != MPC_DEFAULT_VALUES))
+    {
+        // only changeable and default pages without block descriptors are cached
+        return scsi_Mode_Sense_10(device, pageCode, allocationLength, subPageCode, DBD, LLBAA, pageControl, ptrData);
+    }
+    scsiModePageCacheEntry* entry = find_SCSI_Mode_Page_Cache_Entry(cache, pageCode, subPageCode, pageControl);
+    if (entry != M_NULLPTR)
+    {
+        entry->lastUsed = ++cache->useCounter;
+        safe_memset(ptrData, allocationLength, 0, allocationLength);
+        safe_memcpy(ptrData, allocationLength, entry->modeData, M_Min(entry->length, allocationLength));
+        return SUCCESS;
+    }
+    ret = scsi_Mode_Sense_10(device, pageCode, allocationLength, subPageCode, DBD, LLBAA, pageControl, ptrData);
+    if (ret == SUCCESS && allocationLength >= MODE_PARAMETER_HEADER_10_LEN)
+    {
+        // Only keep the page when all of it was transferred and it is the page that was asked for. Otherwise a later
+        // caller with a larger buffer would get a truncated page.
+        uint32_t modeDataLength = C_CAST(uint32_t, M_BytesTo2ByteValue(ptrData[0], ptrData[1])) + UINT32_C(2);
+        uint32_t pageOffset =
+            MODE_PARAMETER_HEADER_10_LEN + C_CAST(uint32_t, M_BytesTo2ByteValue(ptrData[6], ptrData[7]));
+        if (modeDataLength <= allocationLength && modeDataLength <= SCSI_MODE_PAGE_CACHE_MAX_LENGTH &&
+            pageOffset < modeDataLength && get_bit_range_uint8(ptrData[pageOffset], 5, 0) == pageCode)
+        {
+            add_SCSI_Mode_Page_Cache_Entry(cache, pageCode, subPageCode, pageControl, ptrData, modeDataLength);
+        }
+    }
+    return ret;
+}
+
+static void drop_SCSI_Mode_Page_Cache_Entries(ptrSCSIModePageCache cache, uint8_t modePage, uint8_t subpage)
+{
+    for (uint8_t iter = UINT8_C(0); iter < SCSI_MODE_PAGE_CACHE_ENTRIES; ++iter)
+    {
+        scsiModePageCacheEntry* entry = &cache->entries[iter];
+        if (entry->valid && entry->modePage == modePage && entry->subpage == subpage)
+        {
+            drop_SCSI_Mode_Page_Cache_Entry(entry);
+        }
+    }
+}
+
+void invalidate_SCSI_Mode_Pages(ptrSCSIModePageCache cache,
+                                const uint8_t*       modeSelectData,
+                                uint32_t             dataSize,
+                                bool                 sixByteHeader)
+{
+    uint32_t offset = UINT32_C(0);
+    DISABLE_NONNULL_COMPARE
+    if (cache == M_NULLPTR || modeSelectData == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (sixByteHeader && dataSize >= MODE_PARAMETER_HEADER_6_LEN)
+    {
+        offset = MODE_PARAMETER_HEADER_6_LEN + modeSelectData[3];
+    }
+    else if (!sixByteHeader && dataSize >= MODE_PARAMETER_HEADER_10_LEN)
+    {
+        offset = MODE_PARAMETER_HEADER_10_LEN + M_BytesTo2ByteValue(modeSelectData[6], modeSelectData[7]);
+    }
+    else
+    {
+        invalidate_SCSI_Mode_Page_Cache(cache);
+        return;
+    }
+    // a parameter list can carry more than one page, so walk all of them
+    while (offset + UINT32_C(2) <= dataSize)
+    {
+        uint8_t  modePage   = get_bit_range_uint8(modeSelectData[offset], 5, 0);
+        uint8_t  subpage    = UINT8_C(0);
+        uint32_t pageLength = UINT32_C(0);
+        if (modeSelectData[offset] & BIT6)
+        {
+            if (offset + UINT32_C(4) > dataSize)
             {
-                uint64_t startLBAToVerify    = UINT64_C(0);
-                uint64_t startBlkLenToVerify = UINT64_C(0);
-                if (llbaa != returnedllbaa)
-                {
-                    printf("WARNING: Requested long lba mode and returned mode header data do not match!\n");
-                }
-                if (returnedllbaa)
-                {
-                    // long block descriptor
-                    // TODO: check this matches the requested llbaa value?
-                    get_mode_long_block_descriptor_fields(mp + MODE_PARAMETER_HEADER_10_LEN, blockDescLen,
-                                                          &startLBAToVerify, &startBlkLenToVerify);
-                    if (startLBAToVerify == UINT64_C(0))
-                    {
-                        // longlba mode returned without error, but need to use short block descriptor instead since
-                        // this is zero
-                        llbaa = false;
-                        safe_free_aligned(&mp);
-                        continue;
-                    }
-                    // Modify requested fields
-                    if (modifications.modifyNumBlocks)
-                    {
-                        modify_Long_Blk_Desc_Num_Blocks(mp, MODE_PARAMETER_HEADER_10_LEN,
-                                                        modifications.numberOfLogicalBlocks);
-                    }
-                    if (modifications.modifyBlockLen)
-                    {
-                        modify_Long_Blk_Desc_Block_Len(mp, MODE_PARAMETER_HEADER_10_LEN,
-                                                       modifications.logicalBlockLength);
+                break;
+            }
+            subpage    = modeSelectData[offset + 1];
+            pageLength = C_CAST(uint32_t, M_BytesTo2ByteValue(modeSelectData[offset + 2], modeSelectData[offset + 3])) +
+                         UINT32_C(4);
+        }
+        else
+        {
+            pageLength = C_CAST(uint32_t, modeSelectData[offset + 1]) + UINT32_C(2);
+        }
+        if (offset + pageLength > dataSize || modePage == 0)
+        {
+            // vendor specific page zero has no defined format, so nothing can be assumed about what it changed
+            invalidate_SCSI_Mode_Page_Cache(cache);
+            return;
+        }
+        drop_SCSI_Mode_Page_Cache_Entries(cache, modePage, subpage);
+        offset += pageLength;
+    }
+}
+
+eReturnValues cached_SCSI_Mode_Select_10(tDevice*             device,
+                                         ptrSCSIModePageCache cache,
+                                         uint16_t             parameterListLength,
+                                         bool                 pageFormat,
+                                         bool                 savePages,
+                                         bool                 resetToDefaults,
+                                         uint8_t*             ptrData,
+                                         uint32_t             dataSize)
+{
+    eReturnValues ret =
+        scsi_Mode_Select_10(device, parameterListLength, pageFormat, savePages, resetToDefaults, ptrData, dataSize);
+    if (ret == SUCCESS && !resetToDefaults && ptrData != M_NULLPTR)
+    {
+        invalidate_SCSI_Mode_Pages(cache, ptrData, M_Min(C_CAST(uint32_t, parameterListLength), dataSize), false);
+    }
+    else
+    {
+        // Reverting to defaults changes every page. A failed MODE SELECT is not expected to change anything, but
+        // the device may have been left in a state that is not worth guessing about.
+        invalidate_SCSI_Mode_Page_Cache(cache);
+    }
+    return ret;
+}
+
+static void drop_Log_Page_Cache_Entry(logPageCacheEntry* entry)
+{
+    safe_free(&entry->data);
+    safe_memset(entry, sizeof(logPageCacheEntry), 0, sizeof(logPageCacheEntry));
+}
+
+static bool is_Log_Page_Cache_Entry_Current(const logPageCacheEntry* entry,
+                                            const logPageCache*      cache,
+                                            eLogPageCacheSource      source,
+                                            uint8_t                  page,
+                                            uint8_t                  subpage)
+{
+    return entry->valid && entry->source == source && entry->page == page && entry->subpage == subpage &&
+           (cache->maxAgeMilliseconds == LOG_PAGE_CACHE_NO_EXPIRATION ||
+            get_Milliseconds_Since_Unix_Epoch() - entry->readMilliseconds < cache->maxAgeMilliseconds);
+}
+
+static void add_Log_Page_Cache_Entry(ptrLogPageCache     cache,
+                                     eLogPageCacheSource source,
+                                     uint8_t             page,
+                                     uint8_t             subpage,
+                                     uint16_t            parameterPointer,
+                                     const uint8_t*      data,
+                                     uint32_t            length)
+{
+    logPageCacheEntry* entry = &cache->entries[0];
+    for (uint8_t iter = UINT8_C(0); iter < LOG_PAGE_CACHE_ENTRIES; ++iter)
+    {
+        logPageCacheEntry* current = &cache->entries[iter];
+        if (current->valid && current->source == source && current->page == page && current->subpage == subpage &&
+            current->parameterPointer == parameterPointer)
+        {
+            // replace the older copy of this page
+            entry = current;
+            break;
+        }
+        if (!current->valid)
+        {
+            entry = current;
+        }
+        else if (entry->valid && current->lastUsed < entry->lastUsed)
+        {
+            entry = current;
+        }
+    }
+    drop_Log_Page_Cache_Entry(entry);
+    entry->data = M_REINTERPRET_CAST(uint8_t*, safe_malloc(uint32_to_sizet(length)));
+    if (entry->data == M_NULLPTR)
+    {
+        return;
+    }
+    safe_memcpy(entry->data, uint32_to_sizet(length), data, uint32_to_sizet(length));
+    entry->source           = source;
+    entry->page             = page;
+    entry->subpage          = subpage;
+    entry->parameterPointer = parameterPointer;
+    entry->readMilliseconds = get_Milliseconds_Since_Unix_Epoch();
+    entry->length           = length;
+    entry->lastUsed         = ++cache->useCounter;
+    entry->valid            = true;
+}
+
+static bool read_ATA_Log_Page_Cache(ptrLogPageCache     cache,
+                                    eLogPageCacheSource source,
+                                    uint8_t             logAddress,
+                                    uint8_t*            ptrData,
+                                    uint32_t            dataSize)
+{
+    for (uint8_t iter = UINT8_C(0); iter < LOG_PAGE_CACHE_ENTRIES; ++iter)
+    {
+        logPageCacheEntry* entry = &cache->entries[iter];
+        if (is_Log_Page_Cache_Entry_Current(entry, cache, source, logAddress, 0) && entry->length >= dataSize)
+        {
+            safe_memcpy(ptrData, dataSize, entry->data, dataSize);
+            entry->lastUsed = ++cache->useCounter;
+            return true;
+        }
+    }
+    return false;
+}
+
+// A single page can come from a page read on its own or from a copy of the whole log
+static bool read_ATA_Log_Single_Page_Cache(ptrLogPageCache cache,
+                                           uint8_t         logAddress,
+                                           uint16_t        pageNumber,
+                                           uint8_t*        ptrData,
+                                           uint32_t        dataSize)
+{
+    uint32_t pageOffset = C_CAST(uint32_t, pageNumber) * ATA_LOG_PAGE_LEN_BYTES;
+    for (uint8_t iter = UINT8_C(0); iter < LOG_PAGE_CACHE_ENTRIES; ++iter)
+    {
+        logPageCacheEntry* entry = &cache->entries[iter];
+        const uint8_t*     page  = M_NULLPTR;
+        if (is_Log_Page_Cache_Entry_Current(entry, cache, LOG_PAGE_CACHE_ATA_LOG_PAGE, logAddress, 0) &&
+            entry->parameterPointer == pageNumber && entry->length >= ATA_LOG_PAGE_LEN_BYTES)
+        {
+            page = entry->data;
+        }
+        else if (is_Log_Page_Cache_Entry_Current(entry, cache, LOG_PAGE_CACHE_ATA_LOG, logAddress, 0) &&
+                 entry->length >= pageOffset + ATA_LOG_PAGE_LEN_BYTES)
+        {
+            page = &entry->data[pageOffset];
+        }
+        else
+        {
+            continue;
+        }
+        safe_memcpy(ptrData, dataSize, page, ATA_LOG_PAGE_LEN_BYTES);
+        entry->lastUsed = ++cache->useCounter;
+        return true;
+    }
+    return false;
+}
+
+// Builds what LOG SENSE would have returned for parameterPointer from a complete copy of the page. Parameters are
+// in ascending order, so these are the parameters at or above the pointer with the page length set to match.
+static void build_SCSI_Log_Page_From_Cache(const logPageCacheEntry* entry,
+                                           uint32_t                 pageLength,
+                                           uint16_t                 parameterPointer,
+                                           uint8_t*                 ptrData,
+                                           uint32_t                 dataSize)
+{
+    uint32_t returnedLength = LOG_PAGE_HEADER_LENGTH;
+    safe_memset(ptrData, dataSize, 0, dataSize);
+    safe_memcpy(ptrData, dataSize, entry->data, M_Min(dataSize, C_CAST(uint32_t, LOG_PAGE_HEADER_LENGTH)));
+    for (uint32_t offset = LOG_PAGE_HEADER_LENGTH; offset + UINT32_C(4) <= pageLength;)
+    {
+        uint16_t parameterCode   = M_BytesTo2ByteValue(entry->data[offset], entry->data[offset + 1]);
+        uint32_t parameterLength = C_CAST(uint32_t, entry->data[offset + 3]) + UINT32_C(4);
+        if (offset + parameterLength > pageLength)
+        {
+            break;
+        }
+        if (parameterCode >= parameterPointer)
+        {
+            if (returnedLength < dataSize)
+            {
+                safe_memcpy(&ptrData[returnedLength], dataSize - returnedLength, &entry->data[offset],
+                            M_Min(parameterLength, dataSize - returnedLength));
+            }
+            returnedLength += parameterLength;
+        }
+        offset += parameterLength;
+    }
+    if (dataSize >= LOG_PAGE_HEADER_LENGTH)
+    {
+        ptrData[2] = M_Byte1(returnedLength - LOG_PAGE_HEADER_LENGTH);
+        ptrData[3] = M_Byte0(returnedLength - LOG_PAGE_HEADER_LENGTH);
+    }
+}
+
+static bool read_SCSI_Log_Page_Cache(ptrLogPageCache cache,
+                                     uint8_t         pageCode,
+                                     uint8_t         subpageCode,
+                                     uint16_t        parameterPointer,
+                                     uint8_t*        ptrData,
+                                     uint32_t        dataSize)
+{
+    for (uint8_t iter = UINT8_C(0); iter < LOG_PAGE_CACHE_ENTRIES; ++iter)
+    {
+        logPageCacheEntry* entry = &cache->entries[iter];
+        if (!is_Log_Page_Cache_Entry_Current(entry, cache, LOG_PAGE_CACHE_SCSI_LOG_SENSE, pageCode, subpageCode) ||
+            entry->parameterPointer > parameterPointer || entry->length < LOG_PAGE_HEADER_LENGTH)
+        {
+            continue;
+        }
+        uint32_t pageLength =
+            C_CAST(uint32_t, M_BytesTo2ByteValue(entry->data[2], entry->data[3])) + LOG_PAGE_HEADER_LENGTH;
+        if (entry->parameterPointer == parameterPointer && entry->length >= dataSize)
+        {
+            safe_memcpy(ptrData, dataSize, entry->data, dataSize);
+        }
+        else if (entry->length >= pageLength)
+        {
+            build_SCSI_Log_Page_From_Cache(entry, pageLength, parameterPointer, ptrData, dataSize);
+        }
+        else
+        {
+            continue;
+        }
+        entry->lastUsed = ++cache->useCounter;
+        return true;
+    }
+    return false;
+}
+
+void init_Log_Page_Cache(ptrLogPageCache cache, uint32_t maxAgeMilliseconds)
+{
+    DISABLE_NONNULL_COMPARE
+    if (cache != M_NULLPTR)
+    {
+        safe_memset(cache, sizeof(logPageCache), 0, sizeof(logPageCache));
+        cache->maxAgeMilliseconds = maxAgeMilliseconds;
+        init_ATA_Log_Directories(&cache->directories);
+    }
+    RESTORE_NONNULL_COMPARE
+}
+
+void invalidate_Log_Page_Cache(ptrLogPageCache cache)
+{
+    DISABLE_NONNULL_COMPARE
+    if (cache != M_NULLPTR)
+    {
+        for (uint8_t iter = UINT8_C(0); iter < LOG_PAGE_CACHE_ENTRIES; ++iter)
+        {
+            drop_Log_Page_Cache_Entry(&cache->entries[iter]);
+        }
+    }
+    RESTORE_NONNULL_COMPARE
+}
+
+void free_Log_Page_Cache(ptrLogPageCache cache)
+{
+    DISABLE_NONNULL_COMPARE
+    if (cache != M_NULLPTR)
+    {
+        invalidate_Log_Page_Cache(cache);
+        safe_memset(cache, sizeof(logPageCache), 0, sizeof(logPageCache));
+    }
+    RESTORE_NONNULL_COMPARE
+}
+
+eReturnValues cached_ATA_Get_Log(tDevice*        device,
+                                 ptrLogPageCache cache,
+                                 uint8_t         logAddress,
+                                 bool            GPL,
+                                 bool            SMART,
+                                 uint8_t*        ptrData,
+                                 uint32_t        dataSize)
+{
+    if (cache != M_NULLPTR && read_ATA_Log_Page_Cache(cache, LOG_PAGE_CACHE_ATA_LOG, logAddress, ptrData, dataSize))
+    {
+        return SUCCESS;
+    }
+    eReturnValues ret =
+        get_ATA_Log(device, logAddress, M_NULLPTR, M_NULLPTR, GPL, SMART, true, ptrData, dataSize, M_NULLPTR, 0, 0);
+    if (ret == SUCCESS && cache != M_NULLPTR)
+    {
+        add_Log_Page_Cache_Entry(cache, LOG_PAGE_CACHE_ATA_LOG, logAddress, 0, 0, ptrData, dataSize);
+    }
+    return ret;
+}
+
+eReturnValues cached_ATA_Read_Log_Ext_Page(tDevice*        device,
+                                           ptrLogPageCache cache,
+                                           uint8_t         logAddress,
+                                           uint16_t        pageNumber,
+                                           uint8_t*        ptrData,
+                                           uint32_t        dataSize)
+{
+    if (dataSize < ATA_LOG_PAGE_LEN_BYTES)
+    {
+        return BAD_PARAMETER;
+    }
+    if (cache != M_NULLPTR && read_ATA_Log_Single_Page_Cache(cache, logAddress, pageNumber, ptrData, dataSize))
+    {
+        return SUCCESS;
+    }
+    eReturnValues ret = send_ATA_Read_Log_Ext_Cmd(device, logAddress, pageNumber, ptrData, ATA_LOG_PAGE_LEN_BYTES, 0);
+    if (ret == SUCCESS && cache != M_NULLPTR)
+    {
+        add_Log_Page_Cache_Entry(cache, LOG_PAGE_CACHE_ATA_LOG_PAGE, logAddress, 0, pageNumber, ptrData,
+                                 ATA_LOG_PAGE_LEN_BYTES);
+    }
+    return ret;
+}
+
+eReturnValues cached_ATA_SMART_Read_Data(tDevice* device, ptrLogPageCache cache, uint8_t* ptrData, uint32_t dataSize)
+{
+    if (cache != M_NULLPTR &&
+        read_ATA_Log_Page_Cache(cache, LOG_PAGE_CACHE_ATA_SMART_READ_DATA, 0, ptrData, dataSize))
+    {
+        return SUCCESS;
+    }
+    eReturnValues ret = ata_SMART_Read_Data(device, ptrData, dataSize);
+    if (ret == SUCCESS && cache != M_NULLPTR)
+    {
+        add_Log_Page_Cache_Entry(cache, LOG_PAGE_CACHE_ATA_SMART_READ_DATA, 0, 0, 0, ptrData, dataSize);
+    }
+    return ret;
+}
+
+eReturnValues cached_SCSI_Log_Sense(tDevice*        device,
+                                    ptrLogPageCache cache,
+                                    uint8_t         pageCode,
+                                    uint8_t         subpageCode,
+                                    uint16_t        parameterPointer,
+                                    uint8_t*        ptrData,
+                                    uint16_t        dataSize)
+{
+    if (cache != M_NULLPTR &&
+        read_SCSI_Log_Page_Cache(cache, pageCode, subpageCode, parameterPointer, ptrData, dataSize))
+    {
+        return SUCCESS;
+    }
+    eReturnValues ret = scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode,
+                                           parameterPointer, ptrData, dataSize);
+    if (ret == SUCCESS && cache != M_NULLPTR)
+    {
+        add_Log_Page_Cache_Entry(cache, LOG_PAGE_CACHE_SCSI_LOG_SENSE, pageCode, subpageCode, parameterPointer,
+                                 ptrData, dataSize);
+    }
+    return ret;
+}
+
+static M_INLINE void modify_Short_Blk_Desc_Num_Blocks(uint8_t* mp, uint8_t mpheaderlen, uint32_t lba)
+{
+    mp[mpheaderlen + 0] = M_Byte3(lba);
+    mp[mpheaderlen + 1] = M_Byte2(lba);
+    mp[mpheaderlen + 2] = M_Byte1(lba);
+    mp[mpheaderlen + 3] = M_Byte0(lba);
+}
+
+static M_INLINE void modify_Short_Blk_Desc_Block_Len(uint8_t* mp, uint8_t mpheaderlen, uint32_t len)
+{
+    mp[mpheaderlen + 5] = M_Byte2(len);
+    mp[mpheaderlen + 6] = M_Byte1(len);
+    mp[mpheaderlen + 7] = M_Byte0(len);
+}
+
+static M_INLINE void modify_Long_Blk_Desc_Num_Blocks(uint8_t* mp, uint8_t mpheaderlen, uint64_t lba)
+{
+    mp[mpheaderlen + 0] = M_Byte7(lba);
+    mp[mpheaderlen + 1] = M_Byte6(lba);
+    mp[mpheaderlen + 2] = M_Byte5(lba);
+    mp[mpheaderlen + 3] = M_Byte4(lba);
+    mp[mpheaderlen + 4] = M_Byte3(lba);
+    mp[mpheaderlen + 5] = M_Byte2(lba);
+    mp[mpheaderlen + 6] = M_Byte1(lba);
+    mp[mpheaderlen + 7] = M_Byte0(lba);
+}
+
+static M_INLINE void modify_Long_Blk_Desc_Block_Len(uint8_t* mp, uint8_t mpheaderlen, uint32_t len)
+{
+    mp[mpheaderlen + 12] = M_Byte3(len);
+    mp[mpheaderlen + 13] = M_Byte2(len);
+    mp[mpheaderlen + 14] = M_Byte1(len);
+    mp[mpheaderlen + 15] = M_Byte0(len);
+}
+
+static eReturnValues modify_SCSI_Block_Descriptor_10B(tDevice*                 device,
+                                                      modifyScsiBlkDescFields  modifications,
+                                                      modifyScsiBlkDescFields* endingBlockDescriptor)
+{
+    eReturnValues ret = SUCCESS;
+    // SPC2 added concept of long LBA, so use that to determine when to request long lba info.
+    // NOTE: SBC allows returning 0 when requesting longlba format data, so need to check that as well if long lba is
+    // not supported-TJE
+    bool    llbaa        = M_ToBool(device->drive_info.scsiVersion >= SCSI_VERSION_SPC_2);
+    uint8_t attemptCount = UINT8_C(
+        0); // to prevent weird case of misbehaving hardware that fails to respond correctly with and without llbaa
+    // Use a do-while here. If reaching the end and llbaa is false, exit the loop.
+    // this will allow for a retry when needed or only run the command once if llbaa is not supported on older products
+    do
+    {
+        uint8_t  mpalloclen = MODE_PARAMETER_HEADER_10_LEN + LONG_LBA_BLOCK_DESCRIPTOR_LEN;
+        uint8_t* mp =
+            M_STATIC_CAST(uint8_t*, safe_calloc_aligned(mpalloclen, sizeof(uint8_t), device->os_info.minimumAlignment));
+        if (mp == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        ++attemptCount;
+        if (SUCCESS == scsi_Mode_Sense_10(device, 0, mpalloclen, 0, false, llbaa, MPC_CURRENT_VALUES, mp))
+        {
+            uint16_t modeDataLen   = UINT16_C(0);
+            uint16_t blockDescLen  = UINT16_C(0);
+            bool     returnedllbaa = false;
+            get_mode_param_header_10_fields(mp, mpalloclen, &modeDataLen, M_NULLPTR, M_NULLPTR, &returnedllbaa,
+                                            &blockDescLen);
+            if (blockDescLen > 0)
+            {
+                uint64_t startLBAToVerify    = UINT64_C(0);
+                uint64_t startBlkLenToVerify = UINT64_C(0);
+                if (llbaa != returnedllbaa)
+                {
+                    printf("WARNING: Requested long lba mode and returned mode header data do not match!\n");
+                }
+                if (returnedllbaa)
+                {
+                    // long block descriptor
+                    // TODO: check this matches the requested llbaa value?
+                    get_mode_long_block_descriptor_fields(mp + MODE_PARAMETER_HEADER_10_LEN, blockDescLen,
+                                                          &startLBAToVerify, &startBlkLenToVerify);
+                    if (startLBAToVerify == UINT64_C(0))
+                    {
+                        // longlba mode returned without error, but need to use short block descriptor instead since
+                        // this is zero
+                        llbaa = false;
+                        safe_free_aligned(&mp);
+                        continue;
+                    }
+                    // Modify requested fields
+                    if (modifications.modifyNumBlocks)
+                    {
+                        modify_Long_Blk_Desc_Num_Blocks(mp, MODE_PARAMETER_HEADER_10_LEN,
+                                                        modifications.numberOfLogicalBlocks);
+                    }
+                    if (modifications.modifyBlockLen)
+                    {
+                        modify_Long_Blk_Desc_Block_Len(mp, MODE_PARAMETER_HEADER_10_LEN,
+                                                       modifications.logicalBlockLength);
                     }
                 }
                 else
@@ -1699,24 +2399,155 @@ eReturnValues pull_SCSI_Informational_Exceptions_Log(tDevice* device, const char
     }
 }
 
-eReturnValues get_ATA_Log(tDevice*    device,
-                          uint8_t     logAddress,
-                          const char* logName,
-                          const char* fileExtension,
-                          bool        GPL,
-                          bool        SMART,
-                          bool        toBuffer,
-                          uint8_t*    myBuf,
-                          uint32_t    bufSize,
-                          const char* filePath,
-                          uint32_t    transferSizeBytes,
-                          uint16_t    featureRegister)
+// Identify device data and device statistics start with a list of supported pages. Returns true when any page in the
+// range is in that list.
+static bool is_ATA_Log_Page_Range_Listed(const uint8_t* supportedPageList, uint16_t firstPage, uint16_t pageCount)
 {
-    eReturnValues ret     = UNKNOWN;
-    uint32_t      logSize = UINT32_C(0);
-
-#ifdef _DEBUG
-    printf("%s: -->\n", __FUNCTION__);
+    for (uint16_t pageIter = UINT16_C(0); pageIter < supportedPageList[ATA_DEV_STATS_SUP_PG_LIST_LEN_OFFSET];
+         ++pageIter)
+    {
+        uint16_t listedPage = supportedPageList[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + pageIter];
+        if (listedPage >= firstPage && listedPage < C_CAST(uint32_t, firstPage) + pageCount)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Writes bytes that have been collected in a log stream buffer to the output file.
+static eReturnValues write_Log_Stream_Data(tDevice* device, secureFileInfo* fp_log, const uint8_t* data, size_t length)
+{
+    if (SEC_FILE_SUCCESS != secure_Write_File(fp_log, data, length, sizeof(uint8_t), length, M_NULLPTR))
+    {
+        if (VERBOSITY_QUIET < device->deviceVerbosity)
+        {
+            perror("Error writing a file!\n");
+        }
+        return ERROR_WRITING_FILE;
+    }
+    return SUCCESS;
+}
+
+static eReturnValues open_Log_Stream_File(tDevice*         device,
+                                          secureFileInfo** fp_log,
+                                          const char*      filePath,
+                                          const char*      logName,
+                                          const char*      fileExtension)
+{
+    eReturnValues ret = SUCCESS;
+    if (SUCCESS != create_And_Open_Secure_Log_File_Dev_EZ(device, fp_log, NAMING_SERIAL_NUMBER_DATE_TIME, filePath,
+                                                          logName, fileExtension))
+    {
+        if (*fp_log != M_NULLPTR && (*fp_log)->error == SEC_FILE_INSECURE_PATH)
+        {
+            ret = INSECURE_PATH;
+        }
+        else
+        {
+            ret = FILE_OPEN_ERROR;
+        }
+    }
+    return ret;
+}
+
+// Flushes and closes a log stream file. Any error from writing the log is kept over a flush error.
+static eReturnValues close_Log_Stream_File(tDevice* device, secureFileInfo* fp_log, eReturnValues ret)
+{
+    if (SEC_FILE_SUCCESS != secure_Flush_File(fp_log))
+    {
+        if (VERBOSITY_QUIET < device->deviceVerbosity)
+        {
+            perror("Error flushing data!\n");
+        }
+        if (ret == SUCCESS)
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+    }
+    if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
+    {
+        printf("Error closing file!\n");
+        if (ret == SUCCESS)
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+    }
+    else if (ret == SUCCESS && device->deviceVerbosity > VERBOSITY_QUIET)
+    {
+        printf("\nBinary log saved to: %s\n", fp_log->fullpath);
+    }
+    return ret;
+}
+
+static eReturnValues get_SCSI_Log_Sense_Failure_Status(tDevice* device)
+{
+    eReturnValues   ret = FAILURE;
+    senseDataFields senseFields;
+    safe_memset(&senseFields, sizeof(senseDataFields), 0, sizeof(senseDataFields));
+    get_Sense_Data_Fields(device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN, &senseFields);
+    if (senseFields.scsiStatusCodes.senseKey == SENSE_KEY_ILLEGAL_REQUEST && senseFields.scsiStatusCodes.asc == 0x24 &&
+        senseFields.scsiStatusCodes.ascq == 0x00)
+    {
+        ret = NOT_SUPPORTED;
+    }
+    return ret;
+}
+
+// Used when a log page cannot be read in chunks. Reads the whole page and writes out everything after the bytes that
+// were already saved.
+static eReturnValues stream_SCSI_Log_Remainder(tDevice*        device,
+                                               secureFileInfo* fp_log,
+                                               uint8_t         logAddress,
+                                               uint8_t         subpage,
+                                               uint32_t        pageLen,
+                                               uint32_t        bytesWritten)
+{
+    eReturnValues ret       = UNKNOWN;
+    uint8_t*      logBuffer = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(pageLen, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (logBuffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    ret = scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, logAddress, subpage, 0, logBuffer,
+                             C_CAST(uint16_t, pageLen));
+    if (ret == SUCCESS)
+    {
+        uint32_t returnedLength =
+            M_Min(pageLen, C_CAST(uint32_t, M_BytesTo2ByteValue(logBuffer[2], logBuffer[3])) + LOG_PAGE_HEADER_LENGTH);
+        if (returnedLength > bytesWritten)
+        {
+            ret = write_Log_Stream_Data(device, fp_log, &logBuffer[bytesWritten],
+                                        uint32_to_sizet(returnedLength - bytesWritten));
+        }
+    }
+    else
+    {
+        ret = get_SCSI_Log_Sense_Failure_Status(device);
+    }
+    safe_free_aligned(&logBuffer);
+    return ret;
+}
+
+eReturnValues get_ATA_Log(tDevice*    device,
+                          uint8_t     logAddress,
+                          const char* logName,
+                          const char* fileExtension,
+                          bool        GPL,
+                          bool        SMART,
+                          bool        toBuffer,
+                          uint8_t*    myBuf,
+                          uint32_t    bufSize,
+                          const char* filePath,
+                          uint32_t    transferSizeBytes,
+                          uint16_t    featureRegister)
+{
+    eReturnValues ret     = UNKNOWN;
+    uint32_t      logSize = UINT32_C(0);
+
+#ifdef _DEBUG
+    printf("%s: -->\n", __FUNCTION__);
 #endif
 
     if (transferSizeBytes % ATA_LOG_PAGE_LEN_BYTES)
@@ -1724,498 +2555,565 @@ eReturnValues get_ATA_Log(tDevice*    device,
         return BAD_PARAMETER;
     }
 
+    if (!toBuffer)
+    {
+        // Files are written as the log is read so that memory use does not grow with the size of the log.
+        ret = stream_ATA_Log_To_File(device, logAddress, logName, fileExtension, GPL, SMART, filePath,
+                                     transferSizeBytes, featureRegister, LOG_STREAM_DEFAULT_RING_SLOTS);
+#ifdef _DEBUG
+        printf("%s: <--\n", __FUNCTION__);
+#endif
+        return ret;
+    }
+
     if ((logAddress == ATA_SCT_COMMAND_STATUS || logAddress == ATA_SCT_DATA_TRANSFER) &&
         device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly)
     {
         GPL = false;
     }
 
-    if (toBuffer)
+    ret     = SUCCESS;
+    logSize = bufSize;
+    if (bufSize % ATA_LOG_PAGE_LEN_BYTES)
     {
-        ret     = SUCCESS;
-        logSize = bufSize;
-        if (bufSize % ATA_LOG_PAGE_LEN_BYTES)
-        {
-            return BAD_PARAMETER;
-        }
+        return BAD_PARAMETER;
     }
-    else
+    bool     logFromGPL = false;
+    uint8_t* logBuffer  = M_REINTERPRET_CAST(
+        uint8_t*, safe_calloc_aligned(logSize, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (logBuffer == M_NULLPTR)
     {
-        ret = get_ATA_Log_Size(device, logAddress, &logSize, GPL, SMART);
+        perror("Calloc Failure!\n");
+        return MEMORY_FAILURE;
     }
-    if (ret == SUCCESS)
-    {
-        bool            logFromGPL = false;
-        bool            fileOpened = false;
-        secureFileInfo* fp_log     = M_NULLPTR;
-        uint8_t*        logBuffer  = M_REINTERPRET_CAST(
-            uint8_t*, safe_calloc_aligned(logSize, sizeof(uint8_t), device->os_info.minimumAlignment));
-        if (logBuffer == M_NULLPTR)
+
+    if (GPL)
+    {
+        // read each log 1 page at a time since some can get to be so large some controllers won't let you pull it.
+        uint16_t pagesToReadAtATime = UINT16_C(1);
+        uint16_t numberOfLogPages   = C_CAST(uint16_t, logSize / LEGACY_DRIVE_SEC_SIZE);
+        uint16_t pagesToReadNow     = UINT16_C(1);
+        uint16_t currentPage        = UINT16_C(0);
+        if (device->drive_info.interface_type != USB_INTERFACE &&
+            device->drive_info.interface_type != IEEE_1394_INTERFACE)
         {
-            perror("Calloc Failure!\n");
-            return MEMORY_FAILURE;
+            pagesToReadAtATime = 32;
         }
-
-        if (GPL)
+        else
         {
-            // read each log 1 page at a time since some can get to be so large some controllers won't let you pull it.
-            uint16_t pagesToReadAtATime = UINT16_C(1);
-            uint16_t numberOfLogPages   = C_CAST(uint16_t, logSize / LEGACY_DRIVE_SEC_SIZE);
-            uint16_t pagesToReadNow     = UINT16_C(1);
-            uint16_t currentPage        = UINT16_C(0);
-            if (device->drive_info.interface_type != USB_INTERFACE &&
-                device->drive_info.interface_type != IEEE_1394_INTERFACE)
-            {
-                pagesToReadAtATime = 32;
-            }
-            else
-            {
-                // USB and IEEE 1394 should only ever be read 1 page at a time since these interfaces use cheap bridge
-                // chips that typically don't allow larger transfers.
-                pagesToReadAtATime = 1;
-            }
-            if (transferSizeBytes > UINT32_C(0))
-            {
-                // caller is telling us how much to read at a time...so let them.
-                pagesToReadAtATime = C_CAST(uint16_t, (transferSizeBytes / LEGACY_DRIVE_SEC_SIZE));
-            }
-            logFromGPL = true;
-            for (currentPage = UINT16_C(0); currentPage < numberOfLogPages; currentPage += pagesToReadAtATime)
-            {
-                ret            = SUCCESS; // assume success
-                pagesToReadNow = C_CAST(uint16_t, M_Min(numberOfLogPages - currentPage, pagesToReadAtATime));
-                if (currentPage > UINT16_C(0) &&
-                    (logAddress == ATA_LOG_IDENTIFY_DEVICE_DATA || logAddress == ATA_LOG_DEVICE_STATISTICS))
-                {
-                    // special case to allow skipping reading unavailable pages. Need to have already read page 0
-                    // Both of these logs use the same structure in the first 512B to indicate a list of supported
-                    // pages. If reading either of these logs, we can skip a drive request when the page will come back
-                    // as zeroes anyways This can be especially helpful for USB devices reading single sectors at a time
-                    // on logs like device statistics.
-                    bool skipAhead    = true;
-                    bool doneChecking = false;
-                    for (uint8_t pageIter = UINT8_C(0);
-                         !doneChecking && pageIter < logBuffer[ATA_DEV_STATS_SUP_PG_LIST_LEN_OFFSET]; ++pageIter)
-                    {
-                        // offset = deviceStatsLog[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + pageIter] * LEGACY_DRIVE_SEC_SIZE;
-                        // check if the current page is in the list PLUS additional transfer length if reading more than
-                        // a single page at a time!
-                        for (uint32_t pageCheck = currentPage;
-                             !doneChecking && pageCheck < C_CAST(uint32_t, (currentPage + pagesToReadAtATime));
-                             pageCheck += UINT32_C(1))
-                        {
-                            if (pageCheck == logBuffer[ATA_DEV_STATS_SUP_PG_LIST_OFFSET + pageIter])
-                            {
-                                skipAhead    = false;
-                                doneChecking = true;
-                            }
-                        }
-                    }
-                    if (skipAhead)
-                    {
-                        if (fileOpened)
-                        {
-                            // write out to a file
-                            if (SEC_FILE_SUCCESS !=
-                                secure_Write_File(
-                                    fp_log, &logBuffer[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
-                                    uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t),
-                                    uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE, M_NULLPTR))
-                            {
-                                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                                {
-                                    perror("Error writing a file!\n");
-                                }
-                                if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
-                                {
-                                    printf("Error closing file!\n");
-                                }
-                                fileOpened = false;
-                                safe_free_aligned(&logBuffer);
-                                free_Secure_File_Info(&fp_log);
-                                return ERROR_WRITING_FILE;
-                            }
-                            ret = SUCCESS;
-                        }
-                        if (toBuffer)
-                        {
-                            if (bufSize >= logSize)
-                            {
-                                safe_memset(&myBuf[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
-                                            bufSize - (uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE), 0,
-                                            uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE);
-                            }
-                            else
-                            {
-                                return BAD_PARAMETER;
-                            }
-                        }
-                        continue;
-                    }
-                }
-                // loop and read each page or set of pages, then save to a file
-                ret = send_ATA_Read_Log_Ext_Cmd(device, logAddress, currentPage,
-                                                &logBuffer[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
-                                                pagesToReadNow * LEGACY_DRIVE_SEC_SIZE, featureRegister);
-                if (ret == SUCCESS)
-                {
-                    if (device->deviceVerbosity > VERBOSITY_QUIET)
-                    {
-                        if (currentPage % UINT16_C(20) == UINT16_C(0))
-                        {
-                            if (!toBuffer)
-                            {
-                                printf(".");
-                                flush_stdout();
-                            }
-                        }
-                    }
-                    if (!toBuffer && !fileOpened)
-                    {
-                        if (SUCCESS == create_And_Open_Secure_Log_File_Dev_EZ(device, &fp_log,
-                                                                              NAMING_SERIAL_NUMBER_DATE_TIME, filePath,
-                                                                              logName, fileExtension))
-                        {
-                            fileOpened = true;
-                        }
-                        else
-                        {
-                            if (fp_log->error == SEC_FILE_INSECURE_PATH)
-                            {
-                                ret = INSECURE_PATH;
-                            }
-                            else
-                            {
-                                ret = FILE_OPEN_ERROR;
-                            }
-                            safe_free_aligned(&logBuffer);
-                            free_Secure_File_Info(&fp_log);
-                            return FILE_OPEN_ERROR;
-                        }
-                    }
-                    if (fileOpened)
+            // USB and IEEE 1394 should only ever be read 1 page at a time since these interfaces use cheap bridge
+            // chips that typically don't allow larger transfers.
+            pagesToReadAtATime = 1;
+        }
+        if (transferSizeBytes > UINT32_C(0))
+        {
+            // caller is telling us how much to read at a time...so let them.
+            pagesToReadAtATime = C_CAST(uint16_t, (transferSizeBytes / LEGACY_DRIVE_SEC_SIZE));
+        }
+        logFromGPL = true;
+        for (currentPage = UINT16_C(0); currentPage < numberOfLogPages; currentPage += pagesToReadAtATime)
+        {
+            ret            = SUCCESS; // assume success
+            pagesToReadNow = C_CAST(uint16_t, M_Min(numberOfLogPages - currentPage, pagesToReadAtATime));
+            if (currentPage > UINT16_C(0) &&
+                (logAddress == ATA_LOG_IDENTIFY_DEVICE_DATA || logAddress == ATA_LOG_DEVICE_STATISTICS))
+            {
+                // special case to allow skipping reading unavailable pages. Need to have already read page 0
+                // Both of these logs use the same structure in the first 512B to indicate a list of supported
+                // pages. If reading either of these logs, we can skip a drive request when the page will come back
+                // as zeroes anyways This can be especially helpful for USB devices reading single sectors at a time
+                // on logs like device statistics.
+                if (!is_ATA_Log_Page_Range_Listed(logBuffer, currentPage, pagesToReadNow))
+                {
+                    if (bufSize >= logSize)
                     {
-                        // write out to a file
-                        if (SEC_FILE_SUCCESS !=
-                            secure_Write_File(fp_log, &logBuffer[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
-                                              uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t),
-                                              uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE, M_NULLPTR))
-                        {
-                            if (VERBOSITY_QUIET < device->deviceVerbosity)
-                            {
-                                perror("Error writing a file!\n");
-                            }
-                            if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
-                            {
-                                printf("Error closing file!\n");
-                            }
-                            fileOpened = false;
-                            safe_free_aligned(&logBuffer);
-                            free_Secure_File_Info(&fp_log);
-                            return ERROR_WRITING_FILE;
-                        }
-                        ret = SUCCESS;
+                        safe_memset(&myBuf[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
+                                    bufSize - (uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE), 0,
+                                    uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE);
                     }
-                    if (toBuffer)
+                    else
                     {
-                        if (0 != safe_memcpy(&myBuf[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
-                                             bufSize - uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE,
-                                             &logBuffer[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
-                                             uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE))
-                        {
-                            return BAD_PARAMETER;
-                        }
+                        safe_free_aligned(&logBuffer);
+                        return BAD_PARAMETER;
                     }
+                    continue;
                 }
-                else
+            }
+            // loop and read each page or set of pages
+            ret = send_ATA_Read_Log_Ext_Cmd(device, logAddress, currentPage,
+                                            &logBuffer[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
+                                            pagesToReadNow * LEGACY_DRIVE_SEC_SIZE, featureRegister);
+            if (ret == SUCCESS)
+            {
+                if (0 != safe_memcpy(&myBuf[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
+                                     bufSize - uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE,
+                                     &logBuffer[uint16_to_sizet(currentPage) * LEGACY_DRIVE_SEC_SIZE],
+                                     uint16_to_sizet(pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE))
                 {
-                    if (ret != NOT_SUPPORTED)
-                    {
-                        ret = FAILURE;
-                    }
-                    logSize    = UINT32_C(0);
-                    logFromGPL = true;
-                    break;
+                    safe_free_aligned(&logBuffer);
+                    return BAD_PARAMETER;
                 }
             }
-            if (device->deviceVerbosity > VERBOSITY_QUIET)
+            else
             {
-                if (!toBuffer && fp_log)
+                if (ret != NOT_SUPPORTED)
                 {
-                    printf("\nBinary log saved to: %s\n", fp_log->fullpath);
+                    ret = FAILURE;
                 }
+                logSize    = UINT32_C(0);
+                logFromGPL = true;
+                break;
             }
         }
-        // if the log wasn't found in the GPL directory, then try reading from the SMART directory
-        if (!logFromGPL && SMART)
+    }
+    // if the log wasn't found in the GPL directory, then try reading from the SMART directory
+    if (!logFromGPL && SMART)
+    {
+        ret = UNKNOWN; // start fresh again...
+        // read the log from SMART
+        if (ata_SMART_Read_Log(device, logAddress, logBuffer, logSize) == 0)
         {
-            ret = UNKNOWN; // start fresh again...
-            // read the log from SMART
-            if (ata_SMART_Read_Log(device, logAddress, logBuffer, logSize) == 0)
+            if (0 != safe_memcpy(myBuf, bufSize, logBuffer, logSize))
             {
-                if (!toBuffer && !fileOpened)
+                safe_free_aligned(&logBuffer);
+                return BAD_PARAMETER;
+            }
+        }
+        else
+        {
+            // failed to read the log...
+            ret = FAILURE;
+        }
+    }
+    safe_free_aligned(&logBuffer);
+
+#ifdef _DEBUG
+    printf("%s: <--\n", __FUNCTION__);
+#endif
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+//
+//! get_SCSI_Log
+//
+//! \brief   generic function to pull an SCSI log and save it to a file
+//
+//  Entry:
+//!   \param[in]  device - file descriptor
+//!   \param[in]  logAddress - the address of the log you wish to pull
+//!   \param[in]  subpage - set this to something other than zero if looking for a specific subpage to a log
+//!   \param[in]  logName - a string that is the name of the log (NO SPACES please!) M_NULLPTR if no file output needed
+//!   \param[in]  fileExtension - a string for the file extension. You do not need to include a dot character.
+//!   \param[in]  toBuffer - boolean flag specifying if you want to return data in buffer
+//!   \param[in]  myBuf - buffer to return data in if toBuffer is true
+//!   \param[in]  bufSize - size of the buffer to get data filled into it (use get_SCSI_Log_Size)
+//!   \param[in]  filePath - string with path to output the file to. Can be M_NULLPTR for current directory.
+//!
+//  Exit:
+//!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
+//
+//-----------------------------------------------------------------------------
+
+eReturnValues get_SCSI_Log(tDevice*    device,
+                           uint8_t     logAddress,
+                           uint8_t     subpage,
+                           const char* logName,
+                           const char* fileExtension,
+                           bool        toBuffer,
+                           uint8_t*    myBuf,
+                           uint32_t    bufSize,
+                           const char* filePath)
+{
+    eReturnValues ret       = UNKNOWN;
+    uint32_t      pageLen   = UINT32_C(0);
+    uint8_t*      logBuffer = M_NULLPTR;
+
+    if (!toBuffer && logName && fileExtension)
+    {
+        return stream_SCSI_Log_To_File(device, logAddress, subpage, logName, fileExtension, filePath,
+                                       LOG_STREAM_DEFAULT_SCSI_TRANSFER_BYTES);
+    }
+    if (toBuffer)
+    {
+        ret     = SUCCESS;
+        pageLen = bufSize;
+    }
+    else
+    {
+        ret = get_SCSI_Log_Size(device, logAddress, subpage, &pageLen);
+    }
+    if (ret == SUCCESS)
+    {
+        // If the user wants it in a buffer...just return.
+        if (toBuffer && ((bufSize < pageLen) || myBuf == M_NULLPTR))
+        {
+            return BAD_PARAMETER;
+        }
+        else if (toBuffer)
+        {
+            logBuffer = myBuf;
+        }
+        else
+        {
+            logBuffer = M_REINTERPRET_CAST(
+                uint8_t*, safe_calloc_aligned(pageLen, sizeof(uint8_t), device->os_info.minimumAlignment));
+        }
+        if (logBuffer == M_NULLPTR)
+        {
+            if (VERBOSITY_QUIET < device->deviceVerbosity)
+            {
+                perror("Calloc failure!\n");
+            }
+            return MEMORY_FAILURE;
+        }
+
+        if (scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, logAddress, subpage, 0, logBuffer,
+                               C_CAST(uint16_t, pageLen)) == SUCCESS)
+        {
+            ret = SUCCESS;
+        }
+        else
+        {
+            ret = get_SCSI_Log_Sense_Failure_Status(device);
+        }
+        if (!toBuffer)
+        {
+            safe_free_aligned(&logBuffer);
+        }
+    }
+    return ret;
+}
+
+eReturnValues stream_ATA_Log_To_File(tDevice*    device,
+                                     uint8_t     logAddress,
+                                     const char* logName,
+                                     const char* fileExtension,
+                                     bool        GPL,
+                                     bool        SMART,
+                                     const char* filePath,
+                                     uint32_t    transferSizeBytes,
+                                     uint16_t    featureRegister,
+                                     uint8_t     ringSlots)
+{
+    eReturnValues   ret             = UNKNOWN;
+    uint32_t        logSize         = UINT32_C(0);
+    uint32_t        slotSize        = UINT32_C(0);
+    uint16_t        pagesPerSlot    = UINT16_C(1);
+    uint8_t*        ring            = M_NULLPTR;
+    size_t          ringSize        = SIZE_T_C(0);
+    size_t          ringBytesFilled = SIZE_T_C(0);
+    uint8_t         slotsFilled     = UINT8_C(0);
+    secureFileInfo* fp_log          = M_NULLPTR;
+    bool            fileOpened      = false;
+
+    if (transferSizeBytes % ATA_LOG_PAGE_LEN_BYTES)
+    {
+        return BAD_PARAMETER;
+    }
+    if (ringSlots == UINT8_C(0))
+    {
+        ringSlots = LOG_STREAM_DEFAULT_RING_SLOTS;
+    }
+    else if (ringSlots > LOG_STREAM_MAX_RING_SLOTS)
+    {
+        ringSlots = LOG_STREAM_MAX_RING_SLOTS;
+    }
+
+    if ((logAddress == ATA_SCT_COMMAND_STATUS || logAddress == ATA_SCT_DATA_TRANSFER) &&
+        device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly)
+    {
+        GPL = false;
+    }
+
+    ret = get_ATA_Log_Size(device, M_NULLPTR, logAddress, &logSize, GPL, SMART);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    if (GPL)
+    {
+        if (transferSizeBytes > UINT32_C(0))
+        {
+            // caller is telling us how much to read at a time...so let them.
+            pagesPerSlot = C_CAST(uint16_t, (transferSizeBytes / LEGACY_DRIVE_SEC_SIZE));
+        }
+        else if (device->drive_info.interface_type != USB_INTERFACE &&
+                 device->drive_info.interface_type != IEEE_1394_INTERFACE)
+        {
+            pagesPerSlot = UINT16_C(32);
+        }
+        // else USB and IEEE 1394 are read 1 page at a time since their bridge chips rarely allow larger transfers
+        pagesPerSlot = M_Min(pagesPerSlot, C_CAST(uint16_t, logSize / LEGACY_DRIVE_SEC_SIZE));
+        slotSize     = C_CAST(uint32_t, pagesPerSlot) * LEGACY_DRIVE_SEC_SIZE;
+    }
+    else
+    {
+        // SMART read log returns the whole log in one command (255 pages at most), so it cannot be read in pieces.
+        slotSize  = logSize;
+        ringSlots = UINT8_C(1);
+    }
+    ringSize = uint32_to_sizet(slotSize) * ringSlots;
+    ring     = M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(ringSize, sizeof(uint8_t),
+                                                                device->os_info.minimumAlignment));
+    if (ring == M_NULLPTR)
+    {
+        perror("Calloc Failure!\n");
+        return MEMORY_FAILURE;
+    }
+
+    if (GPL)
+    {
+        // Identify device data and device statistics list their supported pages on page 0. Keep a copy of it once it
+        // is read so that requests for unsupported pages can be skipped after page 0 leaves the ring.
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, supportedPages, ATA_LOG_PAGE_LEN_BYTES);
+        bool checkSupportedPages =
+            logAddress == ATA_LOG_IDENTIFY_DEVICE_DATA || logAddress == ATA_LOG_DEVICE_STATISTICS;
+        uint16_t numberOfLogPages = C_CAST(uint16_t, logSize / LEGACY_DRIVE_SEC_SIZE);
+        for (uint16_t currentPage = UINT16_C(0); currentPage < numberOfLogPages; currentPage += pagesPerSlot)
+        {
+            uint16_t pagesToReadNow = C_CAST(uint16_t, M_Min(numberOfLogPages - currentPage, pagesPerSlot));
+            uint32_t bytesToReadNow = C_CAST(uint32_t, pagesToReadNow) * LEGACY_DRIVE_SEC_SIZE;
+            uint8_t* slot           = &ring[ringBytesFilled];
+            if (checkSupportedPages && currentPage > UINT16_C(0) &&
+                !is_ATA_Log_Page_Range_Listed(supportedPages, currentPage, pagesToReadNow))
+            {
+                // these pages would come back as zeroes anyways, so skip asking the drive for them.
+                safe_memset(slot, ringSize - ringBytesFilled, 0, bytesToReadNow);
+            }
+            else
+            {
+                ret = send_ATA_Read_Log_Ext_Cmd(device, logAddress, currentPage, slot, bytesToReadNow, featureRegister);
+                if (ret != SUCCESS)
                 {
-                    if (SUCCESS == create_And_Open_Secure_Log_File_Dev_EZ(device, &fp_log,
-                                                                          NAMING_SERIAL_NUMBER_DATE_TIME, filePath,
-                                                                          logName, fileExtension))
-                    {
-                        fileOpened = true;
-                    }
-                    else
+                    if (ret != NOT_SUPPORTED)
                     {
-                        if (fp_log->error == SEC_FILE_INSECURE_PATH)
-                        {
-                            ret = INSECURE_PATH;
-                        }
-                        else
-                        {
-                            ret = FILE_OPEN_ERROR;
-                        }
-                        safe_free_aligned(&logBuffer);
-                        free_Secure_File_Info(&fp_log);
-                        return FILE_OPEN_ERROR;
+                        ret = FAILURE;
                     }
+                    break;
                 }
-                if (fileOpened)
+                if (checkSupportedPages && currentPage == UINT16_C(0))
                 {
-                    // write out to a file
-                    if (SEC_FILE_SUCCESS !=
-                        secure_Write_File(fp_log, logBuffer, logSize, sizeof(uint8_t), logSize, M_NULLPTR))
-                    {
-                        if (VERBOSITY_QUIET < device->deviceVerbosity)
-                        {
-                            perror("Error writing a file!\n");
-                        }
-                        if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
-                        {
-                            printf("Error closing file!\n");
-                        }
-                        fileOpened = false;
-                        safe_free_aligned(&logBuffer);
-                        free_Secure_File_Info(&fp_log);
-                        return ERROR_WRITING_FILE;
-                    }
-                    ret = SUCCESS;
+                    safe_memcpy(supportedPages, ATA_LOG_PAGE_LEN_BYTES, slot, ATA_LOG_PAGE_LEN_BYTES);
                 }
-                if (toBuffer)
+                if (device->deviceVerbosity > VERBOSITY_QUIET && currentPage % UINT16_C(20) == UINT16_C(0))
                 {
-                    if (0 != safe_memcpy(myBuf, bufSize, logBuffer, logSize))
-                    {
-                        return BAD_PARAMETER;
-                    }
+                    printf(".");
+                    flush_stdout();
                 }
-                else
+            }
+            if (!fileOpened)
+            {
+                ret = open_Log_Stream_File(device, &fp_log, filePath, logName, fileExtension);
+                if (ret != SUCCESS)
                 {
-                    if (device->deviceVerbosity > VERBOSITY_QUIET)
-                    {
-                        printf("\n");
-                        printf("Binary log saved to: %s\n", fp_log->fullpath);
-                    }
+                    break;
                 }
+                fileOpened = true;
             }
-            else
+            ringBytesFilled += bytesToReadNow;
+            ++slotsFilled;
+            if (slotsFilled == ringSlots)
             {
-                // failed to read the log...
-                ret = FAILURE;
+                // the ring is full, so write it all out at once and start filling from the beginning again
+                ret             = write_Log_Stream_Data(device, fp_log, ring, ringBytesFilled);
+                ringBytesFilled = SIZE_T_C(0);
+                slotsFilled     = UINT8_C(0);
+                if (ret != SUCCESS)
+                {
+                    break;
+                }
             }
         }
-
-        if (fileOpened)
+        // write out whatever was read before the log ended or a read failed
+        if (fileOpened && ringBytesFilled > SIZE_T_C(0))
         {
-            if (SEC_FILE_SUCCESS != secure_Flush_File(fp_log))
+            eReturnValues writeRet = write_Log_Stream_Data(device, fp_log, ring, ringBytesFilled);
+            if (writeRet != SUCCESS)
             {
-                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                {
-                    perror("Error flushing data!\n");
-                }
-                if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
-                {
-                    printf("Error closing file!\n");
-                }
-                fileOpened = false;
-                safe_free_aligned(&logBuffer);
-                free_Secure_File_Info(&fp_log);
-                return ERROR_WRITING_FILE;
+                ret = writeRet;
             }
-            if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
+        }
+    }
+    else if (SMART)
+    {
+        if (SUCCESS == ata_SMART_Read_Log(device, logAddress, ring, logSize))
+        {
+            ret = open_Log_Stream_File(device, &fp_log, filePath, logName, fileExtension);
+            if (ret == SUCCESS)
             {
-                printf("Error closing file!\n");
+                fileOpened = true;
+                ret        = write_Log_Stream_Data(device, fp_log, ring, logSize);
             }
-            fileOpened = false;
         }
-        safe_free_aligned(&logBuffer);
-        free_Secure_File_Info(&fp_log);
+        else
+        {
+            ret = FAILURE;
+        }
     }
 
-#ifdef _DEBUG
-    printf("%s: <--\n", __FUNCTION__);
-#endif
+    if (fileOpened)
+    {
+        ret = close_Log_Stream_File(device, fp_log, ret);
+    }
+    safe_free_aligned(&ring);
+    free_Secure_File_Info(&fp_log);
     return ret;
 }
 
-//-----------------------------------------------------------------------------
-//
-//! get_SCSI_Log
-//
-//! \brief   generic function to pull an SCSI log and save it to a file
-//
-//  Entry:
-//!   \param[in]  device - file descriptor
-//!   \param[in]  logAddress - the address of the log you wish to pull
-//!   \param[in]  subpage - set this to something other than zero if looking for a specific subpage to a log
-//!   \param[in]  logName - a string that is the name of the log (NO SPACES please!) M_NULLPTR if no file output needed
-//!   \param[in]  fileExtension - a string for the file extension. You do not need to include a dot character.
-//!   \param[in]  toBuffer - boolean flag specifying if you want to return data in buffer
-//!   \param[in]  myBuf - buffer to return data in if toBuffer is true
-//!   \param[in]  bufSize - size of the buffer to get data filled into it (use get_SCSI_Log_Size)
-//!   \param[in]  filePath - string with path to output the file to. Can be M_NULLPTR for current directory.
-//!
-//  Exit:
-//!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
-//
-//-----------------------------------------------------------------------------
-
-eReturnValues get_SCSI_Log(tDevice*    device,
-                           uint8_t     logAddress,
-                           uint8_t     subpage,
-                           const char* logName,
-                           const char* fileExtension,
-                           bool        toBuffer,
-                           uint8_t*    myBuf,
-                           uint32_t    bufSize,
-                           const char* filePath)
+eReturnValues stream_SCSI_Log_To_File(tDevice*    device,
+                                      uint8_t     logAddress,
+                                      uint8_t     subpage,
+                                      const char* logName,
+                                      const char* fileExtension,
+                                      const char* filePath,
+                                      uint32_t    transferSizeBytes)
 {
-    eReturnValues   ret       = UNKNOWN;
-    uint32_t        pageLen   = UINT32_C(0);
-    secureFileInfo* fp_log    = M_NULLPTR;
-    uint8_t*        logBuffer = M_NULLPTR;
+    eReturnValues   ret              = UNKNOWN;
+    uint32_t        pageLen          = UINT32_C(0);
+    uint32_t        chunkSize        = UINT32_C(0);
+    uint32_t        bytesWritten     = UINT32_C(0);
+    uint16_t        parameterPointer = UINT16_C(0);
+    uint32_t        lastCodeWritten  = UINT32_C(0);
+    bool            wroteParameters  = false;
+    uint8_t*        logBuffer        = M_NULLPTR;
+    secureFileInfo* fp_log           = M_NULLPTR;
+    bool            fileOpened       = false;
+    bool            done             = false;
 
-    if (toBuffer)
+    if (transferSizeBytes > UINT32_C(0) && transferSizeBytes < LOG_STREAM_MIN_SCSI_TRANSFER_BYTES)
     {
-        ret     = SUCCESS;
-        pageLen = bufSize;
+        return BAD_PARAMETER;
     }
-    else
+    ret = get_SCSI_Log_Size(device, logAddress, subpage, &pageLen);
+    if (ret != SUCCESS)
     {
-        ret = get_SCSI_Log_Size(device, logAddress, subpage, &pageLen);
+        return ret;
     }
-    if (ret == SUCCESS)
+    chunkSize = pageLen;
+    if (transferSizeBytes > UINT32_C(0))
     {
-        // If the user wants it in a buffer...just return.
-        if (toBuffer && ((bufSize < pageLen) || myBuf == M_NULLPTR))
+        chunkSize = M_Min(pageLen, transferSizeBytes);
+    }
+    chunkSize = M_Min(chunkSize, C_CAST(uint32_t, UINT16_MAX));
+    logBuffer = M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(chunkSize, sizeof(uint8_t),
+                                                                 device->os_info.minimumAlignment));
+    if (logBuffer == M_NULLPTR)
+    {
+        if (VERBOSITY_QUIET < device->deviceVerbosity)
         {
-            return BAD_PARAMETER;
+            perror("Calloc failure!\n");
         }
-        else if (toBuffer)
+        return MEMORY_FAILURE;
+    }
+
+    // Log pages are read a chunk at a time using the parameter pointer. Each chunk is trimmed back to the last
+    // complete parameter and the next read starts at the parameter code after it. Parameters are returned in ascending
+    // order, so the file ends up with the same data a single read of the whole page would have returned.
+    while (!done)
+    {
+        uint32_t available  = UINT32_C(0);
+        uint32_t received   = UINT32_C(0);
+        uint32_t offset     = LOG_PAGE_HEADER_LENGTH;
+        uint32_t lastCode   = UINT32_C(0);
+        bool     foundParam = false;
+        safe_memset(logBuffer, chunkSize, 0, chunkSize);
+        ret = scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, logAddress, subpage, parameterPointer,
+                                 logBuffer, C_CAST(uint16_t, chunkSize));
+        if (ret != SUCCESS)
         {
-            logBuffer = myBuf;
+            if (fileOpened)
+            {
+                // the device does not allow a parameter pointer on this page, so fall back to a single read
+                ret = stream_SCSI_Log_Remainder(device, fp_log, logAddress, subpage, pageLen, bytesWritten);
+            }
+            else
+            {
+                ret = get_SCSI_Log_Sense_Failure_Status(device);
+            }
+            break;
         }
-        else
+        // the page length only describes the parameters at or after the parameter pointer
+        available = M_BytesTo2ByteValue(logBuffer[2], logBuffer[3]) + LOG_PAGE_HEADER_LENGTH;
+        received  = M_Min(available, chunkSize);
+        if (fileOpened && received >= LOG_PAGE_HEADER_LENGTH * 2)
         {
-            logBuffer = M_REINTERPRET_CAST(
-                uint8_t*, safe_calloc_aligned(pageLen, sizeof(uint8_t), device->os_info.minimumAlignment));
+            // A device or SATL that ignores the parameter pointer returns the start of the page again. Saving that
+            // would duplicate parameters in the file and never reach the end of the page.
+            uint32_t firstCode =
+                M_BytesTo2ByteValue(logBuffer[LOG_PAGE_HEADER_LENGTH], logBuffer[LOG_PAGE_HEADER_LENGTH + 1]);
+            if (firstCode < parameterPointer || (wroteParameters && firstCode <= lastCodeWritten))
+            {
+                ret = stream_SCSI_Log_Remainder(device, fp_log, logAddress, subpage, pageLen, bytesWritten);
+                break;
+            }
         }
-        if (logBuffer == M_NULLPTR)
+        if (!fileOpened)
         {
-            if (VERBOSITY_QUIET < device->deviceVerbosity)
+            ret = open_Log_Stream_File(device, &fp_log, filePath, logName, fileExtension);
+            if (ret != SUCCESS)
             {
-                perror("Calloc failure!\n");
+                break;
             }
-            return MEMORY_FAILURE;
+            fileOpened = true;
+            // the first header describes the whole page, so it is the one saved in the file
+            ret = write_Log_Stream_Data(device, fp_log, logBuffer, LOG_PAGE_HEADER_LENGTH);
+            if (ret != SUCCESS)
+            {
+                break;
+            }
+            bytesWritten += LOG_PAGE_HEADER_LENGTH;
         }
-
-        if (scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, logAddress, subpage, 0, logBuffer,
-                               C_CAST(uint16_t, pageLen)) == SUCCESS)
+        if (received >= available)
+        {
+            // everything that is left fit in this read
+            offset = received;
+            done   = true;
+        }
+        else
         {
-            uint16_t returnedPageLength = M_BytesTo2ByteValue(logBuffer[2], logBuffer[3]) + LOG_PAGE_HEADER_LENGTH;
-            ret                         = SUCCESS;
-            if (!toBuffer && logName && fileExtension) // Because you can also get a log file & get it in buffer.
+            while (offset + LOG_PAGE_HEADER_LENGTH <= received)
             {
-                if (SUCCESS == create_And_Open_Secure_Log_File_Dev_EZ(device, &fp_log, NAMING_SERIAL_NUMBER_DATE_TIME,
-                                                                      filePath, logName, fileExtension))
-                {
-                    // write the log to a file
-                    if (SEC_FILE_SUCCESS != secure_Write_File(fp_log, logBuffer, pageLen, sizeof(uint8_t),
-                                                              M_Min(pageLen, returnedPageLength), M_NULLPTR))
-                    {
-                        if (VERBOSITY_QUIET < device->deviceVerbosity)
-                        {
-                            perror("Error writing to a file!\n");
-                        }
-                        if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
-                        {
-                            printf("Error closing file!\n");
-                        }
-                        if (!toBuffer)
-                        {
-                            safe_free_aligned(&logBuffer);
-                        }
-                        free_Secure_File_Info(&fp_log);
-                        return ERROR_WRITING_FILE;
-                    }
-                    if (SEC_FILE_SUCCESS != secure_Flush_File(fp_log))
-                    {
-                        if (VERBOSITY_QUIET < device->deviceVerbosity)
-                        {
-                            perror("Error flushing data!\n");
-                        }
-                        if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
-                        {
-                            printf("Error closing file!\n");
-                        }
-                        if (!toBuffer)
-                        {
-                            safe_free_aligned(&logBuffer);
-                        }
-                        free_Secure_File_Info(&fp_log);
-                        return ERROR_WRITING_FILE;
-                    }
-                    if (SEC_FILE_SUCCESS != secure_Close_File(fp_log))
-                    {
-                        printf("Error closing file!\n");
-                    }
-                    if (device->deviceVerbosity > VERBOSITY_QUIET)
-                    {
-                        printf("\n");
-                        printf("Binary log saved to: %s\n", fp_log->fullpath);
-                    }
-                }
-                else
+                uint32_t parameterLength = LOG_PAGE_HEADER_LENGTH + logBuffer[offset + 3];
+                if (offset + parameterLength > received)
                 {
-                    if (fp_log->error == SEC_FILE_INSECURE_PATH)
-                    {
-                        ret = INSECURE_PATH;
-                    }
-                    else
-                    {
-                        ret = FAILURE;
-                    }
-                    safe_free_aligned(&logBuffer);
-                    free_Secure_File_Info(&fp_log);
+                    break;
                 }
+                lastCode   = M_BytesTo2ByteValue(logBuffer[offset], logBuffer[offset + 1]);
+                foundParam = true;
+                offset += parameterLength;
             }
         }
-        else
+        if (offset > LOG_PAGE_HEADER_LENGTH)
         {
-            senseDataFields senseFields;
-            safe_memset(&senseFields, sizeof(senseDataFields), 0, sizeof(senseDataFields));
-            get_Sense_Data_Fields(device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN, &senseFields);
-            if (senseFields.scsiStatusCodes.senseKey == SENSE_KEY_ILLEGAL_REQUEST &&
-                senseFields.scsiStatusCodes.asc == 0x24 && senseFields.scsiStatusCodes.ascq == 0x00)
-            {
-                ret = NOT_SUPPORTED;
-            }
-            else
+            ret = write_Log_Stream_Data(device, fp_log, &logBuffer[LOG_PAGE_HEADER_LENGTH],
+                                        uint32_to_sizet(offset - LOG_PAGE_HEADER_LENGTH));
+            if (ret != SUCCESS)
             {
-                ret = FAILURE;
+                break;
             }
+            bytesWritten += offset - LOG_PAGE_HEADER_LENGTH;
         }
-        if (!toBuffer)
+        if (!done)
         {
-            safe_free_aligned(&logBuffer);
+            if (!foundParam || lastCode >= UINT16_MAX)
+            {
+                // a single parameter is larger than the chunk or there is no parameter code left to continue from
+                ret = stream_SCSI_Log_Remainder(device, fp_log, logAddress, subpage, pageLen, bytesWritten);
+                break;
+            }
+            parameterPointer = C_CAST(uint16_t, lastCode + UINT32_C(1));
+            lastCodeWritten  = lastCode;
+            wroteParameters  = true;
         }
-        free_Secure_File_Info(&fp_log);
     }
+
+    if (fileOpened)
+    {
+        ret = close_Log_Stream_File(device, fp_log, ret);
+    }
+    safe_free_aligned(&logBuffer);
+    free_Secure_File_Info(&fp_log);
     return ret;
 }
 
@@ -2328,26 +3226,251 @@ eReturnValues get_SCSI_VPD(tDevice*    device,
                 free_Secure_File_Info(&fp_vpd);
                 return ERROR_WRITING_FILE;
             }
-            if (SEC_FILE_SUCCESS != secure_Close_File(fp_vpd))
+            if (SEC_FILE_SUCCESS != secure_Close_File(fp_vpd))
+            {
+                printf("Error closing file!\n");
+            }
+            fileOpened = false;
+        }
+        safe_free_aligned(&vpdBuffer);
+        free_Secure_File_Info(&fp_vpd);
+    }
+    return ret;
+}
+
+// Picks the starting transfer size when the caller did not specify one. This is only a starting point. The OS, HBA
+// or a bridge may not allow transfers this large, so pull_Telemetry_Data_Area backs off when the first reads fail.
+static uint32_t get_Telemetry_Auto_Transfer_Size(tDevice* device)
+{
+    uint32_t transferSize = TELEMETRY_PULL_MAX_AUTO_TRANSFER_BYTES;
+    if (device->drive_info.drive_type == NVME_DRIVE && device->drive_info.IdentifyData.nvme.ctrl.mdts > 0)
+    {
+        // MDTS is a power of 2 in units of the minimum memory page size. Assume 4K pages since that is the smallest
+        // allowed page size.
+        uint8_t  mdts      = M_Min(device->drive_info.IdentifyData.nvme.ctrl.mdts, UINT8_C(20));
+        uint64_t mdtsBytes = UINT64_C(4096) << mdts;
+        if (mdtsBytes < transferSize)
+        {
+            transferSize = M_STATIC_CAST(uint32_t, mdtsBytes);
+        }
+    }
+    return transferSize;
+}
+
+static eReturnValues read_Telemetry_Chunk(tDevice* device,
+                                          uint8_t  islLogToPull,
+                                          uint32_t pageNumber,
+                                          uint8_t* dataBuffer,
+                                          uint32_t chunkSize)
+{
+    eReturnValues ret = NOT_SUPPORTED;
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+        // read each remaining chunk with the trigger bit set to 0
+        ret = send_ATA_Read_Log_Ext_Cmd(device, islLogToPull, M_STATIC_CAST(uint16_t, pageNumber), dataBuffer,
+                                        chunkSize, 0);
+        break;
+    case SCSI_DRIVE:
+        ret = scsi_Read_Buffer(device, SCSI_RB_ERROR_HISTORY, islLogToPull, pageNumber * LEGACY_DRIVE_SEC_SIZE,
+                               chunkSize, dataBuffer);
+        break;
+    case NVME_DRIVE:
+    {
+        nvmeGetLogPageCmdOpts telemOpts;
+        safe_memset(&telemOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+        telemOpts.dataLen = chunkSize;
+        telemOpts.addr    = dataBuffer;
+        telemOpts.nsid    = NVME_ALL_NAMESPACES;
+        telemOpts.lid     = islLogToPull;
+        telemOpts.lsp     = UINT32_C(1); // read each remaining chunk with the trigger bit set to 1 as thats what
+                                         // nvme-cli is doing - Deb
+        telemOpts.offset  = M_STATIC_CAST(uint64_t, pageNumber) * UINT64_C(512);
+        ret               = nvme_Get_Log_Page(device, &telemOpts);
+    }
+    break;
+    default:
+        break;
+    }
+    return ret;
+}
+
+// Reads the telemetry data area after the header page (page 0) has already been read and saved.
+// Pages are 512B. The file is only flushed at the end, or every flushIntervalBytes when that is non-zero, so the OS
+// can write out data in the background while the next chunk is being read from the device.
+static eReturnValues pull_Telemetry_Data_Area(tDevice*                   device,
+                                              uint8_t                    islLogToPull,
+                                              uint32_t                   islPullingSize,
+                                              bool                       saveToFile,
+                                              secureFileInfo*            isl,
+                                              uint8_t*                   ptrData,
+                                              uint32_t                   dataSize,
+                                              uint32_t                   transferSizeBytes,
+                                              uint32_t                   flushIntervalBytes,
+                                              ptrTelemetryPullStatistics statistics)
+{
+    eReturnValues ret             = SUCCESS;
+    bool          sizeConfirmed   = transferSizeBytes > UINT32_C(0); // only back off on automatically chosen sizes
+    uint32_t      pullChunkSize   = transferSizeBytes;
+    uint32_t      remainingBytes  = UINT32_C(0);
+    uint64_t      bytesSinceFlush = UINT64_C(0);
+    uint8_t*      dataBuffer      = M_NULLPTR;
+    DECLARE_SEATIMER(phaseTimer);
+    if (islPullingSize <= UINT32_C(1))
+    {
+        // nothing after the header page
+        return SUCCESS;
+    }
+    remainingBytes = (islPullingSize - UINT32_C(1)) * LEGACY_DRIVE_SEC_SIZE;
+    if (pullChunkSize == UINT32_C(0))
+    {
+        pullChunkSize = get_Telemetry_Auto_Transfer_Size(device);
+    }
+    if (pullChunkSize > remainingBytes)
+    {
+        pullChunkSize = remainingBytes;
+    }
+    while (dataBuffer == M_NULLPTR)
+    {
+        dataBuffer = M_REINTERPRET_CAST(
+            uint8_t*, safe_calloc_aligned(pullChunkSize, sizeof(uint8_t), device->os_info.minimumAlignment));
+        if (dataBuffer == M_NULLPTR)
+        {
+            if (sizeConfirmed || pullChunkSize <= TELEMETRY_PULL_MIN_AUTO_TRANSFER_BYTES)
+            {
+                perror("calloc failure");
+                return MEMORY_FAILURE;
+            }
+            pullChunkSize = M_Max(TELEMETRY_PULL_MIN_AUTO_TRANSFER_BYTES,
+                                  ((pullChunkSize / UINT32_C(2)) / LEGACY_DRIVE_SEC_SIZE) * LEGACY_DRIVE_SEC_SIZE);
+        }
+    }
+    statistics->transferSizeBytes = pullChunkSize;
+    for (uint32_t pageNumber = UINT32_C(1); pageNumber < islPullingSize;)
+    {
+        uint32_t      chunkSize  = pullChunkSize;
+        eReturnValues readResult = SUCCESS;
+        if (VERBOSITY_QUIET < device->deviceVerbosity)
+        {
+            if ((pageNumber - UINT32_C(1)) % UINT32_C(16) == UINT32_C(0))
+            {
+                printf(".");
+                flush_stdout();
+            }
+        }
+        // adjust chunk size so we don't try and request anything that's not supported by the drive
+        if (pageNumber + (chunkSize / LEGACY_DRIVE_SEC_SIZE) > islPullingSize)
+        {
+            chunkSize = (islPullingSize - pageNumber) * LEGACY_DRIVE_SEC_SIZE;
+        }
+        start_Timer(&phaseTimer);
+        readResult = read_Telemetry_Chunk(device, islLogToPull, pageNumber, dataBuffer, chunkSize);
+        stop_Timer(&phaseTimer);
+        statistics->deviceReadTimeNS += get_Nano_Seconds(phaseTimer);
+        ++(statistics->readCommands);
+        if (SUCCESS != readResult)
+        {
+            if (!sizeConfirmed && pullChunkSize > TELEMETRY_PULL_MIN_AUTO_TRANSFER_BYTES)
+            {
+                // Something in the path rejected this transfer size. Retry the same pages with a smaller transfer.
+                pullChunkSize = M_Max(TELEMETRY_PULL_MIN_AUTO_TRANSFER_BYTES,
+                                      ((pullChunkSize / UINT32_C(2)) / LEGACY_DRIVE_SEC_SIZE) * LEGACY_DRIVE_SEC_SIZE);
+                statistics->transferSizeBytes = pullChunkSize;
+                continue;
+            }
+            ret = FAILURE;
+            break;
+        }
+        if (chunkSize == pullChunkSize)
+        {
+            sizeConfirmed = true;
+        }
+        statistics->bytesPulled += chunkSize;
+        // save to file, or copy to the ptr we were given
+        if (saveToFile)
+        {
+            start_Timer(&phaseTimer);
+            eSecureFileError writeResult =
+                secure_Write_File(isl, dataBuffer, chunkSize, sizeof(uint8_t), chunkSize, M_NULLPTR);
+            stop_Timer(&phaseTimer);
+            statistics->fileWriteTimeNS += get_Nano_Seconds(phaseTimer);
+            if (SEC_FILE_SUCCESS != writeResult)
+            {
+                if (VERBOSITY_QUIET < device->deviceVerbosity)
+                {
+                    perror("Error writing to a file!\n");
+                }
+                ret = ERROR_WRITING_FILE;
+                break;
+            }
+            bytesSinceFlush += chunkSize;
+            if (flushIntervalBytes > UINT32_C(0) && bytesSinceFlush >= flushIntervalBytes)
+            {
+                start_Timer(&phaseTimer);
+                eSecureFileError flushResult = secure_Flush_File(isl);
+                stop_Timer(&phaseTimer);
+                statistics->fileFlushTimeNS += get_Nano_Seconds(phaseTimer);
+                if (SEC_FILE_SUCCESS != flushResult)
+                {
+                    if (VERBOSITY_QUIET < device->deviceVerbosity)
+                    {
+                        perror("Error flushing data!\n");
+                    }
+                    ret = ERROR_WRITING_FILE;
+                    break;
+                }
+                bytesSinceFlush = UINT64_C(0);
+            }
+        }
+        else
+        {
+            if (0 != safe_memcpy(&ptrData[uint32_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE],
+                                 dataSize - (uint32_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE), dataBuffer,
+                                 uint32_to_sizet(chunkSize)))
+            {
+                ret = BAD_PARAMETER;
+                break;
+            }
+        }
+        pageNumber += chunkSize / LEGACY_DRIVE_SEC_SIZE;
+    }
+    if (VERBOSITY_QUIET < device->deviceVerbosity)
+    {
+        printf("\n");
+    }
+    if (saveToFile)
+    {
+        // always flush whatever was pulled so a partial log can still be looked at
+        start_Timer(&phaseTimer);
+        eSecureFileError flushResult = secure_Flush_File(isl);
+        stop_Timer(&phaseTimer);
+        statistics->fileFlushTimeNS += get_Nano_Seconds(phaseTimer);
+        if (SEC_FILE_SUCCESS != flushResult)
+        {
+            if (VERBOSITY_QUIET < device->deviceVerbosity)
             {
-                printf("Error closing file!\n");
+                perror("Error flushing data!\n");
+            }
+            if (ret == SUCCESS)
+            {
+                ret = ERROR_WRITING_FILE;
             }
-            fileOpened = false;
         }
-        safe_free_aligned(&vpdBuffer);
-        free_Secure_File_Info(&fp_vpd);
     }
+    safe_free_aligned(&dataBuffer);
     return ret;
 }
 
-static eReturnValues ata_Pull_Telemetry_Log(tDevice*    device,
-                                            bool        currentOrSaved,
-                                            uint8_t     islDataSet,
-                                            bool        saveToFile,
-                                            uint8_t*    ptrData,
-                                            uint32_t    dataSize,
-                                            const char* filePath,
-                                            uint32_t    transferSizeBytes)
+static eReturnValues ata_Pull_Telemetry_Log(tDevice*                   device,
+                                            bool                       currentOrSaved,
+                                            uint8_t                    islDataSet,
+                                            bool                       saveToFile,
+                                            uint8_t*                   ptrData,
+                                            uint32_t                   dataSize,
+                                            const char*                filePath,
+                                            uint32_t                   transferSizeBytes,
+                                            uint32_t                   flushIntervalBytes,
+                                            ptrTelemetryPullStatistics statistics)
 {
     eReturnValues   ret = SUCCESS;
     secureFileInfo* isl = M_NULLPTR;
@@ -2363,7 +3486,7 @@ static eReturnValues ata_Pull_Telemetry_Log(tDevice*    device,
         return MEMORY_FAILURE;
     }
     // check the GPL directory to make sure that the internal status log is supported by the drive
-    if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_DIRECTORY, 0, dataBuffer, ATA_LOG_PAGE_LEN_BYTES, 0))
+    if (SUCCESS == get_ATA_Log_Directory(device, M_NULLPTR, ATA_LOG_DIRECTORY_GPL, dataBuffer, ATA_LOG_PAGE_LEN_BYTES))
     {
         uint8_t islLogToPull = UINT8_C(0);
         if (currentOrSaved == true)
@@ -2404,8 +3527,13 @@ static eReturnValues ata_Pull_Telemetry_Log(tDevice*    device,
                 }
             }
             // read the first sector of the log with the trigger bit set
-            if (SUCCESS ==
-                send_ATA_Read_Log_Ext_Cmd(device, islLogToPull, 0, dataBuffer, LEGACY_DRIVE_SEC_SIZE, UINT16_C(0x0001)))
+            DECLARE_SEATIMER(triggerTimer);
+            start_Timer(&triggerTimer);
+            eReturnValues triggerResult =
+                send_ATA_Read_Log_Ext_Cmd(device, islLogToPull, 0, dataBuffer, LEGACY_DRIVE_SEC_SIZE, UINT16_C(0x0001));
+            stop_Timer(&triggerTimer);
+            statistics->triggerTimeNS = get_Nano_Seconds(triggerTimer);
+            if (SUCCESS == triggerResult)
             {
                 // now we need to check the sizes reported for the log and what the user is requesting to pull (and save
                 // what we just read to a file)
@@ -2413,14 +3541,6 @@ static eReturnValues ata_Pull_Telemetry_Log(tDevice*    device,
                 uint16_t reportedMediumSize = UINT16_C(0);
                 uint16_t reportedLargeSize  = UINT16_C(0);
                 uint16_t islPullingSize     = UINT16_C(0);
-                uint16_t pageNumber         = UINT16_C(0); // keep track of the current page we are reading/saving
-                uint32_t pullChunkSize =
-                    UINT32_C(8) * LEGACY_DRIVE_SEC_SIZE; // pull the remainder of the log in 4k chunks
-                if (transferSizeBytes > UINT32_C(0))
-                {
-                    pullChunkSize = transferSizeBytes;
-                }
-                uint8_t* temp = M_NULLPTR;
                 // saving first page to file
                 if (saveToFile)
                 {
@@ -2439,20 +3559,6 @@ static eReturnValues ata_Pull_Telemetry_Log(tDevice*    device,
                         free_Secure_File_Info(&isl);
                         return ERROR_WRITING_FILE;
                     }
-                    if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                    {
-                        if (VERBOSITY_QUIET < device->deviceVerbosity)
-                        {
-                            perror("Error flushing data!\n");
-                        }
-                        if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                        {
-                            printf("Error closing file!\n");
-                        }
-                        safe_free_aligned(&dataBuffer);
-                        free_Secure_File_Info(&isl);
-                        return ERROR_WRITING_FILE;
-                    }
                 }
                 else
                 {
@@ -2494,109 +3600,10 @@ static eReturnValues ata_Pull_Telemetry_Log(tDevice*    device,
                     islPullingSize = reportedSmallSize;
                     break;
                 }
-                // increment pageNumber to 1 and reallocate the local data buffer
-                pageNumber += 1;
-                temp = C_CAST(uint8_t*,
-                              safe_realloc_aligned(dataBuffer, 512, pullChunkSize, device->os_info.minimumAlignment));
-                if (temp == M_NULLPTR)
-                {
-                    safe_free_aligned(&dataBuffer);
-                    perror("realloc failure");
-                    return MEMORY_FAILURE;
-                }
-                dataBuffer = temp;
-                safe_memset(dataBuffer, pullChunkSize, 0, pullChunkSize);
-                // read the remaining data
-                for (pageNumber = UINT16_C(1); pageNumber < islPullingSize;
-                     pageNumber += C_CAST(uint16_t, (pullChunkSize / LEGACY_DRIVE_SEC_SIZE)))
-                {
-                    if (VERBOSITY_QUIET < device->deviceVerbosity)
-                    {
-                        if ((pageNumber - 1) % 16 == 0)
-                        {
-                            printf(".");
-                            flush_stdout();
-                        }
-                    }
-                    // adjust pullcheck size so we don't try and request anything that's not supported by the drive
-                    if (pageNumber + (pullChunkSize / LEGACY_DRIVE_SEC_SIZE) > islPullingSize)
-                    {
-                        pullChunkSize = C_CAST(uint32_t, (islPullingSize - pageNumber)) * LEGACY_DRIVE_SEC_SIZE;
-                    }
-                    // read each remaining chunk with the trigger bit set to 0
-                    if (SUCCESS ==
-                        send_ATA_Read_Log_Ext_Cmd(device, islLogToPull, pageNumber, dataBuffer, pullChunkSize, 0))
-                    {
-                        // save to file, or copy to the ptr we were given
-                        if (saveToFile)
-                        {
-                            if (SEC_FILE_SUCCESS != secure_Write_File(isl, dataBuffer, pullChunkSize, sizeof(uint8_t),
-                                                                      pullChunkSize, M_NULLPTR))
-                            {
-                                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                                {
-                                    perror("Error writing to a file!\n");
-                                }
-                                if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                                {
-                                    printf("Error closing file!\n");
-                                }
-                                safe_free_aligned(&dataBuffer);
-                                free_Secure_File_Info(&isl);
-                                return ERROR_WRITING_FILE;
-                            }
-                            if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                            {
-                                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                                {
-                                    perror("Error flushing data!\n");
-                                }
-                                if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                                {
-                                    printf("Error closing file!\n");
-                                }
-                                safe_free_aligned(&dataBuffer);
-                                free_Secure_File_Info(&isl);
-                                return ERROR_WRITING_FILE;
-                            }
-                        }
-                        else
-                        {
-                            if (0 != safe_memcpy(&ptrData[uint16_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE],
-                                                 dataSize - (uint16_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE),
-                                                 dataBuffer, uint32_to_sizet(pullChunkSize)))
-                            {
-                                safe_free_aligned(&dataBuffer);
-                                return BAD_PARAMETER;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        ret = FAILURE;
-                        break;
-                    }
-                    safe_memset(dataBuffer, pullChunkSize, 0, pullChunkSize);
-                }
-                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                {
-                    printf("\n");
-                }
+                ret = pull_Telemetry_Data_Area(device, islLogToPull, islPullingSize, saveToFile, isl, ptrData,
+                                               dataSize, transferSizeBytes, flushIntervalBytes, statistics);
                 if (saveToFile)
                 {
-                    if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                    {
-                        if (VERBOSITY_QUIET < device->deviceVerbosity)
-                        {
-                            perror("Error flushing data!\n");
-                        }
-                        if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                        {
-                            printf("Error closing file!\n");
-                        }
-                        free_Secure_File_Info(&isl);
-                        return ERROR_WRITING_FILE;
-                    }
                     if (SEC_FILE_SUCCESS != secure_Close_File(isl))
                     {
                         printf("Error closing file!\n");
@@ -2622,14 +3629,16 @@ static eReturnValues ata_Pull_Telemetry_Log(tDevice*    device,
     return ret;
 }
 
-static eReturnValues scsi_Pull_Telemetry_Log(tDevice*    device,
-                                             bool        currentOrSaved,
-                                             uint8_t     islDataSet,
-                                             bool        saveToFile,
-                                             uint8_t*    ptrData,
-                                             uint32_t    dataSize,
-                                             const char* filePath,
-                                             uint32_t    transferSizeBytes)
+static eReturnValues scsi_Pull_Telemetry_Log(tDevice*                   device,
+                                             bool                       currentOrSaved,
+                                             uint8_t                    islDataSet,
+                                             bool                       saveToFile,
+                                             uint8_t*                   ptrData,
+                                             uint32_t                   dataSize,
+                                             const char*                filePath,
+                                             uint32_t                   transferSizeBytes,
+                                             uint32_t                   flushIntervalBytes,
+                                             ptrTelemetryPullStatistics statistics)
 {
     eReturnValues   ret          = SUCCESS;
     secureFileInfo* isl          = M_NULLPTR;
@@ -2651,6 +3660,8 @@ static eReturnValues scsi_Pull_Telemetry_Log(tDevice*    device,
         perror("calloc failure");
         return MEMORY_FAILURE;
     }
+    DECLARE_SEATIMER(triggerTimer);
+    start_Timer(&triggerTimer); // snapshot creation through reading the header page
     if (SUCCESS == scsi_Read_Buffer(device,
                                     M_STATIC_CAST(uint8_t, SCSI_RB_ERROR_HISTORY) |
                                         M_STATIC_CAST(uint8_t, RD_BUF_ERR_HIST_MS_SNAPSHOT_INTERNAL_STATUS),
@@ -2713,21 +3724,17 @@ static eReturnValues scsi_Pull_Telemetry_Log(tDevice*    device,
             uint32_t pageNumber = UINT32_C(0);
             // now we can pull the first page of internal status log and find whether the short/long pages are supported
             // by the device
-            if (SUCCESS == scsi_Read_Buffer(device, SCSI_RB_ERROR_HISTORY, islLogToPull, pageNumber,
-                                            LEGACY_DRIVE_SEC_SIZE, dataBuffer))
+            eReturnValues headerResult = scsi_Read_Buffer(device, SCSI_RB_ERROR_HISTORY, islLogToPull, pageNumber,
+                                                          LEGACY_DRIVE_SEC_SIZE, dataBuffer);
+            stop_Timer(&triggerTimer);
+            statistics->triggerTimeNS = get_Nano_Seconds(triggerTimer);
+            if (SUCCESS == headerResult)
             {
-                uint32_t pullChunkSize =
-                    UINT32_C(8) * LEGACY_DRIVE_SEC_SIZE; // pull the remainder of the log in 4k chunks
-                if (transferSizeBytes > UINT32_C(0))
-                {
-                    pullChunkSize = transferSizeBytes;
-                }
                 uint16_t reportedSmallSize  = UINT16_C(0);
                 uint16_t reportedMediumSize = UINT16_C(0);
                 uint16_t reportedLargeSize  = UINT16_C(0);
                 uint32_t reportedXLargeSize = UINT32_C(0);
                 uint32_t islPullingSize     = UINT32_C(0);
-                uint8_t* temp               = M_NULLPTR;
                 if (saveToFile)
                 {
                     if (SUCCESS == create_And_Open_Secure_Log_File_Dev_EZ(device, &isl, NAMING_SERIAL_NUMBER_DATE_TIME,
@@ -2752,20 +3759,6 @@ static eReturnValues scsi_Pull_Telemetry_Log(tDevice*    device,
                             free_Secure_File_Info(&isl);
                             return ERROR_WRITING_FILE;
                         }
-                        if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                        {
-                            if (VERBOSITY_QUIET < device->deviceVerbosity)
-                            {
-                                perror("Error flushing data!\n");
-                            }
-                            if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                            {
-                                printf("Error closing file!\n");
-                            }
-                            safe_free_aligned(&dataBuffer);
-                            free_Secure_File_Info(&isl);
-                            return ERROR_WRITING_FILE;
-                        }
                     }
                     else
                     {
@@ -2839,95 +3832,10 @@ static eReturnValues scsi_Pull_Telemetry_Log(tDevice*    device,
                     islPullingSize = reportedSmallSize;
                     break;
                 }
-                // increment pageNumber to 1 and reallocate the local data buffer
-                pageNumber += UINT32_C(1);
-                temp = C_CAST(uint8_t*,
-                              safe_realloc_aligned(dataBuffer, 512, pullChunkSize, device->os_info.minimumAlignment));
-                if (temp == M_NULLPTR)
-                {
-                    safe_free_aligned(&dataBuffer);
-                    perror("realloc failure");
-                    return MEMORY_FAILURE;
-                }
-                dataBuffer = temp;
-                safe_memset(dataBuffer, pullChunkSize, 0, pullChunkSize);
-                // read the remaining data
-                for (pageNumber = UINT32_C(1); pageNumber < islPullingSize;
-                     pageNumber += (pullChunkSize / LEGACY_DRIVE_SEC_SIZE))
-                {
-                    if (VERBOSITY_QUIET < device->deviceVerbosity)
-                    {
-                        if ((pageNumber - UINT32_C(1)) % UINT32_C(16) == UINT32_C(0))
-                        {
-                            printf(".");
-                            flush_stdout();
-                        }
-                    }
-                    // adjust pullcheck size so we don't try and request anything that's not supported by the drive
-                    if (pageNumber + (pullChunkSize / LEGACY_DRIVE_SEC_SIZE) > islPullingSize)
-                    {
-                        pullChunkSize = (islPullingSize - pageNumber) * LEGACY_DRIVE_SEC_SIZE;
-                    }
-                    // read each remaining chunk of the log
-                    if (SUCCESS == scsi_Read_Buffer(device, SCSI_RB_ERROR_HISTORY, islLogToPull,
-                                                    pageNumber * LEGACY_DRIVE_SEC_SIZE, pullChunkSize, dataBuffer))
-                    {
-                        // save to file, or copy to the ptr we were given
-                        if (saveToFile)
-                        {
-                            if (SEC_FILE_SUCCESS != secure_Write_File(isl, dataBuffer, pullChunkSize, sizeof(uint8_t),
-                                                                      pullChunkSize, M_NULLPTR))
-                            {
-                                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                                {
-                                    perror("Error writing to file!\n");
-                                }
-                                if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                                {
-                                    printf("Error closing file!\n");
-                                }
-                                safe_free_aligned(&dataBuffer);
-                                return ERROR_WRITING_FILE;
-                            }
-                            if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                            {
-                                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                                {
-                                    perror("Error flushing data!\n");
-                                }
-                                if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                                {
-                                    printf("Error closing file!\n");
-                                }
-                                safe_free_aligned(&dataBuffer);
-                                return ERROR_WRITING_FILE;
-                            }
-                        }
-                        else
-                        {
-                            if (0 != safe_memcpy(&ptrData[uint32_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE],
-                                                 dataSize - (uint32_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE),
-                                                 dataBuffer, uint32_to_sizet(pullChunkSize)))
-                            {
-                                safe_free_aligned(&dataBuffer);
-                                return BAD_PARAMETER;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        ret = FAILURE;
-                        break;
-                    }
-                    safe_memset(dataBuffer, pullChunkSize, 0, pullChunkSize);
-                }
-                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                {
-                    printf("\n");
-                }
+                ret = pull_Telemetry_Data_Area(device, islLogToPull, islPullingSize, saveToFile, isl, ptrData,
+                                               dataSize, transferSizeBytes, flushIntervalBytes, statistics);
                 if (saveToFile)
                 {
-                    secure_Flush_File(isl);
                     if (SEC_FILE_SUCCESS != secure_Close_File(isl))
                     {
                         printf("Error closing file!\n");
@@ -2954,14 +3862,16 @@ static eReturnValues scsi_Pull_Telemetry_Log(tDevice*    device,
     return ret;
 }
 
-static eReturnValues nvme_Pull_Telemetry_Log(tDevice*    device,
-                                             bool        currentOrSaved,
-                                             uint8_t     islDataSet,
-                                             bool        saveToFile,
-                                             uint8_t*    ptrData,
-                                             uint32_t    dataSize,
-                                             const char* filePath,
-                                             uint32_t    transferSizeBytes)
+static eReturnValues nvme_Pull_Telemetry_Log(tDevice*                   device,
+                                             bool                       currentOrSaved,
+                                             uint8_t                    islDataSet,
+                                             bool                       saveToFile,
+                                             uint8_t*                   ptrData,
+                                             uint32_t                   dataSize,
+                                             const char*                filePath,
+                                             uint32_t                   transferSizeBytes,
+                                             uint32_t                   flushIntervalBytes,
+                                             ptrTelemetryPullStatistics statistics)
 {
     eReturnValues   ret = SUCCESS;
     secureFileInfo* isl = M_NULLPTR;
@@ -3026,7 +3936,12 @@ static eReturnValues nvme_Pull_Telemetry_Log(tDevice*    device,
             telemOpts.lid     = islLogToPull;
             telemOpts.lsp     = UINT32_C(1); // This will be shifted into bit 8
             telemOpts.offset  = UINT64_C(0);
-            if (SUCCESS == nvme_Get_Log_Page(device, &telemOpts))
+            DECLARE_SEATIMER(triggerTimer);
+            start_Timer(&triggerTimer);
+            eReturnValues triggerResult = nvme_Get_Log_Page(device, &telemOpts);
+            stop_Timer(&triggerTimer);
+            statistics->triggerTimeNS = get_Nano_Seconds(triggerTimer);
+            if (SUCCESS == triggerResult)
             {
                 // now we need to check the sizes reported for the log and what the user is requesting to pull (and save
                 // what we just read to a file)
@@ -3035,14 +3950,6 @@ static eReturnValues nvme_Pull_Telemetry_Log(tDevice*    device,
                 uint16_t reportedLargeSize  = UINT16_C(0);
                 uint32_t reportedXLargeSize = UINT32_C(0);
                 uint32_t islPullingSize     = UINT32_C(0);
-                uint32_t pageNumber         = UINT32_C(0); // keep track of the offset we are reading/saving
-                uint32_t pullChunkSize =
-                    UINT32_C(8) * LEGACY_DRIVE_SEC_SIZE; // pull the remainder of the log in 4k chunks
-                if (transferSizeBytes > UINT32_C(0))
-                {
-                    pullChunkSize = transferSizeBytes;
-                }
-                uint8_t* temp = M_NULLPTR;
                 // saving first page to file
                 if (saveToFile)
                 {
@@ -3061,20 +3968,6 @@ static eReturnValues nvme_Pull_Telemetry_Log(tDevice*    device,
                         free_Secure_File_Info(&isl);
                         return ERROR_WRITING_FILE;
                     }
-                    if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                    {
-                        if (VERBOSITY_QUIET < device->deviceVerbosity)
-                        {
-                            perror("Error flushing data!\n");
-                        }
-                        if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                        {
-                            printf("Error closing file!\n");
-                        }
-                        safe_free_aligned(&dataBuffer);
-                        free_Secure_File_Info(&isl);
-                        return ERROR_WRITING_FILE;
-                    }
                 }
                 else
                 {
@@ -3128,112 +4021,10 @@ static eReturnValues nvme_Pull_Telemetry_Log(tDevice*    device,
                     islPullingSize = reportedSmallSize;
                     break;
                 }
-                // increment pageNumber to 1 and reallocate the local data buffer
-                pageNumber += UINT32_C(1);
-                temp = C_CAST(uint8_t*,
-                              safe_realloc_aligned(dataBuffer, 512, pullChunkSize, device->os_info.minimumAlignment));
-                if (temp == M_NULLPTR)
-                {
-                    safe_free_aligned(&dataBuffer);
-                    perror("realloc failure");
-                    return MEMORY_FAILURE;
-                }
-                dataBuffer     = temp;
-                telemOpts.addr = dataBuffer; // update the data buffer after the reallocation - TJE
-                safe_memset(dataBuffer, pullChunkSize, 0, pullChunkSize);
-                // read the remaining data
-                for (pageNumber = UINT32_C(1); pageNumber < islPullingSize;
-                     pageNumber += C_CAST(uint32_t, (pullChunkSize / LEGACY_DRIVE_SEC_SIZE)))
-                {
-                    if (VERBOSITY_QUIET < device->deviceVerbosity)
-                    {
-                        if ((pageNumber - UINT32_C(1)) % UINT32_C(16) == UINT32_C(0))
-                        {
-                            printf(".");
-                            flush_stdout();
-                        }
-                    }
-                    // adjust pullcheck size so we don't try and request anything that's not supported by the drive
-                    if (pageNumber + (pullChunkSize / LEGACY_DRIVE_SEC_SIZE) > islPullingSize)
-                    {
-                        pullChunkSize = C_CAST(uint32_t, (islPullingSize - pageNumber)) * LEGACY_DRIVE_SEC_SIZE;
-                    }
-                    // read each remaining chunk with the trigger bit set to 1 as thats what nvme-cli is doing - Deb
-                    telemOpts.lsp     = UINT32_C(1);
-                    telemOpts.offset  = C_CAST(uint64_t, pageNumber) * UINT64_C(512);
-                    telemOpts.dataLen = pullChunkSize;
-                    if (SUCCESS == nvme_Get_Log_Page(device, &telemOpts))
-                    {
-                        // save to file, or copy to the ptr we were given
-                        if (saveToFile)
-                        {
-                            if (SEC_FILE_SUCCESS != secure_Write_File(isl, dataBuffer, pullChunkSize, sizeof(uint8_t),
-                                                                      pullChunkSize, M_NULLPTR))
-                            {
-                                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                                {
-                                    perror("Error writing data to a file!\n");
-                                }
-                                if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                                {
-                                    printf("Error closing file!\n");
-                                }
-                                safe_free_aligned(&dataBuffer);
-                                free_Secure_File_Info(&isl);
-                                return ERROR_WRITING_FILE;
-                            }
-                            if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                            {
-                                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                                {
-                                    perror("Error flushing data!\n");
-                                }
-                                if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                                {
-                                    printf("Error closing file!\n");
-                                }
-                                safe_free_aligned(&dataBuffer);
-                                free_Secure_File_Info(&isl);
-                                return ERROR_WRITING_FILE;
-                            }
-                        }
-                        else
-                        {
-                            if (0 != safe_memcpy(&ptrData[uint32_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE],
-                                                 dataSize - (uint32_to_sizet(pageNumber) * LEGACY_DRIVE_SEC_SIZE),
-                                                 dataBuffer, uint32_to_sizet(pullChunkSize)))
-                            {
-                                safe_free_aligned(&dataBuffer);
-                                return BAD_PARAMETER;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        ret = FAILURE;
-                        break;
-                    }
-                    safe_memset(dataBuffer, pullChunkSize, 0, pullChunkSize);
-                }
-                if (VERBOSITY_QUIET < device->deviceVerbosity)
-                {
-                    printf("\n");
-                }
+                ret = pull_Telemetry_Data_Area(device, islLogToPull, islPullingSize, saveToFile, isl, ptrData,
+                                               dataSize, transferSizeBytes, flushIntervalBytes, statistics);
                 if (saveToFile)
                 {
-                    if (SEC_FILE_SUCCESS != secure_Flush_File(isl))
-                    {
-                        if (VERBOSITY_QUIET < device->deviceVerbosity)
-                        {
-                            perror("Error flushing data!\n");
-                        }
-                        if (SEC_FILE_SUCCESS != secure_Close_File(isl))
-                        {
-                            printf("Error closing file!\n");
-                        }
-                        free_Secure_File_Info(&isl);
-                        return ERROR_WRITING_FILE;
-                    }
                     if (SEC_FILE_SUCCESS != secure_Close_File(isl))
                     {
                         printf("Error closing file!\n");
@@ -3255,36 +4046,108 @@ static eReturnValues nvme_Pull_Telemetry_Log(tDevice*    device,
     return ret;
 }
 
-eReturnValues pull_Telemetry_Log(tDevice*    device,
-                                 bool        currentOrSaved,
-                                 uint8_t     islDataSet,
-                                 bool        saveToFile,
-                                 uint8_t*    ptrData,
-                                 uint32_t    dataSize,
-                                 const char* filePath,
-                                 uint32_t    transferSizeBytes)
+eReturnValues pull_Telemetry_Log2(tDevice* device, ptrTelemetryPullOptions options)
 {
     eReturnValues ret = NOT_SUPPORTED;
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || options == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (options->version < TELEMETRY_PULL_OPTIONS_VERSION || options->size < sizeof(telemetryPullOptions) ||
+        (!options->saveToFile && (options->ptrData == M_NULLPTR || options->dataSize == UINT32_C(0))))
+    {
+        return BAD_PARAMETER;
+    }
+    DECLARE_SEATIMER(totalTimer);
+    safe_memset(&options->statistics, sizeof(telemetryPullStatistics), 0, sizeof(telemetryPullStatistics));
+    start_Timer(&totalTimer);
     switch (device->drive_info.drive_type)
     {
     case ATA_DRIVE:
-        ret = ata_Pull_Telemetry_Log(device, currentOrSaved, islDataSet, saveToFile, ptrData, dataSize, filePath,
-                                     transferSizeBytes);
+        ret = ata_Pull_Telemetry_Log(device, options->currentOrSaved, options->islDataSet, options->saveToFile,
+                                     options->ptrData, options->dataSize, options->filePath,
+                                     options->transferSizeBytes, options->flushIntervalBytes, &options->statistics);
         break;
     case NVME_DRIVE:
-        ret = nvme_Pull_Telemetry_Log(device, currentOrSaved, islDataSet, saveToFile, ptrData, dataSize, filePath,
-                                      transferSizeBytes);
+        ret = nvme_Pull_Telemetry_Log(device, options->currentOrSaved, options->islDataSet, options->saveToFile,
+                                      options->ptrData, options->dataSize, options->filePath,
+                                      options->transferSizeBytes, options->flushIntervalBytes, &options->statistics);
         break;
     case SCSI_DRIVE:
-        ret = scsi_Pull_Telemetry_Log(device, currentOrSaved, islDataSet, saveToFile, ptrData, dataSize, filePath,
-                                      transferSizeBytes);
+        ret = scsi_Pull_Telemetry_Log(device, options->currentOrSaved, options->islDataSet, options->saveToFile,
+                                      options->ptrData, options->dataSize, options->filePath,
+                                      options->transferSizeBytes, options->flushIntervalBytes, &options->statistics);
         break;
     default:
         break;
     }
+    stop_Timer(&totalTimer);
+    options->statistics.totalTimeNS = get_Nano_Seconds(totalTimer);
+    if (VERBOSITY_DEFAULT < device->deviceVerbosity)
+    {
+        print_Telemetry_Pull_Statistics(&options->statistics);
+    }
     return ret;
 }
 
+eReturnValues pull_Telemetry_Log(tDevice*    device,
+                                 bool        currentOrSaved,
+                                 uint8_t     islDataSet,
+                                 bool        saveToFile,
+                                 uint8_t*    ptrData,
+                                 uint32_t    dataSize,
+                                 const char* filePath,
+                                 uint32_t    transferSizeBytes)
+{
+    telemetryPullOptions options;
+    safe_memset(&options, sizeof(telemetryPullOptions), 0, sizeof(telemetryPullOptions));
+    options.size               = sizeof(telemetryPullOptions);
+    options.version            = TELEMETRY_PULL_OPTIONS_VERSION;
+    options.currentOrSaved     = currentOrSaved;
+    options.islDataSet         = islDataSet;
+    options.saveToFile         = saveToFile;
+    options.ptrData            = ptrData;
+    options.dataSize           = dataSize;
+    options.filePath           = filePath;
+    options.transferSizeBytes  = transferSizeBytes;
+    options.flushIntervalBytes = UINT32_C(0); // only flush when done
+    return pull_Telemetry_Log2(device, &options);
+}
+
+void print_Telemetry_Pull_Statistics(ptrTelemetryPullStatistics statistics)
+{
+    DISABLE_NONNULL_COMPARE
+    if (statistics == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    printf("\nTelemetry pull statistics:\n");
+    printf("    Transfer size: %" PRIu32 " bytes\n", statistics->transferSizeBytes);
+    printf("    Read commands: %" PRIu32 "\n", statistics->readCommands);
+    printf("    Data area bytes pulled: %" PRIu64 "\n", statistics->bytesPulled);
+    printf("    Trigger/header time: ");
+    print_Command_Time(statistics->triggerTimeNS);
+    printf("\n    Device read time: ");
+    print_Command_Time(statistics->deviceReadTimeNS);
+    printf("\n    File write time: ");
+    print_Command_Time(statistics->fileWriteTimeNS);
+    printf("\n    File flush time: ");
+    print_Command_Time(statistics->fileFlushTimeNS);
+    printf("\n    Total time: ");
+    print_Command_Time(statistics->totalTimeNS);
+    printf("\n");
+    if (statistics->deviceReadTimeNS > UINT64_C(0))
+    {
+        printf("    Device read rate: %0.02f MB/s\n",
+               (M_STATIC_CAST(double, statistics->bytesPulled) /
+                (M_STATIC_CAST(double, statistics->deviceReadTimeNS) / 1000000000.0)) /
+                   1000000.0);
+    }
+}
+
 eReturnValues print_Supported_Logs(tDevice* device, uint64_t flags)
 {
     eReturnValues retStatus = NOT_SUPPORTED;
@@ -3444,7 +4307,8 @@ eReturnValues print_Supported_ATA_Logs(tDevice* device, uint64_t flags)
     {
         if (is_SMART_Enabled(device) && is_SMART_Error_Logging_Supported(device))
         {
-            retStatus = ata_SMART_Read_Log(device, ATA_LOG_DIRECTORY, smartLogBuffer, ATA_LOG_PAGE_LEN_BYTES);
+            retStatus = get_ATA_Log_Directory(device, M_NULLPTR, ATA_LOG_DIRECTORY_SMART, smartLogBuffer,
+                                              ATA_LOG_PAGE_LEN_BYTES);
             if (retStatus != SUCCESS && retStatus != WARN_INVALID_CHECKSUM)
             {
                 legacyDriveNoLogDir = true; // for old drives that do not support multi-sector logs we will rely on
@@ -3462,7 +4326,7 @@ eReturnValues print_Supported_ATA_Logs(tDevice* device, uint64_t flags)
         if (device->drive_info.ata_Options.generalPurposeLoggingSupported)
         {
             if (SUCCESS !=
-                send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_DIRECTORY, 0, gplLogBuffer, ATA_LOG_PAGE_LEN_BYTES, 0))
+                get_ATA_Log_Directory(device, M_NULLPTR, ATA_LOG_DIRECTORY_GPL, gplLogBuffer, ATA_LOG_PAGE_LEN_BYTES))
             {
                 safe_free_aligned(&gplLogBuffer);
             }
@@ -4184,7 +5048,7 @@ static eReturnValues pull_Generic_ATA_Log(tDevice*     device,
                                 transferSizeBytes, 0);
         break;
     case PULL_LOG_RAW_MODE:
-        if (SUCCESS == get_ATA_Log_Size(device, logNum, &logSize, true, false))
+        if (SUCCESS == get_ATA_Log_Size(device, M_NULLPTR, logNum, &logSize, true, false))
         {
             genericLogBuf = M_REINTERPRET_CAST(
                 uint8_t*, safe_calloc_aligned(logSize, sizeof(uint8_t), device->os_info.minimumAlignment));
@@ -4501,7 +5365,7 @@ eReturnValues pull_FARM_Log(tDevice*                 device,
         switch (logAddress)
         {
         case SEAGATE_ATA_LOG_FARM_TIME_SERIES:
-            ret = get_ATA_Log_Size(device, logAddress, &logSize, true, false);
+            ret = get_ATA_Log_Size(device, M_NULLPTR, logAddress, &logSize, true, false);
             if (ret == SUCCESS && logSize > 0)
             {
                 genericLogBuf =
@@ -4647,7 +5511,7 @@ eReturnValues pull_FARM_Log(tDevice*                 device,
             break;
 
         default:
-            ret = get_ATA_Log_Size(device, logAddress, &logSize, true, false);
+            ret = get_ATA_Log_Size(device, M_NULLPTR, logAddress, &logSize, true, false);
             if (ret == SUCCESS && logSize > 0)
             {
                 genericLogBuf =
@@ -4967,7 +5831,7 @@ bool is_FARM_Log_Supported(tDevice* device)
     // NOLINTBEGIN(bugprone-branch-clone)
     // Disabling clang-tidy for readability
     if ((device->drive_info.drive_type == ATA_DRIVE) &&
-        (get_ATA_Log_Size(device, 0xA6, &logSize, true, false) == SUCCESS))
+        (get_ATA_Log_Size(device, M_NULLPTR, 0xA6, &logSize, true, false) == SUCCESS))
     {
         supported = true;
     }
@@ -5016,7 +5880,7 @@ bool is_FARM_Time_Series_Log_Supported(tDevice* device)
     // NOLINTBEGIN(bugprone-branch-clone)
     // Disabling clang-tidy for readability
     if ((device->drive_info.drive_type == ATA_DRIVE) &&
-        (get_ATA_Log_Size(device, 0xC6, &logSize, true, false) == SUCCESS))
+        (get_ATA_Log_Size(device, M_NULLPTR, 0xC6, &logSize, true, false) == SUCCESS))
     {
         supported = true;
     }
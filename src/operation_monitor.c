@@ -0,0 +1,602 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file operation_monitor.c
+// \brief This file defines the functions for tracking long running operations (sanitize, DST, format) on many devices
+// from a single thread.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "error_translation.h"
+#include "io_utils.h"
+#include "math_utils.h"
+#include "memory_safety.h"
+#include "sleep.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "dst.h"
+#include "format.h"
+#include "operation_monitor.h"
+#include "operations_Common.h"
+#include "platform_helper.h"
+#include "sanitize.h"
+
+static M_INLINE uint64_t get_Monitor_Tick(uint64_t milliseconds)
+{
+    return milliseconds / OPERATION_MONITOR_TICK_MILLISECONDS;
+}
+
+static M_INLINE uint32_t get_Slot_For_Tick(uint64_t tick)
+{
+    return M_STATIC_CAST(uint32_t, tick % OPERATION_MONITOR_WHEEL_SLOTS);
+}
+
+static void schedule_Monitored_Operation(ptrOperationMonitor monitor, uint32_t index, uint64_t tick)
+{
+    uint32_t slot                          = get_Slot_For_Tick(tick);
+    monitor->operation[index].nextPollTick = tick;
+    monitor->operation[index].nextInSlot   = monitor->wheel[slot];
+    monitor->wheel[slot]                   = index;
+}
+
+ptrOperationMonitor new_Operation_Monitor(uint32_t maxOperations)
+{
+    ptrOperationMonitor monitor = M_NULLPTR;
+    if (maxOperations > UINT32_C(0) && maxOperations < OPERATION_MONITOR_INVALID_INDEX)
+    {
+        size_t monitorSize =
+            sizeof(operationMonitor) + (sizeof(monitoredOperation) * (M_STATIC_CAST(size_t, maxOperations) - 1));
+        monitor = M_REINTERPRET_CAST(ptrOperationMonitor, safe_calloc(monitorSize, sizeof(uint8_t)));
+        if (monitor != M_NULLPTR)
+        {
+            monitor->maxOperations        = maxOperations;
+            monitor->maxConsecutiveErrors = OPERATION_MONITOR_MAX_CONSECUTIVE_ERRORS;
+            monitor->lastServicedTick     = get_Monitor_Tick(get_Milliseconds_Since_Unix_Epoch());
+            for (uint32_t slot = UINT32_C(0); slot < OPERATION_MONITOR_WHEEL_SLOTS; ++slot)
+            {
+                monitor->wheel[slot] = OPERATION_MONITOR_INVALID_INDEX;
+            }
+        }
+    }
+    return monitor;
+}
+
+eReturnValues add_Operation_To_Monitor(ptrOperationMonitor monitor,
+                                       tDevice*            device,
+                                       eMonitoredOperation operation,
+                                       uint32_t            pollIntervalMilliseconds,
+                                       uint32_t*           index)
+{
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR || device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (monitor->numberOfOperations >= monitor->maxOperations)
+    {
+        return MEMORY_FAILURE;
+    }
+    uint32_t              newIndex = monitor->numberOfOperations;
+    ptrMonitoredOperation newOp    = &monitor->operation[newIndex];
+    uint64_t              now      = get_Milliseconds_Since_Unix_Epoch();
+    uint64_t              ticks    = UINT64_C(0);
+    safe_memset(newOp, sizeof(monitoredOperation), 0, sizeof(monitoredOperation));
+    if (pollIntervalMilliseconds == UINT32_C(0))
+    {
+        pollIntervalMilliseconds = OPERATION_MONITOR_DEFAULT_POLL_MILLISECONDS;
+    }
+    // round up to a whole number of ticks so that a poll is never scheduled in the tick currently being serviced
+    ticks = (pollIntervalMilliseconds + OPERATION_MONITOR_TICK_MILLISECONDS - 1) / OPERATION_MONITOR_TICK_MILLISECONDS;
+    newOp->device                   = device;
+    newOp->operation                = operation;
+    newOp->state                    = MONITORED_OPERATION_STATE_IN_PROGRESS;
+    newOp->lastResult               = IN_PROGRESS;
+    newOp->pollIntervalMilliseconds = M_STATIC_CAST(uint32_t, ticks * OPERATION_MONITOR_TICK_MILLISECONDS);
+    newOp->startTimeMilliseconds    = now;
+    schedule_Monitored_Operation(monitor, newIndex, get_Monitor_Tick(now) + ticks);
+    ++monitor->numberOfOperations;
+    ++monitor->activeOperations;
+    if (index != M_NULLPTR)
+    {
+        *index = newIndex;
+    }
+    return SUCCESS;
+}
+
+eReturnValues start_Monitored_Sanitize(ptrOperationMonitor      monitor,
+                                       tDevice*                 device,
+                                       sanitizeOperationOptions sanitizeOptions,
+                                       uint32_t*                index)
+{
+    eReturnValues ret            = UNKNOWN;
+    uint32_t      pollIntervalMS = UINT32_C(1000); // crypto and block erase. Matches the existing polling loop
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR || device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (monitor->numberOfOperations >= monitor->maxOperations)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (sanitizeOptions.sanitizeEraseOperation == OVERWRITE_ERASE)
+    {
+        pollIntervalMS = UINT32_C(60000);
+    }
+    sanitizeOptions.pollForProgress = false;
+    ret                             = run_Sanitize_Operation2(device, sanitizeOptions);
+    if (ret == SUCCESS || ret == IN_PROGRESS)
+    {
+        ret = add_Operation_To_Monitor(monitor, device, MONITORED_OPERATION_SANITIZE, pollIntervalMS, index);
+    }
+    return ret;
+}
+
+eReturnValues start_Monitored_DST(ptrOperationMonitor monitor, tDevice* device, eDSTType DSTType, uint32_t* index)
+{
+    eReturnValues ret            = UNKNOWN;
+    uint32_t      pollIntervalMS = UINT32_C(5000);
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR || device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (monitor->numberOfOperations >= monitor->maxOperations)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (DSTType == DST_TYPE_LONG)
+    {
+        pollIntervalMS = UINT32_C(15000);
+    }
+    ret = run_DST(device, DSTType, false, false, false);
+    if (ret == SUCCESS || ret == IN_PROGRESS)
+    {
+        ret = add_Operation_To_Monitor(monitor, device, MONITORED_OPERATION_DST, pollIntervalMS, index);
+    }
+    return ret;
+}
+
+eReturnValues start_Monitored_Format_Unit(ptrOperationMonitor     monitor,
+                                          tDevice*                device,
+                                          runFormatUnitParameters formatParameters,
+                                          uint32_t*               index)
+{
+    eReturnValues ret            = UNKNOWN;
+    uint32_t      pollIntervalMS = UINT32_C(300000);
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR || device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (monitor->numberOfOperations >= monitor->maxOperations)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (is_SSD(device) || formatParameters.formatType == FORMAT_FAST_WRITE_NOT_REQUIRED ||
+        formatParameters.formatType == FORMAT_FAST_WRITE_REQUIRED)
+    {
+        pollIntervalMS = UINT32_C(5000);
+    }
+    formatParameters.disableImmediate = false;
+    ret                               = run_Format_Unit(device, formatParameters, false);
+    if (ret == SUCCESS)
+    {
+        ret = add_Operation_To_Monitor(monitor, device, MONITORED_OPERATION_FORMAT_UNIT, pollIntervalMS, index);
+    }
+    return ret;
+}
+
+eReturnValues start_Monitored_NVM_Format(ptrOperationMonitor    monitor,
+                                         tDevice*               device,
+                                         runNVMFormatParameters nvmParams,
+                                         uint32_t*              index)
+{
+    eReturnValues ret = UNKNOWN;
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR || device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (monitor->numberOfOperations >= monitor->maxOperations)
+    {
+        return MEMORY_FAILURE;
+    }
+    ret = run_NVMe_Format(device, nvmParams, false);
+    if (ret == SUCCESS)
+    {
+        ret = add_Operation_To_Monitor(monitor, device, MONITORED_OPERATION_NVM_FORMAT, UINT32_C(5000), index);
+    }
+    return ret;
+}
+
+static eMonitoredOperationState poll_Sanitize_Operation(ptrMonitoredOperation op)
+{
+    eMonitoredOperationState state          = MONITORED_OPERATION_STATE_IN_PROGRESS;
+    eSanitizeStatus          sanitizeStatus = SANITIZE_STATUS_UNKNOWN;
+    op->lastResult                          = get_Sanitize_Progress(op->device, &op->percentComplete, &sanitizeStatus);
+    op->deviceStatus                        = M_STATIC_CAST(uint8_t, sanitizeStatus);
+    switch (sanitizeStatus)
+    {
+    case SANITIZE_STATUS_IN_PROGRESS:
+        break;
+    case SANITIZE_STATUS_SUCCESS:
+    case SANITIZE_STATUS_NOT_IN_PROGRESS:
+        if (op->lastResult == IN_PROGRESS)
+        {
+            // SCSI reports the operation through the return value when the sense data does not say sanitize
+            break;
+        }
+        if (op->lastResult == SUCCESS)
+        {
+            state = MONITORED_OPERATION_STATE_COMPLETE;
+        }
+        break;
+    case SANITIZE_STATUS_FAILED:
+    case SANITIZE_STATUS_FAILED_PHYSICAL_SECTORS_REMAIN:
+    case SANITIZE_STATUS_UNSUPPORTED_FEATURE:
+    case SANITIZE_STATUS_FROZEN:
+    case SANITIZE_STATUS_FREEZELOCK_FAILED_DUE_TO_ANTI_FREEZE_LOCK:
+        state = MONITORED_OPERATION_STATE_FAILED;
+        break;
+    case SANITIZE_STATUS_NEVER_SANITIZED:
+    case SANITIZE_STATUS_UNKNOWN:
+        if (op->lastResult == SUCCESS)
+        {
+            // The device says it is no longer sanitizing, but cannot say whether the last sanitize passed.
+            state = MONITORED_OPERATION_STATE_FAILED;
+        }
+        break;
+    }
+    return state;
+}
+
+static eMonitoredOperationState poll_DST_Operation(ptrMonitoredOperation op)
+{
+    eMonitoredOperationState state           = MONITORED_OPERATION_STATE_IN_PROGRESS;
+    uint32_t                 percentComplete = UINT32_C(0);
+    uint8_t                  status          = UINT8_C(0xFF);
+    op->lastResult                           = get_DST_Progress(op->device, &percentComplete, &status);
+    if (op->lastResult == SUCCESS)
+    {
+        op->deviceStatus    = status;
+        op->percentComplete = M_STATIC_CAST(double, percentComplete);
+        switch (status)
+        {
+        case 0x00:
+            state = MONITORED_OPERATION_STATE_COMPLETE;
+            break;
+        case 0x01:
+        case 0x02:
+            state = MONITORED_OPERATION_STATE_ABORTED;
+            break;
+        case 0x0F:
+            break;
+        default:
+            state = MONITORED_OPERATION_STATE_FAILED;
+            break;
+        }
+    }
+    return state;
+}
+
+static eMonitoredOperationState poll_Format_Unit_Operation(ptrMonitoredOperation op)
+{
+    eMonitoredOperationState state = MONITORED_OPERATION_STATE_IN_PROGRESS;
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, senseData, SPC3_SENSE_LEN);
+    // Request sense directly rather than through get_Format_Progress() so that a failed format can be told apart
+    // from a device that is not answering.
+    op->lastResult = scsi_Request_Sense_Cmd(op->device, false, senseData, SPC3_SENSE_LEN);
+    if (op->lastResult == SUCCESS)
+    {
+        uint8_t senseKey = UINT8_C(0);
+        uint8_t asc      = UINT8_C(0);
+        uint8_t ascq     = UINT8_C(0);
+        uint8_t fru      = UINT8_C(0);
+        get_Sense_Key_ASC_ASCQ_FRU(senseData, SPC3_SENSE_LEN, &senseKey, &asc, &ascq, &fru);
+        op->deviceStatus = asc;
+        if (senseKey == SENSE_KEY_NOT_READY && asc == 0x04 && ascq == 0x04)
+        {
+            op->percentComplete = (M_BytesTo2ByteValue(senseData[16], senseData[17]) * 100.0) / 65536.0;
+            op->lastResult      = IN_PROGRESS;
+        }
+        else if (asc == 0x31)
+        {
+            // medium format corrupted or format command failed
+            state = MONITORED_OPERATION_STATE_FAILED;
+        }
+        else if (senseKey == SENSE_KEY_NO_ERROR)
+        {
+            formatStatus status;
+            safe_memset(&status, sizeof(formatStatus), 0, sizeof(formatStatus));
+            state = MONITORED_OPERATION_STATE_COMPLETE;
+            if (SUCCESS == get_Format_Status(op->device, &status) && status.formatParametersAllFs)
+            {
+                // The format status log reports all F's for the last format parameters when that format failed.
+                state = MONITORED_OPERATION_STATE_FAILED;
+            }
+            else
+            {
+                op->percentComplete = 100.0;
+            }
+        }
+        else
+        {
+            op->lastResult = UNKNOWN;
+        }
+    }
+    return state;
+}
+
+static eMonitoredOperationState poll_NVM_Format_Operation(ptrMonitoredOperation op)
+{
+    eMonitoredOperationState state           = MONITORED_OPERATION_STATE_IN_PROGRESS;
+    uint8_t                  percentComplete = UINT8_C(0);
+    op->lastResult                           = get_NVM_Format_Progress(op->device, &percentComplete);
+    if (op->lastResult == SUCCESS || op->lastResult == IN_PROGRESS)
+    {
+        op->percentComplete = M_STATIC_CAST(double, percentComplete);
+    }
+    if (op->lastResult == SUCCESS)
+    {
+        state = MONITORED_OPERATION_STATE_COMPLETE;
+    }
+    return state;
+}
+
+// Reads progress for one operation. Returns true when the operation left the in progress state.
+static bool poll_Monitored_Operation(ptrOperationMonitor monitor, ptrMonitoredOperation op, uint64_t now)
+{
+    eMonitoredOperationState state = MONITORED_OPERATION_STATE_IN_PROGRESS;
+    switch (op->operation)
+    {
+    case MONITORED_OPERATION_SANITIZE:
+        state = poll_Sanitize_Operation(op);
+        break;
+    case MONITORED_OPERATION_DST:
+        state = poll_DST_Operation(op);
+        break;
+    case MONITORED_OPERATION_FORMAT_UNIT:
+        state = poll_Format_Unit_Operation(op);
+        break;
+    case MONITORED_OPERATION_NVM_FORMAT:
+        state = poll_NVM_Format_Operation(op);
+        break;
+    }
+    ++op->pollCount;
+    op->lastPollTimeMilliseconds = now;
+    if (state == MONITORED_OPERATION_STATE_IN_PROGRESS && op->lastResult != SUCCESS && op->lastResult != IN_PROGRESS)
+    {
+        ++op->consecutiveErrors;
+        if (op->consecutiveErrors >= monitor->maxConsecutiveErrors)
+        {
+            state = MONITORED_OPERATION_STATE_ERROR;
+        }
+    }
+    else
+    {
+        op->consecutiveErrors = UINT32_C(0);
+    }
+    op->state = state;
+    if (state != MONITORED_OPERATION_STATE_IN_PROGRESS)
+    {
+        op->endTimeMilliseconds = now;
+        if (state == MONITORED_OPERATION_STATE_COMPLETE && op->operation != MONITORED_OPERATION_DST)
+        {
+            // same as the blocking polling loops: the data on the device changed underneath the OS
+            os_Update_File_System_Cache(op->device);
+        }
+        return true;
+    }
+    return false;
+}
+
+eReturnValues service_Operation_Monitor(ptrOperationMonitor        monitor,
+                                        operationMonitorCompletion completion,
+                                        void*                      completionData)
+{
+    uint64_t now                 = get_Milliseconds_Since_Unix_Epoch();
+    uint64_t currentTick         = get_Monitor_Tick(now);
+    uint64_t slotsToScan         = UINT64_C(0);
+    bool     clockMovedBackwards = false;
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (currentTick < monitor->lastServicedTick)
+    {
+        // system clock moved backwards. Every scheduled tick is now in the future, so poll every operation once in
+        // this pass and reschedule it from the new clock rather than waiting for the clock to catch up.
+        monitor->lastServicedTick = currentTick;
+        slotsToScan               = OPERATION_MONITOR_WHEEL_SLOTS;
+        clockMovedBackwards       = true;
+    }
+    else
+    {
+        slotsToScan = M_Min(currentTick - monitor->lastServicedTick + UINT64_C(1), OPERATION_MONITOR_WHEEL_SLOTS);
+    }
+    for (uint64_t slotIter = UINT64_C(0); slotIter < slotsToScan && monitor->activeOperations > 0; ++slotIter)
+    {
+        uint32_t slot = get_Slot_For_Tick(monitor->lastServicedTick + slotIter);
+        // detach the slot's list, then reinsert anything that is not due yet or still running.
+        uint32_t entry       = monitor->wheel[slot];
+        monitor->wheel[slot] = OPERATION_MONITOR_INVALID_INDEX;
+        while (entry != OPERATION_MONITOR_INVALID_INDEX)
+        {
+            ptrMonitoredOperation op   = &monitor->operation[entry];
+            uint32_t              next = op->nextInSlot;
+            if (!clockMovedBackwards && op->nextPollTick > currentTick)
+            {
+                // not due yet. Keep it in the same slot for a later revolution of the wheel.
+                schedule_Monitored_Operation(monitor, entry, op->nextPollTick);
+            }
+            else if (poll_Monitored_Operation(monitor, op, now))
+            {
+                --monitor->activeOperations;
+                if (completion != M_NULLPTR)
+                {
+                    completion(op, completionData);
+                }
+            }
+            else
+            {
+                schedule_Monitored_Operation(monitor, entry,
+                                             currentTick + (op->pollIntervalMilliseconds /
+                                                            OPERATION_MONITOR_TICK_MILLISECONDS));
+            }
+            entry = next;
+        }
+    }
+    monitor->lastServicedTick = currentTick;
+    if (monitor->activeOperations > 0)
+    {
+        return IN_PROGRESS;
+    }
+    return SUCCESS;
+}
+
+uint32_t get_Operation_Monitor_Wait_Time(ptrOperationMonitor monitor)
+{
+    uint64_t now         = get_Milliseconds_Since_Unix_Epoch();
+    uint64_t currentTick = get_Monitor_Tick(now);
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR || monitor->activeOperations == 0)
+    {
+        return UINT32_MAX;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (currentTick > monitor->lastServicedTick)
+    {
+        // at least one tick has not been serviced yet.
+        for (uint64_t tick = monitor->lastServicedTick + 1; tick <= currentTick; ++tick)
+        {
+            for (uint32_t entry = monitor->wheel[get_Slot_For_Tick(tick)]; entry != OPERATION_MONITOR_INVALID_INDEX;
+                 entry          = monitor->operation[entry].nextInSlot)
+            {
+                if (monitor->operation[entry].nextPollTick <= currentTick)
+                {
+                    return UINT32_C(0);
+                }
+            }
+            if (tick - monitor->lastServicedTick >= OPERATION_MONITOR_WHEEL_SLOTS)
+            {
+                break;
+            }
+        }
+    }
+    // walk forward one revolution of the wheel looking for the next due entry
+    for (uint64_t tick = currentTick + 1; tick <= currentTick + OPERATION_MONITOR_WHEEL_SLOTS; ++tick)
+    {
+        for (uint32_t entry = monitor->wheel[get_Slot_For_Tick(tick)]; entry != OPERATION_MONITOR_INVALID_INDEX;
+             entry          = monitor->operation[entry].nextInSlot)
+        {
+            if (monitor->operation[entry].nextPollTick <= tick)
+            {
+                return M_STATIC_CAST(uint32_t, (tick * OPERATION_MONITOR_TICK_MILLISECONDS) - now);
+            }
+        }
+    }
+    // nothing due within one revolution. Sleep until the wheel comes back around.
+    return M_STATIC_CAST(uint32_t,
+                         ((currentTick + OPERATION_MONITOR_WHEEL_SLOTS) * OPERATION_MONITOR_TICK_MILLISECONDS) - now);
+}
+
+eReturnValues run_Operation_Monitor(ptrOperationMonitor        monitor,
+                                    operationMonitorCompletion completion,
+                                    void*                      completionData)
+{
+    eReturnValues ret = SUCCESS;
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    while (IN_PROGRESS == service_Operation_Monitor(monitor, completion, completionData))
+    {
+        uint32_t waitTime = get_Operation_Monitor_Wait_Time(monitor);
+        if (waitTime > UINT32_C(0) && waitTime != UINT32_MAX)
+        {
+            delay_Milliseconds(waitTime);
+        }
+    }
+    for (uint32_t iter = UINT32_C(0); iter < monitor->numberOfOperations; ++iter)
+    {
+        if (monitor->operation[iter].state != MONITORED_OPERATION_STATE_COMPLETE)
+        {
+            ret = FAILURE;
+            break;
+        }
+    }
+    return ret;
+}
+
+static const char* get_Monitored_Operation_Name(eMonitoredOperation operation)
+{
+    switch (operation)
+    {
+    case MONITORED_OPERATION_SANITIZE:
+        return "Sanitize";
+    case MONITORED_OPERATION_DST:
+        return "DST";
+    case MONITORED_OPERATION_FORMAT_UNIT:
+        return "Format Unit";
+    case MONITORED_OPERATION_NVM_FORMAT:
+        return "NVM Format";
+    }
+    return "Unknown";
+}
+
+static const char* get_Monitored_State_Name(eMonitoredOperationState state)
+{
+    switch (state)
+    {
+    case MONITORED_OPERATION_STATE_IN_PROGRESS:
+        return "In Progress";
+    case MONITORED_OPERATION_STATE_COMPLETE:
+        return "Complete";
+    case MONITORED_OPERATION_STATE_FAILED:
+        return "Failed";
+    case MONITORED_OPERATION_STATE_ABORTED:
+        return "Aborted";
+    case MONITORED_OPERATION_STATE_ERROR:
+        return "Error Reading Progress";
+    }
+    return "Unknown";
+}
+
+void print_Operation_Monitor_Progress(ptrOperationMonitor monitor)
+{
+    DISABLE_NONNULL_COMPARE
+    if (monitor == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    printf("%-20s %-20s %-12s %-24s %s\n", "Handle", "Serial Number", "Operation", "State", "Progress");
+    for (uint32_t iter = UINT32_C(0); iter < monitor->numberOfOperations; ++iter)
+    {
+        ptrMonitoredOperation op = &monitor->operation[iter];
+        printf("%-20s %-20s %-12s %-24s %6.2f%%\n", op->device->os_info.name, op->device->drive_info.serialNumber,
+               get_Monitored_Operation_Name(op->operation), get_Monitored_State_Name(op->state), op->percentComplete);
+    }
+}
@@ -53,7 +53,8 @@ eReturnValues get_Ready_LED_State(tDevice* device, bool* readyLEDOnOff)
             perror("calloc failure!");
             return MEMORY_FAILURE;
         }
-        if (SUCCESS == scsi_Mode_Sense_10(device, 0x19, 24, 0, true, false, MPC_CURRENT_VALUES, modeSense))
+        if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, 0x19, 24, 0, true, false, MPC_CURRENT_VALUES,
+                                                 modeSense))
         {
             ret = SUCCESS;
             if (modeSense[2 + MODE_PARAMETER_HEADER_10_LEN] & BIT4)
@@ -94,7 +95,8 @@ eReturnValues change_Ready_LED(tDevice* device, bool readyLEDDefault, bool ready
         if (readyLEDDefault)
         {
             // we need to read the default AND current page this way we only touch 1 bit on the page
-            if (SUCCESS == scsi_Mode_Sense_10(device, 0x19, 24, 0, true, false, MPC_DEFAULT_VALUES, modeSelect))
+            if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, 0x19, 24, 0, true, false, MPC_DEFAULT_VALUES,
+                                                     modeSelect))
             {
                 if (modeSelect[2 + MODE_PARAMETER_HEADER_10_LEN] & BIT4)
                 {
@@ -103,7 +105,8 @@ eReturnValues change_Ready_LED(tDevice* device, bool readyLEDDefault, bool ready
             }
             safe_memset(modeSelect, 24, 0, 24);
         }
-        if (SUCCESS == scsi_Mode_Sense_10(device, 0x19, 24, 0, true, false, MPC_CURRENT_VALUES, modeSelect))
+        if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, 0x19, 24, 0, true, false, MPC_CURRENT_VALUES,
+                                                 modeSelect))
         {
             if (readyLEDOnOff) // set the bit to 1
             {
@@ -131,7 +134,7 @@ eReturnValues change_Ready_LED(tDevice* device, bool readyLEDDefault, bool ready
             modeSelect[6] = 0;
             modeSelect[7] = 0;
             // send the mode select command
-            ret = scsi_Mode_Select_10(device, 24, true, true, false, modeSelect, 24);
+            ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, 24, true, true, false, modeSelect, 24);
         }
         safe_free_aligned(&modeSelect);
     }
@@ -162,8 +165,8 @@ eReturnValues scsi_Set_NV_DIS(tDevice* device, bool nv_disEnableDisable)
         return MEMORY_FAILURE;
     }
     // first read the current settings
-    ret = scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                             MPC_CURRENT_VALUES, cachingModePage);
+    ret = cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0,
+                                    true, false, MPC_CURRENT_VALUES, cachingModePage);
     if (ret == SUCCESS)
     {
         // set up the mode parameter header
@@ -198,8 +201,8 @@ eReturnValues scsi_Set_NV_DIS(tDevice* device, bool nv_disEnableDisable)
             }
         }
         // send the mode select command
-        ret = scsi_Mode_Select_10(device, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, true, true, false,
-                                  cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
+        ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, true, true,
+                                         false, cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
     }
     safe_free_aligned(&cachingModePage);
     return ret;
@@ -218,8 +221,8 @@ eReturnValues scsi_Set_Read_Look_Ahead(tDevice* device, bool readLookAheadEnable
         return MEMORY_FAILURE;
     }
     // first read the current settings
-    ret = scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                             MPC_CURRENT_VALUES, cachingModePage);
+    ret = cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0,
+                                    true, false, MPC_CURRENT_VALUES, cachingModePage);
     if (ret == SUCCESS)
     {
         // set up the mode parameter header
@@ -251,8 +254,8 @@ eReturnValues scsi_Set_Read_Look_Ahead(tDevice* device, bool readLookAheadEnable
             }
         }
         // send the mode select command
-        ret = scsi_Mode_Select_10(device, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, true, true, false,
-                                  cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
+        ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, true, true,
+                                         false, cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
     }
     safe_free_aligned(&cachingModePage);
     return ret;
@@ -304,8 +307,8 @@ eReturnValues scsi_Set_Write_Cache(tDevice* device, bool writeCacheEnableDisable
         return MEMORY_FAILURE;
     }
     // first read the current settings
-    ret = scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                             MPC_CURRENT_VALUES, cachingModePage);
+    ret = cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0,
+                                    true, false, MPC_CURRENT_VALUES, cachingModePage);
     if (ret == SUCCESS)
     {
         // set up the mode parameter header
@@ -337,8 +340,8 @@ eReturnValues scsi_Set_Write_Cache(tDevice* device, bool writeCacheEnableDisable
             }
         }
         // send the mode select command
-        ret = scsi_Mode_Select_10(device, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, true, true, false,
-                                  cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
+        ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, true, true,
+                                         false, cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
     }
     safe_free_aligned(&cachingModePage);
     return ret;
@@ -427,8 +430,9 @@ bool scsi_Is_Read_Look_Ahead_Supported(tDevice* device)
         return false;
     }
     // if changable, then it is supported
-    if (SUCCESS == scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                      MPC_CHANGABLE_VALUES, cachingModePage))
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING,
+                                             MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
+                                             MPC_CHANGABLE_VALUES, cachingModePage))
     {
         // check the offset to see if the bit is set.
         if (cachingModePage[MODE_PARAMETER_HEADER_10_LEN + 12] & BIT5)
@@ -439,8 +443,9 @@ bool scsi_Is_Read_Look_Ahead_Supported(tDevice* device)
     safe_memset(cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0,
                 MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
     // check default to see if it is enabled and just cannot be disabled (unlikely)
-    if (!supported && SUCCESS == scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN,
-                                                    0, true, false, MPC_DEFAULT_VALUES, cachingModePage))
+    if (!supported && SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING,
+                                                           MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true,
+                                                           false, MPC_DEFAULT_VALUES, cachingModePage))
     {
         // check the offset to see if the bit is set.
         if (!(cachingModePage[MODE_PARAMETER_HEADER_10_LEN + 12] & BIT5))
@@ -525,8 +530,9 @@ bool scsi_is_NV_DIS_Bit_Set(tDevice* device)
         return false;
     }
     // first read the current settings
-    if (SUCCESS == scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                      MPC_CURRENT_VALUES, cachingModePage))
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING,
+                                             MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
+                                             MPC_CURRENT_VALUES, cachingModePage))
     {
         // check the offset to see if the bit is set.
         if (cachingModePage[MODE_PARAMETER_HEADER_10_LEN + 12] & BIT0)
@@ -556,8 +562,9 @@ bool scsi_Is_Read_Look_Ahead_Enabled(tDevice* device)
         return false;
     }
     // first read the current settings
-    if (SUCCESS == scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                      MPC_CURRENT_VALUES, cachingModePage))
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING,
+                                             MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
+                                             MPC_CURRENT_VALUES, cachingModePage))
     {
         // check the offset to see if the bit is set.
         if (cachingModePage[MODE_PARAMETER_HEADER_10_LEN + 12] & BIT5)
@@ -624,8 +631,9 @@ bool scsi_Is_Write_Cache_Supported(tDevice* device)
         return false;
     }
     // if changable, then it is supported
-    if (SUCCESS == scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                      MPC_CHANGABLE_VALUES, cachingModePage))
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING,
+                                             MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
+                                             MPC_CHANGABLE_VALUES, cachingModePage))
     {
         // check the offset to see if the bit is set.
         if (cachingModePage[MODE_PARAMETER_HEADER_10_LEN + 2] & BIT2)
@@ -636,8 +644,9 @@ bool scsi_Is_Write_Cache_Supported(tDevice* device)
     safe_memset(cachingModePage, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0,
                 MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN);
     // check default to see if it is enabled and just cannot be disabled (unlikely)
-    if (!supported && SUCCESS == scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN,
-                                                    0, true, false, MPC_DEFAULT_VALUES, cachingModePage))
+    if (!supported && SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING,
+                                                           MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true,
+                                                           false, MPC_DEFAULT_VALUES, cachingModePage))
     {
         // check the offset to see if the bit is set.
         if (cachingModePage[MODE_PARAMETER_HEADER_10_LEN + 2] & BIT2)
@@ -708,8 +717,9 @@ bool scsi_Is_Write_Cache_Enabled(tDevice* device)
         return false;
     }
     // first read the current settings
-    if (SUCCESS == scsi_Mode_Sense_10(device, MP_CACHING, MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                      MPC_CURRENT_VALUES, cachingModePage))
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CACHING,
+                                             MP_CACHING_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
+                                             MPC_CURRENT_VALUES, cachingModePage))
     {
         // check the offset to see if the bit is set.
         if (cachingModePage[MODE_PARAMETER_HEADER_10_LEN + 2] & BIT2)
@@ -844,7 +854,7 @@ eReturnValues get_Supported_Erase_Methods(tDevice*    device,
 
     get_Sanitize_Device_Features(device, &sanitizeInfo);
 
-    get_ATA_Security_Info(device, &ataSecurityInfo, sat_ATA_Security_Protocol_Supported(device));
+    get_ATA_Security_Info(device, M_NULLPTR, &ataSecurityInfo, sat_ATA_Security_Protocol_Supported(device));
 
     get_NVMe_Format_Support(device, &nvmeFormatInfo);
 
@@ -1526,8 +1536,8 @@ eReturnValues set_Sense_Data_Format(tDevice* device, bool defaultSetting, bool d
     // Change D_Sense for Control Mode page
     DECLARE_ZERO_INIT_ARRAY(uint8_t, controlModePage, MODE_PARAMETER_HEADER_10_LEN + 12);
     bool mode6ByteCmd = false;
-    if (SUCCESS == scsi_Mode_Sense_10(device, MP_CONTROL, MODE_PARAMETER_HEADER_10_LEN + 12, 0, true, false,
-                                      MPC_CURRENT_VALUES, controlModePage))
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CONTROL, MODE_PARAMETER_HEADER_10_LEN + 12, 0, true,
+                                             false, MPC_CURRENT_VALUES, controlModePage))
     {
         mode6ByteCmd = false;
     }
@@ -1560,8 +1570,8 @@ eReturnValues set_Sense_Data_Format(tDevice* device, bool defaultSetting, bool d
             }
         }
         else if (!mode6ByteCmd &&
-                 SUCCESS == scsi_Mode_Sense_10(device, MP_CONTROL, MODE_PARAMETER_HEADER_10_LEN + 12, 0, true, false,
-                                               MPC_DEFAULT_VALUES, controlModePageDefaults))
+                 SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_CONTROL, MODE_PARAMETER_HEADER_10_LEN + 12,
+                                                      0, true, false, MPC_DEFAULT_VALUES, controlModePageDefaults))
         {
             if (controlModePage[MODE_PARAMETER_HEADER_10_LEN + 2] & BIT2)
             {
@@ -1602,8 +1612,8 @@ eReturnValues set_Sense_Data_Format(tDevice* device, bool defaultSetting, bool d
     }
     else
     {
-        ret = scsi_Mode_Select_10(device, MODE_PARAMETER_HEADER_10_LEN + 12, true, saveParameters, false,
-                                  controlModePage, MODE_PARAMETER_HEADER_10_LEN + 12);
+        ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, MODE_PARAMETER_HEADER_10_LEN + 12, true, saveParameters,
+                                         false, controlModePage, MODE_PARAMETER_HEADER_10_LEN + 12);
     }
     return ret;
 }
@@ -1831,7 +1841,7 @@ eReturnValues scsi_Update_Mode_Page(tDevice* device, uint8_t modePage, uint8_t s
             scsi_MP_Reset_To_Defaults_Supported(device))
         {
             // requesting to reset all mode pages. Send the mode select command with the RTD bit set.
-            ret              = scsi_Mode_Select_10(device, 0, true, true, true, M_NULLPTR, 0);
+            ret              = cached_SCSI_Mode_Select_10(device, M_NULLPTR, 0, true, true, true, M_NULLPTR, 0);
             uint8_t senseKey = UINT8_C(0);
             uint8_t asc      = UINT8_C(0);
             uint8_t ascq     = UINT8_C(0);
@@ -1967,8 +1977,9 @@ eReturnValues scsi_Update_Mode_Page(tDevice* device, uint8_t modePage, uint8_t s
                         }
                         else
                         {
-                            if (SUCCESS != scsi_Mode_Select_10(device, currentPageToSetLength, pageFormat, savable,
-                                                               false, currentPageToSet, currentPageToSetLength))
+                            if (SUCCESS != cached_SCSI_Mode_Select_10(device, M_NULLPTR, currentPageToSetLength,
+                                                                      pageFormat, savable, false, currentPageToSet,
+                                                                      currentPageToSetLength))
                             {
                                 ++failedModeSelects;
                                 printf("WARNING! Unable to reset page %" PRIX8 "h", currentPage);
@@ -2065,8 +2076,8 @@ eReturnValues scsi_Update_Mode_Page(tDevice* device, uint8_t modePage, uint8_t s
                 }
                 else
                 {
-                    if (SUCCESS != scsi_Mode_Select_10(device, C_CAST(uint16_t, modePageLength), pageFormat, savable,
-                                                       false, modeData, modePageLength))
+                    if (SUCCESS != cached_SCSI_Mode_Select_10(device, M_NULLPTR, C_CAST(uint16_t, modePageLength),
+                                                              pageFormat, savable, false, modeData, modePageLength))
                     {
                         ret = FAILURE;
                     }
@@ -2163,8 +2174,8 @@ eReturnValues scsi_Set_Mode_Page(tDevice* device, uint8_t* modePageData, uint16_
             }
             else
             {
-                if (SUCCESS != scsi_Mode_Select_10(device, C_CAST(uint16_t, modePageLength), pageFormat, saveChanges,
-                                                   false, modeData, modePageLength))
+                if (SUCCESS != cached_SCSI_Mode_Select_10(device, M_NULLPTR, C_CAST(uint16_t, modePageLength),
+                                                          pageFormat, saveChanges, false, modeData, modePageLength))
                 {
                     ret = FAILURE;
                 }
@@ -3128,8 +3139,8 @@ eReturnValues get_Concurrent_Positioning_Ranges(tDevice* device, ptrConcurrentRa
         {
             uint32_t concurrentLogSizeBytes =
                 0; // NOTE: spec currently says this is at most 1024 bytes, but may be as low as 512
-            if (SUCCESS == get_ATA_Log_Size(device, ATA_LOG_CONCURRENT_POSITIONING_RANGES, &concurrentLogSizeBytes,
-                                            true, false) &&
+            if (SUCCESS == get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_CONCURRENT_POSITIONING_RANGES,
+                                            &concurrentLogSizeBytes, true, false) &&
                 concurrentLogSizeBytes > 0)
             {
                 uint8_t* concurrentRangeLog =
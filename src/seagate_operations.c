@@ -115,8 +115,8 @@ eReturnValues scsi_Set_Phy_Speed(tDevice* device, uint8_t phySpeedGen, bool allP
     {
         return MEMORY_FAILURE;
     }
-    if (SUCCESS == scsi_Mode_Sense_10(device, MP_PROTOCOL_SPECIFIC_PORT, phyControlLength, 0x01, true, false,
-                                      MPC_CURRENT_VALUES, sasPhyControl))
+    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_PROTOCOL_SPECIFIC_PORT, phyControlLength, 0x01, true,
+                                             false, MPC_CURRENT_VALUES, sasPhyControl))
     {
         // make sure we got the header as we expect it, then validate we got all the data we needed.
         // uint16_t modeDataLength = M_BytesTo2ByteValue(sasPhyControl[0], sasPhyControl[1]);
@@ -145,8 +145,8 @@ eReturnValues scsi_Set_Phy_Speed(tDevice* device, uint8_t phySpeedGen, bool allP
                     return MEMORY_FAILURE;
                 }
                 sasPhyControl = temp;
-                if (SUCCESS != scsi_Mode_Sense_10(device, MP_PROTOCOL_SPECIFIC_PORT, phyControlLength, 0x01, true,
-                                                  false, MPC_CURRENT_VALUES, sasPhyControl))
+                if (SUCCESS != cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_PROTOCOL_SPECIFIC_PORT, phyControlLength,
+                                                         0x01, true, false, MPC_CURRENT_VALUES, sasPhyControl))
                 {
                     safe_free_aligned(&sasPhyControl);
                     return FAILURE;
@@ -211,7 +211,8 @@ eReturnValues scsi_Set_Phy_Speed(tDevice* device, uint8_t phySpeedGen, bool allP
                 }
                 // we've finished making our changes to the mode page, so it's time to write it back!
                 if (SUCCESS !=
-                    scsi_Mode_Select_10(device, phyControlLength, true, true, false, sasPhyControl, phyControlLength))
+                    cached_SCSI_Mode_Select_10(device, M_NULLPTR, phyControlLength, true, true, false, sasPhyControl,
+                                               phyControlLength))
                 {
                     ret = FAILURE;
                 }
@@ -479,8 +480,8 @@ static eReturnValues seagate_SAS_Get_JIT_Modes(tDevice* device, ptrSeagateJITMod
             DECLARE_ZERO_INIT_ARRAY(uint8_t, seagateUnitAttentionParameters, 12 + MODE_PARAMETER_HEADER_10_LEN);
             bool    readPage     = false;
             uint8_t headerLength = MODE_PARAMETER_HEADER_10_LEN;
-            if (SUCCESS == scsi_Mode_Sense_10(device, 0, 12 + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                              MPC_CURRENT_VALUES, seagateUnitAttentionParameters))
+            if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, 0, 12 + MODE_PARAMETER_HEADER_10_LEN, 0, true,
+                                                     false, MPC_CURRENT_VALUES, seagateUnitAttentionParameters))
             {
                 readPage = true;
             }
@@ -559,8 +560,9 @@ static eReturnValues seagate_SAS_Set_JIT_Modes(tDevice* device,
                 // We need to read the default mode page to get the status of the JIT bits, save them, then pass them
                 // along...
                 bool readDefaults = false;
-                if (SUCCESS == scsi_Mode_Sense_10(device, 0, 12 + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                                  MPC_DEFAULT_VALUES, seagateUnitAttentionParameters))
+                if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, 0, 12 + MODE_PARAMETER_HEADER_10_LEN, 0,
+                                                         true, false, MPC_DEFAULT_VALUES,
+                                                         seagateUnitAttentionParameters))
                 {
                     readDefaults = true;
                     headerLength = MODE_PARAMETER_HEADER_10_LEN;
@@ -603,8 +605,8 @@ static eReturnValues seagate_SAS_Set_JIT_Modes(tDevice* device,
                     return FAILURE;
                 }
             }
-            if (SUCCESS == scsi_Mode_Sense_10(device, 0, 12 + MODE_PARAMETER_HEADER_10_LEN, 0, true, false,
-                                              MPC_CURRENT_VALUES, seagateUnitAttentionParameters))
+            if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, 0, 12 + MODE_PARAMETER_HEADER_10_LEN, 0, true,
+                                                     false, MPC_CURRENT_VALUES, seagateUnitAttentionParameters))
             {
                 readPage     = true;
                 headerLength = MODE_PARAMETER_HEADER_10_LEN;
@@ -644,8 +646,8 @@ static eReturnValues seagate_SAS_Set_JIT_Modes(tDevice* device,
                 // Now we need to do a mode select to send this data back to the drive!!
                 if (headerLength == MODE_PARAMETER_HEADER_10_LEN)
                 {
-                    ret = scsi_Mode_Select_10(device, 12 + headerLength, false, nonvolatile, false,
-                                              seagateUnitAttentionParameters, 12 + headerLength);
+                    ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, 12 + headerLength, false, nonvolatile, false,
+                                                     seagateUnitAttentionParameters, 12 + headerLength);
                 }
                 else
                 {
@@ -747,8 +749,9 @@ eReturnValues seagate_Get_Power_Balance(tDevice* device, bool* supported, bool*
                 return MEMORY_FAILURE;
             }
             // read changeable values to get supported
-            if (SUCCESS == scsi_Mode_Sense_10(device, MP_POWER_CONSUMPTION, MODE_PARAMETER_HEADER_10_LEN + 16, 0x01,
-                                              true, false, MPC_CHANGABLE_VALUES, pcModePage))
+            if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_POWER_CONSUMPTION,
+                                                     MODE_PARAMETER_HEADER_10_LEN + 16, 0x01, true, false,
+                                                     MPC_CHANGABLE_VALUES, pcModePage))
             {
                 ret = SUCCESS;
                 // This is as close as I can figure the best way to check for power balance support - TJE
@@ -767,8 +770,9 @@ eReturnValues seagate_Get_Power_Balance(tDevice* device, bool* supported, bool*
                     RESTORE_NONNULL_COMPARE
                     // read current values to get enabled/disabled
                     safe_memset(pcModePage, MODE_PARAMETER_HEADER_10_LEN + 16, 0, MODE_PARAMETER_HEADER_10_LEN + 16);
-                    if (SUCCESS == scsi_Mode_Sense_10(device, MP_POWER_CONSUMPTION, MODE_PARAMETER_HEADER_10_LEN + 16,
-                                                      0x01, true, false, MPC_CURRENT_VALUES, pcModePage))
+                    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_POWER_CONSUMPTION,
+                                                             MODE_PARAMETER_HEADER_10_LEN + 16, 0x01, true, false,
+                                                             MPC_CURRENT_VALUES, pcModePage))
                     {
                         // check the active level to make sure it is zero
                         uint8_t activeLevel = pcModePage[MODE_PARAMETER_HEADER_10_LEN + 6] & 0x07;
@@ -796,8 +800,9 @@ eReturnValues seagate_Get_Power_Balance(tDevice* device, bool* supported, bool*
                     RESTORE_NONNULL_COMPARE
                     // read current values to get enabled/disabled
                     safe_memset(pcModePage, MODE_PARAMETER_HEADER_10_LEN + 16, 0, MODE_PARAMETER_HEADER_10_LEN + 16);
-                    if (SUCCESS == scsi_Mode_Sense_10(device, MP_POWER_CONSUMPTION, MODE_PARAMETER_HEADER_10_LEN + 16,
-                                                      0x01, true, false, MPC_CURRENT_VALUES, pcModePage))
+                    if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_POWER_CONSUMPTION,
+                                                             MODE_PARAMETER_HEADER_10_LEN + 16, 0x01, true, false,
+                                                             MPC_CURRENT_VALUES, pcModePage))
                     {
                         // check the active level to make sure it is zero
                         uint8_t activeLevel = pcModePage[MODE_PARAMETER_HEADER_10_LEN + 6] & 0x07;
@@ -861,8 +866,9 @@ eReturnValues seagate_Set_Power_Balance(tDevice* device, ePowerBalanceMode power
         }
         // First, need to read changable values page to see if this is a drive needing the old method, or the new one. -
         // TJE
-        if (SUCCESS == scsi_Mode_Sense_10(device, MP_POWER_CONSUMPTION, MODE_PARAMETER_HEADER_10_LEN + 16, 0x01, true,
-                                          false, MPC_CHANGABLE_VALUES, pcModePage))
+        if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_POWER_CONSUMPTION,
+                                                 MODE_PARAMETER_HEADER_10_LEN + 16, 0x01, true, false,
+                                                 MPC_CHANGABLE_VALUES, pcModePage))
         {
             // Detect the old method by seeing if active mode is not changable, but power condition identifier is.
             if (pcModePage[MODE_PARAMETER_HEADER_10_LEN + 7] == 0xFF &&
@@ -873,8 +879,9 @@ eReturnValues seagate_Set_Power_Balance(tDevice* device, ePowerBalanceMode power
             // Assume for now that otherwise this is changable by modifying the active field.
         }
         // not read and modify the page to enable or disable this feature.
-        if (SUCCESS == scsi_Mode_Sense_10(device, MP_POWER_CONSUMPTION, 16 + MODE_PARAMETER_HEADER_10_LEN, 0x01, true,
-                                          false, MPC_CURRENT_VALUES, pcModePage))
+        if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_POWER_CONSUMPTION,
+                                                 16 + MODE_PARAMETER_HEADER_10_LEN, 0x01, true, false,
+                                                 MPC_CURRENT_VALUES, pcModePage))
         {
             pcModePage[MODE_PARAMETER_HEADER_10_LEN + 6] &= 0xFC; // clear lower 2 bits to 0
             if (oldMethod)
@@ -902,8 +909,8 @@ eReturnValues seagate_Set_Power_Balance(tDevice* device, ePowerBalanceMode power
                 }
             }
             // now do mode select with the data for the mode to set
-            ret = scsi_Mode_Select_10(device, 16 + MODE_PARAMETER_HEADER_10_LEN, true, true, false, pcModePage,
-                                      16 + MODE_PARAMETER_HEADER_10_LEN);
+            ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, 16 + MODE_PARAMETER_HEADER_10_LEN, true, true, false,
+                                             pcModePage, 16 + MODE_PARAMETER_HEADER_10_LEN);
         }
         safe_free_aligned(&pcModePage);
     }
@@ -1503,7 +1510,7 @@ bool is_Seagate_Power_Telemetry_Feature_Supported(tDevice* device)
     {
         // check if log page E3h has data
         uint32_t logSize = UINT32_C(0);
-        if (SUCCESS == get_ATA_Log_Size(device, SEAGATE_ATA_LOG_POWER_TELEMETRY, &logSize, true, false))
+        if (SUCCESS == get_ATA_Log_Size(device, M_NULLPTR, SEAGATE_ATA_LOG_POWER_TELEMETRY, &logSize, true, false))
         {
             if (logSize > 0)
             {
@@ -1608,7 +1615,7 @@ eReturnValues get_Power_Telemetry_Data(tDevice* device, ptrSeagatePwrTelemetry p
     // first, determine how much data there is, allocate memory, then read it all into that buffer
     if (device->drive_info.drive_type == ATA_DRIVE)
     {
-        ret = get_ATA_Log_Size(device, SEAGATE_ATA_LOG_POWER_TELEMETRY, &powerTelemetryLogSize, true, false);
+        ret = get_ATA_Log_Size(device, M_NULLPTR, SEAGATE_ATA_LOG_POWER_TELEMETRY, &powerTelemetryLogSize, true, false);
         if (ret == SUCCESS && powerTelemetryLogSize > 0)
         {
             powerTelemetryLog = M_REINTERPRET_CAST(uint8_t*, safe_calloc_aligned(powerTelemetryLogSize, sizeof(uint8_t),
@@ -2354,7 +2361,7 @@ bool is_Seagate_DeviceStatistics_Supported(tDevice* device)
     // NOLINTBEGIN(bugprone-branch-clone)
     // Disable clang-tidy for readability
     if ((device->drive_info.drive_type == ATA_DRIVE) &&
-        (get_ATA_Log_Size(device, 0xC7, &logSize, true, false) == SUCCESS))
+        (get_ATA_Log_Size(device, M_NULLPTR, 0xC7, &logSize, true, false) == SUCCESS))
     {
         supported = true;
     }
@@ -2384,7 +2391,7 @@ static eReturnValues get_Seagate_ATA_DeviceStatistics(tDevice* device, ptrSeagat
 
     uint32_t deviceStatsSize = UINT32_C(0);
     // need to get the seagate device statistics log
-    if (SUCCESS == get_ATA_Log_Size(device, 0xC7, &deviceStatsSize, true, false))
+    if (SUCCESS == get_ATA_Log_Size(device, M_NULLPTR, 0xC7, &deviceStatsSize, true, false))
     {
         uint8_t* deviceStatsLog = M_REINTERPRET_CAST(
             uint8_t*, safe_calloc_aligned(deviceStatsSize, sizeof(uint8_t), device->os_info.minimumAlignment));
@@ -547,8 +547,8 @@ ptrcapacityModelNumberMapping get_Capacity_Model_Number_Mapping(tDevice* device)
     if (device->drive_info.drive_type == ATA_DRIVE)
     {
         uint32_t capMNLogSizeBytes = UINT32_C(0);
-        if (SUCCESS ==
-                get_ATA_Log_Size(device, ATA_LOG_CAPACITY_MODELNUMBER_MAPPING, &capMNLogSizeBytes, true, false) &&
+        if (SUCCESS == get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_CAPACITY_MODELNUMBER_MAPPING, &capMNLogSizeBytes,
+                                        true, false) &&
             capMNLogSizeBytes > 0)
         {
             uint8_t* capMNMappingLog = C_CAST(
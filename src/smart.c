@@ -35,6 +35,11 @@
 #include "usb_hacks.h"
 
 eReturnValues get_SMART_Attributes(tDevice* device, smartLogData* smartAttrs)
+{
+    return get_SMART_Attributes_Cached(device, M_NULLPTR, smartAttrs);
+}
+
+eReturnValues get_SMART_Attributes_Cached(tDevice* device, ptrLogPageCache logCache, smartLogData* smartAttrs)
 {
     eReturnValues ret = UNKNOWN;
     if (device->drive_info.drive_type == ATA_DRIVE && is_SMART_Enabled(device))
@@ -48,7 +53,7 @@ eReturnValues get_SMART_Attributes(tDevice* device, smartLogData* smartAttrs)
             perror("Calloc Failure!\n");
             return MEMORY_FAILURE;
         }
-        ret = ata_SMART_Read_Data(device, ATAdataBuffer, LEGACY_DRIVE_SEC_SIZE);
+        ret = cached_ATA_SMART_Read_Data(device, logCache, ATAdataBuffer, LEGACY_DRIVE_SEC_SIZE);
         if (ret == SUCCESS)
         {
             smartAttrs->attributes.ataSMARTAttr.smartVersion = M_BytesTo2ByteValue(ATAdataBuffer[1], ATAdataBuffer[0]);
@@ -117,976 +122,422 @@ eReturnValues get_SMART_Attributes(tDevice* device, smartLogData* smartAttrs)
         ret = nvme_Get_SMART_Log_Page(device, NVME_ALL_NAMESPACES, C_CAST(uint8_t*, &smartAttrs->attributes),
                                       NVME_SMART_HEALTH_LOG_LEN);
     }
-    else
-    {
-        ret = NOT_SUPPORTED;
-        if (VERBOSITY_QUIET < device->deviceVerbosity)
-        {
-            printf("Getting SMART attributes is not supported on this drive type at this time\n");
-        }
-    }
-    return ret;
-}
-
-void get_Attribute_Name(tDevice* device, uint8_t attributeNumber, char** attributeName)
-{
-    eSeagateFamily isSeagateDrive = is_Seagate_Family(device);
-    /*
-    I broke the attribute name finder apart because sometimes there's overlap and sometimes there isn't.
-    Also, this will let me name the attributes according to the respective specs for each drive.
-    */
-    // NOTE: I don't like that this function isn't taking a length in, but all uses are matching this define. It SHOULD
-    // be safe enough, but that is something we may need to reconsider in the future-TJE
-    safe_memset(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, 0, MAX_ATTRIBUTE_NAME_LENGTH);
-    switch (isSeagateDrive)
-    {
-    case SEAGATE:
-        switch (attributeNumber)
-        {
-        case 1: // read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Rate");
-            break;
-        case 3: // spin up time
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Up Time");
-            break;
-        case 4: // start stop count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Start/Stop Count");
-            break;
-        case 5: // retired sectors count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Retired Sectors Count");
-            break;
-        case 7: // Seek Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Error Rate");
-            break;
-        case 9: // Power on Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 10: // Spin Retry Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Retry Count");
-            break;
-        case 12: // Drive Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        case 18: // Read Error Rate self test
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Head Health Self Assessment");
-            break;
-        case 174: // Unexpected Power Loss Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Unexpected Power Loss Count");
-            break;
-        case 183: // PHY Counter Events
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "PHY Counter Events");
-            break;
-        case 184: // IOEDC Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "IOEDC Count");
-            break;
-        case 187: // Reported Un-correctable
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reported Un-correctable");
-            break;
-        case 188: // Command Timeout
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Command Timeout");
-            break;
-        case 189: // High Fly Writes
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "High Fly Writes");
-            break;
-        case 190: // Airflow Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Airflow Temperature");
-            break;
-        case 191: // Shock Sensor Counter
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Shock Sensor Counter");
-            break;
-        case 192: // Emergency Retract Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Emergency Retract Count");
-            break;
-        case 193: // Load-Unload Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load-Unload Count");
-            break;
-        case 194: // Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Temperature");
-            break;
-        case 195: // ECC On the Fly Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "ECC On The Fly Count");
-            break;
-        case 197: // Pending-Sparing Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Pending-Sparing Count");
-            break;
-        case 198: // offline Uncorrectable Sector Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Offline Uncorrectable Sector Count");
-            break;
-        case 199: // Ultra DMA CRC Error
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Ultra DMA CRC Error");
-            break;
-        case 200: // Pressure Measurement Limit
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Pressure Measurement Limit");
-            break;
-        case 230: // Life Curve Status
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Life Curve Status");
-            break;
-        case 231: // SSD Life Left
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Life Left");
-            break;
-        case 235: // SSD Power Loss Mgmt Life Left
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Power Less Mgmt Life Left");
-            break;
-        case 240: // Head flight Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Head Flight Hours");
-            break;
-        case 241: // Lifetime Writes from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Writes From Host");
-            break;
-        case 242: // Lifetime Reads from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Reads From Host");
-            break;
-        case 254: // Free Fall Event
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Free Fall Event");
-            break;
-        default:
-            break;
-        }
-        break;
-    case SEAGATE_VENDOR_D: // with Seagate for now. Might move sometime
-    case SEAGATE_VENDOR_E: // with Seagate for now. Might move sometime
-        switch (attributeNumber)
-        {
-        case 1: // read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Rate");
-            break;
-        case 5: // retired sectors count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Retired Sectors Count");
-            break;
-        case 9: // Power on Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 12: // Drive Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        case 171: // Program Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Program Fail Count");
-            break;
-        case 172: // Erase Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Erase Fail Count");
-            break;
-        case 181: // Program Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Program Fail Count");
-            break;
-        case 182: // Erase Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Erase Fail Count");
-            break;
-        case 194: // Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Temperature");
-            break;
-        case 201: // Soft Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Soft Error Rate");
-            break;
-        case 204: // Soft ECC Correction Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Soft ECC Correction Rate");
-            break;
-        case 231: // SSD Life Left
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Life Left");
-            break;
-        case 234: // Lifetime Write to Flash
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Writes To Flash in GiB");
-            break;
-        case 241: // Lifetime Writes from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Writes From Host in GiB");
-            break;
-        case 242: // Lifetime Reads from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Reads From Host in GiB");
-            break;
-        case 250: // Lifetime NAND Read Retries
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime NAND Read Retries");
-            break;
-        default:
-            break;
-        }
-        break;
-    case SAMSUNG:
-        switch (attributeNumber)
-        {
-        case 1: // read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Rate");
-            break;
-        case 2: // Throughput Performance
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Throughput Performance");
-            break;
-        case 3: // spin up time
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Up Time");
-            break;
-        case 4: // start stop count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Start/Stop Count");
-            break;
-        case 5: // retired sectors count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Retired Sectors Count");
-            break;
-        case 7: // Seek Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Error Rate");
-            break;
-        case 8: // seek time performance.
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Time Performance");
-            break;
-        case 9: // Power on Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 10: // Spin Retry Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Retry Count");
-            break;
-        case 11: // calibration retry count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Calibration Retry Count");
-            break;
-        case 12: // Drive Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        case 180: // End to End Error Detection
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "End to End Error Detection");
-            break;
-        case 181: // Unaligned Access
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Unaligned Access");
-            break;
-        case 183: // SATA Interface Downshift
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SATA Interface Downshift");
-            break;
-        case 184: // End to End detection
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "End To End Detection");
-            break;
-        case 187: // Reported Un-correctable
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reported Un-correctable");
-            break;
-        case 188: // Command Timeout
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Command Timeout");
-            break;
-        case 190: // Airflow Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Airflow Temperature");
-            break;
-        case 191: // Shock Sensor Counter
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Shock Sensor Counter");
-            break;
-        case 192: // Emergency Retract Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Emergency Retract Count");
-            break;
-        case 193: // Load-Unload Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load-Unload Count");
-            break;
-        case 194: // Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Temperature");
-            break;
-        case 195: // ECC On the Fly Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "ECC On The Fly Count");
-            break;
-        case 196: // Re-allocate Sector Event
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Re-allocate Sector Event");
-            break;
-        case 197: // Pending-Sparing Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Pending Sector Count");
-            break;
-        case 198: // offlince uncorrectable sectors
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Offline Uncorrectable Sectors");
-            break;
-        case 199: // Ultra DMA CRC Error
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Ultra DMA CRC Error");
-            break;
-        case 200: // Write Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Write Error Rate");
-            break;
-        case 201: // Soft Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Soft Error Rate");
-            break;
-        case 223: // Load Retry Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load Retry Count");
-            break;
-        case 225: // Load Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load Cycle Count");
-            break;
-        case 240: // Head Fly Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Head Flight Hours");
-            break;
-        case 241: // Total Write Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total Write Count");
-            break;
-        case 242: // Total Read Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total Read Count");
-            break;
-        case 254: // Free fall Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Free Fall Count");
-            break;
-        default:
-            break;
-        }
-        break;
-    case MAXTOR:
-        // names are from here: https://www.smartmontools.org/wiki/AttributesMaxtor
-        switch (attributeNumber)
-        {
-        case 1: // raw read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Raw Read Error Rate");
-            break;
-        case 2: // throughput performance
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Throughput Performance");
-            break;
-        case 3: // spin-up time
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Up Time");
-            break;
-        case 4: // start/stop count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Start/Stop Count");
-            break;
-        case 5: // Reallocated Sector Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reallocated Sector Count");
-            break;
-        case 6: // start/stop count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Start/Stop Count");
-            break;
-        case 7: // seek error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Error Rate");
-            break;
-        case 8: // seek time performance
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Time Performance");
-            break;
-        case 9: // power on hours
-            // internal spec says this is minutes, but not sure which drives report in minutes.
-            // Old drives I have tested seem to do hours. may need to use revision number
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power-On Hours");
-            break;
-        case 10: // spin-up retry count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin-Up Retry Count");
-            break;
-        case 11: // calibration retry count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Calibration Retry Count");
-            break;
-        case 12: // power cycle count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power Cycle Count");
-            break;
-        case 13: // soft read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Soft Read Error Rate");
-            break;
-        case 192: // power-off retract cycle count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power-Off Retract Cycle Count");
-            break;
-        case 193: // Load/Unload Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load/Unload Cycle Count");
-            break;
-        case 194: // HDA Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "HDA Temperature");
-            break;
-        case 195: // Hardware ECC Recovered
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Hardware ECC Recovered");
-            break;
-        case 196: // Reallocated Event Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Re-allocate Event Count");
-            break;
-        case 197: // Current Pending Sector Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Current Pending Sector Count");
-            break;
-        case 198: // Offline Scan Uncorrectable Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Off-line Uncorrectable Count");
-            break;
-        case 199: // UltraDMA CRC Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Ultra DMA CRC Error Rate");
-            break;
-        case 200: // Write Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Write Error Rate");
-            break;
-        case 201: // Soft Read Error Rate
-            // off track errors is an alternate name
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Soft Read Error Rate");
-            break;
-        case 202: // Data Addres Mark Errors
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Data Address Mark Errors");
-            break;
-        case 203: // run out cancel
-            // ECC errors is an alternate name
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Run Out Cancel");
-            break;
-        case 204: // Soft ECC Correction
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Soft ECC Correction");
-            break;
-        case 205: // Thermal Asperity Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Thermal Asperity Rate");
-            break;
-        case 206: // Flying Height
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Flying Height");
-            break;
-        case 207: // Spin High Current
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin High Current");
-            break;
-        case 208: // Spin Buzz
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Buzz");
-            break;
-        case 209: // Offline Seek Performance
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Offline Seek Performance");
-            break;
-        case 210: // Vibration during Write
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Vibration During Write");
-            break;
-        case 211: // Vibration during Read
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Vibration During Read");
-            break;
-        case 212: // Shock during Write
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Shock During Write");
-            break;
-        case 220: // Disk Shift
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Disk Shift");
-            break;
-        case 221: // G-Sense Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "G-Sense Error Rate");
-            break;
-        case 222: // Loaded Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Loaded Hours");
-            break;
-        case 223: // Load/Unload Retry Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load/Unload Retry Count");
-            break;
-        case 224: // Load Friction
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load Friction");
-            break;
-        case 225: // Load/Unload Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load/Unload Cycle Count");
-            break;
-        case 226: // Load-in Time
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Load-In Time");
-            break;
-        case 227: // Torque Amplification Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Torque Amplification Count");
-            break;
-        case 228: // Power-Off Retract Cycle
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power-Off Retract Cycle");
-            break;
-        case 230: // GMR Head Amplitude
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "GMR Head Amplitude");
-            break;
-        case 231: // Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Temperature");
-            break;
-        case 240: // Head Flying Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Head Flying Hours");
-            break;
-        case 250: // Read Error Retry Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Retry Rate");
-            break;
-        default:
-            break;
-        }
-        break;
-    case SEAGATE_VENDOR_B:
-    case SEAGATE_VENDOR_C:
-        switch (attributeNumber)
-        {
-        case 1: // read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Raw Read Error Rate");
-            break;
-        case 5: // retired block count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Retired Block Count");
-            break;
-        case 9: // Power on Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 12: // Drive Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        case 100: // Total Erase Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total Erase Count");
-            break;
-        case 168: // Min Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Min Power Cycle Count");
-            break;
-        case 169: // Max power cycle count (seagate-vendor-b-c)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Max Power Cycle Count");
-            break;
-        case 171: // Program Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Program Fail Count");
-            break;
-        case 172: // Erase Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Erase Fail Count");
-            break;
-        case 174: // Unexpected Power Loss Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Unexpected Power Loss Count");
-            break;
-        case 175: // Maximum Program Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Maximum Program Fail Count");
-            break;
-        case 176: // Maximum Erase Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Maximum Erase Fail Count");
-            break;
-        case 177: // Wear Leveling Count
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Wear Leveling Count");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Endurance Used");
-            }
-            break;
-        case 178: // Used Reserved Block Count for The Worst Die
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Used Reserve Block Count (Chip)");
-            break;
-        case 179: // Used Reserved Block Count for SSD
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Used Reserve Block Count (Total)");
-            break;
-        case 180: // reported IOEDC Error In Interval (Seagate/Samsung), End to End Error Detection Rate
-            if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "End To End Error Detection Rate");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Unused Reserved Block Count (Total)");
-            }
-            break;
-        case 181: // Program Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Program Fail Count");
-            break;
-        case 182: // Erase Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Erase Fail Count");
-            break;
-        case 183: // PHY Counter Events (Seagate), SATA Downshift Count (Seagate-vendor-b-c)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SATA Downshift Count");
-            break;
-        case 184: // IOEDC Count (Seagate), End to End Error Detection Count (Seagate-vendor-b-c)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "End To End Error Detection Count");
-            break;
-        case 187: // Reported Un-correctable
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reported Un-correctable");
-            break;
-        case 188: // Command Timeout
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Command Timeout");
-            break;
-        case 190: // Airflow Temperature (Seagate), SATA Error Counters (Seagate-vendor-b-c)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SATA Error Counters");
-            break;
-        case 194: // Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Temperature");
-            break;
-        case 195: // ECC On the Fly Count (Seagate)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "ECC On The Fly Count");
-            break;
-        case 196: // Re-allocate Sector Event
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Re-allocate Sector Event");
-            break;
-        case 197: // Pending-Sparing Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Current Pending Sector Count");
-            break;
-        case 198: // offlince uncorrectable sectors
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Off-line Uncorrectable Sectors");
-            break;
-        case 199: // Ultra DMA CRC Error
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Ultra DMA CRC Error");
-            break;
-        case 201: // Uncorrectable Read Error Rate (Seagate-vendor-b-c)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Uncorrectable Read Error Rate");
-            break;
-        case 204: // Soft ECC Correction Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Soft ECC Correction Rate");
-            break;
-        case 212: // Phy Error Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Phy Error Count");
-            break;
-        case 231: // SSD Life Left
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Life Left");
-            break;
-        case 234: //
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "NAND GiB Written");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Vendor Specific");
-            }
-            break;
-        case 241: // Lifetime Writes from Host
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Writes From Host in GiB");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total LBAs Written");
-            }
-            break;
-        case 242: // Lifetime Reads from Host
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Reads From Host in GiB");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total LBAs Read");
-            }
-            break;
-        case 245: // SSD Life Left (%)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Life Left %%");
-            break;
-        case 250: // Lifetime NAND Read Retries
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime NAND Read Retries");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Retry Rate");
-            }
-            break;
-        default:
-            break;
-        }
-        break;
-    case SEAGATE_VENDOR_F:
-        switch (attributeNumber)
-        {
-        case 1: // UECC error count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "UECC Error count");
-            break;
-        case 9: // Power on Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 12: // Drive Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        case 16: // Spare Blocks Available
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spare Blocks Available");
-            break;
-        case 17: // Remaining Spare Blocks
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Remaining Spare Blocks");
-            break;
-        case 168: // Sata Phy Error Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Sata Phy Error Count");
-            break;
-        case 170: // Bad Block Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Bad Block Count");
-            break;
-        case 173: // Erase Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Erase Count");
-            break;
-        case 174: // Unexpected Power Loss Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Unexpected Power Loss Count");
-            break;
-        case 177: // Wear Range Delta
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Wear Range Delta");
-            break;
-        case 192: // Unexpected power loss count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Unexpected Power loss Count");
-            break;
-        case 194: // Primary Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Primary Temperature");
-            break;
-        case 218: // CRC Error Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "CRC Error Count");
-            break;
-        case 231: // SSD Life Left
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Life Left");
-            break;
-        case 232: // Read failure block count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Failure Block Count");
-            break;
-        case 233: // NAND GiB written
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "NAND GiB Written");
-            break;
-        case 234: // NAND sectors read
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "NAND sectors Read");
-            break;
-        case 235: // NAND sectors written
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "NAND sectors Written");
-            break;
-        case 241: // Lifetime Writes from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Writes From Host");
-            break;
-        case 242: // Lifetime Reads from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Reads From Host");
-            break;
-        case 246: // Write Protect Detail
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Write Protect Detail");
-            break;
-        default:
-            break;
-        }
-        break;
-    case SEAGATE_VENDOR_G:
-        switch (attributeNumber)
-        {
-        case 1: // Raw Read Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Raw Read Error Rate");
-            break;
-        case 5: // Reallocated Sector Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reallocated Sector Count");
-            break;
-        case 9: // Power on Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 11: // Power Fail Event Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power Fail Event Count");
-            break;
-        case 12: // Drive Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        case 100: // Flash Gigabytes Erased
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Flash Gigabytes Erased");
-            break;
-        case 101: // Lifetime DevSleep Exit Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime DevSleep Exit Count");
-            break;
-        case 102: // Lifetime PS4 Entry Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime PS4 Entry Count");
-            break;
-        case 103: // Lifetime PS3 Exit Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime PS3 Exit Count");
-            break;
-        case 170: // Grown Bad Block Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Grown Bad Block Count");
-            break;
-        case 171: // Program Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Program Fail Count");
-            break;
-        case 172: // Erase Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Erase Fail Count");
-            break;
-        case 173: // Average Program/Erase Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Average Program/Erase Count");
-            break;
-        case 174: // Unexpected Power Loss Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Unexpected Power Loss Count");
-            break;
-        case 177: // Wear Range Delta
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Wear Range Delta");
-            break;
-        case 183: // SATA/PCIe Interface Downshift Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SATA/PCIe Interface Downshift Count");
-            break;
-        case 184: // End-To-End CRC Error Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "End-To-End CRC Error Count");
-            break;
-        case 187: // Uncorrectable ECC Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Uncorrectable ECC Count");
-            break;
-        case 194: // Primary Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Primary Temperature");
-            break;
-        case 195: // RAISE ECC Correctable Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "RAISE ECC Correctable Count");
-            break;
-        case 198: // Uncorrectable Read Error Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Uncorrectable Read Error Count");
-            break;
-        case 199: // SATA R-Error (CRC) Error Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SATA R-Error (CRC) Error Count");
-            break;
-        case 230: // Drive Life Protection Status
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Life Protection Status");
-            break;
-        case 231: // SSD Life Left
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Life Left");
-            break;
-        case 232: // Available Reserved Space
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Available Reserved Space");
-            break;
-        case 233: // Lifetime Writes to Flash
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Writes to Flash");
-            break;
-        case 241: // Lifetime Writes from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Writes From Host");
-            break;
-        case 242: // Lifetime Reads from Host
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Lifetime Reads From Host");
-            break;
-        case 243: // Free Space
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Free Space");
-            break;
-        default:
-            break;
-        }
-        break;
-    case SEAGATE_CONNER:
-        // From product manual for models CFS635A/CFS850A/CFS1275A
-        switch (attributeNumber)
-        {
-        case 1:
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Firm Error Rate");
-            break;
-        case 3:
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Up Time");
-            break;
-        case 4:
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Up Count");
-            break;
-        case 5:
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Retired Sectors");
-            break;
-        case 7:
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Error Rate");
-            break;
-        case 10:
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Retries");
-            break;
-        case 12:
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        default:
-            break;
-        }
-        break;
-    case SEAGATE_VENDOR_K:
-        switch (attributeNumber)
-        {
-        case 1: // read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Rate");
-            break;
-        case 5: // reallocated sector count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reallocated Sector Count");
-            break;
-        case 9: // power on hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 12: // power cycle count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power Cycle Count");
-            break;
-        case 160: // Uncorrectable Sector Count during r/w
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Uncorrectable Sector Count - R/W");
-            break;
-        case 161: // Number of valid spare blocks
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Number of Valid Spare Blocks");
-            break;
-        case 163: // number of invalid blocks
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Number of Invalid Blocks");
-            break;
-        case 164: // Total erase count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total Erase Count");
-            break;
-        case 165: // Maximum erase count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Maximum Erase Count");
-            break;
-        case 166: // Minimum erase count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Minimum Erase Count");
-            break;
-        case 167: // average erase count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Average Erase Count");
-            break;
-        case 168: // Max erase count of spec
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Max Erase Count of Spec");
-            break;
-        case 169: // remaining life
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Remaining Life");
-            break;
-        case 172: // Erase fail count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Erase Fail Count");
-            break;
-        case 173: // reserved
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reserved");
-            break;
-        case 181: // Total Program Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total Program Fail Count");
-            break;
-        case 182: // Total Erase Fail Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total Erase Fail Count");
-            break;
-        case 187: // Uncorrectable error count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Uncorrectable Error Count");
-            break;
-        case 192: // power off retract count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power Off Retract Count");
-            break;
-        case 194: // temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Temperature");
-            break;
-        case 196: // reallocation event count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reallocation Event Count");
-            break;
-        case 218: // USB 3.0 recovery count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "USB 3.0 Recovery Count");
-            break;
-        case 231: // SSD Life Left
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "SSD Life Left");
-            break;
-        case 233: // NAND Write (32MB units)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "NAND Written");
-            break;
-        case 241: // Total LBA Written (32MB units)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total LBAs Written");
-            break;
-        case 242: // Total LBA Read (32MB units)
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total LBAs Read");
-            break;
-        case 244: // Average Erase count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Average Erase Count");
-            break;
-        case 245: // maximum erase count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Maximum Erase Count");
-            break;
-        case 246: // Total Erase Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Total Erase Count");
-            break;
-        default:
-            break;
-        }
-        break;
-    case SEAGATE_QUANTUM:
-        switch (attributeNumber)
-        {
-        case 1: // read error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Rate");
-            break;
-        case 3: // spin up time
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Up Time");
-            break;
-        case 4: // start-stop count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Start-Stop Count");
-            break;
-        case 5: // Reallocated sector count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reallocated Sector Count");
-            break;
-        case 7: // seek error rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Error Rate");
-            break;
-        case 9: // power on hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 11: // recal retry count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Recalibration Retry Count");
-            break;
-        case 12: // drive power cycle count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        default:
-            break;
-        }
-        break;
-    default:
-        switch (attributeNumber)
+    else
+    {
+        ret = NOT_SUPPORTED;
+        if (VERBOSITY_QUIET < device->deviceVerbosity)
         {
-        case 1: // Read Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Read Error Rate");
-            break;
-        case 3: // Spin Up Time
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Up Time");
-            break;
-        case 4: // Start/Stop Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Start/Stop Count");
-            break;
-        case 5: // Retired Sectors Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Retired Sectors Count");
-            break;
-        case 7: // Seek Error Rate
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Seek Error Rate");
-            break;
-        case 9: // Power On Hours
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Power On Hours");
-            break;
-        case 10: // Spin Retry Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Spin Retry Count");
-            break;
-        case 12: // Drive Power Cycle Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Drive Power Cycle Count");
-            break;
-        case 187: // Reported Un-correctable
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Reported Un-correctable");
-            break;
-        case 194: // Temperature
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Temperature");
-            break;
-        case 197: // Pending-Sparing Count
-            snprintf_err_handle(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, "Pending-Sparing Count");
-            break;
-        default:
-            break;
+            printf("Getting SMART attributes is not supported on this drive type at this time\n");
         }
-        break;
     }
+    return ret;
+}
+
+/*
+I broke the attribute names apart by family because sometimes there's overlap and sometimes there isn't.
+Also, this will let me name the attributes according to the respective specs for each drive.
+Each table is indexed by attribute number. Attributes without a name for that family are M_NULLPTR.
+*/
+#define SMART_ATTRIBUTE_NAME_TABLE_ENTRIES (UINT8_MAX + 1)
+
+static const char* const seagateAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Read Error Rate",
+    [3]   = "Spin Up Time",
+    [4]   = "Start/Stop Count",
+    [5]   = "Retired Sectors Count",
+    [7]   = "Seek Error Rate",
+    [9]   = "Power On Hours",
+    [10]  = "Spin Retry Count",
+    [12]  = "Drive Power Cycle Count",
+    [18]  = "Head Health Self Assessment",
+    [174] = "Unexpected Power Loss Count",
+    [183] = "PHY Counter Events",
+    [184] = "IOEDC Count",
+    [187] = "Reported Un-correctable",
+    [188] = "Command Timeout",
+    [189] = "High Fly Writes",
+    [190] = "Airflow Temperature",
+    [191] = "Shock Sensor Counter",
+    [192] = "Emergency Retract Count",
+    [193] = "Load-Unload Count",
+    [194] = "Temperature",
+    [195] = "ECC On The Fly Count",
+    [197] = "Pending-Sparing Count",
+    [198] = "Offline Uncorrectable Sector Count",
+    [199] = "Ultra DMA CRC Error",
+    [200] = "Pressure Measurement Limit",
+    [230] = "Life Curve Status",
+    [231] = "SSD Life Left",
+    [235] = "SSD Power Less Mgmt Life Left",
+    [240] = "Head Flight Hours",
+    [241] = "Lifetime Writes From Host",
+    [242] = "Lifetime Reads From Host",
+    [254] = "Free Fall Event",
+};
+
+// SEAGATE_VENDOR_D and SEAGATE_VENDOR_E. With Seagate for now. Might move sometime
+static const char* const seagateVendorDEAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Read Error Rate",
+    [5]   = "Retired Sectors Count",
+    [9]   = "Power On Hours",
+    [12]  = "Drive Power Cycle Count",
+    [171] = "Program Fail Count",
+    [172] = "Erase Fail Count",
+    [181] = "Program Fail Count",
+    [182] = "Erase Fail Count",
+    [194] = "Temperature",
+    [201] = "Soft Error Rate",
+    [204] = "Soft ECC Correction Rate",
+    [231] = "SSD Life Left",
+    [234] = "Lifetime Writes To Flash in GiB",
+    [241] = "Lifetime Writes From Host in GiB",
+    [242] = "Lifetime Reads From Host in GiB",
+    [250] = "Lifetime NAND Read Retries",
+};
+
+static const char* const samsungAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Read Error Rate",
+    [2]   = "Throughput Performance",
+    [3]   = "Spin Up Time",
+    [4]   = "Start/Stop Count",
+    [5]   = "Retired Sectors Count",
+    [7]   = "Seek Error Rate",
+    [8]   = "Seek Time Performance",
+    [9]   = "Power On Hours",
+    [10]  = "Spin Retry Count",
+    [11]  = "Calibration Retry Count",
+    [12]  = "Drive Power Cycle Count",
+    [180] = "End to End Error Detection",
+    [181] = "Unaligned Access",
+    [183] = "SATA Interface Downshift",
+    [184] = "End To End Detection",
+    [187] = "Reported Un-correctable",
+    [188] = "Command Timeout",
+    [190] = "Airflow Temperature",
+    [191] = "Shock Sensor Counter",
+    [192] = "Emergency Retract Count",
+    [193] = "Load-Unload Count",
+    [194] = "Temperature",
+    [195] = "ECC On The Fly Count",
+    [196] = "Re-allocate Sector Event",
+    [197] = "Pending Sector Count",
+    [198] = "Offline Uncorrectable Sectors",
+    [199] = "Ultra DMA CRC Error",
+    [200] = "Write Error Rate",
+    [201] = "Soft Error Rate",
+    [223] = "Load Retry Count",
+    [225] = "Load Cycle Count",
+    [240] = "Head Flight Hours",
+    [241] = "Total Write Count",
+    [242] = "Total Read Count",
+    [254] = "Free Fall Count",
+};
+
+// names are from here: https://www.smartmontools.org/wiki/AttributesMaxtor
+static const char* const maxtorAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Raw Read Error Rate",
+    [2]   = "Throughput Performance",
+    [3]   = "Spin Up Time",
+    [4]   = "Start/Stop Count",
+    [5]   = "Reallocated Sector Count",
+    [6]   = "Start/Stop Count",
+    [7]   = "Seek Error Rate",
+    [8]   = "Seek Time Performance",
+    // internal spec says this is minutes, but not sure which drives report in minutes.
+    // Old drives I have tested seem to do hours. may need to use revision number
+    [9]   = "Power-On Hours",
+    [10]  = "Spin-Up Retry Count",
+    [11]  = "Calibration Retry Count",
+    [12]  = "Power Cycle Count",
+    [13]  = "Soft Read Error Rate",
+    [192] = "Power-Off Retract Cycle Count",
+    [193] = "Load/Unload Cycle Count",
+    [194] = "HDA Temperature",
+    [195] = "Hardware ECC Recovered",
+    [196] = "Re-allocate Event Count",
+    [197] = "Current Pending Sector Count",
+    [198] = "Off-line Uncorrectable Count",
+    [199] = "Ultra DMA CRC Error Rate",
+    [200] = "Write Error Rate",
+    // off track errors is an alternate name
+    [201] = "Soft Read Error Rate",
+    [202] = "Data Address Mark Errors",
+    // ECC errors is an alternate name
+    [203] = "Run Out Cancel",
+    [204] = "Soft ECC Correction",
+    [205] = "Thermal Asperity Rate",
+    [206] = "Flying Height",
+    [207] = "Spin High Current",
+    [208] = "Spin Buzz",
+    [209] = "Offline Seek Performance",
+    [210] = "Vibration During Write",
+    [211] = "Vibration During Read",
+    [212] = "Shock During Write",
+    [220] = "Disk Shift",
+    [221] = "G-Sense Error Rate",
+    [222] = "Loaded Hours",
+    [223] = "Load/Unload Retry Count",
+    [224] = "Load Friction",
+    [225] = "Load/Unload Cycle Count",
+    [226] = "Load-In Time",
+    [227] = "Torque Amplification Count",
+    [228] = "Power-Off Retract Cycle",
+    [230] = "GMR Head Amplitude",
+    [231] = "Temperature",
+    [240] = "Head Flying Hours",
+    [250] = "Read Error Retry Rate",
+};
+
+static const char* const seagateVendorBAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Raw Read Error Rate",
+    [5]   = "Retired Block Count",
+    [9]   = "Power On Hours",
+    [12]  = "Drive Power Cycle Count",
+    [100] = "Total Erase Count",
+    [168] = "Min Power Cycle Count",
+    [169] = "Max Power Cycle Count",
+    [171] = "Program Fail Count",
+    [172] = "Erase Fail Count",
+    [174] = "Unexpected Power Loss Count",
+    [175] = "Maximum Program Fail Count",
+    [176] = "Maximum Erase Fail Count",
+    [177] = "Wear Leveling Count",
+    [178] = "Used Reserve Block Count (Chip)",
+    [179] = "Used Reserve Block Count (Total)",
+    [180] = "Unused Reserved Block Count (Total)",
+    [181] = "Program Fail Count",
+    [182] = "Erase Fail Count",
+    [183] = "SATA Downshift Count",
+    [184] = "End To End Error Detection Count",
+    [187] = "Reported Un-correctable",
+    [188] = "Command Timeout",
+    [190] = "SATA Error Counters",
+    [194] = "Temperature",
+    [195] = "ECC On The Fly Count",
+    [196] = "Re-allocate Sector Event",
+    [197] = "Current Pending Sector Count",
+    [198] = "Off-line Uncorrectable Sectors",
+    [199] = "Ultra DMA CRC Error",
+    [201] = "Uncorrectable Read Error Rate",
+    [204] = "Soft ECC Correction Rate",
+    [212] = "Phy Error Count",
+    [231] = "SSD Life Left",
+    [234] = "NAND GiB Written",
+    [241] = "Lifetime Writes From Host in GiB",
+    [242] = "Lifetime Reads From Host in GiB",
+    [245] = "SSD Life Left %",
+    [250] = "Lifetime NAND Read Retries",
+};
+
+static const char* const seagateVendorCAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Raw Read Error Rate",
+    [5]   = "Retired Block Count",
+    [9]   = "Power On Hours",
+    [12]  = "Drive Power Cycle Count",
+    [100] = "Total Erase Count",
+    [168] = "Min Power Cycle Count",
+    [169] = "Max Power Cycle Count",
+    [171] = "Program Fail Count",
+    [172] = "Erase Fail Count",
+    [174] = "Unexpected Power Loss Count",
+    [175] = "Maximum Program Fail Count",
+    [176] = "Maximum Erase Fail Count",
+    [177] = "Endurance Used",
+    [178] = "Used Reserve Block Count (Chip)",
+    [179] = "Used Reserve Block Count (Total)",
+    [180] = "End To End Error Detection Rate",
+    [181] = "Program Fail Count",
+    [182] = "Erase Fail Count",
+    [183] = "SATA Downshift Count",
+    [184] = "End To End Error Detection Count",
+    [187] = "Reported Un-correctable",
+    [188] = "Command Timeout",
+    [190] = "SATA Error Counters",
+    [194] = "Temperature",
+    [195] = "ECC On The Fly Count",
+    [196] = "Re-allocate Sector Event",
+    [197] = "Current Pending Sector Count",
+    [198] = "Off-line Uncorrectable Sectors",
+    [199] = "Ultra DMA CRC Error",
+    [201] = "Uncorrectable Read Error Rate",
+    [204] = "Soft ECC Correction Rate",
+    [212] = "Phy Error Count",
+    [231] = "SSD Life Left",
+    [234] = "Vendor Specific",
+    [241] = "Total LBAs Written",
+    [242] = "Total LBAs Read",
+    [245] = "SSD Life Left %",
+    [250] = "Read Error Retry Rate",
+};
+
+static const char* const seagateVendorFAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "UECC Error count",
+    [9]   = "Power On Hours",
+    [12]  = "Drive Power Cycle Count",
+    [16]  = "Spare Blocks Available",
+    [17]  = "Remaining Spare Blocks",
+    [168] = "Sata Phy Error Count",
+    [170] = "Bad Block Count",
+    [173] = "Erase Count",
+    [174] = "Unexpected Power Loss Count",
+    [177] = "Wear Range Delta",
+    [192] = "Unexpected Power loss Count",
+    [194] = "Primary Temperature",
+    [218] = "CRC Error Count",
+    [231] = "SSD Life Left",
+    [232] = "Read Failure Block Count",
+    [233] = "NAND GiB Written",
+    [234] = "NAND sectors Read",
+    [235] = "NAND sectors Written",
+    [241] = "Lifetime Writes From Host",
+    [242] = "Lifetime Reads From Host",
+    [246] = "Write Protect Detail",
+};
+
+static const char* const seagateVendorGAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Raw Read Error Rate",
+    [5]   = "Reallocated Sector Count",
+    [9]   = "Power On Hours",
+    [11]  = "Power Fail Event Count",
+    [12]  = "Drive Power Cycle Count",
+    [100] = "Flash Gigabytes Erased",
+    [101] = "Lifetime DevSleep Exit Count",
+    [102] = "Lifetime PS4 Entry Count",
+    [103] = "Lifetime PS3 Exit Count",
+    [170] = "Grown Bad Block Count",
+    [171] = "Program Fail Count",
+    [172] = "Erase Fail Count",
+    [173] = "Average Program/Erase Count",
+    [174] = "Unexpected Power Loss Count",
+    [177] = "Wear Range Delta",
+    [183] = "SATA/PCIe Interface Downshift Count",
+    [184] = "End-To-End CRC Error Count",
+    [187] = "Uncorrectable ECC Count",
+    [194] = "Primary Temperature",
+    [195] = "RAISE ECC Correctable Count",
+    [198] = "Uncorrectable Read Error Count",
+    [199] = "SATA R-Error (CRC) Error Count",
+    [230] = "Drive Life Protection Status",
+    [231] = "SSD Life Left",
+    [232] = "Available Reserved Space",
+    [233] = "Lifetime Writes to Flash",
+    [241] = "Lifetime Writes From Host",
+    [242] = "Lifetime Reads From Host",
+    [243] = "Free Space",
+};
+
+// From product manual for models CFS635A/CFS850A/CFS1275A
+static const char* const seagateConnerAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]  = "Firm Error Rate",
+    [3]  = "Spin Up Time",
+    [4]  = "Spin Up Count",
+    [5]  = "Retired Sectors",
+    [7]  = "Seek Error Rate",
+    [10] = "Spin Retries",
+    [12] = "Drive Power Cycle Count",
+};
+
+static const char* const seagateVendorKAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Read Error Rate",
+    [5]   = "Reallocated Sector Count",
+    [9]   = "Power On Hours",
+    [12]  = "Power Cycle Count",
+    [160] = "Uncorrectable Sector Count - R/W",
+    [161] = "Number of Valid Spare Blocks",
+    [163] = "Number of Invalid Blocks",
+    [164] = "Total Erase Count",
+    [165] = "Maximum Erase Count",
+    [166] = "Minimum Erase Count",
+    [167] = "Average Erase Count",
+    [168] = "Max Erase Count of Spec",
+    [169] = "Remaining Life",
+    [172] = "Erase Fail Count",
+    [173] = "Reserved",
+    [181] = "Total Program Fail Count",
+    [182] = "Total Erase Fail Count",
+    [187] = "Uncorrectable Error Count",
+    [192] = "Power Off Retract Count",
+    [194] = "Temperature",
+    [196] = "Reallocation Event Count",
+    [218] = "USB 3.0 Recovery Count",
+    [231] = "SSD Life Left",
+    [233] = "NAND Written",
+    [241] = "Total LBAs Written",
+    [242] = "Total LBAs Read",
+    [244] = "Average Erase Count",
+    [245] = "Maximum Erase Count",
+    [246] = "Total Erase Count",
+};
+
+static const char* const seagateQuantumAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]  = "Read Error Rate",
+    [3]  = "Spin Up Time",
+    [4]  = "Start-Stop Count",
+    [5]  = "Reallocated Sector Count",
+    [7]  = "Seek Error Rate",
+    [9]  = "Power On Hours",
+    [11] = "Recalibration Retry Count",
+    [12] = "Drive Power Cycle Count",
+};
+
+static const char* const defaultAttributeNames[SMART_ATTRIBUTE_NAME_TABLE_ENTRIES] = {
+    [1]   = "Read Error Rate",
+    [3]   = "Spin Up Time",
+    [4]   = "Start/Stop Count",
+    [5]   = "Retired Sectors Count",
+    [7]   = "Seek Error Rate",
+    [9]   = "Power On Hours",
+    [10]  = "Spin Retry Count",
+    [12]  = "Drive Power Cycle Count",
+    [187] = "Reported Un-correctable",
+    [194] = "Temperature",
+    [197] = "Pending-Sparing Count",
+};
+
+const char* const* get_SMART_Attribute_Name_Table(eSeagateFamily family)
+{
+    switch (family)
+    {
+    case SEAGATE:
+        return seagateAttributeNames;
+    case SEAGATE_VENDOR_D:
+    case SEAGATE_VENDOR_E:
+        return seagateVendorDEAttributeNames;
+    case SAMSUNG:
+        return samsungAttributeNames;
+    case MAXTOR:
+        return maxtorAttributeNames;
+    case SEAGATE_VENDOR_B:
+        return seagateVendorBAttributeNames;
+    case SEAGATE_VENDOR_C:
+        return seagateVendorCAttributeNames;
+    case SEAGATE_VENDOR_F:
+        return seagateVendorFAttributeNames;
+    case SEAGATE_VENDOR_G:
+        return seagateVendorGAttributeNames;
+    case SEAGATE_CONNER:
+        return seagateConnerAttributeNames;
+    case SEAGATE_VENDOR_K:
+        return seagateVendorKAttributeNames;
+    case SEAGATE_QUANTUM:
+        return seagateQuantumAttributeNames;
+    default:
+        return defaultAttributeNames;
+    }
+}
+
+const char* get_SMART_Attribute_Name(tDevice* device, uint8_t attributeNumber)
+{
+    return get_SMART_Attribute_Name_From_Table(get_SMART_Attribute_Name_Table(is_Seagate_Family(device)),
+                                               attributeNumber);
+}
+
+void get_Attribute_Name(tDevice* device, uint8_t attributeNumber, char** attributeName)
+{
+    // NOTE: I don't like that this function isn't taking a length in, but all uses are matching this define. It SHOULD
+    // be safe enough, but that is something we may need to reconsider in the future-TJE
+    safe_memset(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, 0, MAX_ATTRIBUTE_NAME_LENGTH);
+    safe_strcpy(*attributeName, MAX_ATTRIBUTE_NAME_LENGTH, get_SMART_Attribute_Name(device, attributeNumber));
 }
 
 void get_Raw_Field_Unit_String(eATAAttributeRawFieldUnitType uintType, char** unitString, bool isShortName)
@@ -1439,10 +890,8 @@ static eReturnValues get_ATA_Analyzed_ATA_Attributes_From_SMART_Data(tDevice*
 {
     if (device->drive_info.drive_type == ATA_DRIVE)
     {
-        eSeagateFamily isSeagateDrive = is_Seagate_Family(device);
-        char*          attributeName  = M_REINTERPRET_CAST(char*, safe_calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char)));
-        if (attributeName == M_NULLPTR)
-            return MEMORY_FAILURE;
+        eSeagateFamily     isSeagateDrive = is_Seagate_Family(device);
+        const char* const* attributeNames = get_SMART_Attribute_Name_Table(isSeagateDrive);
 
         for (uint8_t iter = UINT8_C(0); iter < UINT8_MAX; ++iter)
         {
@@ -1451,9 +900,8 @@ static eReturnValues get_ATA_Analyzed_ATA_Attributes_From_SMART_Data(tDevice*
                 smartAnylyzedData->attributes[iter].attributeNumber = iter;
                 smartAnylyzedData->attributes[iter].isValid         = true;
 
-                get_Attribute_Name(device, iter, &attributeName);
                 safe_strcpy(smartAnylyzedData->attributes[iter].attributeName, MAX_ATTRIBUTE_NAME_LENGTH,
-                            attributeName);
+                            get_SMART_Attribute_Name_From_Table(attributeNames, iter));
                 get_ata_AttributeType_From_Status_Bit(smartData->attributes.ataSMARTAttr.attributes[iter].data.status,
                                                       &smartAnylyzedData->attributes[iter].attributeType);
                 smartAnylyzedData->attributes[iter].nominal =
@@ -3164,12 +2612,8 @@ static eReturnValues get_ATA_Analyzed_ATA_Attributes_From_SMART_Data(tDevice*
                     }
                     break;
                 }
-
-                safe_memset(attributeName, MAX_ATTRIBUTE_NAME_LENGTH, 0, MAX_ATTRIBUTE_NAME_LENGTH);
             }
         }
-
-        safe_free(&attributeName);
         return SUCCESS;
     }
     else
@@ -5493,7 +4937,7 @@ static bool is_Attr_In_Valid_Range(uint8_t attributeValue)
     return validrange;
 }
 
-eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
+static eReturnValues ata_SMART_Check_Cached(tDevice* device, ptrLogPageCache logCache, ptrSmartTripInfo tripInfo)
 {
     eReturnValues ret = NOT_SUPPORTED; // command return value
     if (is_SMART_Enabled(device))
@@ -5525,7 +4969,7 @@ eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
         // Even though we may have already determined pass/fail, attempt to read the attributes and thresholds for more
         // comparison and detail It is possible for some drives to give "warnings" for attributes that are not
         // warrantied, which would be useful to report when possible.
-        if (SUCCESS == get_SMART_Attributes(device, &attributes))
+        if (SUCCESS == get_SMART_Attributes_Cached(device, logCache, &attributes))
         {
             // go through and compare attirbutes to thresholds (as long as the thresholds were able to be read!!!)
             for (uint16_t counter = UINT16_C(0); counter < ATA_SMART_LOG_MAX_ATTRIBUTES; ++counter)
@@ -5558,9 +5002,8 @@ eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
                                     attributes.attributes.ataSMARTAttr.attributes[counter].data.nominal;
                                 tripInfo->ataAttribute.thresholdValue =
                                     attributes.attributes.ataSMARTAttr.attributes[counter].thresholdData.thresholdValue;
-                                char* attributeName =
-                                    M_REINTERPRET_CAST(char*, safe_calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char)));
-                                get_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber, &attributeName);
+                                const char* attributeName =
+                                    get_SMART_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber);
                                 if (safe_strlen(attributeName))
                                 {
                                     // use the name in the error reason
@@ -5630,14 +5073,9 @@ eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
                                     tripInfo->ataAttribute.thresholdValue =
                                         attributes.attributes.ataSMARTAttr.attributes[counter]
                                             .thresholdData.thresholdValue;
-                                    char* attributeName =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char)));
-                                    if (attributeName)
-                                    {
-                                        get_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber,
-                                                           &attributeName);
-                                    }
-                                    if (attributeName && safe_strlen(attributeName) > 0)
+                                    const char* attributeName =
+                                        get_SMART_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber);
+                                    if (safe_strlen(attributeName) > 0)
                                     {
                                         // use the name in the error reason
                                         snprintf_err_handle(
@@ -5663,7 +5101,6 @@ eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
                                         tripInfo->reasonStringLength =
                                             C_CAST(uint8_t, safe_strlen(tripInfo->reasonString));
                                     }
-                                    safe_free(&attributeName);
                                 }
                                 break;
                             }
@@ -5697,14 +5134,9 @@ eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
                                     tripInfo->ataAttribute.thresholdValue =
                                         attributes.attributes.ataSMARTAttr.attributes[counter]
                                             .thresholdData.thresholdValue;
-                                    char* attributeName =
-                                        M_REINTERPRET_CAST(char*, safe_calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char)));
-                                    if (attributeName)
-                                    {
-                                        get_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber,
-                                                           &attributeName);
-                                    }
-                                    if (attributeName && safe_strlen(attributeName) > 0)
+                                    const char* attributeName =
+                                        get_SMART_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber);
+                                    if (safe_strlen(attributeName) > 0)
                                     {
                                         // use the name in the error reason
                                         snprintf_err_handle(tripInfo->reasonString, UINT8_MAX,
@@ -5731,7 +5163,6 @@ eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
                                         tripInfo->reasonStringLength =
                                             C_CAST(uint8_t, safe_strlen(tripInfo->reasonString));
                                     }
-                                    safe_free(&attributeName);
                                 }
                             }
                         }
@@ -5750,6 +5181,11 @@ eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
     return ret;
 }
 
+eReturnValues ata_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
+{
+    return ata_SMART_Check_Cached(device, M_NULLPTR, tripInfo);
+}
+
 static void translate_SCSI_SMART_Sense_To_String(uint8_t  asc,
                                                  uint8_t  ascq,
                                                  char*    reasonString,
@@ -6280,6 +5716,11 @@ eReturnValues nvme_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
 }
 
 eReturnValues run_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
+{
+    return run_SMART_Check_Cached(device, M_NULLPTR, tripInfo);
+}
+
+eReturnValues run_SMART_Check_Cached(tDevice* device, ptrLogPageCache logCache, ptrSmartTripInfo tripInfo)
 {
     eReturnValues result = UNKNOWN;
     if (device->drive_info.drive_type == SCSI_DRIVE)
@@ -6288,7 +5729,7 @@ eReturnValues run_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
     }
     else if (device->drive_info.drive_type == ATA_DRIVE)
     {
-        result = ata_SMART_Check(device, tripInfo);
+        result = ata_SMART_Check_Cached(device, logCache, tripInfo);
     }
     else if (device->drive_info.drive_type == NVME_DRIVE)
     {
@@ -6297,6 +5738,145 @@ eReturnValues run_SMART_Check(tDevice* device, ptrSmartTripInfo tripInfo)
     return result;
 }
 
+// A single command that is usually enough to tell if a drive is healthy. Drives that are not a clear pass are checked
+// again with run_SMART_Check() by run_Health_Sweep().
+static void quick_Health_Check(tDevice* device, ptrHealthSweepRecord record)
+{
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+        if (is_SMART_Enabled(device))
+        {
+            record->method     = HEALTH_SWEEP_METHOD_SMART_RETURN_STATUS;
+            record->lastResult = ata_SMART_Return_Status(device);
+            if (record->lastResult == SUCCESS && device->drive_info.lastCommandRTFRs.lbaMid == ATA_SMART_SIG_MID &&
+                device->drive_info.lastCommandRTFRs.lbaHi == ATA_SMART_SIG_HI)
+            {
+                record->status = HEALTH_SWEEP_PASS;
+            }
+            else if (record->lastResult == SUCCESS &&
+                     device->drive_info.lastCommandRTFRs.lbaMid == ATA_SMART_BAD_SIG_MID &&
+                     device->drive_info.lastCommandRTFRs.lbaHi == ATA_SMART_BAD_SIG_HI)
+            {
+                record->status = HEALTH_SWEEP_FAIL;
+            }
+        }
+        break;
+    case NVME_DRIVE:
+    {
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, smartLogPage, LEGACY_DRIVE_SEC_SIZE);
+        nvmeGetLogPageCmdOpts smartPageOpts;
+        safe_memset(&smartPageOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+        smartPageOpts.addr    = smartLogPage;
+        smartPageOpts.dataLen = LEGACY_DRIVE_SEC_SIZE;
+        smartPageOpts.lid     = NVME_LOG_SMART_ID;
+        smartPageOpts.nsid    = UINT32_MAX; // requesting controller page, not namespace page. - TJE
+        record->method        = HEALTH_SWEEP_METHOD_NVME_HEALTH_LOG;
+        record->lastResult    = nvme_Get_Log_Page(device, &smartPageOpts);
+        if (record->lastResult == SUCCESS)
+        {
+            record->nvmeCriticalWarning = smartLogPage[0];
+            record->status              = smartLogPage[0] == 0 ? HEALTH_SWEEP_PASS : HEALTH_SWEEP_FAIL;
+        }
+    }
+    break;
+    case SCSI_DRIVE:
+    {
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, infoLogPage, LP_INFORMATION_EXCEPTIONS_LEN);
+        record->method     = HEALTH_SWEEP_METHOD_INFORMATIONAL_EXCEPTIONS_LOG;
+        record->lastResult = scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_INFORMATION_EXCEPTIONS, 0, 0,
+                                                infoLogPage, LP_INFORMATION_EXCEPTIONS_LEN);
+        // validate the page code since some SATLs return bad data
+        if (record->lastResult == SUCCESS && get_bit_range_uint8(infoLogPage[0], 5, 0) == 0x2F &&
+            infoLogPage[1] == 0 && M_BytesTo2ByteValue(infoLogPage[4], infoLogPage[5]) == 0)
+        {
+            record->asc  = infoLogPage[8];
+            record->ascq = infoLogPage[9];
+            // same interpretation as scsi_SMART_Check()
+            if (record->asc == 0x5D)
+            {
+                record->status = HEALTH_SWEEP_FAIL;
+            }
+            else if (record->asc == 0x0B)
+            {
+                record->status = HEALTH_SWEEP_WARNING;
+            }
+            else
+            {
+                record->status = HEALTH_SWEEP_PASS;
+            }
+        }
+    }
+    break;
+    default:
+        record->lastResult = NOT_SUPPORTED;
+        break;
+    }
+}
+
+static void full_Health_Check(tDevice* device, ptrHealthSweepRecord record)
+{
+    smartTripInfo tripInfo;
+    safe_memset(&tripInfo, sizeof(smartTripInfo), 0, sizeof(smartTripInfo));
+    record->escalated  = true;
+    record->lastResult = run_SMART_Check(device, &tripInfo);
+    switch (record->lastResult)
+    {
+    case SUCCESS:
+        record->status = HEALTH_SWEEP_PASS;
+        record->method = HEALTH_SWEEP_METHOD_FULL_SMART_CHECK;
+        break;
+    case FAILURE:
+        record->status = HEALTH_SWEEP_FAIL;
+        record->method = HEALTH_SWEEP_METHOD_FULL_SMART_CHECK;
+        break;
+    case IN_PROGRESS:
+        record->status = HEALTH_SWEEP_WARNING;
+        record->method = HEALTH_SWEEP_METHOD_FULL_SMART_CHECK;
+        break;
+    default:
+        // keep anything the quick check found
+        break;
+    }
+    switch (tripInfo.additionalInformationType)
+    {
+    case SMART_TRIP_INFO_TYPE_SCSI:
+        record->asc  = tripInfo.scsiSenseCode.asc;
+        record->ascq = tripInfo.scsiSenseCode.ascq;
+        break;
+    case SMART_TRIP_INFO_TYPE_ATA:
+        record->attributeNumber = tripInfo.ataAttribute.attributeNumber;
+        break;
+    default:
+        break;
+    }
+}
+
+eReturnValues run_Health_Sweep(tDevice* deviceList, uint32_t numberOfDevices, ptrHealthSweepRecord records)
+{
+    DISABLE_NONNULL_COMPARE
+    if (deviceList == M_NULLPTR || records == M_NULLPTR || numberOfDevices == UINT32_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(records, sizeof(healthSweepRecord) * numberOfDevices, 0, sizeof(healthSweepRecord) * numberOfDevices);
+    // Quick checks for every drive first so one slow or failing drive does not hold up the rest of the fleet
+    for (uint32_t deviceIter = UINT32_C(0); deviceIter < numberOfDevices; ++deviceIter)
+    {
+        records[deviceIter].lastResult = UNKNOWN;
+        quick_Health_Check(&deviceList[deviceIter], &records[deviceIter]);
+    }
+    for (uint32_t deviceIter = UINT32_C(0); deviceIter < numberOfDevices; ++deviceIter)
+    {
+        if (records[deviceIter].status != HEALTH_SWEEP_PASS && records[deviceIter].lastResult != NOT_SUPPORTED)
+        {
+            full_Health_Check(&deviceList[deviceIter], &records[deviceIter]);
+        }
+    }
+    return SUCCESS;
+}
+
 bool is_SMART_Enabled(tDevice* device)
 {
     bool enabled = false;
@@ -6326,8 +5906,9 @@ bool is_SMART_Enabled(tDevice* device)
             perror("calloc failure for infoExceptionsControl");
             return false;
         }
-        if (SUCCESS == scsi_Mode_Sense_10(device, MP_INFORMATION_EXCEPTIONS_CONTROL, 12 + MODE_PARAMETER_HEADER_10_LEN,
-                                          0, true, false, MPC_CURRENT_VALUES, infoExceptionsControl))
+        if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_INFORMATION_EXCEPTIONS_CONTROL,
+                                                 12 + MODE_PARAMETER_HEADER_10_LEN, 0, true, false, MPC_CURRENT_VALUES,
+                                                 infoExceptionsControl))
         {
             if (M_Nibble0(infoExceptionsControl[MODE_PARAMETER_HEADER_10_LEN + 3]) > 0)
             {
@@ -6379,9 +5960,10 @@ bool is_SMART_Check_Supported(tDevice* device)
                 // code to check for a trip.
                 DECLARE_ZERO_INIT_ARRAY(uint8_t, informationalExceptionsModePage,
                                         MP_INFORMATION_EXCEPTIONS_LEN + MODE_PARAMETER_HEADER_10_LEN);
-                if (SUCCESS == scsi_Mode_Sense_10(device, MP_INFORMATION_EXCEPTIONS_CONTROL,
-                                                  MP_INFORMATION_EXCEPTIONS_LEN + MODE_PARAMETER_HEADER_10_LEN, 0, true,
-                                                  false, MPC_CURRENT_VALUES, informationalExceptionsModePage))
+                if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_INFORMATION_EXCEPTIONS_CONTROL,
+                                                         MP_INFORMATION_EXCEPTIONS_LEN + MODE_PARAMETER_HEADER_10_LEN,
+                                                         0, true, false, MPC_CURRENT_VALUES,
+                                                         informationalExceptionsModePage))
                 {
                     // check the page code to be sure we got the right page.
                     if (get_bit_range_uint8(informationalExceptionsModePage[0], 5, 0) == 0x1C &&
@@ -7033,9 +6615,9 @@ eReturnValues get_SCSI_Informational_Exceptions_Info(tDevice*
     {
         bool    gotData      = false;
         uint8_t headerLength = MODE_PARAMETER_HEADER_10_LEN;
-        if (SUCCESS == scsi_Mode_Sense_10(device, MP_INFORMATION_EXCEPTIONS_CONTROL,
-                                          MODE_PARAMETER_HEADER_10_LEN + MP_INFORMATION_EXCEPTIONS_LEN, 0, true, false,
-                                          mpc, infoControlPage))
+        if (SUCCESS == cached_SCSI_Mode_Sense_10(device, M_NULLPTR, MP_INFORMATION_EXCEPTIONS_CONTROL,
+                                                 MODE_PARAMETER_HEADER_10_LEN + MP_INFORMATION_EXCEPTIONS_LEN, 0, true,
+                                                 false, mpc, infoControlPage))
         {
             gotData                              = true;
             controlData->deviceSpecificParameter = infoControlPage[3];
@@ -7167,8 +6749,9 @@ eReturnValues set_SCSI_Informational_Exceptions_Info(tDevice*
     }
     else
     {
-        ret = scsi_Mode_Select_10(device, modePageDataOffset + MP_INFORMATION_EXCEPTIONS_LEN, true, save, false,
-                                  infoControlPage, modePageDataOffset + MP_INFORMATION_EXCEPTIONS_LEN);
+        ret = cached_SCSI_Mode_Select_10(device, M_NULLPTR, modePageDataOffset + MP_INFORMATION_EXCEPTIONS_LEN, true,
+                                         save, false, infoControlPage,
+                                         modePageDataOffset + MP_INFORMATION_EXCEPTIONS_LEN);
     }
     safe_free_aligned(&infoControlPage);
     return ret;
@@ -7677,7 +7260,7 @@ eReturnValues get_ATA_Summary_SMART_Error_Log(tDevice* device, ptrSummarySMARTEr
         {
             // Check to make sure it is in the SMART log directory
             uint32_t smartErrorLogSize = UINT32_C(0);
-            get_ATA_Log_Size(device, ATA_LOG_SUMMARY_SMART_ERROR_LOG, &smartErrorLogSize, false, true);
+            get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_SUMMARY_SMART_ERROR_LOG, &smartErrorLogSize, false, true);
             if (smartErrorLogSize > 0)
             {
                 DECLARE_ZERO_INIT_ARRAY(uint8_t, errorLog, ATA_LOG_PAGE_LEN_BYTES); // This log is only 1 page in spec
@@ -7816,11 +7399,193 @@ eReturnValues get_ATA_Summary_SMART_Error_Log(tDevice* device, ptrSummarySMARTEr
 #define EXT_COMP_SMART_ERROR_LOG_ENTRY_SIZE           UINT8_C(124)
 #define EXT_COMP_SMART_ERROR_LOG_COMMAND_SIZE         UINT8_C(18)
 #define EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE UINT8_C(4)
+#define EXT_COMP_SMART_ERROR_LOG_HEADER_SIZE          UINT8_C(4)
 
 #define COMP_SMART_ERROR_LOG_ENTRY_SIZE               UINT8_C(90)
 #define COMP_SMART_ERROR_LOG_COMMAND_SIZE             UINT8_C(12)
 #define COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE     UINT8_C(5)
 
+// Each entry has 5 command data structures followed by the error data. Returns false when the entry is empty.
+static bool parse_Ext_Comprehensive_SMART_Error_Entry(const uint8_t* entryData, SMARTErrorDataStructure* entry)
+{
+    if (is_Empty(entryData, EXT_COMP_SMART_ERROR_LOG_ENTRY_SIZE))
+    {
+        return false;
+    }
+    safe_memset(entry, sizeof(SMARTErrorDataStructure), 0, sizeof(SMARTErrorDataStructure));
+    entry->extDataStructures = true;
+    // NOTE: don't memcpy since we aren't packing the structs
+    const uint8_t* commandData = entryData;
+    for (uint8_t commandEntry = UINT8_C(0); commandEntry < 5;
+         ++commandEntry, commandData += EXT_COMP_SMART_ERROR_LOG_COMMAND_SIZE)
+    {
+        if (is_Empty(commandData, EXT_COMP_SMART_ERROR_LOG_COMMAND_SIZE))
+        {
+            continue;
+        }
+        ExtSMARTCommandDataStructure* command = &entry->extCommand[commandEntry];
+        command->deviceControl                = commandData[0];
+        command->feature                      = commandData[1];
+        command->featureExt                   = commandData[2];
+        command->count                        = commandData[3];
+        command->countExt                     = commandData[4];
+        command->lbaLow                       = commandData[5];
+        command->lbaLowExt                    = commandData[6];
+        command->lbaMid                       = commandData[7];
+        command->lbaMidExt                    = commandData[8];
+        command->lbaHi                        = commandData[9];
+        command->lbaHiExt                     = commandData[10];
+        command->device                       = commandData[11];
+        command->contentWritten               = commandData[12];
+        command->reserved                     = commandData[13];
+        command->timestampMilliseconds =
+            M_BytesTo4ByteValue(commandData[17], commandData[16], commandData[15], commandData[14]);
+        ++entry->numberOfCommands;
+    }
+    // now set the error data
+    entry->extError.transportSpecific = entryData[90];
+    entry->extError.error             = entryData[91];
+    entry->extError.count             = entryData[92];
+    entry->extError.countExt          = entryData[93];
+    entry->extError.lbaLow            = entryData[94];
+    entry->extError.lbaLowExt         = entryData[95];
+    entry->extError.lbaMid            = entryData[96];
+    entry->extError.lbaMidExt         = entryData[97];
+    entry->extError.lbaHi             = entryData[98];
+    entry->extError.lbaHiExt          = entryData[99];
+    entry->extError.device            = entryData[100];
+    entry->extError.status            = entryData[101];
+    safe_memcpy(entry->extError.extendedErrorInformation, VENDOR_EXTENDED_SMART_CMD_ERR_DATA_LEN, &entryData[102],
+                VENDOR_EXTENDED_SMART_CMD_ERR_DATA_LEN);
+    entry->extError.state         = entryData[121];
+    entry->extError.lifeTimestamp = M_BytesTo2ByteValue(entryData[123], entryData[122]);
+    return true;
+}
+
+static eReturnValues read_ATA_SMART_Error_Log_Iterator_Page(tDevice*                    device,
+                                                            ptrATASMARTErrorLogIterator iterator,
+                                                            uint16_t                    page)
+{
+    if (iterator->pageBuffered && iterator->bufferedPage == page)
+    {
+        return SUCCESS;
+    }
+    iterator->pageBuffered = false;
+    safe_memset(iterator->pageData, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
+    eReturnValues getLog = send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_EXTENDED_COMPREHENSIVE_SMART_ERROR_LOG, page,
+                                                     iterator->pageData, LEGACY_DRIVE_SEC_SIZE, 0);
+    ++iterator->pagesRead;
+    if (getLog == WARN_INVALID_CHECKSUM)
+    {
+        iterator->checksumsValid = false;
+    }
+    else if (getLog != SUCCESS)
+    {
+        return FAILURE;
+    }
+    iterator->pageBuffered = true;
+    iterator->bufferedPage = page;
+    return SUCCESS;
+}
+
+eReturnValues init_ATA_SMART_Error_Log_Iterator(tDevice*                    device,
+                                                ptrATASMARTErrorLogIterator iterator,
+                                                uint16_t                    sinceErrorCount)
+{
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || iterator == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(iterator, sizeof(ataSMARTErrorLogIterator), 0, sizeof(ataSMARTErrorLogIterator));
+    iterator->checksumsValid = true;
+    uint32_t logSize         = UINT32_C(0);
+    if (device->drive_info.drive_type != ATA_DRIVE || !device->drive_info.ata_Options.generalPurposeLoggingSupported ||
+        !is_SMART_Enabled(device) || !is_SMART_Error_Logging_Supported(device) ||
+        SUCCESS != get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_EXTENDED_COMPREHENSIVE_SMART_ERROR_LOG, &logSize, true,
+                                    false) ||
+        logSize < LEGACY_DRIVE_SEC_SIZE)
+    {
+        return NOT_SUPPORTED;
+    }
+    iterator->logPages = C_CAST(uint16_t, M_Min(logSize / LEGACY_DRIVE_SEC_SIZE, UINT16_MAX));
+    // page 0 holds the index of the most recent entry and the device error count
+    eReturnValues ret = read_ATA_SMART_Error_Log_Iterator_Page(device, iterator, 0);
+    if (ret == SUCCESS)
+    {
+        iterator->version          = iterator->pageData[0];
+        iterator->deviceErrorCount = M_BytesTo2ByteValue(iterator->pageData[501], iterator->pageData[500]);
+        uint16_t errorLogIndex     = M_BytesTo2ByteValue(iterator->pageData[3], iterator->pageData[2]);
+        uint32_t logEntries =
+            C_CAST(uint32_t, iterator->logPages) * EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE;
+        // A count lower than sinceErrorCount means the log was cleared, so everything in it is new
+        uint16_t newErrors = iterator->deviceErrorCount;
+        if (sinceErrorCount <= iterator->deviceErrorCount)
+        {
+            newErrors = C_CAST(uint16_t, iterator->deviceErrorCount - sinceErrorCount);
+        }
+        if (errorLogIndex > 0 && errorLogIndex <= logEntries)
+        {
+            iterator->nextIndex        = errorLogIndex;
+            iterator->nextErrorNumber  = iterator->deviceErrorCount;
+            iterator->entriesRemaining = C_CAST(uint16_t, M_Min(newErrors, logEntries));
+        }
+    }
+    iterator->status = ret;
+    return ret;
+}
+
+bool get_Next_ATA_SMART_Error_Log_Entry(tDevice*                    device,
+                                        ptrATASMARTErrorLogIterator iterator,
+                                        SMARTErrorDataStructure*    entry,
+                                        uint16_t*                   errorNumber)
+{
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || iterator == M_NULLPTR || entry == M_NULLPTR)
+    {
+        return false;
+    }
+    RESTORE_NONNULL_COMPARE
+    uint32_t logEntries = C_CAST(uint32_t, iterator->logPages) * EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE;
+    while (iterator->status == SUCCESS && iterator->entriesRemaining > 0)
+    {
+        // The index is 1 based. The log is circular so the next older entry is the one before it, wrapping from the
+        // first entry in the log to the last.
+        uint16_t position = C_CAST(uint16_t, iterator->nextIndex - UINT16_C(1));
+        uint16_t page     = C_CAST(uint16_t, position / EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE);
+        uint32_t offset   = EXT_COMP_SMART_ERROR_LOG_HEADER_SIZE +
+                          (C_CAST(uint32_t, position % EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE) *
+                           EXT_COMP_SMART_ERROR_LOG_ENTRY_SIZE);
+        iterator->status = read_ATA_SMART_Error_Log_Iterator_Page(device, iterator, page);
+        if (iterator->status != SUCCESS)
+        {
+            break;
+        }
+        uint16_t thisErrorNumber = iterator->nextErrorNumber;
+        --iterator->entriesRemaining;
+        --iterator->nextErrorNumber;
+        if (iterator->nextIndex > UINT16_C(1))
+        {
+            --iterator->nextIndex;
+        }
+        else
+        {
+            iterator->nextIndex = C_CAST(uint16_t, logEntries);
+        }
+        if (parse_Ext_Comprehensive_SMART_Error_Entry(&iterator->pageData[offset], entry))
+        {
+            if (errorNumber != M_NULLPTR)
+            {
+                *errorNumber = thisErrorNumber;
+            }
+            return true;
+        }
+        // empty entries are skipped
+    }
+    return false;
+}
+
 // This function will automatically select SMART vs GPL log
 eReturnValues get_ATA_Comprehensive_SMART_Error_Log(tDevice*                      device,
                                                     ptrComprehensiveSMARTErrorLog smartErrorLog,
@@ -7837,221 +7602,42 @@ eReturnValues get_ATA_Comprehensive_SMART_Error_Log(tDevice*
         RESTORE_NONNULL_COMPARE
         if (is_SMART_Enabled(device) && is_SMART_Error_Logging_Supported(device)) // must be enabled to read this page
         {
-            uint32_t compErrLogSize = UINT32_C(0);
-            // now check for GPL summort so we know if we are reading the ext log or not
-            if (device->drive_info.ata_Options.generalPurposeLoggingSupported && !forceSMARTLog &&
-                SUCCESS == get_ATA_Log_Size(device, ATA_LOG_EXTENDED_COMPREHENSIVE_SMART_ERROR_LOG, &compErrLogSize,
-                                            true, false) &&
-                compErrLogSize > 0)
+            uint32_t                 compErrLogSize = UINT32_C(0);
+            eReturnValues            extLogStatus   = NOT_SUPPORTED;
+            ataSMARTErrorLogIterator iterator;
+            // now check for GPL support so we know if we are reading the ext log or not
+            if (device->drive_info.ata_Options.generalPurposeLoggingSupported && !forceSMARTLog)
             {
                 // extended comprehensive SMART error log
-                // We will read each sector of the log as we need it to help with some USB compatibility (and so we
-                // don't read more than we need)
-                DECLARE_ZERO_INIT_ARRAY(uint8_t, errorLog, 512);
-                uint16_t pageNumber = UINT16_C(0);
-                get_ATA_Log_Size(device, ATA_LOG_EXTENDED_COMPREHENSIVE_SMART_ERROR_LOG, &compErrLogSize, true, false);
-                uint16_t maxPage  = C_CAST(uint16_t, compErrLogSize / UINT16_C(512));
-                uint16_t pageIter = UINT16_C(0);
-                if (compErrLogSize > 0)
+                // The iterator reads each page of the log as it is needed to help with some USB compatibility (and so
+                // we don't read more than we need)
+                extLogStatus = init_ATA_SMART_Error_Log_Iterator(device, &iterator, UINT16_C(0));
+            }
+            if (extLogStatus == SUCCESS)
+            {
+                ret                             = SUCCESS;
+                smartErrorLog->version          = iterator.version;
+                smartErrorLog->extLog           = true;
+                smartErrorLog->deviceErrorCount = iterator.deviceErrorCount;
+                while (smartErrorLog->numberOfEntries < SMART_EXT_COMPREHENSIVE_ERRORS_MAX &&
+                       get_Next_ATA_SMART_Error_Log_Entry(
+                           device, &iterator, &smartErrorLog->extSmartError[smartErrorLog->numberOfEntries], M_NULLPTR))
                 {
-                    ret                  = SUCCESS;
-                    eReturnValues getLog = send_ATA_Read_Log_Ext_Cmd(
-                        device, ATA_LOG_EXTENDED_COMPREHENSIVE_SMART_ERROR_LOG, pageNumber, errorLog, 512, 0);
-                    if (getLog == SUCCESS || getLog == WARN_INVALID_CHECKSUM)
-                    {
-                        smartErrorLog->version = errorLog[0];
-                        if (getLog == SUCCESS)
-                        {
-                            smartErrorLog->checksumsValid = true;
-                        }
-                        else
-                        {
-                            smartErrorLog->checksumsValid = false;
-                        }
-                        smartErrorLog->extLog           = true;
-                        smartErrorLog->deviceErrorCount = M_BytesTo2ByteValue(errorLog[501], errorLog[500]);
-                        uint16_t errorLogIndex          = M_BytesTo2ByteValue(errorLog[3], errorLog[2]);
-                        if (errorLogIndex > 0)
-                        {
-                            // get the starting page number
-                            uint8_t pageEntryNumber = errorLogIndex % EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE -
-                                                      1; // which entry on the page (zero indexed)
-                            pageNumber =
-                                errorLogIndex / EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE; // 4 entries per page
-                            while (
-                                smartErrorLog->numberOfEntries < SMART_EXT_COMPREHENSIVE_ERRORS_MAX &&
-                                smartErrorLog->numberOfEntries < smartErrorLog->deviceErrorCount && smartErrorLog->numberOfEntries < (UINT8_C(4) * maxPage) /*make sure we don't go beyond the number of pages the drive actually has*/)
-                            {
-                                while (pageIter <= maxPage)
-                                {
-                                    // first read this page
-                                    safe_memset(errorLog, 512, 0, 512);
-                                    getLog = send_ATA_Read_Log_Ext_Cmd(device,
-                                                                       ATA_LOG_EXTENDED_COMPREHENSIVE_SMART_ERROR_LOG,
-                                                                       pageNumber, errorLog, 512, 0);
-                                    if (getLog == SUCCESS || getLog == WARN_INVALID_CHECKSUM)
-                                    {
-                                        uint8_t pageEntryCounter = UINT8_C(0);
-                                        if (getLog == WARN_INVALID_CHECKSUM)
-                                        {
-                                            smartErrorLog->checksumsValid = false;
-                                        }
-                                        while (pageEntryNumber < EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE && pageEntryCounter < EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE && smartErrorLog->numberOfEntries < (UINT8_C(4) * maxPage)/*make sure we don't go beyond the number of pages the drive actually has*/)//4 entries per page in the ext log
-                                        {
-                                            uint32_t offset = (C_CAST(uint32_t, pageEntryNumber) *
-                                                               EXT_COMP_SMART_ERROR_LOG_ENTRY_SIZE) +
-                                                              EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE;
-                                            --pageEntryNumber; // decrement now before we forget. This is so that we
-                                                               // roll backwards since this log appends. If this rolls
-                                                               // over to UINT8_MAX, we'll break this loop and read
-                                                               // another page.
-                                            // check if the entry is empty
-                                            if (is_Empty(&errorLog[offset], EXT_COMP_SMART_ERROR_LOG_ENTRY_SIZE))
-                                            {
-                                                // restart the loop to find another entry (if any)
-                                                continue;
-                                            }
-                                            // each entry has 5 command data structures to fill in followed by error
-                                            // data
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extDataStructures = true;
-                                            // NOTE: don't memcpy since we aren't packing the structs
-                                            uint32_t commandEntryOffset = offset;
-                                            for (uint8_t commandEntry = UINT8_C(0); commandEntry < 5; ++commandEntry,
-                                                         commandEntryOffset += EXT_COMP_SMART_ERROR_LOG_COMMAND_SIZE)
-                                            {
-                                                if (is_Empty(&errorLog[commandEntryOffset + 0],
-                                                             EXT_COMP_SMART_ERROR_LOG_COMMAND_SIZE))
-                                                {
-                                                    continue;
-                                                }
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .deviceControl = errorLog[commandEntryOffset + 0];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .feature = errorLog[commandEntryOffset + 1];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .featureExt = errorLog[commandEntryOffset + 2];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .count = errorLog[commandEntryOffset + 3];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .countExt = errorLog[commandEntryOffset + 4];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .lbaLow = errorLog[commandEntryOffset + 5];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .lbaLowExt = errorLog[commandEntryOffset + 6];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .lbaMid = errorLog[commandEntryOffset + 7];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .lbaMidExt = errorLog[commandEntryOffset + 8];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .lbaHi = errorLog[commandEntryOffset + 9];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .lbaHiExt = errorLog[commandEntryOffset + 10];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .device = errorLog[commandEntryOffset + 11];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .contentWritten = errorLog[commandEntryOffset + 12];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .reserved = errorLog[commandEntryOffset + 13];
-                                                smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                    .extCommand[commandEntry]
-                                                    .timestampMilliseconds =
-                                                    M_BytesTo4ByteValue(errorLog[commandEntryOffset + 17],
-                                                                        errorLog[commandEntryOffset + 16],
-                                                                        errorLog[commandEntryOffset + 15],
-                                                                        errorLog[commandEntryOffset + 14]);
-                                                ++(smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                       .numberOfCommands);
-                                            }
-                                            // now set the error data
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.transportSpecific = errorLog[offset + 90];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.error = errorLog[offset + 91];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.count = errorLog[offset + 92];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.countExt = errorLog[offset + 93];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.lbaLow = errorLog[offset + 94];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.lbaLowExt = errorLog[offset + 95];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.lbaMid = errorLog[offset + 96];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.lbaMidExt = errorLog[offset + 97];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.lbaHi = errorLog[offset + 98];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.lbaHiExt = errorLog[offset + 99];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.device = errorLog[offset + 100];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.status = errorLog[offset + 101];
-                                            safe_memcpy(smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                            .extError.extendedErrorInformation,
-                                                        VENDOR_EXTENDED_SMART_CMD_ERR_DATA_LEN, &errorLog[offset + 102],
-                                                        VENDOR_EXTENDED_SMART_CMD_ERR_DATA_LEN);
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.state = errorLog[offset + 121];
-                                            smartErrorLog->extSmartError[smartErrorLog->numberOfEntries]
-                                                .extError.lifeTimestamp =
-                                                M_BytesTo2ByteValue(errorLog[offset + 123], errorLog[offset + 122]);
-                                            ++(smartErrorLog->numberOfEntries);
-                                            ++pageEntryCounter;
-                                        }
-                                        // reset the pageEntry number to 4 for next page (start at the end and work
-                                        // backwards)
-                                        pageEntryNumber = EXT_COMP_SMART_ERROR_LOG_MAX_ENTRIES_PER_PAGE - 1;
-                                    }
-                                    else
-                                    {
-                                        // break out of the loop!
-                                    }
-                                    ++pageIter;
-                                    if (pageNumber > 0)
-                                    {
-                                        --pageNumber; // go to the previous page of the log to read entries in order
-                                    }
-                                    else
-                                    {
-                                        pageNumber = maxPage - 1; // minus 1 because zero indexed
-                                    }
-                                }
-                            }
-                        }
-                        else
-                        {
-                            smartErrorLog->numberOfEntries = 0;
-                            ret                            = SUCCESS;
-                        }
-                    }
-                    else
-                    {
-                        ret = FAILURE;
-                    }
+                    ++(smartErrorLog->numberOfEntries);
                 }
+                smartErrorLog->checksumsValid = iterator.checksumsValid;
+            }
+            else if (extLogStatus != NOT_SUPPORTED)
+            {
+                ret = FAILURE;
             }
-            else // GPL log was not available or did not read correctly.
+            else // GPL log was not available
             {
                 // comprehensive SMART error log
                 // read the first sector to get index and device error count. Will read the full thing if those are
                 // non-zero
-                get_ATA_Log_Size(device, ATA_LOG_COMPREHENSIVE_SMART_ERROR_LOG, &compErrLogSize, false, true);
+                get_ATA_Log_Size(device, M_NULLPTR, ATA_LOG_COMPREHENSIVE_SMART_ERROR_LOG, &compErrLogSize, false,
+                                 true);
                 if (compErrLogSize > 0)
                 {
                     ret               = SUCCESS;
@@ -0,0 +1,846 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file structured_output.c
+// \brief This file defines the functions for writing FARM, device statistics and SMART data as JSON Lines or CSV.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "error_translation.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "secure_file.h"
+#include "string_utils.h"
+#include "type_conversion.h"
+
+#include "structured_output.h"
+
+#include <stddef.h> //offsetof
+
+#define STRUCTURED_OUTPUT_VALUE_LENGTH (40)
+
+static void write_Structured_Buffer(ptrStructuredOutput output)
+{
+    if (output->used > SIZE_T_C(0) && !output->writeError)
+    {
+        if (output->file != M_NULLPTR)
+        {
+            if (SEC_FILE_SUCCESS != secure_Write_File(output->file, output->buffer, STRUCTURED_OUTPUT_BUFFER_LENGTH,
+                                                      sizeof(char), output->used, M_NULLPTR))
+            {
+                output->writeError = true;
+            }
+        }
+        else if (fwrite(output->buffer, sizeof(char), output->used, stdout) != output->used)
+        {
+            output->writeError = true;
+        }
+    }
+    output->used = SIZE_T_C(0);
+}
+
+static void append_Structured_Text(ptrStructuredOutput output, const char* text, size_t length)
+{
+    while (length > SIZE_T_C(0))
+    {
+        if (output->used == STRUCTURED_OUTPUT_BUFFER_LENGTH)
+        {
+            write_Structured_Buffer(output);
+        }
+        size_t copyLength = M_Min(length, STRUCTURED_OUTPUT_BUFFER_LENGTH - output->used);
+        safe_memcpy(&output->buffer[output->used], STRUCTURED_OUTPUT_BUFFER_LENGTH - output->used, text, copyLength);
+        output->used += copyLength;
+        text += copyLength;
+        length -= copyLength;
+    }
+}
+
+static M_INLINE void append_Structured_Char(ptrStructuredOutput output, char character)
+{
+    append_Structured_Text(output, &character, SIZE_T_C(1));
+}
+
+// JSON strings are always quoted. CSV fields are only quoted when they contain a separator, quote or line break.
+static void append_Structured_String(ptrStructuredOutput output, const char* text)
+{
+    if (output->format == STRUCTURED_OUTPUT_JSON_LINES)
+    {
+        append_Structured_Char(output, '"');
+        for (const char* iter = text; *iter != '\0'; ++iter)
+        {
+            if (*iter == '"' || *iter == '\\')
+            {
+                append_Structured_Char(output, '\\');
+                append_Structured_Char(output, *iter);
+            }
+            else if (M_STATIC_CAST(unsigned char, *iter) < 0x20)
+            {
+                DECLARE_ZERO_INIT_ARRAY(char, escaped, 8);
+                snprintf_err_handle(escaped, 8, "\\u%04x", M_STATIC_CAST(unsigned int, *iter));
+                append_Structured_Text(output, escaped, safe_strlen(escaped));
+            }
+            else
+            {
+                append_Structured_Char(output, *iter);
+            }
+        }
+        append_Structured_Char(output, '"');
+    }
+    else
+    {
+        bool quote = strpbrk(text, ",\"\r\n") != M_NULLPTR;
+        if (quote)
+        {
+            append_Structured_Char(output, '"');
+        }
+        for (const char* iter = text; *iter != '\0'; ++iter)
+        {
+            if (*iter == '"')
+            {
+                append_Structured_Char(output, '"');
+            }
+            append_Structured_Char(output, *iter);
+        }
+        if (quote)
+        {
+            append_Structured_Char(output, '"');
+        }
+    }
+}
+
+static void begin_Structured_Record(ptrStructuredOutput output, const char* source, const char* name, int32_t index)
+{
+    if (output->format == STRUCTURED_OUTPUT_JSON_LINES)
+    {
+        append_Structured_Text(output, "{\"device\":", SIZE_T_C(10));
+        append_Structured_String(output, output->deviceID);
+        append_Structured_Text(output, ",\"source\":", SIZE_T_C(10));
+        append_Structured_String(output, source);
+        append_Structured_Text(output, ",\"name\":", SIZE_T_C(8));
+        append_Structured_String(output, name);
+        if (index >= 0)
+        {
+            DECLARE_ZERO_INIT_ARRAY(char, indexString, STRUCTURED_OUTPUT_VALUE_LENGTH);
+            snprintf_err_handle(indexString, STRUCTURED_OUTPUT_VALUE_LENGTH, ",\"index\":%" PRId32, index);
+            append_Structured_Text(output, indexString, safe_strlen(indexString));
+        }
+        append_Structured_Text(output, ",\"value\":", SIZE_T_C(9));
+    }
+    else
+    {
+        append_Structured_String(output, output->deviceID);
+        append_Structured_Char(output, ',');
+        append_Structured_String(output, source);
+        append_Structured_Char(output, ',');
+        append_Structured_String(output, name);
+        append_Structured_Char(output, ',');
+        if (index >= 0)
+        {
+            DECLARE_ZERO_INIT_ARRAY(char, indexString, STRUCTURED_OUTPUT_VALUE_LENGTH);
+            snprintf_err_handle(indexString, STRUCTURED_OUTPUT_VALUE_LENGTH, "%" PRId32, index);
+            append_Structured_Text(output, indexString, safe_strlen(indexString));
+        }
+        append_Structured_Char(output, ',');
+    }
+}
+
+static void end_Structured_Record(ptrStructuredOutput output, const char* value)
+{
+    append_Structured_Text(output, value, safe_strlen(value));
+    if (output->format == STRUCTURED_OUTPUT_JSON_LINES)
+    {
+        append_Structured_Char(output, '}');
+    }
+    append_Structured_Char(output, '\n');
+    ++output->recordsWritten;
+}
+
+void init_Structured_Output(ptrStructuredOutput     output,
+                            eStructuredOutputFormat format,
+                            secureFileInfo*         file,
+                            const char*             deviceID)
+{
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(output, sizeof(structuredOutput), 0, sizeof(structuredOutput));
+    output->format = format;
+    output->file   = file;
+    set_Structured_Output_Device(output, deviceID);
+}
+
+void set_Structured_Output_Device(ptrStructuredOutput output, const char* deviceID)
+{
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    safe_memset(output->deviceID, SERIAL_NUM_LEN + 1, 0, SERIAL_NUM_LEN + 1);
+    if (deviceID != M_NULLPTR)
+    {
+        snprintf_err_handle(output->deviceID, SERIAL_NUM_LEN + 1, "%s", deviceID);
+    }
+}
+
+void write_Structured_Output_Header(ptrStructuredOutput output)
+{
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (output->format == STRUCTURED_OUTPUT_CSV)
+    {
+        append_Structured_Text(output, "device,source,name,index,value\n", SIZE_T_C(31));
+    }
+}
+
+void write_Structured_Record_Uint64(ptrStructuredOutput output,
+                                    const char*         source,
+                                    const char*         name,
+                                    int32_t             index,
+                                    uint64_t            value)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, valueString, STRUCTURED_OUTPUT_VALUE_LENGTH);
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR || source == M_NULLPTR || name == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    snprintf_err_handle(valueString, STRUCTURED_OUTPUT_VALUE_LENGTH, "%" PRIu64, value);
+    begin_Structured_Record(output, source, name, index);
+    end_Structured_Record(output, valueString);
+}
+
+void write_Structured_Record_Int64(ptrStructuredOutput output,
+                                   const char*         source,
+                                   const char*         name,
+                                   int32_t             index,
+                                   int64_t             value)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, valueString, STRUCTURED_OUTPUT_VALUE_LENGTH);
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR || source == M_NULLPTR || name == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    snprintf_err_handle(valueString, STRUCTURED_OUTPUT_VALUE_LENGTH, "%" PRId64, value);
+    begin_Structured_Record(output, source, name, index);
+    end_Structured_Record(output, valueString);
+}
+
+void write_Structured_Record_Double(ptrStructuredOutput output,
+                                    const char*         source,
+                                    const char*         name,
+                                    int32_t             index,
+                                    double              value)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, valueString, STRUCTURED_OUTPUT_VALUE_LENGTH);
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR || source == M_NULLPTR || name == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    snprintf_err_handle(valueString, STRUCTURED_OUTPUT_VALUE_LENGTH, "%.15g", value);
+    begin_Structured_Record(output, source, name, index);
+    end_Structured_Record(output, valueString);
+}
+
+void write_Structured_Record_Uint128(ptrStructuredOutput output,
+                                     const char*         source,
+                                     const char*         name,
+                                     int32_t             index,
+                                     const uint8_t       value[16])
+{
+    uint64_t lower = UINT64_C(0);
+    uint64_t upper = UINT64_C(0);
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR || source == M_NULLPTR || name == M_NULLPTR || value == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    lower = M_BytesTo8ByteValue(value[7], value[6], value[5], value[4], value[3], value[2], value[1], value[0]);
+    upper = M_BytesTo8ByteValue(value[15], value[14], value[13], value[12], value[11], value[10], value[9], value[8]);
+    if (upper == UINT64_C(0))
+    {
+        write_Structured_Record_Uint64(output, source, name, index, lower);
+    }
+    else
+    {
+        // Same upper-then-lower hex layout used for a WWN with its extension. JSON needs this quoted.
+        DECLARE_ZERO_INIT_ARRAY(char, valueString, STRUCTURED_OUTPUT_VALUE_LENGTH);
+        snprintf_err_handle(valueString, STRUCTURED_OUTPUT_VALUE_LENGTH, "0x%016" PRIX64 "%016" PRIX64, upper, lower);
+        begin_Structured_Record(output, source, name, index);
+        if (output->format == STRUCTURED_OUTPUT_JSON_LINES)
+        {
+            DECLARE_ZERO_INIT_ARRAY(char, quotedString, STRUCTURED_OUTPUT_VALUE_LENGTH);
+            snprintf_err_handle(quotedString, STRUCTURED_OUTPUT_VALUE_LENGTH, "\"%s\"", valueString);
+            end_Structured_Record(output, quotedString);
+        }
+        else
+        {
+            end_Structured_Record(output, valueString);
+        }
+    }
+}
+
+eReturnValues flush_Structured_Output(ptrStructuredOutput output)
+{
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    write_Structured_Buffer(output);
+    if (output->file == M_NULLPTR)
+    {
+        fflush(stdout);
+    }
+    else if (!output->writeError && SEC_FILE_SUCCESS != secure_Flush_File(output->file))
+    {
+        output->writeError = true;
+    }
+    return output->writeError ? ERROR_WRITING_FILE : SUCCESS;
+}
+
+static const char* farmStructuredPageNames[FARM_PAGE_RELIABILITY_STATS + 1] = {
+    "header", "driveInfo", "workload", "errorStatistics", "environmentStatistics", "reliabilityStatistics"};
+
+typedef struct s_farmSignedRange
+{
+    eFarmPage page;
+    size_t    offset; // offset of the first signed field in the page structure
+    size_t    length; // bytes of consecutive signed fields
+} farmSignedRange;
+
+// Fields the FARM text output prints as signed values
+static const farmSignedRange farmSignedRanges[] = {
+    {FARM_PAGE_ENVIRONMENT_STATS, offsetof(farmEnvironmentStatistics, currentTemperature),
+     offsetof(farmEnvironmentStatistics, timeOverTemp) - offsetof(farmEnvironmentStatistics, currentTemperature)},
+    {FARM_PAGE_ENVIRONMENT_STATS, offsetof(farmEnvironmentStatistics, currentMotorPowerFromMostRecentSMARTSummaryFrame),
+     sizeof(uint64_t)},
+    {FARM_PAGE_RELIABILITY_STATS, offsetof(farmReliabilityStatistics, currentH2SATasymmetryByHeadTZAvg),
+     FARM_MAX_HEADS * sizeof(uint64_t)},
+    {FARM_PAGE_RELIABILITY_STATS, offsetof(farmReliabilityStatistics, appliedFlyHeightClearanceDeltaByHead),
+     FARM_MAX_HEADS * FARM_DIAMETERS * sizeof(uint64_t)},
+};
+
+static bool is_FARM_Signed_Field(uint8_t page, size_t offset)
+{
+    for (size_t rangeIter = SIZE_T_C(0); rangeIter < SIZE_OF_STACK_ARRAY(farmSignedRanges); ++rangeIter)
+    {
+        const farmSignedRange* range = &farmSignedRanges[rangeIter];
+        if (C_CAST(uint8_t, range->page) == page && offset >= range->offset && offset < range->offset + range->length)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void write_FARM_Data_Structured(ptrStructuredOutput output, const farmLogData* farmdata)
+{
+    DISABLE_NONNULL_COMPARE
+    if (output == M_NULLPTR || farmdata == M_NULLPTR)
+    {
+        return;
+    }
+    RESTORE_NONNULL_COMPARE
+    const uint8_t* pages = M_REINTERPRET_CAST(const uint8_t*, farmdata);
+    for (uint8_t pageIter = FARM_PAGE_HEADER; pageIter <= FARM_PAGE_RELIABILITY_STATS; ++pageIter)
+    {
+        for (uint32_t qwordIter = UINT32_C(0); qwordIter < FARM_PAGE_LEN / sizeof(uint64_t); ++qwordIter)
+        {
+            uint64_t field = UINT64_C(0);
+            safe_memcpy(&field, sizeof(uint64_t),
+                        &pages[(C_CAST(size_t, pageIter) * FARM_PAGE_LEN) + (qwordIter * sizeof(uint64_t))],
+                        sizeof(uint64_t));
+            if ((get_Farm_Status_Byte(field) & (FARM_FIELD_SUPPORTED_BIT | FARM_FIELD_VALID_BIT)) ==
+                (FARM_FIELD_SUPPORTED_BIT | FARM_FIELD_VALID_BIT))
+            {
+                if (is_FARM_Signed_Field(pageIter, qwordIter * sizeof(uint64_t)))
+                {
+                    write_Structured_Record_Int64(output, "farm", farmStructuredPageNames[pageIter],
+                                                  C_CAST(int32_t, qwordIter), get_Farm_Signed_Qword_Data(field));
+                }
+                else
+                {
+                    write_Structured_Record_Uint64(output, "farm", farmStructuredPageNames[pageIter],
+                                                   C_CAST(int32_t, qwordIter), get_Farm_Qword_Data(field));
+                }
+            }
+        }
+    }
+}
+
+#define SATA_STATISTIC_FIELD(member)   {#member, offsetof(sataDeviceStatistics, member), false}
+#define SAS_STATISTIC_FIELD(member)    {#member, offsetof(sasDeviceStatitics, member), false}
+#define SATA_TEMPERATURE_FIELD(member) {#member, offsetof(sataDeviceStatistics, member), true}
+#define SAS_TEMPERATURE_FIELD(member)  {#member, offsetof(sasDeviceStatitics, member), true}
+
+typedef struct s_structuredStatisticField
+{
+    const char* name;
+    size_t      offset;
+    bool        isTemperature; // value is a signed byte in degrees Celsius
+} structuredStatisticField;
+
+static const structuredStatisticField sataStatisticFields[] = {
+    SATA_STATISTIC_FIELD(lifetimePoweronResets),
+    SATA_STATISTIC_FIELD(powerOnHours),
+    SATA_STATISTIC_FIELD(logicalSectorsWritten),
+    SATA_STATISTIC_FIELD(numberOfWriteCommands),
+    SATA_STATISTIC_FIELD(logicalSectorsRead),
+    SATA_STATISTIC_FIELD(numberOfReadCommands),
+    SATA_STATISTIC_FIELD(dateAndTimeTimestamp),
+    SATA_STATISTIC_FIELD(pendingErrorCount),
+    SATA_STATISTIC_FIELD(workloadUtilization),
+    SATA_STATISTIC_FIELD(utilizationUsageRate),
+    SATA_STATISTIC_FIELD(resourceAvailability),
+    SATA_STATISTIC_FIELD(randomWriteResourcesUsed),
+    SATA_STATISTIC_FIELD(numberOfFreeFallEventsDetected),
+    SATA_STATISTIC_FIELD(overlimitShockEvents),
+    SATA_STATISTIC_FIELD(spindleMotorPoweronHours),
+    SATA_STATISTIC_FIELD(headFlyingHours),
+    SATA_STATISTIC_FIELD(headLoadEvents),
+    SATA_STATISTIC_FIELD(numberOfReallocatedLogicalSectors),
+    SATA_STATISTIC_FIELD(readRecoveryAttempts),
+    SATA_STATISTIC_FIELD(numberOfMechanicalStartFailures),
+    SATA_STATISTIC_FIELD(numberOfReallocationCandidateLogicalSectors),
+    SATA_STATISTIC_FIELD(numberOfHighPriorityUnloadEvents),
+    SATA_STATISTIC_FIELD(numberOfReportedUncorrectableErrors),
+    SATA_STATISTIC_FIELD(numberOfResetsBetweenCommandAcceptanceAndCommandCompletion),
+    SATA_STATISTIC_FIELD(physicalElementStatusChanged),
+    SATA_TEMPERATURE_FIELD(currentTemperature),
+    SATA_TEMPERATURE_FIELD(averageShortTermTemperature),
+    SATA_TEMPERATURE_FIELD(averageLongTermTemperature),
+    SATA_TEMPERATURE_FIELD(highestTemperature),
+    SATA_TEMPERATURE_FIELD(lowestTemperature),
+    SATA_TEMPERATURE_FIELD(highestAverageShortTermTemperature),
+    SATA_TEMPERATURE_FIELD(lowestAverageShortTermTemperature),
+    SATA_TEMPERATURE_FIELD(highestAverageLongTermTemperature),
+    SATA_TEMPERATURE_FIELD(lowestAverageLongTermTemperature),
+    SATA_STATISTIC_FIELD(timeInOverTemperature),
+    SATA_TEMPERATURE_FIELD(specifiedMaximumOperatingTemperature),
+    SATA_STATISTIC_FIELD(timeInUnderTemperature),
+    SATA_TEMPERATURE_FIELD(specifiedMinimumOperatingTemperature),
+    SATA_STATISTIC_FIELD(numberOfHardwareResets),
+    SATA_STATISTIC_FIELD(numberOfASREvents),
+    SATA_STATISTIC_FIELD(numberOfInterfaceCRCErrors),
+    SATA_STATISTIC_FIELD(percentageUsedIndicator),
+    SATA_STATISTIC_FIELD(maximumOpenZones),
+    SATA_STATISTIC_FIELD(maximumExplicitlyOpenZones),
+    SATA_STATISTIC_FIELD(maximumImplicitlyOpenZones),
+    SATA_STATISTIC_FIELD(minimumEmptyZones),
+    SATA_STATISTIC_FIELD(maximumNonSequentialZones),
+    SATA_STATISTIC_FIELD(zonesEmptied),
+    SATA_STATISTIC_FIELD(suboptimalWriteCommands),
+    SATA_STATISTIC_FIELD(commandsExceedingOptimalLimit),
+    SATA_STATISTIC_FIELD(failedExplicitOpens),
+    SATA_STATISTIC_FIELD(readRuleViolations),
+    SATA_STATISTIC_FIELD(writeRuleViolations),
+    SATA_STATISTIC_FIELD(maximumImplicitOpenSequentialOrBeforeRequiredZones),
+    SATA_STATISTIC_FIELD(lowestAchievableCommandDuration),
+};
+
+static const structuredStatisticField sasStatisticFields[] = {
+    SAS_STATISTIC_FIELD(writeErrorsCorrectedWithoutSubstantialDelay),
+    SAS_STATISTIC_FIELD(writeErrorsCorrectedWithPossibleDelays),
+    SAS_STATISTIC_FIELD(writeTotalReWrites),
+    SAS_STATISTIC_FIELD(writeErrorsCorrected),
+    SAS_STATISTIC_FIELD(writeTotalTimeCorrectionAlgorithmProcessed),
+    SAS_STATISTIC_FIELD(writeTotalBytesProcessed),
+    SAS_STATISTIC_FIELD(writeTotalUncorrectedErrors),
+    SAS_STATISTIC_FIELD(readErrorsCorrectedWithoutSubstantialDelay),
+    SAS_STATISTIC_FIELD(readErrorsCorrectedWithPossibleDelays),
+    SAS_STATISTIC_FIELD(readTotalRereads),
+    SAS_STATISTIC_FIELD(readErrorsCorrected),
+    SAS_STATISTIC_FIELD(readTotalTimeCorrectionAlgorithmProcessed),
+    SAS_STATISTIC_FIELD(readTotalBytesProcessed),
+    SAS_STATISTIC_FIELD(readTotalUncorrectedErrors),
+    SAS_STATISTIC_FIELD(readReverseErrorsCorrectedWithoutSubstantialDelay),
+    SAS_STATISTIC_FIELD(readReverseErrorsCorrectedWithPossibleDelays),
+    SAS_STATISTIC_FIELD(readReverseTotalReReads),
+    SAS_STATISTIC_FIELD(readReverseErrorsCorrected),
+    SAS_STATISTIC_FIELD(readReverseTotalTimeCorrectionAlgorithmProcessed),
+    SAS_STATISTIC_FIELD(readReverseTotalBytesProcessed),
+    SAS_STATISTIC_FIELD(readReverseTotalUncorrectedErrors),
+    SAS_STATISTIC_FIELD(verifyErrorsCorrectedWithoutSubstantialDelay),
+    SAS_STATISTIC_FIELD(verifyErrorsCorrectedWithPossibleDelays),
+    SAS_STATISTIC_FIELD(verifyTotalReVerifies),
+    SAS_STATISTIC_FIELD(verifyErrorsCorrected),
+    SAS_STATISTIC_FIELD(verifyTotalTimeCorrectionAlgorithmProcessed),
+    SAS_STATISTIC_FIELD(verifyTotalBytesProcessed),
+    SAS_STATISTIC_FIELD(verifyTotalUncorrectedErrors),
+    SAS_STATISTIC_FIELD(nonMediumErrorCount),
+    SAS_STATISTIC_FIELD(grownDefectsDuringCertification),
+    SAS_STATISTIC_FIELD(totalBlocksReassignedDuringFormat),
+    SAS_STATISTIC_FIELD(totalNewBlocksReassigned),
+    SAS_STATISTIC_FIELD(powerOnMinutesSinceFormat),
+    SAS_STATISTIC_FIELD(availableLBAMappingresourceCount),
+    SAS_STATISTIC_FIELD(usedLBAMappingResourceCount),
+    SAS_STATISTIC_FIELD(availableProvisioningResourcePercentage),
+    SAS_STATISTIC_FIELD(deduplicatedLBAResourceCount),
+    SAS_STATISTIC_FIELD(compressedLBAResourceCount),
+    SAS_STATISTIC_FIELD(totalEfficiencyLBAResourceCount),
+    SAS_TEMPERATURE_FIELD(temperature),
+    SAS_TEMPERATURE_FIELD(referenceTemperature),
+    SAS_TEMPERATURE_FIELD(currentTemperature),
+    SAS_TEMPERATURE_FIELD(lifetimeMaximumTemperature),
+    SAS_TEMPERATURE_FIELD(lifetimeMinimumTemperature),
+    SAS_TEMPERATURE_FIELD(maximumTemperatureSincePowerOn),
+    SAS_TEMPERATURE_FIELD(minimumTemperatureSincePowerOn),
+    SAS_TEMPERATURE_FIELD(maximumOtherTemperature),
+    SAS_TEMPERATURE_FIELD(minimumOtherTemperature),
+    SAS_STATISTIC_FIELD(currentRelativeHumidity),
+    SAS_STATISTIC_FIELD(lifetimeMaximumRelativeHumidity),
+    SAS_STATISTIC_FIELD(lifetimeMinumumRelativeHumidity),
+    SAS_STATISTIC_FIELD(maximumRelativeHumiditySincePoweron),
+    SAS_STATISTIC_FIELD(minimumRelativeHumiditySincePoweron),
+    SAS_STATISTIC_FIELD(maximumOtherRelativeHumidity),
+    SAS_STATISTIC_FIELD(minimumOtherRelativeHumidity),
+    SAS_TEMPERATURE_FIELD(highCriticalTemperatureLimitTrigger),
+    SAS_TEMPERATURE_FIELD(highCriticalTemperatureLimitReset),
+    SAS_TEMPERATURE_FIELD(lowCriticalTemperatureLimitReset),
+    SAS_TEMPERATURE_FIELD(lowCriticalTemperatureLimitTrigger),
+    SAS_TEMPERATURE_FIELD(highOperatingTemperatureLimitTrigger),
+    SAS_TEMPERATURE_FIELD(highOperatingTemperatureLimitReset),
+    SAS_TEMPERATURE_FIELD(lowOperatingTemperatureLimitReset),
+    SAS_TEMPERATURE_FIELD(lowOperatingTemperatureLimitTrigger),
+    SAS_STATISTIC_FIELD(highCriticalHumidityLimitTrigger),
+    SAS_STATISTIC_FIELD(highCriticalHumidityLimitReset),
+    SAS_STATISTIC_FIELD(lowCriticalHumidityLimitReset),
+    SAS_STATISTIC_FIELD(lowCriticalHumidityLimitTrigger),
+    SAS_STATISTIC_FIELD(highOperatingHumidityLimitTrigger),
+    SAS_STATISTIC_FIELD(highOperatingHumidityLimitReset),
+    SAS_STATISTIC_FIELD(lowOperatingHumidityLimitReset),
+    SAS_STATISTIC_FIELD(lowOperatingHumidityLimitTrigger),
+    SAS_STATISTIC_FIELD(dateOfManufacture),
+    SAS_STATISTIC_FIELD(accountingDate),
+    SAS_STATISTIC_FIELD(specifiedCycleCountOverDeviceLifetime),
+    SAS_STATISTIC_FIELD(accumulatedStartStopCycles),
+    SAS_STATISTIC_FIELD(specifiedLoadUnloadCountOverDeviceLifetime),
+    SAS_STATISTIC_FIELD(accumulatedLoadUnloadCycles),
+    SAS_STATISTIC_FIELD(workloadUtilization),
+    SAS_STATISTIC_FIELD(utilizationUsageRateBasedOnDateAndTime),
+    SAS_STATISTIC_FIELD(percentUsedEndurance),
+    SAS_STATISTIC_FIELD(accumulatedPowerOnMinutes),
+    SAS_STATISTIC_FIELD(numberOfBackgroundScansPerformed),
+    SAS_STATISTIC_FIELD(numberOfBackgroundMediaScansPerformed),
+    SAS_STATISTIC_FIELD(pendingDefectCount),
+    SAS_STATISTIC_FIELD(lpsMisalignmentCount),
+    SAS_STATISTIC_FIELD(remainingNonvolatileTime),
+    SAS_STATISTIC_FIELD(maximumNonvolatileTime),
+    SAS_STATISTIC_FIELD(numberOfReadCommands),
+    SAS_STATISTIC_FIELD(numberOfWriteCommands),
+    SAS_STATISTIC_FIELD(numberOfLogicalBlocksReceived),
+    SAS_STATISTIC_FIELD(numberOfLogicalBlocksTransmitted),
+    SAS_STATISTIC_FIELD(readCommandProcessingIntervals),
+    SAS_STATISTIC_FIELD(writeCommandProcessingIntervals),
+    SAS_STATISTIC_FIELD(weightedNumberOfReadCommandsPlusWriteCommands),
+    SAS_STATISTIC_FIELD(weightedReadCommandProcessingPlusWriteCommandProcessing),
+    SAS_STATISTIC_FIELD(idleTimeIntervals),
+    SAS_STATISTIC_FIELD(timeIntervalDescriptor),
+    SAS_STATISTIC_FIELD(numberOfReadFUACommands),
+    SAS_STATISTIC_FIELD(numberOfWriteFUACommands),
+    SAS_STATISTIC_FIELD(numberOfReadFUANVCommands),
+    SAS_STATISTIC_FIELD(numberOfWriteFUANVCommands),
+    SAS_STATISTIC_FIELD(readFUACommandProcessingIntervals),
+    SAS_STATISTIC_FIELD(writeFUACommandProcessingIntervals),
+    SAS_STATISTIC_FIELD(readFUANVCommandProcessingIntervals),
+    SAS_STATISTIC_FIELD(writeFUANVCommandProcessingIntervals),
+    SAS_STATISTIC_FIELD(readCacheMemoryHits),
+    SAS_STATISTIC_FIELD(readsToCacheMemory),
+    SAS_STATISTIC_FIELD(writeCacheMemoryHits),
+    SAS_STATISTIC_FIELD(writesFromCacheMemory),
+    SAS_STATISTIC_FIELD(timeFromLastHardReset),
+    SAS_STATISTIC_FIELD(cacheTimeInterval),
+    SAS_STATISTIC_FIELD(dateAndTimeTimestamp),
+    SAS_STATISTIC_FIELD(maximumOpenZones),
+    SAS_STATISTIC_FIELD(maximumExplicitlyOpenZones),
+    SAS_STATISTIC_FIELD(maximumImplicitlyOpenZones),
+    SAS_STATISTIC_FIELD(minimumEmptyZones),
+    SAS_STATISTIC_FIELD(maximumNonSequentialZones),
+    SAS_STATISTIC_FIELD(zonesEmptied),
+    SAS_STATISTIC_FIELD(suboptimalWriteCommands),
+    SAS_STATISTIC_FIELD(commandsExceedingOptimalLimit),
+    SAS_STATISTIC_FIELD(failedExplicitOpens),
+    SAS_STATISTIC_FIELD(readRuleViolations),
+    SAS_STATISTIC_FIELD(writeRuleViolations),
+    SAS_STATISTIC_FIELD(maxImplicitlyOpenSeqOrBeforeReqZones),
+    SAS_STATISTIC_FIELD(grownDefects),
+    SAS_STATISTIC_FIELD(primaryDefects),
+    SAS_STATISTIC_FIELD(transitionsToActive),
+    SAS_STATISTIC_FIELD(transitionsToIdleA),
+    SAS_STATISTIC_FIELD(transitionsToIdleB),
+    SAS_STATISTIC_FIELD(transitionsToIdleC),
+    SAS_STATISTIC_FIELD(transitionsToStandbyZ),
+    SAS_STATISTIC_FIELD(transitionsToStandbyY),
+};
+
+static void write_Structured_Statistic(ptrStructuredOutput output,
+                                       const char*         name,
+                                       int32_t             index,
+                                       const statistic*    stat,
+                                       bool                isTemperature)
+{
+    if (stat->isSupported && stat->isValueValid)
+    {
+        if (isTemperature)
+        {
+            // Temperatures are reported as a signed byte. Same conversion print_DeviceStatistics uses.
+            write_Structured_Record_Int64(output, "devstat", name, index,
+                                          C_CAST(int64_t, C_CAST(int8_t, stat->statisticValue)));
+        }
+        else
+        {
+            write_Structured_Record_Uint64(output, "devstat", name, index, stat->statisticValue);
+        }
+    }
+}
+
+static void write_Structured_Statistic_Table(ptrStructuredOutput             output,
+                                             const void*                     statistics,
+                                             const structuredStatisticField* fields,
+                                             size_t                          numberOfFields)
+{
+    for (size_t fieldIter = SIZE_T_C(0); fieldIter < numberOfFields; ++fieldIter)
+    {
+        const uint8_t* statBytes = M_REINTERPRET_CAST(const uint8_t*, statistics) + fields[fieldIter].offset;
+        write_Structured_Statistic(output, fields[fieldIter].name, STRUCTURED_OUTPUT_NO_INDEX,
+                                   M_REINTERPRET_CAST(const statistic*, statBytes), fields[fieldIter].isTemperature);
+    }
+}
+
+static void write_Structured_CDL_Group(ptrStructuredOutput      output,
+                                       uint8_t                  range,
+                                       const char*              groupName,
+                                       const cdlStatisticGroup* group)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, readName, STRUCTURED_OUTPUT_VALUE_LENGTH);
+    DECLARE_ZERO_INIT_ARRAY(char, writeName, STRUCTURED_OUTPUT_VALUE_LENGTH);
+    snprintf_err_handle(readName, STRUCTURED_OUTPUT_VALUE_LENGTH, "cdlRange%" PRIu8 ".%s.readPolicy", range,
+                        groupName);
+    snprintf_err_handle(writeName, STRUCTURED_OUTPUT_VALUE_LENGTH, "cdlRange%" PRIu8 ".%s.writePolicy", range,
+                        groupName);
+    for (uint8_t policyIter = UINT8_C(0); policyIter < MAX_CDL_RW_POLICIES; ++policyIter)
+    {
+        // policies are numbered from 1
+        write_Structured_Statistic(output, readName, policyIter + 1, &group->readPolicy[policyIter], false);
+        write_Structured_Statistic(output, writeName, policyIter + 1, &group->writePolicy[policyIter], false);
+    }
+}
+
+static void write_Structured_SATA_Statistics(ptrStructuredOutput output, const sataDeviceStatistics* sataStats)
+{
+    write_Structured_Statistic_Table(output, sataStats, sataStatisticFields,
+                                     sizeof(sataStatisticFields) / sizeof(sataStatisticFields[0]));
+    if (sataStats->cdlStatisticsSupported)
+    {
+        for (uint8_t rangeIter = UINT8_C(0);
+             rangeIter < sataStats->cdlStatisticRanges && rangeIter < MAX_CDL_STATISTIC_RANGES; ++rangeIter)
+        {
+            write_Structured_CDL_Group(output, rangeIter, "groupA", &sataStats->cdlRange[rangeIter].groupA);
+            write_Structured_CDL_Group(output, rangeIter, "groupB", &sataStats->cdlRange[rangeIter].groupB);
+        }
+    }
+    for (uint8_t vendorIter = UINT8_C(0);
+         vendorIter < sataStats->vendorSpecificStatisticsPopulated && vendorIter < MAX_VENDOR_STATISTICS; ++vendorIter)
+    {
+        write_Structured_Statistic(output, "vendorSpecificStatistics", vendorIter,
+                                   &sataStats->vendorSpecificStatistics[vendorIter], false);
+    }
+}
+
+static void write_Structured_SAS_Statistics(ptrStructuredOutput output, const sasDeviceStatitics* sasStats)
+{
+    write_Structured_Statistic_Table(output, sasStats, sasStatisticFields,
+                                     sizeof(sasStatisticFields) / sizeof(sasStatisticFields[0]));
+    if (sasStats->protocolStatisticsType == STAT_PROT_SAS)
+    {
+        for (uint16_t portIter = UINT16_C(0);
+             portIter < sasStats->sasProtStats.portCount && portIter < SAS_STATISTICS_MAX_PORTS; ++portIter)
+        {
+            const sasProtocolPortStatistics* port = &sasStats->sasProtStats.sasStatsPerPort[portIter];
+            if (!port->sasProtStatsValid)
+            {
+                continue;
+            }
+            for (uint8_t phyIter = UINT8_C(0); phyIter < port->phyCount && phyIter < SAS_STATISTICS_MAX_PHYS; ++phyIter)
+            {
+                const sasProtocolStatisticsPhy* phy = &port->perPhy[phyIter];
+                if (!phy->sasPhyStatsValid)
+                {
+                    continue;
+                }
+                // the index is the phy identifier, the port identifier is in the name
+                DECLARE_ZERO_INIT_ARRAY(char, name, STRUCTURED_OUTPUT_VALUE_LENGTH * 2);
+                snprintf_err_handle(name, STRUCTURED_OUTPUT_VALUE_LENGTH * 2, "port%" PRIu16 ".invalidDWORDCount",
+                                    port->portID);
+                write_Structured_Statistic(output, name, phy->phyID, &phy->invalidDWORDCount, false);
+                snprintf_err_handle(name, STRUCTURED_OUTPUT_VALUE_LENGTH * 2,
+                                    "port%" PRIu16 ".runningDisparityErrorCount", port->portID);
+                write_Structured_Statistic(output, name, phy->phyID, &phy->runningDisparityErrorCount, false);
+                snprintf_err_handle(name, STRUCTURED_OUTPUT_VALUE_LENGTH * 2,
+                                    "port%" PRIu16 ".lossOfDWORDSynchronizationCount", port->portID);
+                write_Structured_Statistic(output, name, phy->phyID, &phy->lossOfDWORDSynchronizationCount, false);
+                snprintf_err_handle(name, STRUCTURED_OUTPUT_VALUE_LENGTH * 2, "port%" PRIu16 ".phyResetProblemCount",
+                                    port->portID);
+                write_Structured_Statistic(output, name, phy->phyID, &phy->phyResetProblemCount, false);
+            }
+        }
+    }
+}
+
+eReturnValues write_DeviceStatistics_Structured(tDevice*            device,
+                                                ptrDeviceStatistics deviceStats,
+                                                ptrStructuredOutput output)
+{
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || deviceStats == M_NULLPTR || output == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        write_Structured_SATA_Statistics(output, &deviceStats->sataStatistics);
+    }
+    else if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        write_Structured_SAS_Statistics(output, &deviceStats->sasStatistics);
+    }
+    else
+    {
+        return NOT_SUPPORTED;
+    }
+    return SUCCESS;
+}
+
+static void write_Structured_ATA_Attributes(tDevice* device, ataSMARTLog* smartLog, ptrStructuredOutput output)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, unnamedAttribute, MAX_ATTRIBUTE_NAME_LENGTH);
+    DECLARE_ZERO_INIT_ARRAY(char, fieldName, MAX_ATTRIBUTE_NAME_LENGTH + 16);
+    const char* const* attributeNames = get_SMART_Attribute_Name_Table(is_Seagate_Family(device));
+    for (uint8_t iter = UINT8_C(0); iter < UINT8_MAX; ++iter)
+    {
+        if (!smartLog->attributes[iter].valid)
+        {
+            continue;
+        }
+        const uint8_t* raw           = smartLog->attributes[iter].data.rawData;
+        const char*    attributeName = get_SMART_Attribute_Name_From_Table(attributeNames, iter);
+        if (safe_strlen(attributeName) == SIZE_T_C(0))
+        {
+            snprintf_err_handle(unnamedAttribute, MAX_ATTRIBUTE_NAME_LENGTH, "Attribute %" PRIu8, iter);
+            attributeName = unnamedAttribute;
+        }
+        snprintf_err_handle(fieldName, MAX_ATTRIBUTE_NAME_LENGTH + 16, "%s.current", attributeName);
+        write_Structured_Record_Uint64(output, "smart", fieldName, iter, smartLog->attributes[iter].data.nominal);
+        snprintf_err_handle(fieldName, MAX_ATTRIBUTE_NAME_LENGTH + 16, "%s.worst", attributeName);
+        write_Structured_Record_Uint64(output, "smart", fieldName, iter, smartLog->attributes[iter].data.worstEver);
+        if (smartLog->attributes[iter].thresholdDataValid)
+        {
+            snprintf_err_handle(fieldName, MAX_ATTRIBUTE_NAME_LENGTH + 16, "%s.threshold", attributeName);
+            write_Structured_Record_Uint64(output, "smart", fieldName, iter,
+                                           smartLog->attributes[iter].thresholdData.thresholdValue);
+        }
+        snprintf_err_handle(fieldName, MAX_ATTRIBUTE_NAME_LENGTH + 16, "%s.raw", attributeName);
+        write_Structured_Record_Uint64(output, "smart", fieldName, iter,
+                                       M_BytesTo8ByteValue(0, 0, raw[5], raw[4], raw[3], raw[2], raw[1], raw[0]));
+    }
+}
+
+static void write_Structured_NVMe_Health(nvmeSmartLog* health, ptrStructuredOutput output)
+{
+    write_Structured_Record_Uint64(output, "smart", "criticalWarning", STRUCTURED_OUTPUT_NO_INDEX,
+                                   health->criticalWarning);
+    // Kelvin in the log
+    write_Structured_Record_Int64(
+        output, "smart", "temperature", STRUCTURED_OUTPUT_NO_INDEX,
+        C_CAST(int64_t, M_BytesTo2ByteValue(health->temperature[1], health->temperature[0])) - INT64_C(273));
+    write_Structured_Record_Uint64(output, "smart", "availSpare", STRUCTURED_OUTPUT_NO_INDEX, health->availSpare);
+    write_Structured_Record_Uint64(output, "smart", "spareThresh", STRUCTURED_OUTPUT_NO_INDEX, health->spareThresh);
+    write_Structured_Record_Uint64(output, "smart", "percentUsed", STRUCTURED_OUTPUT_NO_INDEX, health->percentUsed);
+    write_Structured_Record_Uint64(output, "smart", "enduranceGroupCriticalWarning", STRUCTURED_OUTPUT_NO_INDEX,
+                                   health->enduranceGroupCriticalWarning);
+    write_Structured_Record_Uint128(output, "smart", "dataUnitsRead", STRUCTURED_OUTPUT_NO_INDEX,
+                                    health->dataUnitsRead);
+    write_Structured_Record_Uint128(output, "smart", "dataUnitsWritten", STRUCTURED_OUTPUT_NO_INDEX,
+                                    health->dataUnitsWritten);
+    write_Structured_Record_Uint128(output, "smart", "hostReads", STRUCTURED_OUTPUT_NO_INDEX, health->hostReads);
+    write_Structured_Record_Uint128(output, "smart", "hostWrites", STRUCTURED_OUTPUT_NO_INDEX, health->hostWrites);
+    write_Structured_Record_Uint128(output, "smart", "ctrlBusyTime", STRUCTURED_OUTPUT_NO_INDEX, health->ctrlBusyTime);
+    write_Structured_Record_Uint128(output, "smart", "powerCycles", STRUCTURED_OUTPUT_NO_INDEX, health->powerCycles);
+    write_Structured_Record_Uint128(output, "smart", "powerOnHours", STRUCTURED_OUTPUT_NO_INDEX, health->powerOnHours);
+    write_Structured_Record_Uint128(output, "smart", "unsafeShutdowns", STRUCTURED_OUTPUT_NO_INDEX,
+                                    health->unsafeShutdowns);
+    write_Structured_Record_Uint128(output, "smart", "mediaErrors", STRUCTURED_OUTPUT_NO_INDEX, health->mediaErrors);
+    write_Structured_Record_Uint128(output, "smart", "numErrLogEntries", STRUCTURED_OUTPUT_NO_INDEX,
+                                    health->numErrLogEntries);
+    write_Structured_Record_Uint64(output, "smart", "warningTempTime", STRUCTURED_OUTPUT_NO_INDEX,
+                                   le32_to_host(health->warningTempTime));
+    write_Structured_Record_Uint64(output, "smart", "criticalCompTime", STRUCTURED_OUTPUT_NO_INDEX,
+                                   le32_to_host(health->criticalCompTime));
+    for (uint8_t sensorIter = UINT8_C(0); sensorIter < UINT8_C(8); ++sensorIter)
+    {
+        if (health->tempSensor[sensorIter] != 0)
+        {
+            // sensors are numbered from 1
+            write_Structured_Record_Int64(output, "smart", "tempSensor", sensorIter + 1,
+                                          C_CAST(int64_t, le16_to_host(health->tempSensor[sensorIter])) - INT64_C(273));
+        }
+    }
+    write_Structured_Record_Uint64(output, "smart", "thermalMgmtTemp1TransCount", STRUCTURED_OUTPUT_NO_INDEX,
+                                   le32_to_host(health->thermalMgmtTemp1TransCount));
+    write_Structured_Record_Uint64(output, "smart", "thermalMgmtTemp2TransCount", STRUCTURED_OUTPUT_NO_INDEX,
+                                   le32_to_host(health->thermalMgmtTemp2TransCount));
+    write_Structured_Record_Uint64(output, "smart", "totalTimeThermalMgmtTemp1", STRUCTURED_OUTPUT_NO_INDEX,
+                                   le32_to_host(health->totalTimeThermalMgmtTemp1));
+    write_Structured_Record_Uint64(output, "smart", "totalTimeThermalMgmtTemp2", STRUCTURED_OUTPUT_NO_INDEX,
+                                   le32_to_host(health->totalTimeThermalMgmtTemp2));
+}
+
+eReturnValues write_SMART_Attributes_Structured(tDevice* device, smartLogData* smartData, ptrStructuredOutput output)
+{
+    DISABLE_NONNULL_COMPARE
+    if (device == M_NULLPTR || smartData == M_NULLPTR || output == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    RESTORE_NONNULL_COMPARE
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        write_Structured_ATA_Attributes(device, &smartData->attributes.ataSMARTAttr, output);
+    }
+    else if (device->drive_info.drive_type == NVME_DRIVE)
+    {
+        write_Structured_NVMe_Health(&smartData->attributes.nvmeSMARTAttr, output);
+    }
+    else
+    {
+        return NOT_SUPPORTED;
+    }
+    return SUCCESS;
+}
@@ -23,71 +23,34 @@
 #include "string_utils.h"
 #include "type_conversion.h"
 
+#include "logs.h"
 #include "platform_helper.h"
 #include "trim_unmap.h"
 
-static bool is_ATA_Data_Set_Management_XL_Supported(tDevice* device)
+static bool is_ATA_Data_Set_Management_XL_Supported(tDevice* device, ptrATALogDirectories directories)
 {
     bool supported = false;
-    if (device->drive_info.ata_Options.generalPurposeLoggingSupported)
+    if (device->drive_info.ata_Options.generalPurposeLoggingSupported &&
+        is_ATA_Identify_Data_Log_Page_Supported(device, directories, ATA_ID_DATA_LOG_SUPPORTED_CAPABILITIES))
     {
         DECLARE_ZERO_INIT_ARRAY(uint8_t, logBuffer, LEGACY_DRIVE_SEC_SIZE);
-        if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_IDENTIFY_DEVICE_DATA, ATA_ID_DATA_LOG_SUPPORTED_PAGES,
-                                                 logBuffer, LEGACY_DRIVE_SEC_SIZE, 0))
+        if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_IDENTIFY_DEVICE_DATA,
+                                                 ATA_ID_DATA_LOG_SUPPORTED_CAPABILITIES, logBuffer,
+                                                 LEGACY_DRIVE_SEC_SIZE, 0))
         {
-            bool supportedCapabilitiesPage = false;
-            // find the supported capabilities page in the list, then read it
-            uint8_t  pageNumber = logBuffer[2];
-            uint16_t revision   = M_BytesTo2ByteValue(logBuffer[1], logBuffer[0]);
-            if (pageNumber == C_CAST(uint8_t, ATA_ID_DATA_LOG_SUPPORTED_PAGES) && revision >= ATA_ID_DATA_VERSION_1)
+            uint64_t qword0 = M_BytesTo8ByteValue(logBuffer[7], logBuffer[6], logBuffer[5], logBuffer[4], logBuffer[3],
+                                                  logBuffer[2], logBuffer[1], logBuffer[0]);
+            if (qword0 & BIT63 && M_Byte2(qword0) == ATA_ID_DATA_LOG_SUPPORTED_CAPABILITIES &&
+                M_Word0(qword0) >= ATA_ID_DATA_VERSION_1)
             {
-                // data is valid, so figure out supported pages
-                uint8_t listLen = logBuffer[ATA_ID_DATA_SUP_PG_LIST_LEN_OFFSET];
-                for (uint16_t iter = ATA_ID_DATA_SUP_PG_LIST_OFFSET;
-                     iter < C_CAST(uint16_t, listLen + ATA_ID_DATA_SUP_PG_LIST_OFFSET) && iter < LEGACY_DRIVE_SEC_SIZE;
-                     ++iter)
+                uint64_t supportedCapabilities =
+                    M_BytesTo8ByteValue(logBuffer[15], logBuffer[14], logBuffer[13], logBuffer[12], logBuffer[11],
+                                        logBuffer[10], logBuffer[9], logBuffer[8]);
+                if (supportedCapabilities & BIT63)
                 {
-                    switch (logBuffer[iter])
+                    if (supportedCapabilities & BIT50)
                     {
-                    case ATA_ID_DATA_LOG_SUPPORTED_CAPABILITIES:
-                        supportedCapabilitiesPage = true;
-                        break;
-                    case ATA_ID_DATA_LOG_SUPPORTED_PAGES:
-                    case ATA_ID_DATA_LOG_COPY_OF_IDENTIFY_DATA:
-                    case ATA_ID_DATA_LOG_CAPACITY:
-                    case ATA_ID_DATA_LOG_CURRENT_SETTINGS:
-                    case ATA_ID_DATA_LOG_ATA_STRINGS:
-                    case ATA_ID_DATA_LOG_SECURITY:
-                    case ATA_ID_DATA_LOG_PARALLEL_ATA:
-                    case ATA_ID_DATA_LOG_SERIAL_ATA:
-                    case ATA_ID_DATA_LOG_ZONED_DEVICE_INFORMATION:
-                    default:
-                        break;
-                    }
-                }
-            }
-            if (supportedCapabilitiesPage)
-            {
-                safe_memset(logBuffer, LEGACY_DRIVE_SEC_SIZE, 0, LEGACY_DRIVE_SEC_SIZE);
-                if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, ATA_LOG_IDENTIFY_DEVICE_DATA,
-                                                         ATA_ID_DATA_LOG_SUPPORTED_CAPABILITIES, logBuffer,
-                                                         LEGACY_DRIVE_SEC_SIZE, 0))
-                {
-                    uint64_t qword0 = M_BytesTo8ByteValue(logBuffer[7], logBuffer[6], logBuffer[5], logBuffer[4],
-                                                          logBuffer[3], logBuffer[2], logBuffer[1], logBuffer[0]);
-                    if (qword0 & BIT63 && M_Byte2(qword0) == ATA_ID_DATA_LOG_SUPPORTED_CAPABILITIES &&
-                        M_Word0(qword0) >= ATA_ID_DATA_VERSION_1)
-                    {
-                        uint64_t supportedCapabilities =
-                            M_BytesTo8ByteValue(logBuffer[15], logBuffer[14], logBuffer[13], logBuffer[12],
-                                                logBuffer[11], logBuffer[10], logBuffer[9], logBuffer[8]);
-                        if (supportedCapabilities & BIT63)
-                        {
-                            if (supportedCapabilities & BIT50)
-                            {
-                                supported = true;
-                            }
-                        }
+                        supported = true;
                     }
                 }
             }
@@ -220,13 +183,13 @@ bool is_Trim_Or_Unmap_Supported(tDevice* device, uint32_t* maxTrimOrUnmapBlockDe
     return supported;
 }
 
-eReturnValues trim_Unmap_Range(tDevice* device, uint64_t startLBA, uint64_t range)
+eReturnValues trim_Unmap_Range(tDevice* device, ptrATALogDirectories directories, uint64_t startLBA, uint64_t range)
 {
     eReturnValues ret = UNKNOWN;
     switch (device->drive_info.drive_type)
     {
     case ATA_DRIVE:
-        ret = ata_Trim_Range(device, startLBA, range);
+        ret = ata_Trim_Range(device, directories, startLBA, range);
         break;
     case NVME_DRIVE:
         ret = nvme_Deallocate_Range(device, startLBA, range);
@@ -302,14 +265,14 @@ eReturnValues nvme_Deallocate_Range(tDevice* device, uint64_t startLBA, uint64_t
     return ret;
 }
 
-eReturnValues ata_Trim_Range(tDevice* device, uint64_t startLBA, uint64_t range)
+eReturnValues ata_Trim_Range(tDevice* device, ptrATALogDirectories directories, uint64_t startLBA, uint64_t range)
 {
     eReturnValues ret                            = UNKNOWN;
     uint32_t      maxTrimOrUnmapBlockDescriptors = UINT32_C(0);
     uint32_t      maxLBACount                    = UINT32_C(0);
     if (is_Trim_Or_Unmap_Supported(device, &maxTrimOrUnmapBlockDescriptors, &maxLBACount))
     {
-        bool     xlCommand          = is_ATA_Data_Set_Management_XL_Supported(device);
+        bool     xlCommand          = is_ATA_Data_Set_Management_XL_Supported(device, directories);
         uint64_t maxRange           = xlCommand ? UINT64_MAX : UINT16_MAX;     // xl = uint64_max, regular = uint16_max
         uint16_t maxEntriesPerPage  = xlCommand ? UINT16_C(32) : UINT16_C(64); // regular cmd = 64, regular = 32
         uint8_t  entryLengthBytes   = xlCommand ? UINT8_C(16) : UINT8_C(8);